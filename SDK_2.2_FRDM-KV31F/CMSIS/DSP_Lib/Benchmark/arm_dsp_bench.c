@@ -0,0 +1,1509 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_dsp_bench.c
+*
+* Description:  Accuracy and throughput benchmark of the DSP library.
+*
+* Target Processor: Cortex-M4 with FPU, or x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+* For each function family (BasicMath, Filtering, Matrix, Transform,
+* Statistics and Support) the benchmark runs the float32_t, q31_t, q15_t and
+* q7_t versions the library provides on a fixed pseudo random signal and
+* compares the outputs with a double precision reference computed from the
+* same quantized inputs.  It reports the signal to noise ratio in dB, the
+* largest error in units in the last place (float32_t outputs) or in output
+* LSBs (fixed-point outputs), and fails the functions whose SNR drops below
+* their limit.  It then times each function on blocks of 16, 64, 256 and
+* 1024 samples; the matrix functions use square matrices of the same number
+* of elements and the transforms FFTs of that length.
+*
+* Host: the CMakeLists.txt in CMSIS/DSP_Lib builds arm_dsp_bench and
+* registers the accuracy run with CTest.
+*
+*   arm_dsp_bench [-a] [-t] [-f text]
+*
+*   -a       accuracy only; the exit status is the number of failures
+*   -t       throughput only, in millions of samples per second
+*   -f text  only the functions whose family or name contains text
+*
+* ARM_HOST_SIMD=generic|sse2|avx2|neon selects the kernel set under test.
+*
+* Target: build this file with -DARM_DSP_BENCH_TARGET into a FRDM-KV31F
+* project, for example one made from boards/frdmkv31f/demo_apps/hello_world,
+* and link CMSIS/Lib/GCC/libarm_cortexM4lf_math.a.  The results are printed
+* on the debug console UART; the throughput is in core clock cycles per
+* sample counted by the DWT cycle counter, and the blocks stop at 256 samples
+* to fit the RAM.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#if defined(ARM_DSP_BENCH_TARGET)
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#define BENCH_PRINTF            PRINTF
+#define BENCH_MAX_BLOCK         256u
+#else
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#ifdef ARM_HOST_SIMD_BUILD
+#include "arm_math_host.h"
+#endif
+#define BENCH_PRINTF            printf
+#define BENCH_MAX_BLOCK         1024u
+#endif
+
+#define BENCH_ACC_BLOCK         256u    /* block size of the accuracy run */
+#define BENCH_TAPS              32u     /* FIR filter and convolution kernel length */
+#define BENCH_STAGES            2u      /* biquad stages */
+#define BENCH_CHANNELS          3u      /* interleaved channels of the multi-channel filters */
+#define BENCH_NUM_SIZES         4u      /* block sizes of the throughput run */
+
+static const uint32_t benchSizes[BENCH_NUM_SIZES] = { 16u, 64u, 256u, 1024u };
+
+/**
+ * @brief Storage types of the inputs and outputs.
+ */
+typedef enum
+{
+  BENCH_F32,
+  BENCH_Q31,
+  BENCH_Q15,
+  BENCH_Q7,
+  BENCH_Q63
+} bench_type;
+
+static const char *const benchTypeName[] = { "f32", "q31", "q15", "q7", "q63" };
+
+/**
+ * @brief One function under test.
+ */
+typedef struct
+{
+  const char *pFamily;                              /* function family */
+  const char *pName;                                /* function name */
+  bench_type type;                                  /* data type of the function */
+  bench_type outType;                               /* storage type of the outputs */
+  double outScale;                                  /* output format relative to outType, 1.0 for 1.31, 1.15 and 1.7 */
+  int (*pInit)(uint32_t blockSize);                 /* prepares an instance, nonzero if the size is not supported; may be NULL */
+  void (*pRun)(uint32_t blockSize);                 /* runs the function on the inputs */
+  uint32_t (*pRef)(uint32_t blockSize, double *pRef); /* double precision reference, returns the number of outputs */
+  double minSnr;                                    /* accuracy limit (dB) */
+} bench_case;
+
+/*
+* Inputs, outputs and work areas of each type.  The A and B inputs hold
+* 2*BENCH_MAX_BLOCK values so that they also serve as complex FFT inputs.
+*/
+static float32_t fA[2u * BENCH_MAX_BLOCK], fB[2u * BENCH_MAX_BLOCK];
+static float32_t fD[2u * BENCH_MAX_BLOCK + BENCH_TAPS], fS[2u * BENCH_MAX_BLOCK + BENCH_TAPS];
+static float32_t fH[BENCH_TAPS], fBq[5u * BENCH_STAGES], fMA[BENCH_MAX_BLOCK], fMB[BENCH_MAX_BLOCK];
+static q31_t iA31[2u * BENCH_MAX_BLOCK], iB31[2u * BENCH_MAX_BLOCK];
+static q31_t iD31[2u * BENCH_MAX_BLOCK + BENCH_TAPS], iS31[2u * BENCH_MAX_BLOCK + BENCH_TAPS];
+static q31_t iH31[BENCH_TAPS], iBq31[5u * BENCH_STAGES], iMA31[BENCH_MAX_BLOCK], iMB31[BENCH_MAX_BLOCK];
+static q15_t iA15[2u * BENCH_MAX_BLOCK], iB15[2u * BENCH_MAX_BLOCK];
+static q15_t iD15[2u * BENCH_MAX_BLOCK + BENCH_TAPS], iS15[2u * BENCH_MAX_BLOCK + BENCH_TAPS];
+static q15_t iH15[BENCH_TAPS], iBq15[6u * BENCH_STAGES], iMA15[BENCH_MAX_BLOCK], iMB15[BENCH_MAX_BLOCK];
+static q7_t iA7[2u * BENCH_MAX_BLOCK], iB7[2u * BENCH_MAX_BLOCK];
+static q7_t iD7[2u * BENCH_MAX_BLOCK + BENCH_TAPS], iS7[2u * BENCH_MAX_BLOCK + BENCH_TAPS];
+static q7_t iH7[BENCH_TAPS];
+static q63_t lD63[1], lS63[4u * BENCH_STAGES];
+static uint32_t uIndex;                             /* index output of max and min */
+
+/* References, measured outputs and DFT twiddle factors */
+static double dRef[2u * BENCH_MAX_BLOCK + BENCH_TAPS], dOut[2u * BENCH_MAX_BLOCK + BENCH_TAPS];
+static double dTwiddle[2u * BENCH_MAX_BLOCK];
+
+/* One de-interleaved channel of the multi-channel filter references */
+static float32_t fC[BENCH_MAX_BLOCK];
+static q31_t iC31[BENCH_MAX_BLOCK];
+static double dChan[BENCH_MAX_BLOCK];
+
+/* Biquad prototype: b0, b1, b2, a1, a2 per stage with the sign convention of the library */
+static const double benchBiquad[5u * BENCH_STAGES] =
+{
+  0.20, 0.30, 0.20, 0.50, -0.25,
+  0.25, -0.10, 0.25, -0.30, -0.20
+};
+
+/* Instances */
+static arm_fir_instance_f32 firF32;
+static arm_fir_instance_q31 firQ31;
+static arm_fir_instance_q15 firQ15;
+static arm_fir_instance_q7 firQ7;
+static arm_biquad_casd_df1_inst_f32 df1F32;
+static arm_biquad_cascade_df2T_instance_f32 df2TF32;
+static arm_biquad_casd_df1_inst_q31 df1Q31;
+static arm_biquad_casd_df1_inst_q15 df1Q15;
+static arm_biquad_cas_df1_32x64_ins_q31 df1x64Q31;
+static arm_fir_multi_instance_f32 firMultiF32;
+static arm_fir_multi_instance_q31 firMultiQ31;
+static arm_biquad_cascade_multi_df1_instance_f32 df1MultiF32;
+static arm_biquad_cascade_multi_df2T_instance_f32 df2TMultiF32;
+static arm_biquad_cascade_multi_df1_instance_q31 df1MultiQ31;
+static arm_matrix_instance_f32 matAF32, matBF32, matDF32;
+static arm_matrix_instance_q31 matAQ31, matBQ31, matDQ31;
+static arm_matrix_instance_q15 matAQ15, matBQ15, matDQ15;
+static const arm_cfft_instance_f32 *pCfftF32;
+static const arm_cfft_instance_q31 *pCfftQ31;
+static const arm_cfft_instance_q15 *pCfftQ15;
+static arm_rfft_fast_instance_f32 rfftF32;
+static arm_rfft_instance_q31 rfftQ31;
+static arm_rfft_instance_q15 rfftQ15;
+static uint32_t matDim;                             /* matrix dimension of the block size */
+
+/*******************************************************************************
+ * Inputs and conversions
+ ******************************************************************************/
+
+/**
+ * @brief Value of element i of an array of the given type, 1.31, 1.15 and 1.7 for the fixed-point types.
+ */
+static double bench_value(
+  bench_type type,
+  const void *pData,
+  uint32_t i)
+{
+  switch (type)
+  {
+  case BENCH_F32:
+    return ((double) ((const float32_t *) pData)[i]);
+  case BENCH_Q31:
+    return ((double) ((const q31_t *) pData)[i] / 2147483648.0);
+  case BENCH_Q15:
+    return ((double) ((const q15_t *) pData)[i] / 32768.0);
+  case BENCH_Q7:
+    return ((double) ((const q7_t *) pData)[i] / 128.0);
+  default:
+    return ((double) ((const q63_t *) pData)[i]);
+  }
+}
+
+/**
+ * @brief Rounds x to a fixed-point value with frac fractional bits, saturated to 1.frac.
+ */
+static int32_t bench_quantize(
+  double x,
+  uint32_t frac)
+{
+  double scaled = floor(x * (double) (1uL << frac) + 0.5);
+  double lim = (double) (1uL << frac);
+
+  if (scaled >= lim)
+  {
+    scaled = lim - 1.0;
+  }
+  else if (scaled < -lim)
+  {
+    scaled = -lim;
+  }
+
+  return ((int32_t) scaled);
+}
+
+/**
+ * @brief Stores x as element i of every type.
+ */
+static void bench_store(
+  double x,
+  uint32_t i,
+  float32_t *pF32,
+  q31_t *pQ31,
+  q15_t *pQ15,
+  q7_t *pQ7)
+{
+  pF32[i] = (float32_t) x;
+  if (pQ31 != NULL)
+  {
+    pQ31[i] = (x >= 1.0) ? 0x7FFFFFFF : (q31_t) floor(x * 2147483648.0 + 0.5);
+  }
+  if (pQ15 != NULL)
+  {
+    pQ15[i] = (q15_t) bench_quantize(x, 15u);
+  }
+  if (pQ7 != NULL)
+  {
+    pQ7[i] = (q7_t) bench_quantize(x, 7u);
+  }
+}
+
+/**
+ * @brief Fills the inputs: a sum of sines and noise in A, noise in B, both within +-0.5.
+ */
+static void bench_inputs(
+  void)
+{
+  uint32_t seed = 12345u;                           /* linear congruential generator */
+  uint32_t i, k;                                    /* counters */
+  double noise, x, sum;                             /* samples */
+
+  for (i = 0u; i < 2u * BENCH_MAX_BLOCK; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    noise = ((double) (seed >> 8) / 16777216.0) - 0.5;
+    x = 0.25 * sin(0.05 * (double) i) + 0.15 * sin(0.71 * (double) i + 1.0) + 0.2 * noise;
+    bench_store(x, i, fA, iA31, iA15, iA7);
+
+    seed = seed * 1664525u + 1013904223u;
+    noise = ((double) (seed >> 8) / 16777216.0) - 0.5;
+    bench_store(0.99 * noise, i, fB, iB31, iB15, iB7);
+  }
+
+  /* Hann windowed sinc lowpass, cut off at a quarter of the sampling rate */
+  sum = 0.0;
+  for (k = 0u; k < BENCH_TAPS; k++)
+  {
+    x = (double) k - 0.5 * (double) (BENCH_TAPS - 1u);
+    dRef[k] = ((x == 0.0) ? 1.0 : sin(0.5 * PI * x) / (0.5 * PI * x)) *
+              (0.5 - 0.5 * cos(2.0 * PI * ((double) k + 0.5) / (double) BENCH_TAPS));
+    sum += dRef[k];
+  }
+  for (k = 0u; k < BENCH_TAPS; k++)
+  {
+    bench_store(0.9 * dRef[k] / sum, k, fH, iH31, iH15, iH7);
+  }
+
+  /* Biquad coefficients, q15_t stages hold {b0, 0, b1, b2, a1, a2} */
+  for (k = 0u; k < BENCH_STAGES; k++)
+  {
+    for (i = 0u; i < 5u; i++)
+    {
+      bench_store(benchBiquad[5u * k + i], 5u * k + i, fBq, iBq31, NULL, NULL);
+      iBq15[6u * k + i + ((i == 0u) ? 0u : 1u)] = (q15_t) bench_quantize(benchBiquad[5u * k + i], 15u);
+    }
+    iBq15[6u * k + 1u] = 0;
+  }
+
+  /* Matrix inputs, scaled by 1/4 so that the fixed-point products do not saturate */
+  for (i = 0u; i < BENCH_MAX_BLOCK; i++)
+  {
+    bench_store(0.25 * bench_value(BENCH_F32, fA, i), i, fMA, iMA31, iMA15, NULL);
+    bench_store(0.25 * bench_value(BENCH_F32, fB, i), i, fMB, iMB31, iMB15, NULL);
+  }
+}
+
+/*******************************************************************************
+ * Double precision references
+ ******************************************************************************/
+
+/**
+ * @brief FIR filter with the time reversed coefficients of the library, from a zero state.
+ */
+static uint32_t bench_ref_fir(
+  bench_type type,
+  const void *pX,
+  const void *pH,
+  uint32_t n,
+  double *pRef)
+{
+  uint32_t i, k;                                    /* counters */
+  int32_t j;                                        /* input index */
+  double acc;                                       /* accumulator */
+
+  for (i = 0u; i < n; i++)
+  {
+    acc = 0.0;
+    for (k = 0u; k < BENCH_TAPS; k++)
+    {
+      j = (int32_t) i - (int32_t) (BENCH_TAPS - 1u) + (int32_t) k;
+      if (j >= 0)
+      {
+        acc += bench_value(type, pH, k) * bench_value(type, pX, (uint32_t) j);
+      }
+    }
+    pRef[i] = acc;
+  }
+
+  return (n);
+}
+
+/**
+ * @brief Biquad cascade with the quantized coefficients, from a zero state.
+ */
+static uint32_t bench_ref_biquad(
+  bench_type type,
+  const void *pX,
+  uint32_t n,
+  double *pRef)
+{
+  double c[5u * BENCH_STAGES];                      /* quantized coefficients */
+  double x1, x2, y1, y2, x, y;                      /* state */
+  uint32_t i, s;                                    /* counters */
+
+  for (i = 0u; i < 5u * BENCH_STAGES; i++)
+  {
+    c[i] = (type == BENCH_F32) ? bench_value(BENCH_F32, fBq, i) :
+           (type == BENCH_Q31) ? bench_value(BENCH_Q31, iBq31, i) :
+           bench_value(BENCH_Q15, iBq15, i + (i / 5u) + ((i % 5u) == 0u ? 0u : 1u));
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    pRef[i] = bench_value(type, pX, i);
+  }
+  for (s = 0u; s < BENCH_STAGES; s++)
+  {
+    x1 = x2 = y1 = y2 = 0.0;
+    for (i = 0u; i < n; i++)
+    {
+      x = pRef[i];
+      y = c[5u * s] * x + c[5u * s + 1u] * x1 + c[5u * s + 2u] * x2 + c[5u * s + 3u] * y1 + c[5u * s + 4u] * y2;
+      x2 = x1;
+      x1 = x;
+      y2 = y1;
+      y1 = y;
+      pRef[i] = y;
+    }
+  }
+
+  return (n);
+}
+
+/**
+ * @brief FIR filter or biquad cascade of each of the BENCH_CHANNELS channels interleaved in the A input.
+ */
+static uint32_t bench_ref_multi(
+  bench_type type,
+  int fir,
+  uint32_t n,
+  double *pRef)
+{
+  uint32_t frames = n / BENCH_CHANNELS, ch, i;      /* frames and counters */
+  const void *pX = (type == BENCH_F32) ? (const void *) fC : (const void *) iC31;  /* one channel */
+
+  for (ch = 0u; ch < BENCH_CHANNELS; ch++)
+  {
+    for (i = 0u; i < frames; i++)
+    {
+      fC[i] = fA[i * BENCH_CHANNELS + ch];
+      iC31[i] = iA31[i * BENCH_CHANNELS + ch];
+    }
+    if (fir)
+    {
+      (void) bench_ref_fir(type, pX, (type == BENCH_F32) ? (const void *) fH : (const void *) iH31, frames, dChan);
+    }
+    else
+    {
+      (void) bench_ref_biquad(type, pX, frames, dChan);
+    }
+    for (i = 0u; i < frames; i++)
+    {
+      pRef[i * BENCH_CHANNELS + ch] = dChan[i];
+    }
+  }
+
+  return (frames * BENCH_CHANNELS);
+}
+
+/**
+ * @brief Convolution of n input samples with the FIR coefficients.
+ */
+static uint32_t bench_ref_conv(
+  bench_type type,
+  const void *pX,
+  const void *pH,
+  uint32_t n,
+  double *pRef)
+{
+  uint32_t i, k;                                    /* counters */
+
+  for (i = 0u; i < n + BENCH_TAPS - 1u; i++)
+  {
+    pRef[i] = 0.0;
+    for (k = 0u; k < BENCH_TAPS; k++)
+    {
+      if ((i >= k) && ((i - k) < n))
+      {
+        pRef[i] += bench_value(type, pH, k) * bench_value(type, pX, i - k);
+      }
+    }
+  }
+
+  return (n + BENCH_TAPS - 1u);
+}
+
+/**
+ * @brief Product of two d x d matrices.
+ */
+static uint32_t bench_ref_mat_mult(
+  bench_type type,
+  const void *pA,
+  const void *pB,
+  uint32_t d,
+  double *pRef)
+{
+  uint32_t i, j, k;                                 /* counters */
+
+  for (i = 0u; i < d; i++)
+  {
+    for (j = 0u; j < d; j++)
+    {
+      pRef[i * d + j] = 0.0;
+      for (k = 0u; k < d; k++)
+      {
+        pRef[i * d + j] += bench_value(type, pA, i * d + k) * bench_value(type, pB, k * d + j);
+      }
+    }
+  }
+
+  return (d * d);
+}
+
+/**
+ * @brief DFT of n points, complex or real input, multiplied by scale.  The
+ *        real form returns the packed spectrum of arm_rfft_fast_f32 when
+ *        packed is set, and bins 0 to n/2 otherwise.
+ */
+static uint32_t bench_ref_dft(
+  bench_type type,
+  const void *pX,
+  uint32_t n,
+  int isComplex,
+  int packed,
+  double scale,
+  double *pRef)
+{
+  uint32_t i, k, idx, nBins;                        /* counters */
+  double sr, si, xr, xi;                            /* accumulators and input */
+
+  for (i = 0u; i < n; i++)
+  {
+    dTwiddle[2u * i] = cos(2.0 * PI * (double) i / (double) n);
+    dTwiddle[2u * i + 1u] = -sin(2.0 * PI * (double) i / (double) n);
+  }
+
+  nBins = isComplex ? n : (n / 2u + 1u);
+  for (k = 0u; k < nBins; k++)
+  {
+    sr = 0.0;
+    si = 0.0;
+    for (i = 0u; i < n; i++)
+    {
+      idx = (uint32_t) (((uint64_t) i * k) % n);
+      xr = bench_value(type, pX, isComplex ? 2u * i : i);
+      xi = isComplex ? bench_value(type, pX, 2u * i + 1u) : 0.0;
+      sr += xr * dTwiddle[2u * idx] - xi * dTwiddle[2u * idx + 1u];
+      si += xr * dTwiddle[2u * idx + 1u] + xi * dTwiddle[2u * idx];
+    }
+
+    if (packed && (k == n / 2u))
+    {
+      pRef[1] = sr * scale;
+    }
+    else
+    {
+      pRef[2u * k] = sr * scale;
+      pRef[2u * k + 1u] = si * scale;
+    }
+  }
+
+  return (packed ? n : 2u * nBins);
+}
+
+/**
+ * @brief Mean, variance (normalised by n - 1), power and extrema of n samples.
+ */
+static void bench_ref_stats(
+  bench_type type,
+  const void *pX,
+  uint32_t n,
+  double *pMean,
+  double *pVar,
+  double *pPower,
+  double *pMax,
+  double *pMin)
+{
+  uint32_t i;                                       /* counter */
+  double x, sum = 0.0, power = 0.0, var = 0.0;      /* accumulators */
+
+  *pMax = bench_value(type, pX, 0u);
+  *pMin = *pMax;
+  for (i = 0u; i < n; i++)
+  {
+    x = bench_value(type, pX, i);
+    sum += x;
+    power += x * x;
+    *pMax = (x > *pMax) ? x : *pMax;
+    *pMin = (x < *pMin) ? x : *pMin;
+  }
+  *pMean = sum / (double) n;
+  for (i = 0u; i < n; i++)
+  {
+    x = bench_value(type, pX, i) - *pMean;
+    var += x * x;
+  }
+  *pVar = var / (double) (n - 1u);
+  *pPower = power;
+}
+
+/*******************************************************************************
+ * Functions under test
+ ******************************************************************************/
+
+/* Element by element functions of the A and B inputs */
+#define BENCH_ELEMENTWISE(id, T, pA, pB, call, expr)                           \
+static void run_##id(uint32_t n)                                               \
+{                                                                              \
+  call;                                                                        \
+}                                                                              \
+static uint32_t ref_##id(uint32_t n, double *pRef)                             \
+{                                                                              \
+  uint32_t i;                                                                  \
+  double a, b;                                                                 \
+  for (i = 0u; i < n; i++)                                                     \
+  {                                                                            \
+    a = bench_value(T, pA, i);                                                 \
+    b = bench_value(T, pB, i);                                                 \
+    (void) b;                                                                  \
+    pRef[i] = (expr);                                                          \
+  }                                                                            \
+  return (n);                                                                  \
+}
+
+BENCH_ELEMENTWISE(add_f32, BENCH_F32, fA, fB, arm_add_f32(fA, fB, fD, n), a + b)
+BENCH_ELEMENTWISE(add_q31, BENCH_Q31, iA31, iB31, arm_add_q31(iA31, iB31, iD31, n), a + b)
+BENCH_ELEMENTWISE(add_q15, BENCH_Q15, iA15, iB15, arm_add_q15(iA15, iB15, iD15, n), a + b)
+BENCH_ELEMENTWISE(add_q7, BENCH_Q7, iA7, iB7, arm_add_q7(iA7, iB7, iD7, n), a + b)
+BENCH_ELEMENTWISE(sub_f32, BENCH_F32, fA, fB, arm_sub_f32(fA, fB, fD, n), a - b)
+BENCH_ELEMENTWISE(sub_q31, BENCH_Q31, iA31, iB31, arm_sub_q31(iA31, iB31, iD31, n), a - b)
+BENCH_ELEMENTWISE(sub_q15, BENCH_Q15, iA15, iB15, arm_sub_q15(iA15, iB15, iD15, n), a - b)
+BENCH_ELEMENTWISE(sub_q7, BENCH_Q7, iA7, iB7, arm_sub_q7(iA7, iB7, iD7, n), a - b)
+BENCH_ELEMENTWISE(mult_f32, BENCH_F32, fA, fB, arm_mult_f32(fA, fB, fD, n), a * b)
+BENCH_ELEMENTWISE(mult_q31, BENCH_Q31, iA31, iB31, arm_mult_q31(iA31, iB31, iD31, n), a * b)
+BENCH_ELEMENTWISE(mult_q15, BENCH_Q15, iA15, iB15, arm_mult_q15(iA15, iB15, iD15, n), a * b)
+BENCH_ELEMENTWISE(mult_q7, BENCH_Q7, iA7, iB7, arm_mult_q7(iA7, iB7, iD7, n), a * b)
+BENCH_ELEMENTWISE(scale_f32, BENCH_F32, fA, fB, arm_scale_f32(fA, 0.75f, fD, n), a * 0.75)
+BENCH_ELEMENTWISE(scale_q31, BENCH_Q31, iA31, iB31, arm_scale_q31(iA31, 0x60000000, 0, iD31, n), a * 0.75)
+BENCH_ELEMENTWISE(scale_q15, BENCH_Q15, iA15, iB15, arm_scale_q15(iA15, 0x6000, 0, iD15, n), a * 0.75)
+BENCH_ELEMENTWISE(scale_q7, BENCH_Q7, iA7, iB7, arm_scale_q7(iA7, 0x60, 0, iD7, n), a * 0.75)
+BENCH_ELEMENTWISE(abs_f32, BENCH_F32, fA, fB, arm_abs_f32(fA, fD, n), fabs(a))
+BENCH_ELEMENTWISE(abs_q31, BENCH_Q31, iA31, iB31, arm_abs_q31(iA31, iD31, n), fabs(a))
+BENCH_ELEMENTWISE(abs_q15, BENCH_Q15, iA15, iB15, arm_abs_q15(iA15, iD15, n), fabs(a))
+BENCH_ELEMENTWISE(abs_q7, BENCH_Q7, iA7, iB7, arm_abs_q7(iA7, iD7, n), fabs(a))
+BENCH_ELEMENTWISE(negate_f32, BENCH_F32, fA, fB, arm_negate_f32(fA, fD, n), -a)
+BENCH_ELEMENTWISE(negate_q31, BENCH_Q31, iA31, iB31, arm_negate_q31(iA31, iD31, n), -a)
+BENCH_ELEMENTWISE(negate_q15, BENCH_Q15, iA15, iB15, arm_negate_q15(iA15, iD15, n), -a)
+BENCH_ELEMENTWISE(negate_q7, BENCH_Q7, iA7, iB7, arm_negate_q7(iA7, iD7, n), -a)
+BENCH_ELEMENTWISE(float_to_q31, BENCH_F32, fA, fB, arm_float_to_q31(fA, iD31, n), a)
+BENCH_ELEMENTWISE(float_to_q15, BENCH_F32, fA, fB, arm_float_to_q15(fA, iD15, n), a)
+BENCH_ELEMENTWISE(float_to_q7, BENCH_F32, fA, fB, arm_float_to_q7(fA, iD7, n), a)
+BENCH_ELEMENTWISE(q31_to_float, BENCH_Q31, iA31, iB31, arm_q31_to_float(iA31, fD, n), a)
+BENCH_ELEMENTWISE(q15_to_float, BENCH_Q15, iA15, iB15, arm_q15_to_float(iA15, fD, n), a)
+BENCH_ELEMENTWISE(q7_to_float, BENCH_Q7, iA7, iB7, arm_q7_to_float(iA7, fD, n), a)
+BENCH_ELEMENTWISE(q31_to_q15, BENCH_Q31, iA31, iB31, arm_q31_to_q15(iA31, iD15, n), a)
+BENCH_ELEMENTWISE(q15_to_q31, BENCH_Q15, iA15, iB15, arm_q15_to_q31(iA15, iD31, n), a)
+BENCH_ELEMENTWISE(q15_to_q7, BENCH_Q15, iA15, iB15, arm_q15_to_q7(iA15, iD7, n), a)
+BENCH_ELEMENTWISE(q7_to_q31, BENCH_Q7, iA7, iB7, arm_q7_to_q31(iA7, iD31, n), a)
+BENCH_ELEMENTWISE(copy_f32, BENCH_F32, fA, fB, arm_copy_f32(fA, fD, n), a)
+BENCH_ELEMENTWISE(copy_q7, BENCH_Q7, iA7, iB7, arm_copy_q7(iA7, iD7, n), a)
+
+/* Dot products, one output */
+#define BENCH_DOT(id, T, pA, pB, call)                                         \
+static void run_##id(uint32_t n)                                               \
+{                                                                              \
+  call;                                                                        \
+}                                                                              \
+static uint32_t ref_##id(uint32_t n, double *pRef)                             \
+{                                                                              \
+  uint32_t i;                                                                  \
+  pRef[0] = 0.0;                                                               \
+  for (i = 0u; i < n; i++)                                                     \
+  {                                                                            \
+    pRef[0] += bench_value(T, pA, i) * bench_value(T, pB, i);                  \
+  }                                                                            \
+  return (1u);                                                                 \
+}
+
+BENCH_DOT(dot_prod_f32, BENCH_F32, fA, fB, arm_dot_prod_f32(fA, fB, n, &fD[0]))
+BENCH_DOT(dot_prod_q31, BENCH_Q31, iA31, iB31, arm_dot_prod_q31(iA31, iB31, n, &lD63[0]))
+BENCH_DOT(dot_prod_q15, BENCH_Q15, iA15, iB15, arm_dot_prod_q15(iA15, iB15, n, &lD63[0]))
+BENCH_DOT(dot_prod_q7, BENCH_Q7, iA7, iB7, arm_dot_prod_q7(iA7, iB7, n, &iD31[0]))
+
+/* FIR filters */
+static int init_fir_f32(uint32_t n)
+{
+  arm_fir_init_f32(&firF32, BENCH_TAPS, fH, fS, n);
+  return (0);
+}
+static int init_fir_q31(uint32_t n)
+{
+  arm_fir_init_q31(&firQ31, BENCH_TAPS, iH31, iS31, n);
+  return (0);
+}
+static int init_fir_q15(uint32_t n)
+{
+  return ((arm_fir_init_q15(&firQ15, BENCH_TAPS, iH15, iS15, n) == ARM_MATH_SUCCESS) ? 0 : 1);
+}
+static int init_fir_q7(uint32_t n)
+{
+  arm_fir_init_q7(&firQ7, BENCH_TAPS, iH7, iS7, n);
+  return (0);
+}
+static void run_fir_f32(uint32_t n) { arm_fir_f32(&firF32, fA, fD, n); }
+static void run_fir_q31(uint32_t n) { arm_fir_q31(&firQ31, iA31, iD31, n); }
+static void run_fir_fast_q31(uint32_t n) { arm_fir_fast_q31(&firQ31, iA31, iD31, n); }
+static void run_fir_q15(uint32_t n) { arm_fir_q15(&firQ15, iA15, iD15, n); }
+static void run_fir_fast_q15(uint32_t n) { arm_fir_fast_q15(&firQ15, iA15, iD15, n); }
+static void run_fir_q7(uint32_t n) { arm_fir_q7(&firQ7, iA7, iD7, n); }
+static uint32_t ref_fir_f32(uint32_t n, double *pRef) { return (bench_ref_fir(BENCH_F32, fA, fH, n, pRef)); }
+static uint32_t ref_fir_q31(uint32_t n, double *pRef) { return (bench_ref_fir(BENCH_Q31, iA31, iH31, n, pRef)); }
+static uint32_t ref_fir_q15(uint32_t n, double *pRef) { return (bench_ref_fir(BENCH_Q15, iA15, iH15, n, pRef)); }
+static uint32_t ref_fir_q7(uint32_t n, double *pRef) { return (bench_ref_fir(BENCH_Q7, iA7, iH7, n, pRef)); }
+
+/* Biquad cascades */
+static int init_df1_f32(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cascade_df1_init_f32(&df1F32, BENCH_STAGES, fBq, fS);
+  return (0);
+}
+static int init_df2T_f32(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cascade_df2T_init_f32(&df2TF32, BENCH_STAGES, fBq, fS);
+  return (0);
+}
+static int init_df1_q31(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cascade_df1_init_q31(&df1Q31, BENCH_STAGES, iBq31, iS31, 0);
+  return (0);
+}
+static int init_df1_32x64_q31(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cas_df1_32x64_init_q31(&df1x64Q31, BENCH_STAGES, iBq31, lS63, 0u);
+  return (0);
+}
+static int init_df1_q15(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cascade_df1_init_q15(&df1Q15, BENCH_STAGES, iBq15, iS15, 0);
+  return (0);
+}
+static void run_df1_f32(uint32_t n) { arm_biquad_cascade_df1_f32(&df1F32, fA, fD, n); }
+static void run_df2T_f32(uint32_t n) { arm_biquad_cascade_df2T_f32(&df2TF32, fA, fD, n); }
+static void run_df1_q31(uint32_t n) { arm_biquad_cascade_df1_q31(&df1Q31, iA31, iD31, n); }
+static void run_df1_fast_q31(uint32_t n) { arm_biquad_cascade_df1_fast_q31(&df1Q31, iA31, iD31, n); }
+static void run_df1_32x64_q31(uint32_t n) { arm_biquad_cas_df1_32x64_q31(&df1x64Q31, iA31, iD31, n); }
+static void run_df1_q15(uint32_t n) { arm_biquad_cascade_df1_q15(&df1Q15, iA15, iD15, n); }
+static void run_df1_fast_q15(uint32_t n) { arm_biquad_cascade_df1_fast_q15(&df1Q15, iA15, iD15, n); }
+static uint32_t ref_biquad_f32(uint32_t n, double *pRef) { return (bench_ref_biquad(BENCH_F32, fA, n, pRef)); }
+static uint32_t ref_biquad_q31(uint32_t n, double *pRef) { return (bench_ref_biquad(BENCH_Q31, iA31, n, pRef)); }
+static uint32_t ref_biquad_q15(uint32_t n, double *pRef) { return (bench_ref_biquad(BENCH_Q15, iA15, n, pRef)); }
+
+/* Multi-channel filters: a block of n samples is n / BENCH_CHANNELS interleaved frames */
+static int init_fir_multi_f32(uint32_t n)
+{
+  arm_fir_multi_init_f32(&firMultiF32, BENCH_TAPS, BENCH_CHANNELS, fH, fS, n / BENCH_CHANNELS);
+  return (0);
+}
+static int init_fir_multi_q31(uint32_t n)
+{
+  arm_fir_multi_init_q31(&firMultiQ31, BENCH_TAPS, BENCH_CHANNELS, iH31, iS31, n / BENCH_CHANNELS);
+  return (0);
+}
+static int init_df1_multi_f32(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cascade_multi_df1_init_f32(&df1MultiF32, BENCH_STAGES, BENCH_CHANNELS, fBq, fS);
+  return (0);
+}
+static int init_df2T_multi_f32(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cascade_multi_df2T_init_f32(&df2TMultiF32, BENCH_STAGES, BENCH_CHANNELS, fBq, fS);
+  return (0);
+}
+static int init_df1_multi_q31(uint32_t n)
+{
+  (void) n;
+  arm_biquad_cascade_multi_df1_init_q31(&df1MultiQ31, BENCH_STAGES, BENCH_CHANNELS, iBq31, iS31, 0);
+  return (0);
+}
+static void run_fir_multi_f32(uint32_t n) { arm_fir_multi_f32(&firMultiF32, fA, fD, n / BENCH_CHANNELS); }
+static void run_fir_multi_q31(uint32_t n) { arm_fir_multi_q31(&firMultiQ31, iA31, iD31, n / BENCH_CHANNELS); }
+static void run_df1_multi_f32(uint32_t n) { arm_biquad_cascade_multi_df1_f32(&df1MultiF32, fA, fD, n / BENCH_CHANNELS); }
+static void run_df2T_multi_f32(uint32_t n) { arm_biquad_cascade_multi_df2T_f32(&df2TMultiF32, fA, fD, n / BENCH_CHANNELS); }
+static void run_df1_multi_q31(uint32_t n) { arm_biquad_cascade_multi_df1_q31(&df1MultiQ31, iA31, iD31, n / BENCH_CHANNELS); }
+static uint32_t ref_fir_multi_f32(uint32_t n, double *pRef) { return (bench_ref_multi(BENCH_F32, 1, n, pRef)); }
+static uint32_t ref_fir_multi_q31(uint32_t n, double *pRef) { return (bench_ref_multi(BENCH_Q31, 1, n, pRef)); }
+static uint32_t ref_biquad_multi_f32(uint32_t n, double *pRef) { return (bench_ref_multi(BENCH_F32, 0, n, pRef)); }
+static uint32_t ref_biquad_multi_q31(uint32_t n, double *pRef) { return (bench_ref_multi(BENCH_Q31, 0, n, pRef)); }
+
+/* Convolution with the FIR coefficients */
+static void run_conv_f32(uint32_t n) { arm_conv_f32(fA, n, fH, BENCH_TAPS, fD); }
+static void run_conv_q31(uint32_t n) { arm_conv_q31(iA31, n, iH31, BENCH_TAPS, iD31); }
+static void run_conv_q15(uint32_t n) { arm_conv_q15(iA15, n, iH15, BENCH_TAPS, iD15); }
+static void run_conv_q7(uint32_t n) { arm_conv_q7(iA7, n, iH7, BENCH_TAPS, iD7); }
+static uint32_t ref_conv_f32(uint32_t n, double *pRef) { return (bench_ref_conv(BENCH_F32, fA, fH, n, pRef)); }
+static uint32_t ref_conv_q31(uint32_t n, double *pRef) { return (bench_ref_conv(BENCH_Q31, iA31, iH31, n, pRef)); }
+static uint32_t ref_conv_q15(uint32_t n, double *pRef) { return (bench_ref_conv(BENCH_Q15, iA15, iH15, n, pRef)); }
+static uint32_t ref_conv_q7(uint32_t n, double *pRef) { return (bench_ref_conv(BENCH_Q7, iA7, iH7, n, pRef)); }
+
+/* Matrices: a block of n samples is a square matrix of n elements */
+static int bench_mat_dim(uint32_t n)
+{
+  matDim = 1u;
+  while ((matDim + 1u) * (matDim + 1u) <= n)
+  {
+    matDim++;
+  }
+  return ((matDim * matDim == n) ? 0 : 1);
+}
+static int init_mat_f32(uint32_t n)
+{
+  if (bench_mat_dim(n) != 0)
+  {
+    return (1);
+  }
+  arm_mat_init_f32(&matAF32, (uint16_t) matDim, (uint16_t) matDim, fMA);
+  arm_mat_init_f32(&matBF32, (uint16_t) matDim, (uint16_t) matDim, fMB);
+  arm_mat_init_f32(&matDF32, (uint16_t) matDim, (uint16_t) matDim, fD);
+  return (0);
+}
+static int init_mat_q31(uint32_t n)
+{
+  if (bench_mat_dim(n) != 0)
+  {
+    return (1);
+  }
+  arm_mat_init_q31(&matAQ31, (uint16_t) matDim, (uint16_t) matDim, iMA31);
+  arm_mat_init_q31(&matBQ31, (uint16_t) matDim, (uint16_t) matDim, iMB31);
+  arm_mat_init_q31(&matDQ31, (uint16_t) matDim, (uint16_t) matDim, iD31);
+  return (0);
+}
+static int init_mat_q15(uint32_t n)
+{
+  if (bench_mat_dim(n) != 0)
+  {
+    return (1);
+  }
+  arm_mat_init_q15(&matAQ15, (uint16_t) matDim, (uint16_t) matDim, iMA15);
+  arm_mat_init_q15(&matBQ15, (uint16_t) matDim, (uint16_t) matDim, iMB15);
+  arm_mat_init_q15(&matDQ15, (uint16_t) matDim, (uint16_t) matDim, iD15);
+  return (0);
+}
+static int init_mat_inverse_f32(uint32_t n)
+{
+  uint32_t i;                                       /* counter */
+
+  if (init_mat_f32(n) != 0)
+  {
+    return (1);
+  }
+
+  /* Identity plus a small random part keeps the matrix well conditioned */
+  for (i = 0u; i < n; i++)
+  {
+    fMB[i] = ((i % (matDim + 1u)) == 0u ? 1.0f : 0.0f) + fMA[i] / (float32_t) matDim;
+  }
+  arm_mat_init_f32(&matBF32, (uint16_t) matDim, (uint16_t) matDim, fS);
+  return (0);
+}
+static void run_mat_mult_f32(uint32_t n) { (void) n; arm_mat_mult_f32(&matAF32, &matBF32, &matDF32); }
+static void run_mat_mult_q31(uint32_t n) { (void) n; arm_mat_mult_q31(&matAQ31, &matBQ31, &matDQ31); }
+static void run_mat_mult_fast_q31(uint32_t n) { (void) n; arm_mat_mult_fast_q31(&matAQ31, &matBQ31, &matDQ31); }
+static void run_mat_mult_q15(uint32_t n) { (void) n; arm_mat_mult_q15(&matAQ15, &matBQ15, &matDQ15, iS15); }
+static void run_mat_mult_fast_q15(uint32_t n) { (void) n; arm_mat_mult_fast_q15(&matAQ15, &matBQ15, &matDQ15, iS15); }
+static void run_mat_add_f32(uint32_t n) { (void) n; arm_mat_add_f32(&matAF32, &matBF32, &matDF32); }
+static void run_mat_add_q31(uint32_t n) { (void) n; arm_mat_add_q31(&matAQ31, &matBQ31, &matDQ31); }
+static void run_mat_add_q15(uint32_t n) { (void) n; arm_mat_add_q15(&matAQ15, &matBQ15, &matDQ15); }
+static void run_mat_trans_f32(uint32_t n) { (void) n; arm_mat_trans_f32(&matAF32, &matDF32); }
+static void run_mat_trans_q31(uint32_t n) { (void) n; arm_mat_trans_q31(&matAQ31, &matDQ31); }
+static void run_mat_trans_q15(uint32_t n) { (void) n; arm_mat_trans_q15(&matAQ15, &matDQ15); }
+static void run_mat_inverse_f32(uint32_t n)
+{
+  /* The inverse destroys its source, so the time includes a copy */
+  memcpy(fS, fMB, n * sizeof(float32_t));
+  arm_mat_inverse_f32(&matBF32, &matDF32);
+}
+static uint32_t ref_mat_mult_f32(uint32_t n, double *pRef) { (void) n; return (bench_ref_mat_mult(BENCH_F32, fMA, fMB, matDim, pRef)); }
+static uint32_t ref_mat_mult_q31(uint32_t n, double *pRef) { (void) n; return (bench_ref_mat_mult(BENCH_Q31, iMA31, iMB31, matDim, pRef)); }
+static uint32_t ref_mat_mult_q15(uint32_t n, double *pRef) { (void) n; return (bench_ref_mat_mult(BENCH_Q15, iMA15, iMB15, matDim, pRef)); }
+
+#define BENCH_MAT_ELEMENTWISE(id, T, pA, pB, expr)                             \
+static uint32_t ref_##id(uint32_t n, double *pRef)                             \
+{                                                                              \
+  uint32_t i, j;                                                               \
+  (void) n;                                                                    \
+  for (i = 0u; i < matDim; i++)                                                \
+  {                                                                            \
+    for (j = 0u; j < matDim; j++)                                              \
+    {                                                                          \
+      pRef[i * matDim + j] = (expr);                                           \
+    }                                                                          \
+  }                                                                            \
+  return (matDim * matDim);                                                    \
+}
+
+BENCH_MAT_ELEMENTWISE(mat_add_f32, BENCH_F32, fMA, fMB, bench_value(BENCH_F32, fMA, i * matDim + j) + bench_value(BENCH_F32, fMB, i * matDim + j))
+BENCH_MAT_ELEMENTWISE(mat_add_q31, BENCH_Q31, iMA31, iMB31, bench_value(BENCH_Q31, iMA31, i * matDim + j) + bench_value(BENCH_Q31, iMB31, i * matDim + j))
+BENCH_MAT_ELEMENTWISE(mat_add_q15, BENCH_Q15, iMA15, iMB15, bench_value(BENCH_Q15, iMA15, i * matDim + j) + bench_value(BENCH_Q15, iMB15, i * matDim + j))
+BENCH_MAT_ELEMENTWISE(mat_trans_f32, BENCH_F32, fMA, fMB, bench_value(BENCH_F32, fMA, j * matDim + i))
+BENCH_MAT_ELEMENTWISE(mat_trans_q31, BENCH_Q31, iMA31, iMB31, bench_value(BENCH_Q31, iMA31, j * matDim + i))
+BENCH_MAT_ELEMENTWISE(mat_trans_q15, BENCH_Q15, iMA15, iMB15, bench_value(BENCH_Q15, iMA15, j * matDim + i))
+
+/**
+ * @brief Inverse by Gauss-Jordan elimination with partial pivoting, in place in pRef.
+ */
+static uint32_t ref_mat_inverse_f32(uint32_t n, double *pRef)
+{
+  double *pM = dTwiddle;                            /* working copy of the matrix */
+  uint32_t d = matDim, i, j, k, p;                  /* dimension and counters */
+  double t;                                         /* pivot and swap temporary */
+
+  (void) n;
+  for (i = 0u; i < d * d; i++)
+  {
+    pM[i] = bench_value(BENCH_F32, fMB, i);
+    pRef[i] = ((i % (d + 1u)) == 0u) ? 1.0 : 0.0;
+  }
+  for (k = 0u; k < d; k++)
+  {
+    p = k;
+    for (i = k + 1u; i < d; i++)
+    {
+      p = (fabs(pM[i * d + k]) > fabs(pM[p * d + k])) ? i : p;
+    }
+    for (j = 0u; j < d; j++)
+    {
+      t = pM[k * d + j]; pM[k * d + j] = pM[p * d + j]; pM[p * d + j] = t;
+      t = pRef[k * d + j]; pRef[k * d + j] = pRef[p * d + j]; pRef[p * d + j] = t;
+    }
+    t = pM[k * d + k];
+    for (j = 0u; j < d; j++)
+    {
+      pM[k * d + j] /= t;
+      pRef[k * d + j] /= t;
+    }
+    for (i = 0u; i < d; i++)
+    {
+      if (i != k)
+      {
+        t = pM[i * d + k];
+        for (j = 0u; j < d; j++)
+        {
+          pM[i * d + j] -= t * pM[k * d + j];
+          pRef[i * d + j] -= t * pRef[k * d + j];
+        }
+      }
+    }
+  }
+
+  return (d * d);
+}
+
+/* Transforms: a block of n samples is an FFT of length n */
+static int init_cfft_f32(uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:   pCfftF32 = &arm_cfft_sR_f32_len16;   break;
+  case 64u:   pCfftF32 = &arm_cfft_sR_f32_len64;   break;
+  case 256u:  pCfftF32 = &arm_cfft_sR_f32_len256;  break;
+  case 1024u: pCfftF32 = &arm_cfft_sR_f32_len1024; break;
+  default:    return (1);
+  }
+  return (0);
+}
+static int init_cfft_q31(uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:   pCfftQ31 = &arm_cfft_sR_q31_len16;   break;
+  case 64u:   pCfftQ31 = &arm_cfft_sR_q31_len64;   break;
+  case 256u:  pCfftQ31 = &arm_cfft_sR_q31_len256;  break;
+  case 1024u: pCfftQ31 = &arm_cfft_sR_q31_len1024; break;
+  default:    return (1);
+  }
+  return (0);
+}
+static int init_cfft_q15(uint32_t n)
+{
+  switch (n)
+  {
+  case 16u:   pCfftQ15 = &arm_cfft_sR_q15_len16;   break;
+  case 64u:   pCfftQ15 = &arm_cfft_sR_q15_len64;   break;
+  case 256u:  pCfftQ15 = &arm_cfft_sR_q15_len256;  break;
+  case 1024u: pCfftQ15 = &arm_cfft_sR_q15_len1024; break;
+  default:    return (1);
+  }
+  return (0);
+}
+static int init_rfft_fast_f32(uint32_t n)
+{
+  return ((arm_rfft_fast_init_f32(&rfftF32, (uint16_t) n) == ARM_MATH_SUCCESS) ? 0 : 1);
+}
+static int init_rfft_q31(uint32_t n)
+{
+  return ((arm_rfft_init_q31(&rfftQ31, n, 0u, 1u) == ARM_MATH_SUCCESS) ? 0 : 1);
+}
+static int init_rfft_q15(uint32_t n)
+{
+  return ((arm_rfft_init_q15(&rfftQ15, n, 0u, 1u) == ARM_MATH_SUCCESS) ? 0 : 1);
+}
+
+/* The transforms work in place or modify their input, so the times include a copy */
+static void run_cfft_f32(uint32_t n)
+{
+  memcpy(fD, fA, 2u * n * sizeof(float32_t));
+  arm_cfft_f32(pCfftF32, fD, 0u, 1u);
+}
+static void run_cfft_q31(uint32_t n)
+{
+  memcpy(iD31, iA31, 2u * n * sizeof(q31_t));
+  arm_cfft_q31(pCfftQ31, iD31, 0u, 1u);
+}
+static void run_cfft_q15(uint32_t n)
+{
+  memcpy(iD15, iA15, 2u * n * sizeof(q15_t));
+  arm_cfft_q15(pCfftQ15, iD15, 0u, 1u);
+}
+static void run_rfft_fast_f32(uint32_t n)
+{
+  memcpy(fS, fA, n * sizeof(float32_t));
+  arm_rfft_fast_f32(&rfftF32, fS, fD, 0u);
+}
+static void run_rfft_q31(uint32_t n)
+{
+  memcpy(iS31, iA31, n * sizeof(q31_t));
+  arm_rfft_q31(&rfftQ31, iS31, iD31);
+}
+static void run_rfft_q15(uint32_t n)
+{
+  memcpy(iS15, iA15, n * sizeof(q15_t));
+  arm_rfft_q15(&rfftQ15, iS15, iD15);
+}
+
+/* The fixed-point FFTs scale their output by 1/n */
+static uint32_t ref_cfft_f32(uint32_t n, double *pRef) { return (bench_ref_dft(BENCH_F32, fA, n, 1, 0, 1.0, pRef)); }
+static uint32_t ref_cfft_q31(uint32_t n, double *pRef) { return (bench_ref_dft(BENCH_Q31, iA31, n, 1, 0, 1.0 / (double) n, pRef)); }
+static uint32_t ref_cfft_q15(uint32_t n, double *pRef) { return (bench_ref_dft(BENCH_Q15, iA15, n, 1, 0, 1.0 / (double) n, pRef)); }
+static uint32_t ref_rfft_fast_f32(uint32_t n, double *pRef) { return (bench_ref_dft(BENCH_F32, fA, n, 0, 1, 1.0, pRef)); }
+static uint32_t ref_rfft_q31(uint32_t n, double *pRef) { return (bench_ref_dft(BENCH_Q31, iA31, n, 0, 0, 1.0 / (double) n, pRef)); }
+static uint32_t ref_rfft_q15(uint32_t n, double *pRef) { return (bench_ref_dft(BENCH_Q15, iA15, n, 0, 0, 1.0 / (double) n, pRef)); }
+
+/* Statistics, one output */
+#define BENCH_STAT(id, T, pX, call, result)                                    \
+static void run_##id(uint32_t n)                                               \
+{                                                                              \
+  call;                                                                        \
+}                                                                              \
+static uint32_t ref_##id(uint32_t n, double *pRef)                             \
+{                                                                              \
+  double mean, var, power, max, min;                                           \
+  bench_ref_stats(T, pX, n, &mean, &var, &power, &max, &min);                  \
+  (void) mean; (void) var; (void) power; (void) max; (void) min;               \
+  pRef[0] = (result);                                                          \
+  return (1u);                                                                 \
+}
+
+BENCH_STAT(mean_f32, BENCH_F32, fA, arm_mean_f32(fA, n, &fD[0]), mean)
+BENCH_STAT(mean_q31, BENCH_Q31, iA31, arm_mean_q31(iA31, n, &iD31[0]), mean)
+BENCH_STAT(mean_q15, BENCH_Q15, iA15, arm_mean_q15(iA15, n, &iD15[0]), mean)
+BENCH_STAT(mean_q7, BENCH_Q7, iA7, arm_mean_q7(iA7, n, &iD7[0]), mean)
+BENCH_STAT(var_f32, BENCH_F32, fA, arm_var_f32(fA, n, &fD[0]), var)
+BENCH_STAT(var_q31, BENCH_Q31, iA31, arm_var_q31(iA31, n, &iD31[0]), var)
+BENCH_STAT(var_q15, BENCH_Q15, iA15, arm_var_q15(iA15, n, &iD15[0]), var)
+BENCH_STAT(std_f32, BENCH_F32, fA, arm_std_f32(fA, n, &fD[0]), sqrt(var))
+BENCH_STAT(std_q31, BENCH_Q31, iA31, arm_std_q31(iA31, n, &iD31[0]), sqrt(var))
+BENCH_STAT(std_q15, BENCH_Q15, iA15, arm_std_q15(iA15, n, &iD15[0]), sqrt(var))
+BENCH_STAT(rms_f32, BENCH_F32, fA, arm_rms_f32(fA, n, &fD[0]), sqrt(power / (double) n))
+/* arm_rms_q31 accumulates in 2.62 with one guard bit, so it gets the quieter matrix input */
+BENCH_STAT(rms_q31, BENCH_Q31, iMA31, arm_rms_q31(iMA31, n, &iD31[0]), sqrt(power / (double) n))
+BENCH_STAT(rms_q15, BENCH_Q15, iA15, arm_rms_q15(iA15, n, &iD15[0]), sqrt(power / (double) n))
+BENCH_STAT(power_f32, BENCH_F32, fA, arm_power_f32(fA, n, &fD[0]), power)
+BENCH_STAT(power_q31, BENCH_Q31, iA31, arm_power_q31(iA31, n, &lD63[0]), power)
+BENCH_STAT(power_q15, BENCH_Q15, iA15, arm_power_q15(iA15, n, &lD63[0]), power)
+BENCH_STAT(power_q7, BENCH_Q7, iA7, arm_power_q7(iA7, n, &iD31[0]), power)
+BENCH_STAT(max_f32, BENCH_F32, fA, arm_max_f32(fA, n, &fD[0], &uIndex), max)
+BENCH_STAT(max_q31, BENCH_Q31, iA31, arm_max_q31(iA31, n, &iD31[0], &uIndex), max)
+BENCH_STAT(max_q15, BENCH_Q15, iA15, arm_max_q15(iA15, n, &iD15[0], &uIndex), max)
+BENCH_STAT(max_q7, BENCH_Q7, iA7, arm_max_q7(iA7, n, &iD7[0], &uIndex), max)
+BENCH_STAT(min_f32, BENCH_F32, fA, arm_min_f32(fA, n, &fD[0], &uIndex), min)
+BENCH_STAT(min_q31, BENCH_Q31, iA31, arm_min_q31(iA31, n, &iD31[0], &uIndex), min)
+BENCH_STAT(min_q15, BENCH_Q15, iA15, arm_min_q15(iA15, n, &iD15[0], &uIndex), min)
+BENCH_STAT(min_q7, BENCH_Q7, iA7, arm_min_q7(iA7, n, &iD7[0], &uIndex), min)
+
+#define Q48   (1.0 / 281474976710656.0)             /* 16.48 format of a q63_t */
+#define Q30   (1.0 / 1073741824.0)                  /* 34.30 format of a q63_t */
+#define Q14   131072.0                              /* 18.14 format of a q31_t */
+
+/*
+* The limits sit a few dB under the SNR measured with the C code of the
+* library; the functions that only move or compare values must be exact.
+*/
+#define EXACT 1000.0
+
+static const bench_case benchCases[] =
+{
+  { "BasicMath",  "arm_add_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_add_f32, ref_add_f32, 145.0 },
+  { "BasicMath",  "arm_add_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_add_q31, ref_add_q31, EXACT },
+  { "BasicMath",  "arm_add_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_add_q15, ref_add_q15, EXACT },
+  { "BasicMath",  "arm_add_q7",                    BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_add_q7,  ref_add_q7,  EXACT },
+  { "BasicMath",  "arm_sub_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_sub_f32, ref_sub_f32, 145.0 },
+  { "BasicMath",  "arm_sub_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_sub_q31, ref_sub_q31, EXACT },
+  { "BasicMath",  "arm_sub_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_sub_q15, ref_sub_q15, EXACT },
+  { "BasicMath",  "arm_sub_q7",                    BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_sub_q7,  ref_sub_q7,  EXACT },
+  { "BasicMath",  "arm_mult_f32",                  BENCH_F32, BENCH_F32, 1.0, NULL, run_mult_f32, ref_mult_f32, 145.0 },
+  { "BasicMath",  "arm_mult_q31",                  BENCH_Q31, BENCH_Q31, 1.0, NULL, run_mult_q31, ref_mult_q31, 160.0 },
+  { "BasicMath",  "arm_mult_q15",                  BENCH_Q15, BENCH_Q15, 1.0, NULL, run_mult_q15, ref_mult_q15, 65.0 },
+  { "BasicMath",  "arm_mult_q7",                   BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_mult_q7,  ref_mult_q7,  15.0 },
+  { "BasicMath",  "arm_scale_f32",                 BENCH_F32, BENCH_F32, 1.0, NULL, run_scale_f32, ref_scale_f32, 145.0 },
+  { "BasicMath",  "arm_scale_q31",                 BENCH_Q31, BENCH_Q31, 1.0, NULL, run_scale_q31, ref_scale_q31, 165.0 },
+  { "BasicMath",  "arm_scale_q15",                 BENCH_Q15, BENCH_Q15, 1.0, NULL, run_scale_q15, ref_scale_q15, 75.0 },
+  { "BasicMath",  "arm_scale_q7",                  BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_scale_q7,  ref_scale_q7,  25.0 },
+  { "BasicMath",  "arm_abs_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_abs_f32, ref_abs_f32, EXACT },
+  { "BasicMath",  "arm_abs_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_abs_q31, ref_abs_q31, EXACT },
+  { "BasicMath",  "arm_abs_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_abs_q15, ref_abs_q15, EXACT },
+  { "BasicMath",  "arm_abs_q7",                    BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_abs_q7,  ref_abs_q7,  EXACT },
+  { "BasicMath",  "arm_negate_f32",                BENCH_F32, BENCH_F32, 1.0, NULL, run_negate_f32, ref_negate_f32, EXACT },
+  { "BasicMath",  "arm_negate_q31",                BENCH_Q31, BENCH_Q31, 1.0, NULL, run_negate_q31, ref_negate_q31, EXACT },
+  { "BasicMath",  "arm_negate_q15",                BENCH_Q15, BENCH_Q15, 1.0, NULL, run_negate_q15, ref_negate_q15, EXACT },
+  { "BasicMath",  "arm_negate_q7",                 BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_negate_q7,  ref_negate_q7,  EXACT },
+  { "BasicMath",  "arm_dot_prod_f32",              BENCH_F32, BENCH_F32, 1.0, NULL, run_dot_prod_f32, ref_dot_prod_f32, 135.0 },
+  { "BasicMath",  "arm_dot_prod_q31",              BENCH_Q31, BENCH_Q63, Q48, NULL, run_dot_prod_q31, ref_dot_prod_q31, 240.0 },
+  { "BasicMath",  "arm_dot_prod_q15",              BENCH_Q15, BENCH_Q63, Q30, NULL, run_dot_prod_q15, ref_dot_prod_q15, EXACT },
+  { "BasicMath",  "arm_dot_prod_q7",               BENCH_Q7,  BENCH_Q31, Q14, NULL, run_dot_prod_q7,  ref_dot_prod_q7,  EXACT },
+  { "Filtering",  "arm_fir_f32",                   BENCH_F32, BENCH_F32, 1.0, init_fir_f32, run_fir_f32, ref_fir_f32, 135.0 },
+  { "Filtering",  "arm_fir_q31",                   BENCH_Q31, BENCH_Q31, 1.0, init_fir_q31, run_fir_q31, ref_fir_q31, 170.0 },
+  { "Filtering",  "arm_fir_fast_q31",              BENCH_Q31, BENCH_Q31, 1.0, init_fir_q31, run_fir_fast_q31, ref_fir_q31, 155.0 },
+  { "Filtering",  "arm_fir_q15",                   BENCH_Q15, BENCH_Q15, 1.0, init_fir_q15, run_fir_q15, ref_fir_q15, 75.0 },
+  { "Filtering",  "arm_fir_fast_q15",              BENCH_Q15, BENCH_Q15, 1.0, init_fir_q15, run_fir_fast_q15, ref_fir_q15, 75.0 },
+  { "Filtering",  "arm_fir_q7",                    BENCH_Q7,  BENCH_Q7,  1.0, init_fir_q7,  run_fir_q7,  ref_fir_q7,  25.0 },
+  { "Filtering",  "arm_biquad_cascade_df1_f32",    BENCH_F32, BENCH_F32, 1.0, init_df1_f32, run_df1_f32, ref_biquad_f32, 135.0 },
+  { "Filtering",  "arm_biquad_cascade_df2T_f32",   BENCH_F32, BENCH_F32, 1.0, init_df2T_f32, run_df2T_f32, ref_biquad_f32, 140.0 },
+  { "Filtering",  "arm_biquad_cascade_df1_q31",    BENCH_Q31, BENCH_Q31, 1.0, init_df1_q31, run_df1_q31, ref_biquad_q31, 160.0 },
+  { "Filtering",  "arm_biquad_cascade_df1_fast_q31", BENCH_Q31, BENCH_Q31, 1.0, init_df1_q31, run_df1_fast_q31, ref_biquad_q31, 150.0 },
+  { "Filtering",  "arm_biquad_cas_df1_32x64_q31",  BENCH_Q31, BENCH_Q31, 1.0, init_df1_32x64_q31, run_df1_32x64_q31, ref_biquad_q31, 160.0 },
+  { "Filtering",  "arm_biquad_cascade_df1_q15",    BENCH_Q15, BENCH_Q15, 1.0, init_df1_q15, run_df1_q15, ref_biquad_q15, 65.0 },
+  { "Filtering",  "arm_biquad_cascade_df1_fast_q15", BENCH_Q15, BENCH_Q15, 1.0, init_df1_q15, run_df1_fast_q15, ref_biquad_q15, 65.0 },
+  { "Filtering",  "arm_fir_multi_f32",             BENCH_F32, BENCH_F32, 1.0, init_fir_multi_f32, run_fir_multi_f32, ref_fir_multi_f32, 135.0 },
+  { "Filtering",  "arm_fir_multi_q31",             BENCH_Q31, BENCH_Q31, 1.0, init_fir_multi_q31, run_fir_multi_q31, ref_fir_multi_q31, 170.0 },
+  { "Filtering",  "arm_biquad_cascade_multi_df1_f32", BENCH_F32, BENCH_F32, 1.0, init_df1_multi_f32, run_df1_multi_f32, ref_biquad_multi_f32, 135.0 },
+  { "Filtering",  "arm_biquad_cascade_multi_df2T_f32", BENCH_F32, BENCH_F32, 1.0, init_df2T_multi_f32, run_df2T_multi_f32, ref_biquad_multi_f32, 140.0 },
+  { "Filtering",  "arm_biquad_cascade_multi_df1_q31", BENCH_Q31, BENCH_Q31, 1.0, init_df1_multi_q31, run_df1_multi_q31, ref_biquad_multi_q31, 160.0 },
+  { "Filtering",  "arm_conv_f32",                  BENCH_F32, BENCH_F32, 1.0, NULL, run_conv_f32, ref_conv_f32, 135.0 },
+  { "Filtering",  "arm_conv_q31",                  BENCH_Q31, BENCH_Q31, 1.0, NULL, run_conv_q31, ref_conv_q31, 170.0 },
+  { "Filtering",  "arm_conv_q15",                  BENCH_Q15, BENCH_Q15, 1.0, NULL, run_conv_q15, ref_conv_q15, 75.0 },
+  { "Filtering",  "arm_conv_q7",                   BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_conv_q7,  ref_conv_q7,  25.0 },
+  { "Matrix",     "arm_mat_mult_f32",              BENCH_F32, BENCH_F32, 1.0, init_mat_f32, run_mat_mult_f32, ref_mat_mult_f32, 135.0 },
+  { "Matrix",     "arm_mat_mult_q31",              BENCH_Q31, BENCH_Q31, 1.0, init_mat_q31, run_mat_mult_q31, ref_mat_mult_q31, 150.0 },
+  { "Matrix",     "arm_mat_mult_fast_q31",         BENCH_Q31, BENCH_Q31, 1.0, init_mat_q31, run_mat_mult_fast_q31, ref_mat_mult_q31, 120.0 },
+  { "Matrix",     "arm_mat_mult_q15",              BENCH_Q15, BENCH_Q15, 1.0, init_mat_q15, run_mat_mult_q15, ref_mat_mult_q15, 55.0 },
+  { "Matrix",     "arm_mat_mult_fast_q15",         BENCH_Q15, BENCH_Q15, 1.0, init_mat_q15, run_mat_mult_fast_q15, ref_mat_mult_q15, 55.0 },
+  { "Matrix",     "arm_mat_add_f32",               BENCH_F32, BENCH_F32, 1.0, init_mat_f32, run_mat_add_f32, ref_mat_add_f32, 145.0 },
+  { "Matrix",     "arm_mat_add_q31",               BENCH_Q31, BENCH_Q31, 1.0, init_mat_q31, run_mat_add_q31, ref_mat_add_q31, EXACT },
+  { "Matrix",     "arm_mat_add_q15",               BENCH_Q15, BENCH_Q15, 1.0, init_mat_q15, run_mat_add_q15, ref_mat_add_q15, EXACT },
+  { "Matrix",     "arm_mat_trans_f32",             BENCH_F32, BENCH_F32, 1.0, init_mat_f32, run_mat_trans_f32, ref_mat_trans_f32, EXACT },
+  { "Matrix",     "arm_mat_trans_q31",             BENCH_Q31, BENCH_Q31, 1.0, init_mat_q31, run_mat_trans_q31, ref_mat_trans_q31, EXACT },
+  { "Matrix",     "arm_mat_trans_q15",             BENCH_Q15, BENCH_Q15, 1.0, init_mat_q15, run_mat_trans_q15, ref_mat_trans_q15, EXACT },
+  { "Matrix",     "arm_mat_inverse_f32",           BENCH_F32, BENCH_F32, 1.0, init_mat_inverse_f32, run_mat_inverse_f32, ref_mat_inverse_f32, 135.0 },
+  { "Transform",  "arm_cfft_f32",                  BENCH_F32, BENCH_F32, 1.0, init_cfft_f32, run_cfft_f32, ref_cfft_f32, 130.0 },
+  { "Transform",  "arm_cfft_q31",                  BENCH_Q31, BENCH_Q31, 1.0, init_cfft_q31, run_cfft_q31, ref_cfft_q31, 135.0 },
+  { "Transform",  "arm_cfft_q15",                  BENCH_Q15, BENCH_Q15, 1.0, init_cfft_q15, run_cfft_q15, ref_cfft_q15, 45.0 },
+  { "Transform",  "arm_rfft_fast_f32",             BENCH_F32, BENCH_F32, 1.0, init_rfft_fast_f32, run_rfft_fast_f32, ref_rfft_fast_f32, 130.0 },
+  { "Transform",  "arm_rfft_q31",                  BENCH_Q31, BENCH_Q31, 1.0, init_rfft_q31, run_rfft_q31, ref_rfft_q31, 130.0 },
+  { "Transform",  "arm_rfft_q15",                  BENCH_Q15, BENCH_Q15, 1.0, init_rfft_q15, run_rfft_q15, ref_rfft_q15, 40.0 },
+  { "Statistics", "arm_mean_f32",                  BENCH_F32, BENCH_F32, 1.0, NULL, run_mean_f32, ref_mean_f32, 115.0 },
+  { "Statistics", "arm_mean_q31",                  BENCH_Q31, BENCH_Q31, 1.0, NULL, run_mean_q31, ref_mean_q31, 150.0 },
+  { "Statistics", "arm_mean_q15",                  BENCH_Q15, BENCH_Q15, 1.0, NULL, run_mean_q15, ref_mean_q15, 60.0 },
+  { "Statistics", "arm_mean_q7",                   BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_mean_q7,  ref_mean_q7,  5.0 },
+  { "Statistics", "arm_var_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_var_f32, ref_var_f32, 120.0 },
+  { "Statistics", "arm_var_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_var_q31, ref_var_q31, 150.0 },
+  { "Statistics", "arm_var_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_var_q15, ref_var_q15, 80.0 },
+  { "Statistics", "arm_std_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_std_f32, ref_std_f32, 125.0 },
+  { "Statistics", "arm_std_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_std_q31, ref_std_q31, 160.0 },
+  { "Statistics", "arm_std_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_std_q15, ref_std_q15, 75.0 },
+  { "Statistics", "arm_rms_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_rms_f32, ref_rms_f32, 125.0 },
+  { "Statistics", "arm_rms_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_rms_q31, ref_rms_q31, 145.0 },
+  { "Statistics", "arm_rms_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_rms_q15, ref_rms_q15, 75.0 },
+  { "Statistics", "arm_power_f32",                 BENCH_F32, BENCH_F32, 1.0, NULL, run_power_f32, ref_power_f32, 120.0 },
+  { "Statistics", "arm_power_q31",                 BENCH_Q31, BENCH_Q63, Q48, NULL, run_power_q31, ref_power_q31, 260.0 },
+  { "Statistics", "arm_power_q15",                 BENCH_Q15, BENCH_Q63, Q30, NULL, run_power_q15, ref_power_q15, EXACT },
+  { "Statistics", "arm_power_q7",                  BENCH_Q7,  BENCH_Q31, Q14, NULL, run_power_q7,  ref_power_q7,  EXACT },
+  { "Statistics", "arm_max_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_max_f32, ref_max_f32, EXACT },
+  { "Statistics", "arm_max_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_max_q31, ref_max_q31, EXACT },
+  { "Statistics", "arm_max_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_max_q15, ref_max_q15, EXACT },
+  { "Statistics", "arm_max_q7",                    BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_max_q7,  ref_max_q7,  EXACT },
+  { "Statistics", "arm_min_f32",                   BENCH_F32, BENCH_F32, 1.0, NULL, run_min_f32, ref_min_f32, EXACT },
+  { "Statistics", "arm_min_q31",                   BENCH_Q31, BENCH_Q31, 1.0, NULL, run_min_q31, ref_min_q31, EXACT },
+  { "Statistics", "arm_min_q15",                   BENCH_Q15, BENCH_Q15, 1.0, NULL, run_min_q15, ref_min_q15, EXACT },
+  { "Statistics", "arm_min_q7",                    BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_min_q7,  ref_min_q7,  EXACT },
+  { "Support",    "arm_float_to_q31",              BENCH_F32, BENCH_Q31, 1.0, NULL, run_float_to_q31, ref_float_to_q31, EXACT },
+  { "Support",    "arm_float_to_q15",              BENCH_F32, BENCH_Q15, 1.0, NULL, run_float_to_q15, ref_float_to_q15, 75.0 },
+  { "Support",    "arm_float_to_q7",               BENCH_F32, BENCH_Q7,  1.0, NULL, run_float_to_q7,  ref_float_to_q7,  30.0 },
+  { "Support",    "arm_q31_to_float",              BENCH_Q31, BENCH_F32, 1.0, NULL, run_q31_to_float, ref_q31_to_float, 145.0 },
+  { "Support",    "arm_q15_to_float",              BENCH_Q15, BENCH_F32, 1.0, NULL, run_q15_to_float, ref_q15_to_float, EXACT },
+  { "Support",    "arm_q7_to_float",               BENCH_Q7,  BENCH_F32, 1.0, NULL, run_q7_to_float,  ref_q7_to_float,  EXACT },
+  { "Support",    "arm_q31_to_q15",                BENCH_Q31, BENCH_Q15, 1.0, NULL, run_q31_to_q15, ref_q31_to_q15, 75.0 },
+  { "Support",    "arm_q15_to_q31",                BENCH_Q15, BENCH_Q31, 1.0, NULL, run_q15_to_q31, ref_q15_to_q31, EXACT },
+  { "Support",    "arm_q15_to_q7",                 BENCH_Q15, BENCH_Q7,  1.0, NULL, run_q15_to_q7,  ref_q15_to_q7,  30.0 },
+  { "Support",    "arm_q7_to_q31",                 BENCH_Q7,  BENCH_Q31, 1.0, NULL, run_q7_to_q31,  ref_q7_to_q31,  EXACT },
+  { "Support",    "arm_copy_f32",                  BENCH_F32, BENCH_F32, 1.0, NULL, run_copy_f32, ref_copy_f32, EXACT },
+  { "Support",    "arm_copy_q7",                   BENCH_Q7,  BENCH_Q7,  1.0, NULL, run_copy_q7,  ref_copy_q7,  EXACT },
+};
+
+#define BENCH_NUM_CASES (sizeof(benchCases) / sizeof(benchCases[0]))
+
+/*******************************************************************************
+ * Measurement
+ ******************************************************************************/
+
+/**
+ * @brief Formats x with the given number of decimals without the floating-point printf support of the target.
+ */
+static const char *bench_fmt(
+  char *pBuf,
+  double x,
+  uint32_t decimals)
+{
+  uint32_t scale = 1u, i;                           /* 10^decimals and counter */
+  uint32_t whole, frac;                             /* integer and fractional digits */
+  char *p = pBuf;                                   /* write pointer */
+  char digits[12];                                  /* reversed digits */
+  uint32_t n = 0u;                                  /* number of digits */
+
+  for (i = 0u; i < decimals; i++)
+  {
+    scale *= 10u;
+  }
+  if (x < 0.0)
+  {
+    *p++ = '-';
+    x = -x;
+  }
+  if (x > 4.0e9 / (double) scale)
+  {
+    x = 4.0e9 / (double) scale;
+  }
+  whole = (uint32_t) floor(x * (double) scale + 0.5);
+  frac = whole % scale;
+  whole /= scale;
+  do
+  {
+    digits[n++] = (char) ('0' + whole % 10u);
+    whole /= 10u;
+  } while (whole != 0u);
+  while (n > 0u)
+  {
+    *p++ = digits[--n];
+  }
+  if (decimals > 0u)
+  {
+    *p++ = '.';
+    for (i = decimals; i > 0u; i--)
+    {
+      p[i - 1u] = (char) ('0' + frac % 10u);
+      frac /= 10u;
+    }
+    p += decimals;
+  }
+  *p = '\0';
+
+  return (pBuf);
+}
+
+/**
+ * @brief Distance between x and the next float32_t away from zero.
+ */
+static double bench_ulp(
+  double x)
+{
+  int e;                                            /* binary exponent */
+
+  x = fabs(x);
+  if (x < 1.1754943508222875e-38)
+  {
+    return (1.4012984643248171e-45);
+  }
+  (void) frexp(x, &e);
+  return (ldexp(1.0, e - 24));
+}
+
+/**
+ * @brief Runs one function on the accuracy block and compares it with its reference.
+ * @return 0 when the function meets its limit.
+ */
+static int bench_accuracy(
+  const bench_case *pCase)
+{
+  uint32_t n = BENCH_ACC_BLOCK, count, i;           /* block size and counters */
+  double signal = 0.0, noise = 0.0, err, maxErr = 0.0, lsb, snr;  /* statistics */
+  const void *pOut;                                 /* output buffer */
+  char snrText[16], errText[16], limitText[16];     /* formatted results */
+  int fail;                                         /* result */
+
+  if ((pCase->pInit != NULL) && (pCase->pInit(n) != 0))
+  {
+    return (0);
+  }
+  pCase->pRun(n);
+  count = pCase->pRef(n, dRef);
+
+  switch (pCase->outType)
+  {
+  case BENCH_F32: pOut = fD;   lsb = 0.0; break;
+  case BENCH_Q31: pOut = iD31; lsb = pCase->outScale / 2147483648.0; break;
+  case BENCH_Q15: pOut = iD15; lsb = pCase->outScale / 32768.0; break;
+  case BENCH_Q7:  pOut = iD7;  lsb = pCase->outScale / 128.0; break;
+  default:        pOut = lD63; lsb = pCase->outScale; break;
+  }
+
+  for (i = 0u; i < count; i++)
+  {
+    dOut[i] = bench_value(pCase->outType, pOut, i) * pCase->outScale;
+    err = fabs(dOut[i] - dRef[i]);
+    signal += dRef[i] * dRef[i];
+    noise += err * err;
+    err /= (lsb > 0.0) ? lsb : bench_ulp(dRef[i]);
+    maxErr = (err > maxErr) ? err : maxErr;
+  }
+
+  snr = (noise > 0.0) ? 10.0 * log10(signal / noise) : EXACT;
+  fail = (snr < pCase->minSnr) ? 1 : 0;
+
+  BENCH_PRINTF("%-11s %-33s %-4s %9s %11s %-4s %6s  %s\r\n", pCase->pFamily, pCase->pName,
+               benchTypeName[pCase->type], (noise > 0.0) ? bench_fmt(snrText, snr, 1u) : "exact",
+               bench_fmt(errText, maxErr, 1u), (lsb > 0.0) ? "lsb" : "ulp",
+               (pCase->minSnr >= EXACT) ? "exact" : bench_fmt(limitText, pCase->minSnr, 0u),
+               fail ? "FAIL" : "ok");
+
+  return (fail);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+/**
+ * @brief Core clock cycles per sample of one call, after a warm-up call.
+ */
+static double bench_rate(
+  const bench_case *pCase,
+  uint32_t n)
+{
+  uint32_t start;                                   /* cycle counter at the start */
+
+  pCase->pRun(n);
+  start = DWT->CYCCNT;
+  pCase->pRun(n);
+  return ((double) (DWT->CYCCNT - start) / (double) n);
+}
+
+#else
+
+static double bench_seconds(
+  void)
+{
+  struct timespec t;                                /* monotonic time */
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return ((double) t.tv_sec + 1.0e-9 * (double) t.tv_nsec);
+}
+
+/**
+ * @brief Millions of samples per second, over at least 20 ms of repeated calls.
+ */
+static double bench_rate(
+  const bench_case *pCase,
+  uint32_t n)
+{
+  uint32_t reps = 1u, i;                            /* repetitions and counter */
+  double start, elapsed;                            /* times */
+
+  pCase->pRun(n);
+  for (;;)
+  {
+    start = bench_seconds();
+    for (i = 0u; i < reps; i++)
+    {
+      pCase->pRun(n);
+    }
+    elapsed = bench_seconds() - start;
+    if ((elapsed >= 0.02) || (reps >= (1u << 30)))
+    {
+      return ((double) reps * (double) n / elapsed * 1.0e-6);
+    }
+    reps *= 2u;
+  }
+}
+
+#endif
+
+/**
+ * @brief Prints the throughput of one function at every block size that fits.
+ */
+static void bench_throughput(
+  const bench_case *pCase)
+{
+  uint32_t k, n;                                    /* size counter and block size */
+  char text[16];                                    /* formatted result */
+
+  BENCH_PRINTF("%-33s %-4s", pCase->pName, benchTypeName[pCase->type]);
+  for (k = 0u; k < BENCH_NUM_SIZES; k++)
+  {
+    n = benchSizes[k];
+    if ((n > BENCH_MAX_BLOCK) || ((pCase->pInit != NULL) && (pCase->pInit(n) != 0)))
+    {
+      BENCH_PRINTF(" %9s", "-");
+      continue;
+    }
+    BENCH_PRINTF(" %9s", bench_fmt(text, bench_rate(pCase, n), 2u));
+  }
+  BENCH_PRINTF("\r\n");
+}
+
+/**
+ * @brief Runs the accuracy and throughput tables for the functions whose family or name contains pFilter.
+ * @return number of functions below their accuracy limit.
+ */
+static int bench_run(
+  int accuracy,
+  int throughput,
+  const char *pFilter)
+{
+  uint32_t i, k;                                    /* counters */
+  int fails = 0;                                    /* failed functions */
+  const bench_case *pCase;                          /* function under test */
+
+  bench_inputs();
+
+  if (accuracy)
+  {
+    BENCH_PRINTF("\r\naccuracy, %u samples\r\n", (unsigned) BENCH_ACC_BLOCK);
+    BENCH_PRINTF("%-11s %-33s %-4s %9s %15s %6s  %s\r\n", "family", "function", "type", "snr(dB)", "max error", "limit", "result");
+    for (i = 0u; i < BENCH_NUM_CASES; i++)
+    {
+      pCase = &benchCases[i];
+      if ((pFilter == NULL) || strstr(pCase->pFamily, pFilter) || strstr(pCase->pName, pFilter))
+      {
+        fails += bench_accuracy(pCase);
+      }
+    }
+    BENCH_PRINTF("%d function(s) below their accuracy limit\r\n", fails);
+  }
+
+  if (throughput)
+  {
+#if defined(ARM_DSP_BENCH_TARGET)
+    BENCH_PRINTF("\r\nthroughput, cycles per sample\r\n");
+#else
+    BENCH_PRINTF("\r\nthroughput, Msamples/s\r\n");
+#endif
+    BENCH_PRINTF("%-33s %-4s", "function", "type");
+    for (k = 0u; k < BENCH_NUM_SIZES; k++)
+    {
+      BENCH_PRINTF(" %9u", (unsigned) benchSizes[k]);
+    }
+    BENCH_PRINTF("\r\n");
+    for (i = 0u; i < BENCH_NUM_CASES; i++)
+    {
+      pCase = &benchCases[i];
+      if ((pFilter == NULL) || strstr(pCase->pFamily, pFilter) || strstr(pCase->pName, pFilter))
+      {
+        bench_throughput(pCase);
+      }
+    }
+  }
+
+  return (fails);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+int main(void)
+{
+  BOARD_InitPins();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  /* Start the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_PRINTF("CMSIS DSP benchmark, core clock %u Hz\r\n", (unsigned) SystemCoreClock);
+  bench_run(1, 1, NULL);
+
+  while (1)
+  {
+  }
+}
+
+#else
+
+int main(
+  int argc,
+  char **argv)
+{
+  int accuracy = 1, throughput = 1, i;              /* options and counter */
+  const char *pFilter = NULL;                       /* function filter */
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-a") == 0)
+    {
+      throughput = 0;
+    }
+    else if (strcmp(argv[i], "-t") == 0)
+    {
+      accuracy = 0;
+    }
+    else if ((strcmp(argv[i], "-f") == 0) && (i + 1 < argc))
+    {
+      pFilter = argv[++i];
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [-a] [-t] [-f text]\n", argv[0]);
+      return (2);
+    }
+  }
+
+#ifdef ARM_HOST_SIMD_BUILD
+  BENCH_PRINTF("CMSIS DSP benchmark, %s kernels\n", arm_host_simd_name(arm_host_simd_level()));
+#else
+  BENCH_PRINTF("CMSIS DSP benchmark\n");
+#endif
+
+  return (bench_run(accuracy, throughput, pFilter));
+}
+
+#endif
@@ -0,0 +1,504 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fft_tables_bench.c
+*
+* Description:  FFT tables generated in RAM against the flash tables.
+*
+* Target Processor: Cortex-M4 with FPU, or x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+
+/*
+* Checks the CFFT and RFFT tables built in RAM by arm_cfft_gen_init_*() and
+* arm_rfft_fast_gen_init_f32() against the flash tables of
+* arm_common_tables.h, for every length up to BENCH_MAX_LEN:
+*
+*   bitrev   the generated bit reversal table has the length of the flash
+*            table, and a transform using it with the flash twiddle factors
+*            gives the output of the constant instance bit for bit
+*   twiddle  largest difference from the flash twiddle factors, in units of
+*            the last place of Q31 and Q15 and in 1e-9 for float32_t
+*   snr      output of the RAM instance against the output of the constant
+*            instance, in dB; equal outputs are reported as "exact"
+*   init     time of the generation of the tables
+*
+* Host: built by the CMakeLists.txt in CMSIS/DSP_Lib and run by CTest; the
+* exit status is the number of failed checks and the times are in
+* microseconds.  The vector arm_cfft_f32() of the host build has tables of
+* its own, so CTest also runs the check with ARM_HOST_SIMD=generic.
+*
+* Target: build this file with -DARM_DSP_BENCH_TARGET into a FRDM-KV31F
+* project as for arm_dsp_bench.c.  The times are in thousands of core clock
+* cycles from the DWT cycle counter, BENCH_MAX_LEN is 1024 to leave room in
+* RAM, and the results are printed on the debug console.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "arm_math.h"
+#include "arm_const_structs.h"
+
+#if defined(ARM_DSP_BENCH_TARGET)
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#define BENCH_PRINTF            PRINTF
+#define BENCH_MAX_LEN           1024u           /* longest CFFT checked */
+#else
+#include <stdio.h>
+#include <time.h>
+#define BENCH_PRINTF            printf
+#define BENCH_MAX_LEN           4096u           /* longest CFFT checked */
+#endif
+
+#define BENCH_SNR_F32           120             /* lowest SNR of the float32_t transforms, dB */
+#define BENCH_SNR_Q31           100             /* lowest SNR of the Q31 transforms, dB */
+#define BENCH_NUM_LENGTHS       9u              /* CFFT lengths 16 ... 4096 */
+
+/* Generated tables; the float32_t bit reversal tables can be longer than fftLen */
+static float32_t fTwiddle[2u * BENCH_MAX_LEN];
+static float32_t fTwiddleRFFT[2u * BENCH_MAX_LEN];
+static q31_t iTwiddle31[3u * BENCH_MAX_LEN / 2u];
+static q15_t iTwiddle15[3u * BENCH_MAX_LEN / 2u];
+static uint16_t bitRev[2u * BENCH_MAX_LEN];
+
+/* Inputs and outputs, complex */
+static float32_t fIn[2u * BENCH_MAX_LEN], fOutA[2u * BENCH_MAX_LEN], fOutB[2u * BENCH_MAX_LEN];
+static q31_t iIn31[2u * BENCH_MAX_LEN], iOutA31[2u * BENCH_MAX_LEN], iOutB31[2u * BENCH_MAX_LEN];
+static q15_t iIn15[2u * BENCH_MAX_LEN], iOutA15[2u * BENCH_MAX_LEN], iOutB15[2u * BENCH_MAX_LEN];
+
+/* Permutations of the bit reversal tables */
+static uint16_t permA[BENCH_MAX_LEN], permB[BENCH_MAX_LEN];
+
+/* Constant instances of every length */
+static const arm_cfft_instance_f32 *const cfftF32[BENCH_NUM_LENGTHS] =
+{
+  &arm_cfft_sR_f32_len16, &arm_cfft_sR_f32_len32, &arm_cfft_sR_f32_len64,
+  &arm_cfft_sR_f32_len128, &arm_cfft_sR_f32_len256, &arm_cfft_sR_f32_len512,
+  &arm_cfft_sR_f32_len1024, &arm_cfft_sR_f32_len2048, &arm_cfft_sR_f32_len4096
+};
+static const arm_cfft_instance_q31 *const cfftQ31[BENCH_NUM_LENGTHS] =
+{
+  &arm_cfft_sR_q31_len16, &arm_cfft_sR_q31_len32, &arm_cfft_sR_q31_len64,
+  &arm_cfft_sR_q31_len128, &arm_cfft_sR_q31_len256, &arm_cfft_sR_q31_len512,
+  &arm_cfft_sR_q31_len1024, &arm_cfft_sR_q31_len2048, &arm_cfft_sR_q31_len4096
+};
+static const arm_cfft_instance_q15 *const cfftQ15[BENCH_NUM_LENGTHS] =
+{
+  &arm_cfft_sR_q15_len16, &arm_cfft_sR_q15_len32, &arm_cfft_sR_q15_len64,
+  &arm_cfft_sR_q15_len128, &arm_cfft_sR_q15_len256, &arm_cfft_sR_q15_len512,
+  &arm_cfft_sR_q15_len1024, &arm_cfft_sR_q15_len2048, &arm_cfft_sR_q15_len4096
+};
+
+/**
+ * @brief Fixed pseudo random inputs, at half of full scale.
+ */
+static void bench_inputs(
+  void)
+{
+  uint32_t seed = 2017u;                         /* linear congruential generator */
+  uint32_t i;                                    /* loop counter */
+  float32_t x;                                   /* value in [-1, 1) */
+
+  for (i = 0u; i < 2u * BENCH_MAX_LEN; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x = (float32_t) ((int32_t) seed) / 2147483648.0f;
+    fIn[i] = 0.5f * x;
+    iIn31[i] = (q31_t) (0.5f * x * 2147483648.0f);
+    iIn15[i] = (q15_t) (0.5f * x * 32768.0f);
+  }
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+static uint32_t bench_start;
+
+static void bench_timer_start(
+  void)
+{
+  bench_start = DWT->CYCCNT;
+}
+
+/* Thousands of cycles since bench_timer_start() */
+static uint32_t bench_timer_read(
+  void)
+{
+  return ((DWT->CYCCNT - bench_start + 500u) / 1000u);
+}
+
+#else
+
+static struct timespec bench_start;
+
+static void bench_timer_start(
+  void)
+{
+  clock_gettime(CLOCK_MONOTONIC, &bench_start);
+}
+
+/* Microseconds since bench_timer_start() */
+static uint32_t bench_timer_read(
+  void)
+{
+  struct timespec now;                           /* current time */
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return ((uint32_t) ((now.tv_sec - bench_start.tv_sec) * 1000000 + (now.tv_nsec - bench_start.tv_nsec) / 1000 + 1) );
+}
+
+#endif
+
+/**
+ * @brief Compares the permutations of two bit reversal tables.
+ * @return 1 if the tables have the same length and permutation.
+ */
+static int bench_same_bitrev(
+  const uint16_t * pA,
+  uint16_t lengthA,
+  const uint16_t * pB,
+  uint16_t lengthB,
+  uint32_t fftLen)
+{
+  uint32_t i;                                    /* loop counter */
+  uint16_t t;                                    /* swapped index */
+
+  for (i = 0u; i < fftLen; i++)
+  {
+    permA[i] = (uint16_t) i;
+    permB[i] = (uint16_t) i;
+  }
+  for (i = 0u; i < lengthA; i += 2u)
+  {
+    t = permA[pA[i] / 8u];
+    permA[pA[i] / 8u] = permA[pA[i + 1u] / 8u];
+    permA[pA[i + 1u] / 8u] = t;
+  }
+  for (i = 0u; i < lengthB; i += 2u)
+  {
+    t = permB[pB[i] / 8u];
+    permB[pB[i] / 8u] = permB[pB[i + 1u] / 8u];
+    permB[pB[i + 1u] / 8u] = t;
+  }
+
+  return (((lengthA == lengthB) && (memcmp(permA, permB, fftLen * sizeof(uint16_t)) == 0)) ? 1 : 0);
+}
+
+/**
+ * @brief Signal to noise ratio of pB against the reference pA.
+ * @return SNR in dB, or -1 if the outputs are equal.
+ */
+static int32_t bench_snr(
+  const float64_t * pA,
+  const float64_t * pB,
+  uint32_t n)
+{
+  float64_t signal = 0.0, noise = 0.0;           /* energies */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < n; i++)
+  {
+    signal += pA[i] * pA[i];
+    noise += (pA[i] - pB[i]) * (pA[i] - pB[i]);
+  }
+
+  return ((noise == 0.0) ? -1 : (int32_t) (10.0 * log10(signal / noise)));
+}
+
+/* The outputs, widened for bench_snr() */
+static float64_t dOutA[2u * BENCH_MAX_LEN], dOutB[2u * BENCH_MAX_LEN];
+
+/**
+ * @brief Prints one row of the report.
+ * @return 1 if a check failed.
+ */
+static int bench_report(
+  const char * pType,
+  uint32_t fftLen,
+  int sameBitRev,
+  uint32_t twiddleDiff,
+  int32_t snr,
+  int32_t minSnr,
+  uint32_t initTime)
+{
+  int fail = ((sameBitRev == 0) || ((snr >= 0) && (snr < minSnr))) ? 1 : 0;
+
+  if (snr < 0)
+  {
+    BENCH_PRINTF("%-9s %5u %-8s %8u %6s %8u  %s\r\n", pType, (unsigned) fftLen, sameBitRev ? "same" : "DIFFER",
+                 (unsigned) twiddleDiff, "exact", (unsigned) initTime, fail ? "FAIL" : "ok");
+  }
+  else
+  {
+    BENCH_PRINTF("%-9s %5u %-8s %8u %6d %8u  %s\r\n", pType, (unsigned) fftLen, sameBitRev ? "same" : "DIFFER",
+                 (unsigned) twiddleDiff, (int) snr, (unsigned) initTime, fail ? "FAIL" : "ok");
+  }
+
+  return (fail);
+}
+
+/**
+ * @brief Checks the float32_t CFFT of one length.
+ */
+static int bench_cfft_f32(
+  const arm_cfft_instance_f32 * pFlash)
+{
+  arm_cfft_instance_f32 ram, mixed;              /* generated and mixed instances */
+  uint32_t n = pFlash->fftLen;                   /* FFT length */
+  uint32_t i, initTime, diff = 0u, d;            /* counter, time and twiddle differences */
+  int same;                                      /* bit reversal check */
+
+  bench_timer_start();
+  arm_cfft_gen_init_f32(&ram, (uint16_t) n, fTwiddle, bitRev);
+  initTime = bench_timer_read();
+
+  for (i = 0u; i < 2u * n; i++)
+  {
+    d = (uint32_t) (fabs((float64_t) fTwiddle[i] - (float64_t) pFlash->pTwiddle[i]) * 1.0e9 + 0.5);
+    diff = (d > diff) ? d : diff;
+  }
+
+  /* The generated bit reversal with the flash twiddle factors must give the flash output */
+  mixed = *pFlash;
+  mixed.pBitRevTable = ram.pBitRevTable;
+  mixed.bitRevLength = ram.bitRevLength;
+  memcpy(fOutA, fIn, 2u * n * sizeof(float32_t));
+  memcpy(fOutB, fIn, 2u * n * sizeof(float32_t));
+  arm_cfft_f32(pFlash, fOutA, 0u, 1u);
+  arm_cfft_f32(&mixed, fOutB, 0u, 1u);
+  same = bench_same_bitrev(ram.pBitRevTable, ram.bitRevLength, pFlash->pBitRevTable, pFlash->bitRevLength, n) &&
+         (memcmp(fOutA, fOutB, 2u * n * sizeof(float32_t)) == 0);
+
+  memcpy(fOutB, fIn, 2u * n * sizeof(float32_t));
+  arm_cfft_f32(&ram, fOutB, 0u, 1u);
+  for (i = 0u; i < 2u * n; i++)
+  {
+    dOutA[i] = fOutA[i];
+    dOutB[i] = fOutB[i];
+  }
+
+  return (bench_report("cfft f32", n, same, diff, bench_snr(dOutA, dOutB, 2u * n), BENCH_SNR_F32, initTime));
+}
+
+/**
+ * @brief Checks the Q31 CFFT of one length.
+ */
+static int bench_cfft_q31(
+  const arm_cfft_instance_q31 * pFlash)
+{
+  arm_cfft_instance_q31 ram, mixed;              /* generated and mixed instances */
+  uint32_t n = pFlash->fftLen;                   /* FFT length */
+  uint32_t i, initTime, diff = 0u, d;            /* counter, time and twiddle differences */
+  int same;                                      /* bit reversal check */
+
+  bench_timer_start();
+  arm_cfft_gen_init_q31(&ram, (uint16_t) n, iTwiddle31, bitRev);
+  initTime = bench_timer_read();
+
+  for (i = 0u; i < 3u * n / 2u; i++)
+  {
+    d = (uint32_t) labs((long) iTwiddle31[i] - (long) pFlash->pTwiddle[i]);
+    diff = (d > diff) ? d : diff;
+  }
+
+  mixed = *pFlash;
+  mixed.pBitRevTable = ram.pBitRevTable;
+  mixed.bitRevLength = ram.bitRevLength;
+  memcpy(iOutA31, iIn31, 2u * n * sizeof(q31_t));
+  memcpy(iOutB31, iIn31, 2u * n * sizeof(q31_t));
+  arm_cfft_q31(pFlash, iOutA31, 0u, 1u);
+  arm_cfft_q31(&mixed, iOutB31, 0u, 1u);
+  same = bench_same_bitrev(ram.pBitRevTable, ram.bitRevLength, pFlash->pBitRevTable, pFlash->bitRevLength, n) &&
+         (memcmp(iOutA31, iOutB31, 2u * n * sizeof(q31_t)) == 0);
+
+  memcpy(iOutB31, iIn31, 2u * n * sizeof(q31_t));
+  arm_cfft_q31(&ram, iOutB31, 0u, 1u);
+  for (i = 0u; i < 2u * n; i++)
+  {
+    dOutA[i] = (float64_t) iOutA31[i];
+    dOutB[i] = (float64_t) iOutB31[i];
+  }
+
+  return (bench_report("cfft q31", n, same, diff, bench_snr(dOutA, dOutB, 2u * n), BENCH_SNR_Q31, initTime));
+}
+
+/**
+ * @brief Checks the Q15 CFFT of one length; the generated tables equal the flash tables.
+ */
+static int bench_cfft_q15(
+  const arm_cfft_instance_q15 * pFlash)
+{
+  arm_cfft_instance_q15 ram, mixed;              /* generated and mixed instances */
+  uint32_t n = pFlash->fftLen;                   /* FFT length */
+  uint32_t i, initTime, diff = 0u, d;            /* counter, time and twiddle differences */
+  int same;                                      /* bit reversal check */
+
+  bench_timer_start();
+  arm_cfft_gen_init_q15(&ram, (uint16_t) n, iTwiddle15, bitRev);
+  initTime = bench_timer_read();
+
+  for (i = 0u; i < 3u * n / 2u; i++)
+  {
+    d = (uint32_t) abs((int) iTwiddle15[i] - (int) pFlash->pTwiddle[i]);
+    diff = (d > diff) ? d : diff;
+  }
+
+  mixed = *pFlash;
+  mixed.pBitRevTable = ram.pBitRevTable;
+  mixed.bitRevLength = ram.bitRevLength;
+  memcpy(iOutA15, iIn15, 2u * n * sizeof(q15_t));
+  memcpy(iOutB15, iIn15, 2u * n * sizeof(q15_t));
+  arm_cfft_q15(pFlash, iOutA15, 0u, 1u);
+  arm_cfft_q15(&mixed, iOutB15, 0u, 1u);
+  same = bench_same_bitrev(ram.pBitRevTable, ram.bitRevLength, pFlash->pBitRevTable, pFlash->bitRevLength, n) &&
+         (memcmp(iOutA15, iOutB15, 2u * n * sizeof(q15_t)) == 0);
+
+  memcpy(iOutB15, iIn15, 2u * n * sizeof(q15_t));
+  arm_cfft_q15(&ram, iOutB15, 0u, 1u);
+  for (i = 0u; i < 2u * n; i++)
+  {
+    dOutA[i] = (float64_t) iOutA15[i];
+    dOutB[i] = (float64_t) iOutB15[i];
+  }
+
+  /* Equal tables must give equal outputs */
+  return (bench_report("cfft q15", n, same, diff, bench_snr(dOutA, dOutB, 2u * n), 1000, initTime));
+}
+
+/**
+ * @brief Checks the float32_t fast RFFT of one length against arm_rfft_fast_init_f32().
+ */
+static int bench_rfft_f32(
+  uint32_t n)
+{
+  arm_rfft_fast_instance_f32 flash, ram;         /* flash and generated instances */
+  uint32_t i, initTime, diff = 0u, d;            /* counter, time and twiddle differences */
+  int same;                                      /* bit reversal check */
+
+  arm_rfft_fast_init_f32(&flash, (uint16_t) n);
+  bench_timer_start();
+  arm_rfft_fast_gen_init_f32(&ram, (uint16_t) n, fTwiddle, fTwiddleRFFT, bitRev);
+  initTime = bench_timer_read();
+
+  for (i = 0u; i < n; i++)
+  {
+    d = (uint32_t) (fabs((float64_t) fTwiddleRFFT[i] - (float64_t) flash.pTwiddleRFFT[i]) * 1.0e9 + 0.5);
+    diff = (d > diff) ? d : diff;
+  }
+  same = bench_same_bitrev(ram.Sint.pBitRevTable, ram.Sint.bitRevLength, flash.Sint.pBitRevTable,
+                           flash.Sint.bitRevLength, n / 2u);
+
+  /* arm_rfft_fast_f32() overwrites its input */
+  memcpy(fOutB, fIn, n * sizeof(float32_t));
+  arm_rfft_fast_f32(&flash, fOutB, fOutA, 0u);
+  memcpy(fOutB, fIn, n * sizeof(float32_t));
+  arm_rfft_fast_f32(&ram, fOutB, &fOutB[n], 0u);
+  for (i = 0u; i < n; i++)
+  {
+    dOutA[i] = fOutA[i];
+    dOutB[i] = fOutB[n + i];
+  }
+
+  return (bench_report("rfft f32", n, same, diff, bench_snr(dOutA, dOutB, n), BENCH_SNR_F32, initTime));
+}
+
+/**
+ * @brief Checks every length.
+ * @return number of failed checks.
+ */
+static int bench_run(
+  void)
+{
+  uint32_t i;                                    /* loop counter */
+  int fails = 0;                                 /* failed checks */
+
+  bench_inputs();
+
+#if defined(ARM_DSP_BENCH_TARGET)
+  BENCH_PRINTF("\r\ntwiddle: f32 in 1e-9, Q31 and Q15 in LSB; init in 1000 cycles\r\n");
+#else
+  BENCH_PRINTF("\r\ntwiddle: f32 in 1e-9, Q31 and Q15 in LSB; init in us\r\n");
+#endif
+  BENCH_PRINTF("%-9s %5s %-8s %8s %6s %8s  %s\r\n", "transform", "len", "bitrev", "twiddle", "snr", "init", "result");
+  for (i = 0u; (i < BENCH_NUM_LENGTHS) && (cfftF32[i]->fftLen <= BENCH_MAX_LEN); i++)
+  {
+    fails += bench_cfft_f32(cfftF32[i]);
+  }
+  for (i = 0u; (i < BENCH_NUM_LENGTHS) && (cfftQ31[i]->fftLen <= BENCH_MAX_LEN); i++)
+  {
+    fails += bench_cfft_q31(cfftQ31[i]);
+  }
+  for (i = 0u; (i < BENCH_NUM_LENGTHS) && (cfftQ15[i]->fftLen <= BENCH_MAX_LEN); i++)
+  {
+    fails += bench_cfft_q15(cfftQ15[i]);
+  }
+  for (i = 32u; i <= 2u * BENCH_MAX_LEN && i <= 4096u; i *= 2u)
+  {
+    fails += bench_rfft_f32(i);
+  }
+  BENCH_PRINTF("%d check(s) failed\r\n", fails);
+
+  return (fails);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+int main(void)
+{
+  BOARD_InitPins();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  /* Start the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_PRINTF("CMSIS DSP FFT table generator check, core clock %u Hz\r\n", (unsigned) SystemCoreClock);
+  bench_run();
+
+  while (1)
+  {
+  }
+}
+
+#else
+
+int main(void)
+{
+  BENCH_PRINTF("CMSIS DSP FFT table generator check\n");
+
+  return (bench_run());
+}
+
+#endif
@@ -0,0 +1,504 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_resample_bench.c
+*
+* Description:  Rational resampler against the FIR interpolator and decimator.
+*
+* Target Processor: Cortex-M4 with FPU, or x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+
+/*
+* Checks and times the rational resampler arm_fir_resample_*() of
+* FilteringFunctions in float32_t and q31_t, for the factors that bring the
+* sensor streams onto the fusion timebase:
+*
+*   1/4  200 Hz accelerometer to 50 Hz fusion
+*   1/8  400 Hz gyroscope to 50 Hz fusion
+*   2/5  200 Hz accelerometer to 80 Hz
+*   3/4  400 Hz gyroscope to 300 Hz
+*   5/4  40 Hz magnetometer to 50 Hz fusion
+*   4/1  interpolation only
+*
+* Every output must be equal to that of arm_fir_interpolate_*() followed by
+* keeping the upsampled samples 0, M, 2M, ..., and with L=1 to that of
+* arm_fir_decimate_*().  The stream of BENCH_LEN samples is also processed in
+* bursts of 0 to BENCH_CHUNK samples, as read from a FIFO, which must give
+* the outputs of one call.  The filters are Hamming windowed sincs of
+* BENCH_TAPS_PER_RATIO*max(L, M) taps, rounded up to a multiple of L, with the
+* cutoff at 0.9 of the lower Nyquist frequency; the q31 coefficients are at
+* half gain for the Q31 range.
+*
+* When the output rate is the lower one, the attenuation of a tone at 0.6 of
+* the output sample rate, which aliases to 0.4 of it, is printed beside that
+* of the mean of the inputs since the previous output, which is what
+* processAccelData() and friends compute from a FIFO read.
+*
+* The times are those of BENCH_BLOCK inputs, for the resampler and for the
+* interpolator that computes all of the upsampled samples.
+*
+* Host: built by the CMakeLists.txt in CMSIS/DSP_Lib and run by CTest; the
+* exit status is the number of cases whose outputs differ and the times
+* are in nanoseconds.
+*
+* Target: build this file with -DARM_DSP_BENCH_TARGET into a FRDM-KV31F
+* project as for arm_dsp_bench.c.  The times are in core clock cycles from
+* the DWT cycle counter and the results are printed on the debug console.
+*/
+
+#include <math.h>
+#include "arm_math.h"
+
+#if defined(ARM_DSP_BENCH_TARGET)
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#define BENCH_PRINTF            PRINTF
+#else
+#include <stdio.h>
+#include <time.h>
+#define BENCH_PRINTF            printf
+#endif
+
+#define BENCH_LEN               960u            /* samples in the stream, a multiple of every M */
+#define BENCH_CHUNK             11u             /* largest burst while checking */
+#define BENCH_BLOCK             256u            /* samples per timed run */
+#define BENCH_TAPS_PER_RATIO    16u             /* filter taps per unit of max(L, M) */
+#define BENCH_MAX_L             5u              /* largest interpolation factor */
+#define BENCH_MAX_M             8u              /* largest decimation factor */
+#define BENCH_MAX_TAPS          (BENCH_TAPS_PER_RATIO * BENCH_MAX_M + BENCH_MAX_L)
+#define BENCH_MAX_OUT           (BENCH_LEN * BENCH_MAX_L)
+#define BENCH_PI                3.14159265358979323846
+
+/**
+ * @brief Resampling factors under test.
+ */
+typedef struct
+{
+  uint8_t L;                                     /* interpolation factor */
+  uint8_t M;                                     /* decimation factor */
+  const char *use;                               /* sensor stream */
+} bench_case;
+
+static const bench_case benchCases[] =
+{
+  { 1u, 4u, "accel 200->50" },
+  { 1u, 8u, "gyro 400->50" },
+  { 2u, 5u, "accel 200->80" },
+  { 3u, 4u, "gyro 400->300" },
+  { 5u, 4u, "mag 40->50" },
+  { 4u, 1u, "interpolate" }
+};
+
+/* Inputs */
+static float32_t fX[BENCH_LEN];
+static q31_t iX31[BENCH_LEN];
+
+/* Coefficients in time reversed order */
+static float32_t fB[BENCH_MAX_TAPS];
+static q31_t iB31[BENCH_MAX_TAPS];
+
+/* Outputs of one call (o), of bursts (c) and of the reference (r) */
+static float32_t fO[BENCH_MAX_OUT], fC[BENCH_MAX_OUT], fR[BENCH_MAX_OUT];
+static q31_t iO31[BENCH_MAX_OUT], iC31[BENCH_MAX_OUT], iR31[BENCH_MAX_OUT];
+
+/* States and instances */
+static float32_t fState[BENCH_LEN + BENCH_MAX_TAPS];
+static q31_t iState31[BENCH_LEN + BENCH_MAX_TAPS];
+static arm_fir_resample_instance_f32 resF32;
+static arm_fir_resample_instance_q31 resQ31;
+static arm_fir_interpolate_instance_f32 intF32;
+static arm_fir_interpolate_instance_q31 intQ31;
+static arm_fir_decimate_instance_f32 decF32;
+static arm_fir_decimate_instance_q31 decQ31;
+
+/* Case under test */
+static const bench_case *benchCase;
+static uint16_t benchTaps;
+
+/**
+ * @brief Fixed pseudo random inputs.
+ */
+static void bench_inputs(
+  void)
+{
+  uint32_t seed = 2017u;                         /* linear congruential generator */
+  uint32_t i;                                    /* loop counter */
+  float32_t x;                                   /* value in [-1, 1) */
+
+  for (i = 0u; i < BENCH_LEN; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x = (float32_t) ((int32_t) seed) / 2147483648.0f;
+    fX[i] = 0.5f * x;
+    iX31[i] = (q31_t) (x * 67108864.0f);
+  }
+}
+
+/**
+ * @brief Hamming windowed sinc of gain L, in time reversed order.
+ */
+static void bench_coeffs(
+  void)
+{
+  uint32_t L = benchCase->L, M = benchCase->M;   /* factors */
+  uint32_t i;                                    /* loop counter */
+  double fc, t, b;                               /* cutoff (cycles per upsampled sample), time and coefficient */
+
+  benchTaps = (uint16_t) (BENCH_TAPS_PER_RATIO * ((L > M) ? L : M));
+  benchTaps = (uint16_t) (((benchTaps + L - 1u) / L) * L);
+  fc = 0.45 / (double) ((L > M) ? L : M);
+  for (i = 0u; i < benchTaps; i++)
+  {
+    t = (double) i - 0.5 * (double) (benchTaps - 1u);
+    b = (t == 0.0) ? 2.0 * fc : sin(2.0 * BENCH_PI * fc * t) / (BENCH_PI * t);
+    b *= (double) L * (0.54 - 0.46 * cos(2.0 * BENCH_PI * (double) i / (double) (benchTaps - 1u)));
+    fB[benchTaps - 1u - i] = (float32_t) b;
+    iB31[benchTaps - 1u - i] = (q31_t) (0.5 * b * 2147483648.0);
+  }
+}
+
+/**
+ * @brief Outputs of the interpolator followed by keeping every M-th sample, the count is returned.
+ */
+static uint32_t bench_reference(
+  void)
+{
+  uint32_t L = benchCase->L, M = benchCase->M;   /* factors */
+  uint32_t i, n = 0u;                            /* loop counter and outputs */
+
+  arm_fir_interpolate_init_f32(&intF32, (uint8_t) L, benchTaps, fB, fState, BENCH_LEN);
+  arm_fir_interpolate_f32(&intF32, fX, fO, BENCH_LEN);
+  arm_fir_interpolate_init_q31(&intQ31, (uint8_t) L, benchTaps, iB31, iState31, BENCH_LEN);
+  arm_fir_interpolate_q31(&intQ31, iX31, iO31, BENCH_LEN);
+
+  for (i = 0u; i < BENCH_LEN * L; i += M)
+  {
+    fR[n] = fO[i];
+    iR31[n] = iO31[i];
+    n++;
+  }
+
+  return (n);
+}
+
+/**
+ * @brief Number of the outputs of both types that differ from the reference.
+ */
+static uint32_t bench_differ(
+  const float32_t *pF,
+  const q31_t *pI,
+  uint32_t count)
+{
+  uint32_t i, diff = 0u;                         /* loop counter and differing outputs */
+
+  for (i = 0u; i < count; i++)
+  {
+    diff += (pF[i] != fR[i]) ? 1u : 0u;
+    diff += (pI[i] != iR31[i]) ? 1u : 0u;
+  }
+
+  return (diff);
+}
+
+/**
+ * @brief Checks the resampler of the case under test, the number of differing outputs is returned.
+ */
+static uint32_t bench_check(
+  void)
+{
+  uint32_t L = benchCase->L, M = benchCase->M;   /* factors */
+  uint32_t count, n, len, burst, outF, outI;     /* outputs, input position, burst and output positions */
+  uint32_t diff = 0u;                            /* differing outputs */
+
+  count = bench_reference();
+
+  /* One call */
+  arm_fir_resample_init_f32(&resF32, (uint8_t) L, (uint8_t) M, benchTaps, fB, fState, BENCH_LEN);
+  arm_fir_resample_init_q31(&resQ31, (uint8_t) L, (uint8_t) M, benchTaps, iB31, iState31, BENCH_LEN);
+  outF = arm_fir_resample_f32(&resF32, fX, fO, BENCH_LEN);
+  outI = arm_fir_resample_q31(&resQ31, iX31, iO31, BENCH_LEN);
+  diff += (outF != count) + (outI != count);
+  diff += bench_differ(fO, iO31, count);
+
+  /* FIFO bursts of 0 to BENCH_CHUNK samples */
+  arm_fir_resample_init_f32(&resF32, (uint8_t) L, (uint8_t) M, benchTaps, fB, fState, BENCH_CHUNK);
+  arm_fir_resample_init_q31(&resQ31, (uint8_t) L, (uint8_t) M, benchTaps, iB31, iState31, BENCH_CHUNK);
+  outF = 0u;
+  outI = 0u;
+  for (n = 0u, burst = 0u; n < BENCH_LEN; n += len, burst++)
+  {
+    len = (burst * 7u) % (BENCH_CHUNK + 1u);
+    len = (BENCH_LEN - n < len) ? BENCH_LEN - n : len;
+    outF += arm_fir_resample_f32(&resF32, &fX[n], &fC[outF], len);
+    outI += arm_fir_resample_q31(&resQ31, &iX31[n], &iC31[outI], len);
+  }
+  diff += (outF != count) + (outI != count);
+  diff += bench_differ(fC, iC31, count);
+
+  /* Without interpolation, the decimator */
+  if (L == 1u)
+  {
+    arm_fir_decimate_init_f32(&decF32, benchTaps, (uint8_t) M, fB, fState, BENCH_LEN);
+    arm_fir_decimate_f32(&decF32, fX, fC, BENCH_LEN);
+    arm_fir_decimate_init_q31(&decQ31, benchTaps, (uint8_t) M, iB31, iState31, BENCH_LEN);
+    arm_fir_decimate_q31(&decQ31, iX31, iC31, BENCH_LEN);
+    diff += bench_differ(fC, iC31, BENCH_LEN / M);
+  }
+
+  return (diff);
+}
+
+/**
+ * @brief Attenuation (dB) of a tone at 3/4 of the output sample rate, resampled (*pRes) and box averaged (*pBox).
+ */
+static void bench_alias(
+  double *pRes,
+  double *pBox)
+{
+  uint32_t L = benchCase->L, M = benchCase->M;   /* factors */
+  uint32_t i, k, count, first, last, skip;       /* loop counters, outputs, inputs of a box and settling outputs */
+  double f, acc, res = 0.0, box = 0.0;           /* tone (cycles per input), box mean and mean squares */
+
+  f = 0.6 * (double) L / (double) M;
+  for (i = 0u; i < BENCH_LEN; i++)
+  {
+    fC[i] = (float32_t) sin(2.0 * BENCH_PI * f * (double) i);
+  }
+
+  arm_fir_resample_init_f32(&resF32, (uint8_t) L, (uint8_t) M, benchTaps, fB, fState, BENCH_LEN);
+  count = arm_fir_resample_f32(&resF32, fC, fO, BENCH_LEN);
+
+  /* After the filter has settled */
+  skip = benchTaps / M + 1u;
+  for (k = skip; k < count; k++)
+  {
+    res += (double) fO[k] * (double) fO[k];
+  }
+  res /= (double) (count - skip);
+
+  /* Mean of the inputs since the previous output, as the fusion averages a FIFO read */
+  for (k = 1u; k < count; k++)
+  {
+    first = ((k - 1u) * M) / L + 1u;
+    last = (k * M) / L;
+    acc = 0.0;
+    for (i = first; i <= last; i++)
+    {
+      acc += (double) fC[i];
+    }
+    acc /= (double) (last + 1u - first);
+    box += acc * acc;
+  }
+  box /= (double) (count - 1u);
+
+  /* Relative to the mean square of the tone, 1/2 */
+  *pRes = -10.0 * log10(2.0 * res + 1.0e-30);
+  *pBox = -10.0 * log10(2.0 * box + 1.0e-30);
+}
+
+static void run_resample_f32(void)
+{
+  arm_fir_resample_f32(&resF32, fX, fO, BENCH_BLOCK);
+}
+
+static void run_resample_q31(void)
+{
+  arm_fir_resample_q31(&resQ31, iX31, iO31, BENCH_BLOCK);
+}
+
+static void run_interpolate_f32(void)
+{
+  arm_fir_interpolate_f32(&intF32, fX, fO, BENCH_BLOCK);
+}
+
+static void run_interpolate_q31(void)
+{
+  arm_fir_interpolate_q31(&intQ31, iX31, iO31, BENCH_BLOCK);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+/**
+ * @brief Core clock cycles of one run, after a warm-up run.
+ */
+static uint32_t bench_time(
+  void (*pRun)(void))
+{
+  uint32_t start;                                /* cycle counter at the start */
+
+  pRun();
+  start = DWT->CYCCNT;
+  pRun();
+  return (DWT->CYCCNT - start);
+}
+
+#else
+
+static double bench_seconds(
+  void)
+{
+  struct timespec t;                             /* monotonic time */
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return ((double) t.tv_sec + 1.0e-9 * (double) t.tv_nsec);
+}
+
+/**
+ * @brief Nanoseconds of one run, the best of five batches of at least 2 ms.
+ */
+static uint32_t bench_time(
+  void (*pRun)(void))
+{
+  uint32_t reps = 1u, i, batch;                  /* repetitions and loop counters */
+  double start, elapsed, best = 1.0e9;           /* times */
+
+  pRun();
+  for (batch = 0u; batch < 5u; batch++)
+  {
+    do
+    {
+      start = bench_seconds();
+      for (i = 0u; i < reps; i++)
+      {
+        pRun();
+      }
+      elapsed = bench_seconds() - start;
+      if (elapsed < 0.002)
+      {
+        reps *= 2u;
+      }
+    } while ((elapsed < 0.002) && (reps < (1u << 30)));
+
+    elapsed /= (double) reps;
+    best = (elapsed < best) ? elapsed : best;
+  }
+
+  return ((uint32_t) (best * 1.0e9 + 0.5));
+}
+
+#endif
+
+/**
+ * @brief Checks and times every case.
+ * @return number of cases whose outputs differ.
+ */
+static int bench_run(
+  void)
+{
+  uint32_t c;                                    /* case */
+  uint32_t diff;                                 /* differing outputs */
+  uint32_t timeF, timeQ, timeIF, timeIQ;         /* times of the resampler and of the interpolator */
+  double res, box;                               /* attenuations of the alias tone (dB) */
+  int fails = 0;                                 /* cases that differ */
+
+  bench_inputs();
+
+#if defined(ARM_DSP_BENCH_TARGET)
+  BENCH_PRINTF("\r\ntime of %u inputs, cycles\r\n", (unsigned) BENCH_BLOCK);
+#else
+  BENCH_PRINTF("\r\ntime of %u inputs, ns\r\n", (unsigned) BENCH_BLOCK);
+#endif
+  BENCH_PRINTF("%-14s %3s %4s %8s %8s %8s %8s %9s %9s  %s\r\n", "stream", "L/M", "taps", "interp", "resample",
+               "interp", "resample", "alias dB", "box dB", "result");
+  BENCH_PRINTF("%-14s %3s %4s %8s %8s %8s %8s\r\n", "", "", "", "f32", "f32", "q31", "q31");
+  for (c = 0u; c < sizeof(benchCases) / sizeof(benchCases[0]); c++)
+  {
+    benchCase = &benchCases[c];
+    bench_coeffs();
+
+    diff = bench_check();
+    fails += (diff > 0u) ? 1 : 0;
+
+    /* Timed on the first BENCH_BLOCK inputs */
+    arm_fir_interpolate_init_f32(&intF32, benchCase->L, benchTaps, fB, fState, BENCH_BLOCK);
+    timeIF = bench_time(run_interpolate_f32);
+    arm_fir_interpolate_init_q31(&intQ31, benchCase->L, benchTaps, iB31, iState31, BENCH_BLOCK);
+    timeIQ = bench_time(run_interpolate_q31);
+    arm_fir_resample_init_f32(&resF32, benchCase->L, benchCase->M, benchTaps, fB, fState, BENCH_BLOCK);
+    timeF = bench_time(run_resample_f32);
+    arm_fir_resample_init_q31(&resQ31, benchCase->L, benchCase->M, benchTaps, iB31, iState31, BENCH_BLOCK);
+    timeQ = bench_time(run_resample_q31);
+
+    BENCH_PRINTF("%-14s %u/%u %4u %8u %8u %8u %8u ", benchCase->use, (unsigned) benchCase->L,
+                 (unsigned) benchCase->M, (unsigned) benchTaps, (unsigned) timeIF, (unsigned) timeF,
+                 (unsigned) timeIQ, (unsigned) timeQ);
+    if (6u * benchCase->L < 5u * benchCase->M)
+    {
+      /* The target printf has no floating-point support, so the attenuations are printed in tenths */
+      bench_alias(&res, &box);
+      BENCH_PRINTF("%7d.%u %7d.%u  ", (int) res, (unsigned) ((res - (double) (int) res) * 10.0),
+                   (int) box, (unsigned) ((box - (double) (int) box) * 10.0));
+    }
+    else
+    {
+      BENCH_PRINTF("%9s %9s  ", "-", "-");
+    }
+    BENCH_PRINTF("%s\r\n", (diff > 0u) ? "DIFFER" : "equal");
+  }
+  BENCH_PRINTF("%d case(s) differ from the interpolator and decimator\r\n", fails);
+
+  return (fails);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+int main(void)
+{
+  BOARD_InitPins();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  /* Start the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_PRINTF("CMSIS DSP rational resampler benchmark, core clock %u Hz\r\n", (unsigned) SystemCoreClock);
+  bench_run();
+
+  while (1)
+  {
+  }
+}
+
+#else
+
+int main(void)
+{
+  BENCH_PRINTF("CMSIS DSP rational resampler benchmark\n");
+
+  return (bench_run());
+}
+
+#endif
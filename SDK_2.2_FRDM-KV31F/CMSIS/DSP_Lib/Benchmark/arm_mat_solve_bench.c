@@ -0,0 +1,470 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_solve_bench.c
+*
+* Description:  Symmetric positive definite solvers against the matrix inverse.
+*
+* Target Processor: Cortex-M4 with FPU, or x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+* Solves A * x = b for symmetric positive definite matrices of size 3 to 12,
+* the range of the sensor fusion covariance and calibration matrices, in
+* four ways and prints the time and the backward error of each:
+*
+*   inverse    arm_mat_inverse_f32(), then x = inv(A) * b
+*   chol       arm_mat_cholesky_f32() and two triangular solves
+*   ldlt       arm_mat_ldlt_f32(), two triangular solves and a diagonal scaling
+*   chol_f64   arm_mat_cholesky_f64() and the substitutions in float64_t
+*
+* followed by the inverse itself: arm_mat_inverse_f32() against the
+* Cholesky factor and the triangular solvers with the identity matrix as
+* right hand side.  The backward error is |A * x - b| / (|A| * |x| + |b|)
+* in the infinity norm, and |A * X - I| / (|A| * |X|) for the inverses.
+*
+* Host: built by the CMakeLists.txt in CMSIS/DSP_Lib and run by CTest; the
+* exit status is the number of solutions whose error exceeds the limit and
+* the times are in microseconds.
+*
+* Target: build this file with -DARM_DSP_BENCH_TARGET into a FRDM-KV31F
+* project as for arm_dsp_bench.c.  The times are in core clock cycles from
+* the DWT cycle counter and the results are printed on the debug console.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "arm_math.h"
+
+#if defined(ARM_DSP_BENCH_TARGET)
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#define BENCH_PRINTF            PRINTF
+#else
+#include <stdio.h>
+#include <time.h>
+#define BENCH_PRINTF            printf
+#endif
+
+#define BENCH_MIN_SIZE          3u
+#define BENCH_MAX_SIZE          12u
+#define BENCH_NUM_METHODS       6u
+#define BENCH_LIMIT_F32         1.0e-6          /* backward error limit of the float32_t methods */
+#define BENCH_LIMIT_F64         1.0e-14         /* backward error limit of the float64_t method */
+
+#define N2 (BENCH_MAX_SIZE * BENCH_MAX_SIZE)
+
+static const char *const benchMethod[BENCH_NUM_METHODS] =
+{
+  "inverse", "chol", "ldlt", "chol_f64", "inv_f32", "inv_chol"
+};
+
+/* Problem, factors and solutions */
+static float32_t fA[N2], fW[N2], fL[N2], fLT[N2], fD[N2], fX[N2], fY[N2], fI[N2];
+static float32_t fb[BENCH_MAX_SIZE], fx[BENCH_MAX_SIZE], fy[BENCH_MAX_SIZE];
+static float64_t dA[N2], dL[N2], db[BENCH_MAX_SIZE], dx[BENCH_MAX_SIZE];
+static uint16_t perm[BENCH_MAX_SIZE];
+static arm_matrix_instance_f32 matA, matW, matL, matLT, matD, matX, matY, matI, vecB, vecX, vecY;
+static arm_matrix_instance_f64 matA64, matL64;
+static uint32_t benchN;                          /* size under test */
+static arm_status benchStatus;                   /* status of the last run */
+
+/**
+ * @brief Builds A = M * M^T + n/4 * I and b from a fixed pseudo random M and b.
+ */
+static void bench_problem(
+  uint32_t n)
+{
+  static float64_t m[N2];                        /* random factor */
+  uint32_t seed = 2017u + n;                     /* linear congruential generator */
+  uint32_t i, j, k;                              /* loop counters */
+  float64_t sum;                                 /* accumulator */
+
+  for (i = 0u; i < n * n; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    m[i] = ((float64_t) (seed >> 8) / 16777216.0) - 0.5;
+  }
+
+  for (i = 0u; i < n; i++)
+  {
+    for (j = 0u; j < n; j++)
+    {
+      sum = (i == j) ? 0.25 * (float64_t) n : 0.0;
+      for (k = 0u; k < n; k++)
+      {
+        sum += m[(i * n) + k] * m[(j * n) + k];
+      }
+      fA[(i * n) + j] = (float32_t) sum;
+      fI[(i * n) + j] = (i == j) ? 1.0f : 0.0f;
+    }
+    seed = seed * 1664525u + 1013904223u;
+    fb[i] = (float32_t) (((float64_t) (seed >> 8) / 16777216.0) - 0.5);
+  }
+
+  /* The float64_t problem is the float32_t one, so that the errors compare */
+  for (i = 0u; i < n * n; i++)
+  {
+    dA[i] = (float64_t) fA[i];
+  }
+  for (i = 0u; i < n; i++)
+  {
+    db[i] = (float64_t) fb[i];
+  }
+
+  arm_mat_init_f32(&matA, (uint16_t) n, (uint16_t) n, fA);
+  arm_mat_init_f32(&matW, (uint16_t) n, (uint16_t) n, fW);
+  arm_mat_init_f32(&matL, (uint16_t) n, (uint16_t) n, fL);
+  arm_mat_init_f32(&matLT, (uint16_t) n, (uint16_t) n, fLT);
+  arm_mat_init_f32(&matD, (uint16_t) n, (uint16_t) n, fD);
+  arm_mat_init_f32(&matX, (uint16_t) n, (uint16_t) n, fX);
+  arm_mat_init_f32(&matY, (uint16_t) n, (uint16_t) n, fY);
+  arm_mat_init_f32(&matI, (uint16_t) n, (uint16_t) n, fI);
+  arm_mat_init_f32(&vecB, (uint16_t) n, 1u, fb);
+  arm_mat_init_f32(&vecX, (uint16_t) n, 1u, fx);
+  arm_mat_init_f32(&vecY, (uint16_t) n, 1u, fy);
+  matA64.numRows = (uint16_t) n;
+  matA64.numCols = (uint16_t) n;
+  matA64.pData = dA;
+  matL64.numRows = (uint16_t) n;
+  matL64.numCols = (uint16_t) n;
+  matL64.pData = dL;
+  benchN = n;
+}
+
+/* x = inv(A) * b; the inverse destroys its input, so A is copied first */
+static void run_inverse(void)
+{
+  arm_copy_f32(fA, fW, benchN * benchN);
+  benchStatus = arm_mat_inverse_f32(&matW, &matX);
+  arm_mat_mult_f32(&matX, &vecB, &vecX);
+}
+
+/* A = L * L^T: L * y = b, then L^T * x = y */
+static void run_chol(void)
+{
+  benchStatus = arm_mat_cholesky_f32(&matA, &matL);
+  arm_mat_solve_lower_triangular_f32(&matL, &vecB, &vecY);
+  arm_mat_trans_f32(&matL, &matLT);
+  arm_mat_solve_upper_triangular_f32(&matLT, &vecY, &vecX);
+}
+
+/* P * A * P^T = L * D * L^T: L * y = P * b, D * z = y, L^T * P * x = z */
+static void run_ldlt(void)
+{
+  uint32_t i;                                    /* loop counter */
+
+  benchStatus = arm_mat_ldlt_f32(&matA, &matL, &matD, perm);
+  for (i = 0u; i < benchN; i++)
+  {
+    fx[i] = fb[perm[i]];
+  }
+  arm_mat_solve_lower_triangular_f32(&matL, &vecX, &vecY);
+  for (i = 0u; i < benchN; i++)
+  {
+    fy[i] /= fD[(i * benchN) + i];
+  }
+  arm_mat_trans_f32(&matL, &matLT);
+  arm_mat_solve_upper_triangular_f32(&matLT, &vecY, &vecY);
+  for (i = 0u; i < benchN; i++)
+  {
+    fx[perm[i]] = fy[i];
+  }
+}
+
+/* Cholesky decomposition and substitutions in float64_t */
+static void run_chol_f64(void)
+{
+  uint32_t n = benchN, i, k;                     /* size and loop counters */
+  float64_t sum;                                 /* accumulator */
+
+  benchStatus = arm_mat_cholesky_f64(&matA64, &matL64);
+  for (i = 0u; i < n; i++)
+  {
+    sum = db[i];
+    for (k = 0u; k < i; k++)
+    {
+      sum -= dL[(i * n) + k] * dx[k];
+    }
+    dx[i] = sum / dL[(i * n) + i];
+  }
+  for (i = n; i-- > 0u; )
+  {
+    sum = dx[i];
+    for (k = i + 1u; k < n; k++)
+    {
+      sum -= dL[(k * n) + i] * dx[k];
+    }
+    dx[i] = sum / dL[(i * n) + i];
+  }
+}
+
+/* X = inv(A) by Gauss-Jordan */
+static void run_inv_f32(void)
+{
+  arm_copy_f32(fA, fW, benchN * benchN);
+  benchStatus = arm_mat_inverse_f32(&matW, &matX);
+}
+
+/* X = inv(A) from the Cholesky factor: L * Y = I, then L^T * X = Y */
+static void run_inv_chol(void)
+{
+  benchStatus = arm_mat_cholesky_f32(&matA, &matL);
+  arm_mat_solve_lower_triangular_f32(&matL, &matI, &matY);
+  arm_mat_trans_f32(&matL, &matLT);
+  arm_mat_solve_upper_triangular_f32(&matLT, &matY, &matX);
+}
+
+static void (*const benchRun[BENCH_NUM_METHODS])(void) =
+{
+  run_inverse, run_chol, run_ldlt, run_chol_f64, run_inv_f32, run_inv_chol
+};
+
+/**
+ * @brief Backward error of the last solution of the given method.
+ */
+static float64_t bench_error(
+  uint32_t method)
+{
+  uint32_t n = benchN, i, j, k;                  /* size and loop counters */
+  float64_t r, normA = 0.0, normX = 0.0, normB = 0.0, normR = 0.0, rowA, rowX;  /* norms */
+
+  for (i = 0u; i < n; i++)
+  {
+    rowA = 0.0;
+    rowX = 0.0;
+    for (j = 0u; j < n; j++)
+    {
+      rowA += fabs(dA[(i * n) + j]);
+      rowX += fabs((float64_t) fX[(i * n) + j]);
+    }
+    normA = (rowA > normA) ? rowA : normA;
+    normX = (rowX > normX) ? rowX : normX;
+  }
+
+  if(method >= 4u)
+  {
+    /* Inverse: |A * X - I| / (|A| * |X|) */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j < n; j++)
+      {
+        r = (i == j) ? -1.0 : 0.0;
+        for (k = 0u; k < n; k++)
+        {
+          r += dA[(i * n) + k] * (float64_t) fX[(k * n) + j];
+        }
+        normR = (fabs(r) > normR) ? fabs(r) : normR;
+      }
+    }
+    return (normR / (normA * normX));
+  }
+
+  normX = 0.0;
+  for (i = 0u; i < n; i++)
+  {
+    r = -db[i];
+    for (k = 0u; k < n; k++)
+    {
+      r += dA[(i * n) + k] * ((method == 3u) ? dx[k] : (float64_t) fx[k]);
+    }
+    normR = (fabs(r) > normR) ? fabs(r) : normR;
+    r = (method == 3u) ? dx[i] : (float64_t) fx[i];
+    normX = (fabs(r) > normX) ? fabs(r) : normX;
+    normB = (fabs(db[i]) > normB) ? fabs(db[i]) : normB;
+  }
+  return (normR / (normA * normX + normB));
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+/**
+ * @brief Core clock cycles of one run, after a warm-up run.
+ */
+static uint32_t bench_time(
+  uint32_t method)
+{
+  uint32_t start;                                /* cycle counter at the start */
+
+  benchRun[method]();
+  start = DWT->CYCCNT;
+  benchRun[method]();
+  return (DWT->CYCCNT - start);
+}
+
+#else
+
+static float64_t bench_seconds(
+  void)
+{
+  struct timespec t;                             /* monotonic time */
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return ((float64_t) t.tv_sec + 1.0e-9 * (float64_t) t.tv_nsec);
+}
+
+/**
+ * @brief Nanoseconds of one run, the best of five batches of at least 2 ms.
+ */
+static uint32_t bench_time(
+  uint32_t method)
+{
+  uint32_t reps = 1u, i, batch;                  /* repetitions and loop counters */
+  float64_t start, elapsed, best = 1.0e9;        /* times */
+
+  benchRun[method]();
+  for (batch = 0u; batch < 5u; batch++)
+  {
+    do
+    {
+      start = bench_seconds();
+      for (i = 0u; i < reps; i++)
+      {
+        benchRun[method]();
+      }
+      elapsed = bench_seconds() - start;
+      if(elapsed < 0.002)
+      {
+        reps *= 2u;
+      }
+    } while((elapsed < 0.002) && (reps < (1u << 30)));
+
+    elapsed /= (float64_t) reps;
+    best = (elapsed < best) ? elapsed : best;
+  }
+
+  return ((uint32_t) (best * 1.0e9 + 0.5));
+}
+
+#endif
+
+/**
+ * @brief Prints the times and errors for every size.
+ * @return number of solutions above their error limit.
+ */
+static int bench_run(
+  void)
+{
+  uint32_t n, method;                            /* size and method */
+  float64_t err, limit;                          /* backward error and its limit */
+  int32_t exponent;                              /* decimal exponent of the error */
+  int fails = 0;                                 /* solutions above the limit */
+
+#if defined(ARM_DSP_BENCH_TARGET)
+  BENCH_PRINTF("\r\ntime, cycles\r\n");
+#else
+  BENCH_PRINTF("\r\ntime, ns\r\n");
+#endif
+  BENCH_PRINTF("%4s", "n");
+  for (method = 0u; method < BENCH_NUM_METHODS; method++)
+  {
+    BENCH_PRINTF(" %9s", benchMethod[method]);
+  }
+  BENCH_PRINTF("\r\n");
+  for (n = BENCH_MIN_SIZE; n <= BENCH_MAX_SIZE; n++)
+  {
+    bench_problem(n);
+    BENCH_PRINTF("%4u", (unsigned) n);
+    for (method = 0u; method < BENCH_NUM_METHODS; method++)
+    {
+      BENCH_PRINTF(" %9u", (unsigned) bench_time(method));
+    }
+    BENCH_PRINTF("\r\n");
+  }
+
+  /* The target printf has no floating-point support, so the errors are printed as powers of ten */
+  BENCH_PRINTF("\r\nbackward error, log10\r\n");
+  BENCH_PRINTF("%4s", "n");
+  for (method = 0u; method < BENCH_NUM_METHODS; method++)
+  {
+    BENCH_PRINTF(" %9s", benchMethod[method]);
+  }
+  BENCH_PRINTF("\r\n");
+  for (n = BENCH_MIN_SIZE; n <= BENCH_MAX_SIZE; n++)
+  {
+    bench_problem(n);
+    BENCH_PRINTF("%4u", (unsigned) n);
+    for (method = 0u; method < BENCH_NUM_METHODS; method++)
+    {
+      benchRun[method]();
+      err = bench_error(method);
+      limit = (method == 3u) ? BENCH_LIMIT_F64 : BENCH_LIMIT_F32;
+      exponent = (err > 0.0) ? (int32_t) floor(log10(err)) : -99;
+      if((benchStatus != ARM_MATH_SUCCESS) || !(err <= limit))
+      {
+        fails++;
+        BENCH_PRINTF(" %7d *", (int) exponent);
+      }
+      else
+      {
+        BENCH_PRINTF(" %9d", (int) exponent);
+      }
+    }
+    BENCH_PRINTF("\r\n");
+  }
+  BENCH_PRINTF("%d solution(s) above the error limit\r\n", fails);
+
+  return (fails);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+int main(void)
+{
+  BOARD_InitPins();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  /* Start the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_PRINTF("CMSIS DSP SPD solver benchmark, core clock %u Hz\r\n", (unsigned) SystemCoreClock);
+  bench_run();
+
+  while (1)
+  {
+  }
+}
+
+#else
+
+int main(void)
+{
+  BENCH_PRINTF("CMSIS DSP SPD solver benchmark\n");
+
+  return (bench_run());
+}
+
+#endif
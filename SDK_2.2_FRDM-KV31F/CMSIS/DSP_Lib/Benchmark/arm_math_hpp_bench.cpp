@@ -0,0 +1,448 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_math_hpp_bench.cpp
+*
+* Description:  Compile-time sized C++ filters and matrices against the C functions.
+*
+* Target Processor: Cortex-M4 with FPU, or x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+
+/*
+* Times the templates of arm_math.hpp against the C functions they replace,
+* for the FIR filters up to 32 taps, the biquad cascades of a control loop
+* and the small matrix products of the sensor fusion:
+*
+*   fir_f32, fir_q31        Fir<N, T> against arm_fir_f32() and arm_fir_q31()
+*   biquad_f32, biquad_q31  Biquad<Stages, T> against arm_biquad_cascade_df1_f32() and _q31()
+*   mat_mult_f32            Mat<N, N> products against arm_mat_mult_f32()
+*
+* Each filter processes BENCH_BLOCK samples, once one sample per call, as
+* the ROBOT filter.c does, and once in a single call.  Every output of the
+* templates must be equal to the output of the C function.
+*
+* Host: built by the CMakeLists.txt in CMSIS/DSP_Lib and run by CTest; the
+* exit status is the number of results that differ and the times are in
+* nanoseconds.
+*
+* Target: build this file with -DARM_DSP_BENCH_TARGET into a FRDM-KV31F
+* project as for arm_dsp_bench.c.  The times are in core clock cycles from
+* the DWT cycle counter and the results are printed on the debug console.
+*/
+
+#include <string.h>
+#include "arm_math.hpp"
+
+#if defined(ARM_DSP_BENCH_TARGET)
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#define BENCH_PRINTF            PRINTF
+#else
+#include <stdio.h>
+#include <time.h>
+#define BENCH_PRINTF            printf
+#endif
+
+#define BENCH_BLOCK             32u             /* samples per timed run */
+#define BENCH_MAX_TAPS          32u
+
+/* Keeps the compiler from moving a timed computation out of the timing loop */
+#if defined(__GNUC__)
+#define BENCH_BARRIER()         __asm__ volatile("" ::: "memory")
+#else
+#define BENCH_BARRIER()
+#endif
+
+/* Inputs, coefficients and the outputs of the C functions (c) and of the templates (t) */
+static float32_t fX[BENCH_BLOCK], fH[BENCH_MAX_TAPS], fBq[5u * 4u], fYc[BENCH_BLOCK], fYt[BENCH_BLOCK];
+static q31_t iX[BENCH_BLOCK], iH[BENCH_MAX_TAPS], iBq[5u * 4u], iYc[BENCH_BLOCK], iYt[BENCH_BLOCK];
+static float32_t fS[BENCH_MAX_TAPS + BENCH_BLOCK], fSbq[4u * 4u];
+static q31_t iS[BENCH_MAX_TAPS + BENCH_BLOCK], iSbq[4u * 4u];
+static int benchFails;                           /* results that differ */
+
+/* Second order sections of a high pass and a low pass, as in the ROBOT filter.c */
+static const float32_t benchSections[10] =
+{
+  0.4838474f, -0.9676948f, 0.4838474f, 0.9770010f, -0.4773096f,
+  0.5f, -1.0f, 0.5f, 0.9901619f, -0.4904747f
+};
+
+/**
+ * @brief Fixed pseudo random inputs and coefficients.
+ */
+static void bench_inputs(
+  void)
+{
+  uint32_t seed = 2017u;                         /* linear congruential generator */
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    fX[i] = (float32_t) ((int32_t) seed) / 2147483648.0f;
+    iX[i] = ((q31_t) seed) >> 3;
+  }
+  for (i = 0u; i < BENCH_MAX_TAPS; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    fH[i] = (float32_t) ((int32_t) seed) / (2147483648.0f * (float32_t) BENCH_MAX_TAPS);
+    iH[i] = ((q31_t) seed) / (q31_t) BENCH_MAX_TAPS;
+  }
+  /* Two copies of the sections give up to four stages; the q31 sections are scaled by 1/2 with postShift 1 */
+  for (i = 0u; i < 20u; i++)
+  {
+    fBq[i] = benchSections[i % 10u];
+    iBq[i] = (q31_t) (benchSections[i % 10u] * 1073741824.0f);
+  }
+}
+
+/**
+ * @brief Counts the outputs of the template that differ from the outputs of the C function.
+ */
+template<typename T>
+static void bench_check(
+  const char *pName,
+  uint32_t size,
+  const T *pC,
+  const T *pT)
+{
+  uint32_t i;                                    /* loop counter */
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    if (pC[i] != pT[i])
+    {
+      BENCH_PRINTF("%s %u: output %u differs\r\n", pName, (unsigned) size, (unsigned) i);
+      benchFails++;
+      return;
+    }
+  }
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+/**
+ * @brief Core clock cycles of one run, after a warm-up run.
+ */
+template<typename F>
+static uint32_t bench_time(
+  F run)
+{
+  uint32_t start;                                /* cycle counter at the start */
+
+  run();
+  start = DWT->CYCCNT;
+  run();
+  return (DWT->CYCCNT - start);
+}
+
+#else
+
+static double bench_seconds(
+  void)
+{
+  struct timespec t;                             /* monotonic time */
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return ((double) t.tv_sec + 1.0e-9 * (double) t.tv_nsec);
+}
+
+/**
+ * @brief Nanoseconds of one run, the best of five batches of at least 2 ms.
+ */
+template<typename F>
+static uint32_t bench_time(
+  F run)
+{
+  uint32_t reps = 1u, i, batch;                  /* repetitions and loop counters */
+  double start, elapsed, best = 1.0e9;           /* times */
+
+  run();
+  for (batch = 0u; batch < 5u; batch++)
+  {
+    do
+    {
+      start = bench_seconds();
+      for (i = 0u; i < reps; i++)
+      {
+        run();
+      }
+      elapsed = bench_seconds() - start;
+      if (elapsed < 0.002)
+      {
+        reps *= 2u;
+      }
+    } while ((elapsed < 0.002) && (reps < (1u << 30)));
+
+    elapsed /= (double) reps;
+    best = (elapsed < best) ? elapsed : best;
+  }
+
+  return ((uint32_t) (best * 1.0e9 + 0.5));
+}
+
+#endif
+
+/**
+ * @brief Prints one row: the times of the C function and of the template, and their ratio.
+ */
+static void bench_row(
+  const char *pName,
+  uint32_t size,
+  const char *pMode,
+  uint32_t timeC,
+  uint32_t timeT)
+{
+  /* The target printf has no floating-point support, so the speedup is printed in hundredths */
+  uint32_t speedup = (timeT > 0u) ? (uint32_t) (((uint64_t) timeC * 100u + timeT / 2u) / timeT) : 0u;
+
+  BENCH_PRINTF("%-13s %4u %-9s %9u %9u %6u.%02u\r\n", pName, (unsigned) size, pMode, (unsigned) timeC,
+               (unsigned) timeT, (unsigned) (speedup / 100u), (unsigned) (speedup % 100u));
+}
+
+/**
+ * @brief FIR filter of N taps, one sample per call and one call per block.
+ */
+template<uint32_t N, typename T>
+static void bench_fir(
+  const char *pName,
+  const T *pH,
+  T *pS,
+  const T *pX,
+  T *pYc,
+  T *pYt)
+{
+  typedef arm_dsp::detail::Traits<T> traits;
+  typename traits::fir_t S;                      /* C instance */
+  arm_dsp::Fir<N, T> fir(pH);                    /* template */
+  uint32_t timeC, timeT;                         /* times */
+
+  /* One sample per call */
+  auto runC1 = [&]()
+  {
+    for (uint32_t i = 0u; i < BENCH_BLOCK; i++)
+    {
+      traits::fir(&S, const_cast<T *>(&pX[i]), &pYc[i], 1u);
+    }
+  };
+  auto runT1 = [&]()
+  {
+    for (uint32_t i = 0u; i < BENCH_BLOCK; i++)
+    {
+      pYt[i] = fir.step(pX[i]);
+    }
+  };
+  traits::firInit(&S, (uint16_t) N, const_cast<T *>(pH), pS, 1u);
+  fir.reset();
+  runC1();
+  runT1();
+  bench_check(pName, N, pYc, pYt);
+  timeC = bench_time(runC1);
+  timeT = bench_time(runT1);
+  bench_row(pName, N, "sample", timeC, timeT);
+
+  /* The whole block in one call */
+  auto runCB = [&]() { traits::fir(&S, const_cast<T *>(pX), pYc, BENCH_BLOCK); };
+  auto runTB = [&]() { fir.process(pX, pYt, BENCH_BLOCK); };
+  traits::firInit(&S, (uint16_t) N, const_cast<T *>(pH), pS, BENCH_BLOCK);
+  fir.reset();
+  runCB();
+  runTB();
+  bench_check(pName, N, pYc, pYt);
+  timeC = bench_time(runCB);
+  timeT = bench_time(runTB);
+  bench_row(pName, N, "block", timeC, timeT);
+}
+
+/**
+ * @brief Biquad cascade of Stages stages, one sample per call and one call per block.
+ */
+template<uint32_t Stages, typename T>
+static void bench_biquad(
+  const char *pName,
+  const T *pCoeffs,
+  int8_t postShift,
+  T *pS,
+  const T *pX,
+  T *pYc,
+  T *pYt)
+{
+  typedef arm_dsp::detail::Traits<T> traits;
+  typename traits::biquad_t S;                   /* C instance */
+  arm_dsp::Biquad<Stages, T> biquad(pCoeffs, postShift);  /* template */
+  uint32_t timeC, timeT;                         /* times */
+
+  auto runC1 = [&]()
+  {
+    for (uint32_t i = 0u; i < BENCH_BLOCK; i++)
+    {
+      traits::biquad(&S, const_cast<T *>(&pX[i]), &pYc[i], 1u);
+    }
+  };
+  auto runT1 = [&]()
+  {
+    for (uint32_t i = 0u; i < BENCH_BLOCK; i++)
+    {
+      pYt[i] = biquad.step(pX[i]);
+    }
+  };
+  auto runCB = [&]() { traits::biquad(&S, const_cast<T *>(pX), pYc, BENCH_BLOCK); };
+  auto runTB = [&]() { biquad.process(pX, pYt, BENCH_BLOCK); };
+
+  traits::biquadInit(&S, (uint8_t) Stages, const_cast<T *>(pCoeffs), pS, postShift);
+  runC1();
+  runT1();
+  bench_check(pName, Stages, pYc, pYt);
+  timeC = bench_time(runC1);
+  timeT = bench_time(runT1);
+  bench_row(pName, Stages, "sample", timeC, timeT);
+
+  traits::biquadInit(&S, (uint8_t) Stages, const_cast<T *>(pCoeffs), pS, postShift);
+  biquad.reset();
+  runCB();
+  runTB();
+  bench_check(pName, Stages, pYc, pYt);
+  timeC = bench_time(runCB);
+  timeT = bench_time(runTB);
+  bench_row(pName, Stages, "block", timeC, timeT);
+}
+
+/**
+ * @brief Product of two N x N matrices.
+ */
+template<uint32_t N>
+static void bench_mat_mult(
+  void)
+{
+  static arm_dsp::Mat<N, N> a, b, dc, dt;       /* operands and results */
+  arm_matrix_instance_f32 ma, mb, md;            /* C views */
+  uint32_t timeC, timeT;                         /* times */
+
+  for (uint32_t i = 0u; i < N * N; i++)
+  {
+    a.data[i] = fX[i % BENCH_BLOCK];
+    b.data[i] = fX[(i * 7u + 3u) % BENCH_BLOCK];
+  }
+  ma = a.instance();
+  mb = b.instance();
+  md = dc.instance();
+
+  auto runC = [&]() { (void) arm_mat_mult_f32(&ma, &mb, &md); BENCH_BARRIER(); };
+  auto runT = [&]() { arm_dsp::mult(a, b, dt); BENCH_BARRIER(); };
+  runC();
+  runT();
+  for (uint32_t i = 0u; i < N * N; i++)
+  {
+    if (dc.data[i] != dt.data[i])
+    {
+      BENCH_PRINTF("mat_mult_f32 %u: element %u differs\r\n", (unsigned) N, (unsigned) i);
+      benchFails++;
+      break;
+    }
+  }
+  timeC = bench_time(runC);
+  timeT = bench_time(runT);
+  bench_row("mat_mult_f32", N, "product", timeC, timeT);
+}
+
+/**
+ * @brief Prints the times for every size.
+ * @return number of results that differ.
+ */
+static int bench_run(
+  void)
+{
+  bench_inputs();
+  benchFails = 0;
+
+#if defined(ARM_DSP_BENCH_TARGET)
+  BENCH_PRINTF("\r\ntime of %u samples or one product, cycles\r\n", (unsigned) BENCH_BLOCK);
+#else
+  BENCH_PRINTF("\r\ntime of %u samples or one product, ns\r\n", (unsigned) BENCH_BLOCK);
+#endif
+  BENCH_PRINTF("%-13s %4s %-9s %9s %9s %9s\r\n", "function", "size", "calls", "C", "C++", "speedup");
+
+  bench_fir<4u>("fir_f32", fH, fS, fX, fYc, fYt);
+  bench_fir<8u>("fir_f32", fH, fS, fX, fYc, fYt);
+  bench_fir<16u>("fir_f32", fH, fS, fX, fYc, fYt);
+  bench_fir<32u>("fir_f32", fH, fS, fX, fYc, fYt);
+  bench_fir<4u>("fir_q31", iH, iS, iX, iYc, iYt);
+  bench_fir<8u>("fir_q31", iH, iS, iX, iYc, iYt);
+  bench_fir<16u>("fir_q31", iH, iS, iX, iYc, iYt);
+  bench_fir<32u>("fir_q31", iH, iS, iX, iYc, iYt);
+  bench_biquad<1u>("biquad_f32", fBq, 0, fSbq, fX, fYc, fYt);
+  bench_biquad<2u>("biquad_f32", fBq, 0, fSbq, fX, fYc, fYt);
+  bench_biquad<4u>("biquad_f32", fBq, 0, fSbq, fX, fYc, fYt);
+  bench_biquad<2u>("biquad_q31", iBq, 1, iSbq, iX, iYc, iYt);
+  bench_biquad<4u>("biquad_q31", iBq, 1, iSbq, iX, iYc, iYt);
+  bench_mat_mult<3u>();
+  bench_mat_mult<4u>();
+  bench_mat_mult<6u>();
+
+  BENCH_PRINTF("%d result(s) differ from the C functions\r\n", benchFails);
+
+  return (benchFails);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+int main(void)
+{
+  BOARD_InitPins();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  /* Start the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_PRINTF("CMSIS DSP C++ template benchmark, core clock %u Hz\r\n", (unsigned) SystemCoreClock);
+  bench_run();
+
+  while (1)
+  {
+  }
+}
+
+#else
+
+int main(void)
+{
+  BENCH_PRINTF("CMSIS DSP C++ template benchmark\n");
+
+  return (bench_run());
+}
+
+#endif
@@ -0,0 +1,545 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sliding_stats_bench.c
+*
+* Description:  Sliding-window statistics against recomputation over the window.
+*
+* Target Processor: Cortex-M4 with FPU, or x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+
+/*
+* Checks and times the sliding-window statistics of StatisticsFunctions
+* against the block statistics recomputed over the window for every sample:
+*
+*   meanvar  arm_sliding_mean_var_*() against arm_mean_*() and arm_var_*()
+*   rms      arm_sliding_rms_*() against arm_rms_*()
+*   min      arm_sliding_min_*() against arm_min_*()
+*   max      arm_sliding_max_*() against arm_max_*()
+*
+* in float32_t, q31_t and q15_t, for windows of 16 to BENCH_MAX_WIN samples.
+* A stream of BENCH_LEN samples, a few windows long, is processed in blocks
+* of BENCH_CHUNK samples so that the window wraps and carries over between
+* calls.  The fixed-point outputs and the minima and maxima must be equal to
+* the recomputed ones.  The floating-point means, variances and RMS values
+* are compared with a two-pass double precision computation over the window;
+* the error of the recomputation with arm_mean_f32(), arm_var_f32() and
+* arm_rms_f32() is printed beside theirs.  The f32 inputs carry a DC offset
+* of 1, which is where arm_var_f32() loses most of its precision.  The q31
+* inputs are scaled down by 6 bits for the accumulator headroom that
+* arm_var_q31() and arm_rms_q31() need with 4096 samples.
+*
+* The times are those of BENCH_BLOCK outputs with a full window.
+*
+* Host: built by the CMakeLists.txt in CMSIS/DSP_Lib and run by CTest; the
+* exit status is the number of functions whose outputs differ and the times
+* are in nanoseconds.
+*
+* Target: build this file with -DARM_DSP_BENCH_TARGET into a FRDM-KV31F
+* project as for arm_dsp_bench.c.  The times are in core clock cycles from
+* the DWT cycle counter and the results are printed on the debug console.
+* BENCH_MAX_WIN is 1024 there, for the 96 KB of RAM.
+*/
+
+#include <math.h>
+#include "arm_math.h"
+
+#if defined(ARM_DSP_BENCH_TARGET)
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#define BENCH_PRINTF            PRINTF
+#define BENCH_MAX_WIN           1024u           /* longest window */
+#else
+#include <stdio.h>
+#include <time.h>
+#define BENCH_PRINTF            printf
+#define BENCH_MAX_WIN           4096u           /* longest window */
+#endif
+
+#define BENCH_LEN               (2u * BENCH_MAX_WIN + BENCH_MAX_WIN / 2u + 61u)  /* samples in the stream */
+#define BENCH_CHUNK             37u             /* samples per call while checking */
+#define BENCH_BLOCK             256u            /* samples per timed run */
+#define BENCH_TOL_F32           1.0e-5          /* largest error of the f32 outputs */
+
+/**
+ * @brief Statistics under test.
+ */
+typedef enum
+{
+  BENCH_MEANVAR = 0,
+  BENCH_RMS,
+  BENCH_MIN,
+  BENCH_MAX
+} bench_kind;
+
+/**
+ * @brief Data types under test.
+ */
+typedef enum
+{
+  BENCH_F32 = 0,
+  BENCH_Q31,
+  BENCH_Q15
+} bench_type;
+
+static const char *const benchKindNames[] = { "meanvar", "rms", "min", "max" };
+static const char *const benchTypeNames[] = { "f32", "q31", "q15" };
+static const uint32_t benchWindows[] = { 16u, 64u, 256u, 1024u, 4096u };
+
+/* Inputs */
+static float32_t fX[BENCH_LEN];
+static q31_t iX31[BENCH_LEN];
+static q15_t iX15[BENCH_LEN];
+
+/* Outputs of the sliding (s) and recomputed (r) statistics, a and b for the mean and the variance */
+static float32_t fSa[BENCH_BLOCK], fSb[BENCH_BLOCK], fRa[BENCH_BLOCK], fRb[BENCH_BLOCK];
+static q31_t iSa31[BENCH_BLOCK], iSb31[BENCH_BLOCK], iRa31[BENCH_BLOCK], iRb31[BENCH_BLOCK];
+static q15_t iSa15[BENCH_BLOCK], iSb15[BENCH_BLOCK], iRa15[BENCH_BLOCK], iRb15[BENCH_BLOCK];
+
+/* Windows and instances */
+static float32_t fWin[BENCH_MAX_WIN];
+static q31_t iWin31[BENCH_MAX_WIN];
+static q15_t iWin15[BENCH_MAX_WIN];
+static uint16_t deque[BENCH_MAX_WIN];
+static arm_sliding_mean_var_instance_f32 mvF32;
+static arm_sliding_mean_var_instance_q31 mvQ31;
+static arm_sliding_mean_var_instance_q15 mvQ15;
+static arm_sliding_rms_instance_f32 rmsF32;
+static arm_sliding_rms_instance_q31 rmsQ31;
+static arm_sliding_rms_instance_q15 rmsQ15;
+static arm_sliding_min_max_instance_f32 mmF32;
+static arm_sliding_min_max_instance_q31 mmQ31;
+static arm_sliding_min_max_instance_q15 mmQ15;
+
+/* Function pair under test */
+static bench_kind benchKind;
+static bench_type benchType;
+static uint32_t benchWin;
+static uint32_t benchStart;
+
+/**
+ * @brief Fixed pseudo random inputs.
+ */
+static void bench_inputs(
+  void)
+{
+  uint32_t seed = 2017u;                         /* linear congruential generator */
+  uint32_t i;                                    /* loop counter */
+  float32_t x;                                   /* value in [-1, 1) */
+
+  for (i = 0u; i < BENCH_LEN; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x = (float32_t) ((int32_t) seed) / 2147483648.0f;
+    fX[i] = 1.0f + 0.5f * x;
+    iX31[i] = (q31_t) (x * 33554432.0f);
+    iX15[i] = (q15_t) (0.5f * x * 32768.0f);
+  }
+}
+
+/**
+ * @brief Initializes the instance of the function under test for a window of benchWin samples.
+ */
+static void bench_init(
+  void)
+{
+  uint16_t win = (uint16_t) benchWin;            /* window length */
+
+  switch (benchKind)
+  {
+  case BENCH_MEANVAR:
+    arm_sliding_mean_var_init_f32(&mvF32, win, fWin);
+    arm_sliding_mean_var_init_q31(&mvQ31, win, iWin31);
+    arm_sliding_mean_var_init_q15(&mvQ15, win, iWin15);
+    break;
+  case BENCH_RMS:
+    arm_sliding_rms_init_f32(&rmsF32, win, fWin);
+    arm_sliding_rms_init_q31(&rmsQ31, win, iWin31);
+    arm_sliding_rms_init_q15(&rmsQ15, win, iWin15);
+    break;
+  default:
+    arm_sliding_min_max_init_f32(&mmF32, win, fWin, deque);
+    arm_sliding_min_max_init_q31(&mmQ31, win, iWin31, deque);
+    arm_sliding_min_max_init_q15(&mmQ15, win, iWin15, deque);
+    break;
+  }
+}
+
+/**
+ * @brief Sliding statistics of the samples n to n + len - 1 into the s outputs.
+ */
+static void bench_slide(
+  uint32_t n,
+  uint32_t len)
+{
+  switch ((uint32_t) benchKind * 3u + (uint32_t) benchType)
+  {
+  case 0u: arm_sliding_mean_var_f32(&mvF32, &fX[n], fSa, fSb, len); break;
+  case 1u: arm_sliding_mean_var_q31(&mvQ31, &iX31[n], iSa31, iSb31, len); break;
+  case 2u: arm_sliding_mean_var_q15(&mvQ15, &iX15[n], iSa15, iSb15, len); break;
+  case 3u: arm_sliding_rms_f32(&rmsF32, &fX[n], fSa, len); break;
+  case 4u: arm_sliding_rms_q31(&rmsQ31, &iX31[n], iSa31, len); break;
+  case 5u: arm_sliding_rms_q15(&rmsQ15, &iX15[n], iSa15, len); break;
+  case 6u: arm_sliding_min_f32(&mmF32, &fX[n], fSa, len); break;
+  case 7u: arm_sliding_min_q31(&mmQ31, &iX31[n], iSa31, len); break;
+  case 8u: arm_sliding_min_q15(&mmQ15, &iX15[n], iSa15, len); break;
+  case 9u: arm_sliding_max_f32(&mmF32, &fX[n], fSa, len); break;
+  case 10u: arm_sliding_max_q31(&mmQ31, &iX31[n], iSa31, len); break;
+  default: arm_sliding_max_q15(&mmQ15, &iX15[n], iSa15, len); break;
+  }
+}
+
+/**
+ * @brief Block statistics of the window ending at each of the samples n to n + len - 1 into the r outputs.
+ */
+static void bench_recompute(
+  uint32_t n,
+  uint32_t len)
+{
+  uint32_t i, count, start;                      /* output, samples in the window and first sample */
+  uint32_t index;                                /* unused index of the minimum or maximum */
+
+  for (i = 0u; i < len; i++)
+  {
+    count = (n + i + 1u < benchWin) ? n + i + 1u : benchWin;
+    start = n + i + 1u - count;
+
+    switch ((uint32_t) benchKind * 3u + (uint32_t) benchType)
+    {
+    case 0u:
+      arm_mean_f32(&fX[start], count, &fRa[i]);
+      arm_var_f32(&fX[start], count, &fRb[i]);
+      break;
+    case 1u:
+      arm_mean_q31(&iX31[start], count, &iRa31[i]);
+      arm_var_q31(&iX31[start], count, &iRb31[i]);
+      break;
+    case 2u:
+      arm_mean_q15(&iX15[start], count, &iRa15[i]);
+      arm_var_q15(&iX15[start], count, &iRb15[i]);
+      break;
+    case 3u: arm_rms_f32(&fX[start], count, &fRa[i]); break;
+    case 4u: arm_rms_q31(&iX31[start], count, &iRa31[i]); break;
+    case 5u: arm_rms_q15(&iX15[start], count, &iRa15[i]); break;
+    case 6u: arm_min_f32(&fX[start], count, &fRa[i], &index); break;
+    case 7u: arm_min_q31(&iX31[start], count, &iRa31[i], &index); break;
+    case 8u: arm_min_q15(&iX15[start], count, &iRa15[i], &index); break;
+    case 9u: arm_max_f32(&fX[start], count, &fRa[i], &index); break;
+    case 10u: arm_max_q31(&iX31[start], count, &iRa31[i], &index); break;
+    default: arm_max_q15(&iX15[start], count, &iRa15[i], &index); break;
+    }
+  }
+}
+
+/**
+ * @brief Two-pass double precision mean, variance and RMS of the window ending at sample n.
+ */
+static void bench_reference_f32(
+  uint32_t n,
+  double *pMean,
+  double *pVar,
+  double *pRms)
+{
+  uint32_t i, count, start;                      /* loop counter, samples in the window and first sample */
+  double sum = 0.0, dev = 0.0, sq = 0.0;         /* sums */
+
+  count = (n + 1u < benchWin) ? n + 1u : benchWin;
+  start = n + 1u - count;
+  for (i = start; i <= n; i++)
+  {
+    sum += (double) fX[i];
+    sq += (double) fX[i] * (double) fX[i];
+  }
+  *pMean = sum / (double) count;
+  for (i = start; i <= n; i++)
+  {
+    dev += ((double) fX[i] - *pMean) * ((double) fX[i] - *pMean);
+  }
+  *pVar = (count > 1u) ? dev / (double) (count - 1u) : 0.0;
+  *pRms = sqrt(sq / (double) count);
+}
+
+/**
+ * @brief Largest difference between the f32 outputs and the double precision reference.
+ */
+static double bench_error_f32(
+  uint32_t n,
+  uint32_t len,
+  const float32_t *pA,
+  const float32_t *pB)
+{
+  uint32_t i;                                    /* loop counter */
+  double mean, var, rms, err, worst = 0.0;       /* reference and errors */
+
+  for (i = 0u; i < len; i++)
+  {
+    bench_reference_f32(n + i, &mean, &var, &rms);
+    if (benchKind == BENCH_MEANVAR)
+    {
+      err = fabs((double) pA[i] - mean);
+      worst = (err > worst) ? err : worst;
+      err = fabs((double) pB[i] - var);
+    }
+    else
+    {
+      err = fabs((double) pA[i] - rms);
+    }
+    worst = (err > worst) ? err : worst;
+  }
+
+  return (worst);
+}
+
+/**
+ * @brief Number of the sliding outputs that differ from the recomputed ones.
+ */
+static uint32_t bench_differ(
+  uint32_t len)
+{
+  uint32_t i, diff = 0u;                         /* loop counter and differing outputs */
+
+  for (i = 0u; i < len; i++)
+  {
+    switch (benchType)
+    {
+    case BENCH_F32:
+      diff += (fSa[i] != fRa[i]) ? 1u : 0u;
+      break;
+    case BENCH_Q31:
+      diff += (iSa31[i] != iRa31[i]) ? 1u : 0u;
+      diff += ((benchKind == BENCH_MEANVAR) && (iSb31[i] != iRb31[i])) ? 1u : 0u;
+      break;
+    default:
+      diff += (iSa15[i] != iRa15[i]) ? 1u : 0u;
+      diff += ((benchKind == BENCH_MEANVAR) && (iSb15[i] != iRb15[i])) ? 1u : 0u;
+      break;
+    }
+  }
+
+  return (diff);
+}
+
+static void run_slide(void)
+{
+  bench_slide(benchStart, BENCH_BLOCK);
+}
+
+static void run_recompute(void)
+{
+  bench_recompute(benchStart, BENCH_BLOCK);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+/**
+ * @brief Core clock cycles of one run, after a warm-up run.
+ */
+static uint32_t bench_time(
+  void (*pRun)(void))
+{
+  uint32_t start;                                /* cycle counter at the start */
+
+  pRun();
+  start = DWT->CYCCNT;
+  pRun();
+  return (DWT->CYCCNT - start);
+}
+
+#else
+
+static double bench_seconds(
+  void)
+{
+  struct timespec t;                             /* monotonic time */
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return ((double) t.tv_sec + 1.0e-9 * (double) t.tv_nsec);
+}
+
+/**
+ * @brief Nanoseconds of one run, the best of five batches of at least 2 ms.
+ */
+static uint32_t bench_time(
+  void (*pRun)(void))
+{
+  uint32_t reps = 1u, i, batch;                  /* repetitions and loop counters */
+  double start, elapsed, best = 1.0e9;           /* times */
+
+  pRun();
+  for (batch = 0u; batch < 5u; batch++)
+  {
+    do
+    {
+      start = bench_seconds();
+      for (i = 0u; i < reps; i++)
+      {
+        pRun();
+      }
+      elapsed = bench_seconds() - start;
+      if (elapsed < 0.002)
+      {
+        reps *= 2u;
+      }
+    } while ((elapsed < 0.002) && (reps < (1u << 30)));
+
+    elapsed /= (double) reps;
+    best = (elapsed < best) ? elapsed : best;
+  }
+
+  return ((uint32_t) (best * 1.0e9 + 0.5));
+}
+
+#endif
+
+/**
+ * @brief Checks and times every function for every window length.
+ * @return number of functions whose outputs differ.
+ */
+static int bench_run(
+  void)
+{
+  uint32_t w, k, t, n, len;                      /* loop counters and block */
+  uint32_t timeR, timeS, speedup;                /* times and speedup in hundredths */
+  uint32_t diff;                                 /* differing outputs */
+  double errS, errR;                             /* largest f32 errors, sliding and recomputed */
+  int fails = 0;                                 /* functions that differ */
+
+  bench_inputs();
+
+#if defined(ARM_DSP_BENCH_TARGET)
+  BENCH_PRINTF("\r\ntime of %u outputs, cycles\r\n", (unsigned) BENCH_BLOCK);
+#else
+  BENCH_PRINTF("\r\ntime of %u outputs, ns\r\n", (unsigned) BENCH_BLOCK);
+#endif
+  BENCH_PRINTF("%-8s %-4s %6s %10s %9s %9s  %s\r\n", "stat", "type", "window", "recompute", "sliding", "speedup",
+               "result");
+  for (w = 0u; w < sizeof(benchWindows) / sizeof(benchWindows[0]); w++)
+  {
+    benchWin = benchWindows[w];
+    if (benchWin > BENCH_MAX_WIN)
+    {
+      break;
+    }
+
+    for (k = 0u; k <= (uint32_t) BENCH_MAX; k++)
+    {
+      for (t = 0u; t <= (uint32_t) BENCH_Q15; t++)
+      {
+        benchKind = (bench_kind) k;
+        benchType = (bench_type) t;
+
+        /* The whole stream, in blocks that do not divide the window */
+        bench_init();
+        diff = 0u;
+        errS = 0.0;
+        errR = 0.0;
+        for (n = 0u; n < BENCH_LEN; n += len)
+        {
+          len = (BENCH_LEN - n < BENCH_CHUNK) ? BENCH_LEN - n : BENCH_CHUNK;
+          bench_slide(n, len);
+          bench_recompute(n, len);
+          if ((benchType == BENCH_F32) && (benchKind <= BENCH_RMS))
+          {
+            errS = fmax(errS, bench_error_f32(n, len, fSa, fSb));
+            errR = fmax(errR, bench_error_f32(n, len, fRa, fRb));
+          }
+          else
+          {
+            diff += bench_differ(len);
+          }
+        }
+        if (errS > BENCH_TOL_F32)
+        {
+          diff++;
+        }
+        fails += (diff > 0u) ? 1 : 0;
+
+        /* The last BENCH_BLOCK samples, with a full window */
+        benchStart = BENCH_LEN - BENCH_BLOCK;
+        timeR = bench_time(run_recompute);
+        timeS = bench_time(run_slide);
+
+        /* The target printf has no floating-point support, so the speedup is printed in hundredths */
+        speedup = (timeS > 0u) ? (uint32_t) (((uint64_t) timeR * 100u + timeS / 2u) / timeS) : 0u;
+        BENCH_PRINTF("%-8s %-4s %6u %10u %9u %6u.%02u  ", benchKindNames[k], benchTypeNames[t], (unsigned) benchWin,
+                     (unsigned) timeR, (unsigned) timeS, (unsigned) (speedup / 100u), (unsigned) (speedup % 100u));
+        if ((benchType == BENCH_F32) && (benchKind <= BENCH_RMS))
+        {
+          /* Errors in units of 1e-9 */
+          BENCH_PRINTF("error %u, recomputed %u (1e-9)%s\r\n", (unsigned) (errS * 1.0e9 + 0.5),
+                       (unsigned) (errR * 1.0e9 + 0.5), (diff > 0u) ? "  TOO LARGE" : "");
+        }
+        else
+        {
+          BENCH_PRINTF("%s\r\n", (diff > 0u) ? "DIFFER" : "equal");
+        }
+      }
+    }
+  }
+  BENCH_PRINTF("%d function(s) differ from the recomputation\r\n", fails);
+
+  return (fails);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+int main(void)
+{
+  BOARD_InitPins();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  /* Start the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_PRINTF("CMSIS DSP sliding-window statistics benchmark, core clock %u Hz\r\n", (unsigned) SystemCoreClock);
+  bench_run();
+
+  while (1)
+  {
+  }
+}
+
+#else
+
+int main(void)
+{
+  BENCH_PRINTF("CMSIS DSP sliding-window statistics benchmark\n");
+
+  return (bench_run());
+}
+
+#endif
@@ -0,0 +1,543 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_step_bench.c
+*
+* Description:  Single-sample step functions against the block functions.
+*
+* Target Processor: Cortex-M4 with FPU, or x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+
+/*
+* Times the single-sample filter steps against the block functions called
+* with a blockSize of 1, the way the ROBOT filter.c and CalPosition.c call
+* them from their control loops:
+*
+*   biquad   arm_biquad_step_*() against arm_biquad_cascade_df1_*(), 2 stages
+*   fir      arm_fir_step_*() against arm_fir_*(), 16 taps
+*   lattice  arm_iir_lattice_step_*() against arm_iir_lattice_*(), 4 stages
+*
+* in float32_t, q31_t and q15_t.  Each run filters BENCH_BLOCK samples one
+* at a time, and the outputs of the steps must be equal to the outputs of
+* the block functions.
+*
+* Host: built by the CMakeLists.txt in CMSIS/DSP_Lib and run by CTest; the
+* exit status is the number of functions whose outputs differ and the times
+* are in nanoseconds.
+*
+* Target: build this file with -DARM_DSP_BENCH_TARGET into a FRDM-KV31F
+* project as for arm_dsp_bench.c.  The times are in core clock cycles from
+* the DWT cycle counter and the results are printed on the debug console.
+*/
+
+#include <string.h>
+#include "arm_math.h"
+
+#if defined(ARM_DSP_BENCH_TARGET)
+#include "fsl_device_registers.h"
+#include "fsl_debug_console.h"
+#include "board.h"
+#include "pin_mux.h"
+#include "clock_config.h"
+#define BENCH_PRINTF            PRINTF
+#else
+#include <stdio.h>
+#include <time.h>
+#define BENCH_PRINTF            printf
+#endif
+
+#define BENCH_BLOCK             64u             /* samples per timed run */
+#define BENCH_STAGES            2u              /* biquad stages */
+#define BENCH_TAPS              16u             /* FIR taps */
+#define BENCH_LATTICE           4u              /* lattice stages */
+
+/**
+ * @brief One function pair under test.
+ */
+typedef struct
+{
+  const char *pName;                             /* filter */
+  const char *pType;                             /* data type */
+  void (*pInit)(void);                           /* clears the states of both instances */
+  void (*pBlock)(void);                          /* BENCH_BLOCK calls of the block function */
+  void (*pStep)(void);                           /* BENCH_BLOCK calls of the step function */
+  const void *pOutBlock;                         /* outputs of the block function */
+  const void *pOutStep;                          /* outputs of the step function */
+  uint32_t outSize;                              /* bytes of the outputs */
+} bench_case;
+
+/* Inputs and outputs */
+static float32_t fX[BENCH_BLOCK], fYb[BENCH_BLOCK], fYs[BENCH_BLOCK];
+static q31_t iX31[BENCH_BLOCK], iYb31[BENCH_BLOCK], iYs31[BENCH_BLOCK];
+static q15_t iX15[BENCH_BLOCK], iYb15[BENCH_BLOCK], iYs15[BENCH_BLOCK];
+
+/* Coefficients: a high pass and a low pass section, as in the ROBOT filter.c, scaled by 1/2 for postShift 1 */
+static float32_t fBq[5u * BENCH_STAGES] =
+{
+  0.4838474f, -0.9676948f, 0.4838474f, 0.9770010f, -0.4773096f,
+  0.5f, -1.0f, 0.5f, 0.9901619f, -0.4904747f
+};
+static q31_t iBq31[5u * BENCH_STAGES];
+static q15_t iBq15[6u * BENCH_STAGES];
+static float32_t fH[BENCH_TAPS], fK[BENCH_LATTICE], fV[BENCH_LATTICE + 1u];
+static q31_t iH31[BENCH_TAPS], iK31[BENCH_LATTICE], iV31[BENCH_LATTICE + 1u];
+static q15_t iH15[BENCH_TAPS], iK15[BENCH_LATTICE], iV15[BENCH_LATTICE + 1u];
+
+/* States of the block (b) and step (s) instances */
+static float32_t fSb[BENCH_TAPS + BENCH_LATTICE], fSs[BENCH_TAPS + BENCH_LATTICE];
+static q31_t iSb31[BENCH_TAPS + BENCH_LATTICE], iSs31[BENCH_TAPS + BENCH_LATTICE];
+static q15_t iSb15[BENCH_TAPS + BENCH_LATTICE], iSs15[BENCH_TAPS + BENCH_LATTICE];
+
+static arm_biquad_casd_df1_inst_f32 bqF32b, bqF32s;
+static arm_biquad_casd_df1_inst_q31 bqQ31b, bqQ31s;
+static arm_biquad_casd_df1_inst_q15 bqQ15b, bqQ15s;
+static arm_fir_instance_f32 firF32b, firF32s;
+static arm_fir_instance_q31 firQ31b, firQ31s;
+static arm_fir_instance_q15 firQ15b, firQ15s;
+static arm_iir_lattice_instance_f32 latF32b, latF32s;
+static arm_iir_lattice_instance_q31 latQ31b, latQ31s;
+static arm_iir_lattice_instance_q15 latQ15b, latQ15s;
+
+/**
+ * @brief Fixed pseudo random inputs and filter coefficients.
+ */
+static void bench_inputs(
+  void)
+{
+  uint32_t seed = 2017u;                         /* linear congruential generator */
+  uint32_t i;                                    /* loop counter */
+  float32_t x;                                   /* value in [-1, 1) */
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x = (float32_t) ((int32_t) seed) / 2147483648.0f;
+    fX[i] = 0.5f * x;
+    iX31[i] = (q31_t) (0.5f * x * 2147483648.0f);
+    iX15[i] = (q15_t) (0.5f * x * 32768.0f);
+  }
+  for (i = 0u; i < BENCH_TAPS; i++)
+  {
+    seed = seed * 1664525u + 1013904223u;
+    x = (float32_t) ((int32_t) seed) / 2147483648.0f / (float32_t) BENCH_TAPS;
+    fH[i] = x;
+    iH31[i] = (q31_t) (x * 2147483648.0f);
+    iH15[i] = (q15_t) (x * 32768.0f);
+  }
+  for (i = 0u; i < 5u * BENCH_STAGES; i++)
+  {
+    iBq31[i] = (q31_t) (fBq[i] * 1073741824.0f);
+    iBq15[i + (i / 5u) + ((i % 5u) == 0u ? 0u : 1u)] = (q15_t) (fBq[i] * 16384.0f);
+  }
+  for (i = 0u; i < BENCH_LATTICE; i++)
+  {
+    fK[i] = 0.5f - 0.2f * (float32_t) i;
+    iK31[i] = (q31_t) (fK[i] * 2147483648.0f);
+    iK15[i] = (q15_t) (fK[i] * 32768.0f);
+  }
+  for (i = 0u; i <= BENCH_LATTICE; i++)
+  {
+    fV[i] = 0.3f - 0.1f * (float32_t) i;
+    iV31[i] = (q31_t) (fV[i] * 2147483648.0f);
+    iV15[i] = (q15_t) (fV[i] * 32768.0f);
+  }
+}
+
+/* Biquad cascades */
+static void init_bq_f32(void)
+{
+  arm_biquad_cascade_df1_init_f32(&bqF32b, BENCH_STAGES, fBq, fSb);
+  arm_biquad_cascade_df1_init_f32(&bqF32s, BENCH_STAGES, fBq, fSs);
+}
+static void init_bq_q31(void)
+{
+  arm_biquad_cascade_df1_init_q31(&bqQ31b, BENCH_STAGES, iBq31, iSb31, 1);
+  arm_biquad_cascade_df1_init_q31(&bqQ31s, BENCH_STAGES, iBq31, iSs31, 1);
+}
+static void init_bq_q15(void)
+{
+  arm_biquad_cascade_df1_init_q15(&bqQ15b, BENCH_STAGES, iBq15, iSb15, 1);
+  arm_biquad_cascade_df1_init_q15(&bqQ15s, BENCH_STAGES, iBq15, iSs15, 1);
+}
+static void block_bq_f32(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_biquad_cascade_df1_f32(&bqF32b, &fX[i], &fYb[i], 1u);
+  }
+}
+static void block_bq_q31(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_biquad_cascade_df1_q31(&bqQ31b, &iX31[i], &iYb31[i], 1u);
+  }
+}
+static void block_bq_q15(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_biquad_cascade_df1_q15(&bqQ15b, &iX15[i], &iYb15[i], 1u);
+  }
+}
+static void step_bq_f32(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    fYs[i] = arm_biquad_step_f32(&bqF32s, fX[i]);
+  }
+}
+static void step_bq_q31(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    iYs31[i] = arm_biquad_step_q31(&bqQ31s, iX31[i]);
+  }
+}
+static void step_bq_q15(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    iYs15[i] = arm_biquad_step_q15(&bqQ15s, iX15[i]);
+  }
+}
+
+/* FIR filters */
+static void init_fir_f32(void)
+{
+  arm_fir_init_f32(&firF32b, BENCH_TAPS, fH, fSb, 1u);
+  arm_fir_init_f32(&firF32s, BENCH_TAPS, fH, fSs, 1u);
+}
+static void init_fir_q31(void)
+{
+  arm_fir_init_q31(&firQ31b, BENCH_TAPS, iH31, iSb31, 1u);
+  arm_fir_init_q31(&firQ31s, BENCH_TAPS, iH31, iSs31, 1u);
+}
+static void init_fir_q15(void)
+{
+  (void) arm_fir_init_q15(&firQ15b, BENCH_TAPS, iH15, iSb15, 1u);
+  (void) arm_fir_init_q15(&firQ15s, BENCH_TAPS, iH15, iSs15, 1u);
+}
+static void block_fir_f32(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_fir_f32(&firF32b, &fX[i], &fYb[i], 1u);
+  }
+}
+static void block_fir_q31(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_fir_q31(&firQ31b, &iX31[i], &iYb31[i], 1u);
+  }
+}
+static void block_fir_q15(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_fir_q15(&firQ15b, &iX15[i], &iYb15[i], 1u);
+  }
+}
+static void step_fir_f32(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    fYs[i] = arm_fir_step_f32(&firF32s, fX[i]);
+  }
+}
+static void step_fir_q31(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    iYs31[i] = arm_fir_step_q31(&firQ31s, iX31[i]);
+  }
+}
+static void step_fir_q15(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    iYs15[i] = arm_fir_step_q15(&firQ15s, iX15[i]);
+  }
+}
+
+/* IIR lattice filters */
+static void init_lat_f32(void)
+{
+  arm_iir_lattice_init_f32(&latF32b, BENCH_LATTICE, fK, fV, fSb, 1u);
+  arm_iir_lattice_init_f32(&latF32s, BENCH_LATTICE, fK, fV, fSs, 1u);
+}
+static void init_lat_q31(void)
+{
+  arm_iir_lattice_init_q31(&latQ31b, BENCH_LATTICE, iK31, iV31, iSb31, 1u);
+  arm_iir_lattice_init_q31(&latQ31s, BENCH_LATTICE, iK31, iV31, iSs31, 1u);
+}
+static void init_lat_q15(void)
+{
+  arm_iir_lattice_init_q15(&latQ15b, BENCH_LATTICE, iK15, iV15, iSb15, 1u);
+  arm_iir_lattice_init_q15(&latQ15s, BENCH_LATTICE, iK15, iV15, iSs15, 1u);
+}
+static void block_lat_f32(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_iir_lattice_f32(&latF32b, &fX[i], &fYb[i], 1u);
+  }
+}
+static void block_lat_q31(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_iir_lattice_q31(&latQ31b, &iX31[i], &iYb31[i], 1u);
+  }
+}
+static void block_lat_q15(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    arm_iir_lattice_q15(&latQ15b, &iX15[i], &iYb15[i], 1u);
+  }
+}
+static void step_lat_f32(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    fYs[i] = arm_iir_lattice_step_f32(&latF32s, fX[i]);
+  }
+}
+static void step_lat_q31(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    iYs31[i] = arm_iir_lattice_step_q31(&latQ31s, iX31[i]);
+  }
+}
+static void step_lat_q15(void)
+{
+  uint32_t i;
+
+  for (i = 0u; i < BENCH_BLOCK; i++)
+  {
+    iYs15[i] = arm_iir_lattice_step_q15(&latQ15s, iX15[i]);
+  }
+}
+
+#define F32_OUT fYb, fYs, sizeof(fYb)
+#define Q31_OUT iYb31, iYs31, sizeof(iYb31)
+#define Q15_OUT iYb15, iYs15, sizeof(iYb15)
+
+static const bench_case benchCases[] =
+{
+  { "biquad",  "f32", init_bq_f32,  block_bq_f32,  step_bq_f32,  F32_OUT },
+  { "biquad",  "q31", init_bq_q31,  block_bq_q31,  step_bq_q31,  Q31_OUT },
+  { "biquad",  "q15", init_bq_q15,  block_bq_q15,  step_bq_q15,  Q15_OUT },
+  { "fir",     "f32", init_fir_f32, block_fir_f32, step_fir_f32, F32_OUT },
+  { "fir",     "q31", init_fir_q31, block_fir_q31, step_fir_q31, Q31_OUT },
+  { "fir",     "q15", init_fir_q15, block_fir_q15, step_fir_q15, Q15_OUT },
+  { "lattice", "f32", init_lat_f32, block_lat_f32, step_lat_f32, F32_OUT },
+  { "lattice", "q31", init_lat_q31, block_lat_q31, step_lat_q31, Q31_OUT },
+  { "lattice", "q15", init_lat_q15, block_lat_q15, step_lat_q15, Q15_OUT },
+};
+
+#define BENCH_NUM_CASES (sizeof(benchCases) / sizeof(benchCases[0]))
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+/**
+ * @brief Core clock cycles of one run, after a warm-up run.
+ */
+static uint32_t bench_time(
+  void (*pRun)(void))
+{
+  uint32_t start;                                /* cycle counter at the start */
+
+  pRun();
+  start = DWT->CYCCNT;
+  pRun();
+  return (DWT->CYCCNT - start);
+}
+
+#else
+
+static double bench_seconds(
+  void)
+{
+  struct timespec t;                             /* monotonic time */
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return ((double) t.tv_sec + 1.0e-9 * (double) t.tv_nsec);
+}
+
+/**
+ * @brief Nanoseconds of one run, the best of five batches of at least 2 ms.
+ */
+static uint32_t bench_time(
+  void (*pRun)(void))
+{
+  uint32_t reps = 1u, i, batch;                  /* repetitions and loop counters */
+  double start, elapsed, best = 1.0e9;           /* times */
+
+  pRun();
+  for (batch = 0u; batch < 5u; batch++)
+  {
+    do
+    {
+      start = bench_seconds();
+      for (i = 0u; i < reps; i++)
+      {
+        pRun();
+      }
+      elapsed = bench_seconds() - start;
+      if (elapsed < 0.002)
+      {
+        reps *= 2u;
+      }
+    } while ((elapsed < 0.002) && (reps < (1u << 30)));
+
+    elapsed /= (double) reps;
+    best = (elapsed < best) ? elapsed : best;
+  }
+
+  return ((uint32_t) (best * 1.0e9 + 0.5));
+}
+
+#endif
+
+/**
+ * @brief Prints the times of every function pair.
+ * @return number of step functions whose outputs differ from the block functions.
+ */
+static int bench_run(
+  void)
+{
+  uint32_t i, timeB, timeS, speedup;             /* counter, times and speedup in hundredths */
+  int fails = 0;                                 /* functions that differ */
+  int same;                                      /* outputs of the pair are equal */
+  const bench_case *pCase;                       /* functions under test */
+
+  bench_inputs();
+
+#if defined(ARM_DSP_BENCH_TARGET)
+  BENCH_PRINTF("\r\ntime of %u single-sample calls, cycles\r\n", (unsigned) BENCH_BLOCK);
+#else
+  BENCH_PRINTF("\r\ntime of %u single-sample calls, ns\r\n", (unsigned) BENCH_BLOCK);
+#endif
+  BENCH_PRINTF("%-8s %-4s %9s %9s %9s  %s\r\n", "filter", "type", "block", "step", "speedup", "result");
+  for (i = 0u; i < BENCH_NUM_CASES; i++)
+  {
+    pCase = &benchCases[i];
+
+    /* Both instances start from a zero state, so the outputs must match */
+    pCase->pInit();
+    pCase->pBlock();
+    pCase->pStep();
+    same = (memcmp(pCase->pOutBlock, pCase->pOutStep, pCase->outSize) == 0) ? 1 : 0;
+    fails += 1 - same;
+
+    timeB = bench_time(pCase->pBlock);
+    timeS = bench_time(pCase->pStep);
+
+    /* The target printf has no floating-point support, so the speedup is printed in hundredths */
+    speedup = (timeS > 0u) ? (uint32_t) (((uint64_t) timeB * 100u + timeS / 2u) / timeS) : 0u;
+    BENCH_PRINTF("%-8s %-4s %9u %9u %6u.%02u  %s\r\n", pCase->pName, pCase->pType, (unsigned) timeB,
+                 (unsigned) timeS, (unsigned) (speedup / 100u), (unsigned) (speedup % 100u),
+                 same ? "equal" : "DIFFER");
+  }
+  BENCH_PRINTF("%d step function(s) differ from the block functions\r\n", fails);
+
+  return (fails);
+}
+
+#if defined(ARM_DSP_BENCH_TARGET)
+
+int main(void)
+{
+  BOARD_InitPins();
+  BOARD_BootClockRUN();
+  BOARD_InitDebugConsole();
+
+  /* Start the DWT cycle counter */
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0u;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  BENCH_PRINTF("CMSIS DSP single-sample step benchmark, core clock %u Hz\r\n", (unsigned) SystemCoreClock);
+  bench_run();
+
+  while (1)
+  {
+  }
+}
+
+#else
+
+int main(void)
+{
+  BENCH_PRINTF("CMSIS DSP single-sample step benchmark\n");
+
+  return (bench_run());
+}
+
+#endif
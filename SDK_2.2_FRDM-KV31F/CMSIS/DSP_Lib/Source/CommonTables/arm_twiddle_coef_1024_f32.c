@@ -0,0 +1,1101 @@
+/* ----------------------------------------------------------------------    
+* Copyright (C) 2010-2014 ARM Limited. All rights reserved.    
+*    
+* $Date:        19. March 2015 
+* $Revision: 	V.1.4.5  
+*    
+* Project: 	    CMSIS DSP Library    
+* Title:	    arm_twiddle_coef_1024_f32.c    
+*    
+* Description:	Twiddle factor table of the 1024 point floating-point CFFT
+*    
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*  
+* Redistribution and use in source and binary forms, with or without 
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the 
+*     distribution.
+*   - Neither the name of ARM LIMITED nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE 
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.   
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/**    
+ * @ingroup groupTransforms    
+ */
+
+/**    
+ * @addtogroup CFFT_CIFFT    
+ * @{    
+ */
+
+/*    
+* @brief  Floating-point Twiddle factors Table Generation    
+*/
+
+/**    
+* \par    
+* Example code for Floating-point Twiddle factors Generation:    
+* \par    
+* <pre>for(i = 0; i< N/; i++)    
+* {    
+*	twiddleCoef[2*i]= cos(i * 2*PI/(float)N);    
+*	twiddleCoef[2*i+1]= sin(i * 2*PI/(float)N);    
+* } </pre>    
+* \par    
+* where N = 1024	and PI = 3.14159265358979    
+* \par    
+* Cos and Sin values are in interleaved fashion    
+*     
+*/
+const float32_t twiddleCoef_1024[2048] = {
+1.000000000f	,	0.000000000f	,
+0.999981175f	,	0.006135885f	,
+0.999924702f	,	0.012271538f	,
+0.999830582f	,	0.018406730f	,
+0.999698819f	,	0.024541229f	,
+0.999529418f	,	0.030674803f	,
+0.999322385f	,	0.036807223f	,
+0.999077728f	,	0.042938257f	,
+0.998795456f	,	0.049067674f	,
+0.998475581f	,	0.055195244f	,
+0.998118113f	,	0.061320736f	,
+0.997723067f	,	0.067443920f	,
+0.997290457f	,	0.073564564f	,
+0.996820299f	,	0.079682438f	,
+0.996312612f	,	0.085797312f	,
+0.995767414f	,	0.091908956f	,
+0.995184727f	,	0.098017140f	,
+0.994564571f	,	0.104121634f	,
+0.993906970f	,	0.110222207f	,
+0.993211949f	,	0.116318631f	,
+0.992479535f	,	0.122410675f	,
+0.991709754f	,	0.128498111f	,
+0.990902635f	,	0.134580709f	,
+0.990058210f	,	0.140658239f	,
+0.989176510f	,	0.146730474f	,
+0.988257568f	,	0.152797185f	,
+0.987301418f	,	0.158858143f	,
+0.986308097f	,	0.164913120f	,
+0.985277642f	,	0.170961889f	,
+0.984210092f	,	0.177004220f	,
+0.983105487f	,	0.183039888f	,
+0.981963869f	,	0.189068664f	,
+0.980785280f	,	0.195090322f	,
+0.979569766f	,	0.201104635f	,
+0.978317371f	,	0.207111376f	,
+0.977028143f	,	0.213110320f	,
+0.975702130f	,	0.219101240f	,
+0.974339383f	,	0.225083911f	,
+0.972939952f	,	0.231058108f	,
+0.971503891f	,	0.237023606f	,
+0.970031253f	,	0.242980180f	,
+0.968522094f	,	0.248927606f	,
+0.966976471f	,	0.254865660f	,
+0.965394442f	,	0.260794118f	,
+0.963776066f	,	0.266712757f	,
+0.962121404f	,	0.272621355f	,
+0.960430519f	,	0.278519689f	,
+0.958703475f	,	0.284407537f	,
+0.956940336f	,	0.290284677f	,
+0.955141168f	,	0.296150888f	,
+0.953306040f	,	0.302005949f	,
+0.951435021f	,	0.307849640f	,
+0.949528181f	,	0.313681740f	,
+0.947585591f	,	0.319502031f	,
+0.945607325f	,	0.325310292f	,
+0.943593458f	,	0.331106306f	,
+0.941544065f	,	0.336889853f	,
+0.939459224f	,	0.342660717f	,
+0.937339012f	,	0.348418680f	,
+0.935183510f	,	0.354163525f	,
+0.932992799f	,	0.359895037f	,
+0.930766961f	,	0.365612998f	,
+0.928506080f	,	0.371317194f	,
+0.926210242f	,	0.377007410f	,
+0.923879533f	,	0.382683432f	,
+0.921514039f	,	0.388345047f	,
+0.919113852f	,	0.393992040f	,
+0.916679060f	,	0.399624200f	,
+0.914209756f	,	0.405241314f	,
+0.911706032f	,	0.410843171f	,
+0.909167983f	,	0.416429560f	,
+0.906595705f	,	0.422000271f	,
+0.903989293f	,	0.427555093f	,
+0.901348847f	,	0.433093819f	,
+0.898674466f	,	0.438616239f	,
+0.895966250f	,	0.444122145f	,
+0.893224301f	,	0.449611330f	,
+0.890448723f	,	0.455083587f	,
+0.887639620f	,	0.460538711f	,
+0.884797098f	,	0.465976496f	,
+0.881921264f	,	0.471396737f	,
+0.879012226f	,	0.476799230f	,
+0.876070094f	,	0.482183772f	,
+0.873094978f	,	0.487550160f	,
+0.870086991f	,	0.492898192f	,
+0.867046246f	,	0.498227667f	,
+0.863972856f	,	0.503538384f	,
+0.860866939f	,	0.508830143f	,
+0.857728610f	,	0.514102744f	,
+0.854557988f	,	0.519355990f	,
+0.851355193f	,	0.524589683f	,
+0.848120345f	,	0.529803625f	,
+0.844853565f	,	0.534997620f	,
+0.841554977f	,	0.540171473f	,
+0.838224706f	,	0.545324988f	,
+0.834862875f	,	0.550457973f	,
+0.831469612f	,	0.555570233f	,
+0.828045045f	,	0.560661576f	,
+0.824589303f	,	0.565731811f	,
+0.821102515f	,	0.570780746f	,
+0.817584813f	,	0.575808191f	,
+0.814036330f	,	0.580813958f	,
+0.810457198f	,	0.585797857f	,
+0.806847554f	,	0.590759702f	,
+0.803207531f	,	0.595699304f	,
+0.799537269f	,	0.600616479f	,
+0.795836905f	,	0.605511041f	,
+0.792106577f	,	0.610382806f	,
+0.788346428f	,	0.615231591f	,
+0.784556597f	,	0.620057212f	,
+0.780737229f	,	0.624859488f	,
+0.776888466f	,	0.629638239f	,
+0.773010453f	,	0.634393284f	,
+0.769103338f	,	0.639124445f	,
+0.765167266f	,	0.643831543f	,
+0.761202385f	,	0.648514401f	,
+0.757208847f	,	0.653172843f	,
+0.753186799f	,	0.657806693f	,
+0.749136395f	,	0.662415778f	,
+0.745057785f	,	0.666999922f	,
+0.740951125f	,	0.671558955f	,
+0.736816569f	,	0.676092704f	,
+0.732654272f	,	0.680600998f	,
+0.728464390f	,	0.685083668f	,
+0.724247083f	,	0.689540545f	,
+0.720002508f	,	0.693971461f	,
+0.715730825f	,	0.698376249f	,
+0.711432196f	,	0.702754744f	,
+0.707106781f	,	0.707106781f	,
+0.702754744f	,	0.711432196f	,
+0.698376249f	,	0.715730825f	,
+0.693971461f	,	0.720002508f	,
+0.689540545f	,	0.724247083f	,
+0.685083668f	,	0.728464390f	,
+0.680600998f	,	0.732654272f	,
+0.676092704f	,	0.736816569f	,
+0.671558955f	,	0.740951125f	,
+0.666999922f	,	0.745057785f	,
+0.662415778f	,	0.749136395f	,
+0.657806693f	,	0.753186799f	,
+0.653172843f	,	0.757208847f	,
+0.648514401f	,	0.761202385f	,
+0.643831543f	,	0.765167266f	,
+0.639124445f	,	0.769103338f	,
+0.634393284f	,	0.773010453f	,
+0.629638239f	,	0.776888466f	,
+0.624859488f	,	0.780737229f	,
+0.620057212f	,	0.784556597f	,
+0.615231591f	,	0.788346428f	,
+0.610382806f	,	0.792106577f	,
+0.605511041f	,	0.795836905f	,
+0.600616479f	,	0.799537269f	,
+0.595699304f	,	0.803207531f	,
+0.590759702f	,	0.806847554f	,
+0.585797857f	,	0.810457198f	,
+0.580813958f	,	0.814036330f	,
+0.575808191f	,	0.817584813f	,
+0.570780746f	,	0.821102515f	,
+0.565731811f	,	0.824589303f	,
+0.560661576f	,	0.828045045f	,
+0.555570233f	,	0.831469612f	,
+0.550457973f	,	0.834862875f	,
+0.545324988f	,	0.838224706f	,
+0.540171473f	,	0.841554977f	,
+0.534997620f	,	0.844853565f	,
+0.529803625f	,	0.848120345f	,
+0.524589683f	,	0.851355193f	,
+0.519355990f	,	0.854557988f	,
+0.514102744f	,	0.857728610f	,
+0.508830143f	,	0.860866939f	,
+0.503538384f	,	0.863972856f	,
+0.498227667f	,	0.867046246f	,
+0.492898192f	,	0.870086991f	,
+0.487550160f	,	0.873094978f	,
+0.482183772f	,	0.876070094f	,
+0.476799230f	,	0.879012226f	,
+0.471396737f	,	0.881921264f	,
+0.465976496f	,	0.884797098f	,
+0.460538711f	,	0.887639620f	,
+0.455083587f	,	0.890448723f	,
+0.449611330f	,	0.893224301f	,
+0.444122145f	,	0.895966250f	,
+0.438616239f	,	0.898674466f	,
+0.433093819f	,	0.901348847f	,
+0.427555093f	,	0.903989293f	,
+0.422000271f	,	0.906595705f	,
+0.416429560f	,	0.909167983f	,
+0.410843171f	,	0.911706032f	,
+0.405241314f	,	0.914209756f	,
+0.399624200f	,	0.916679060f	,
+0.393992040f	,	0.919113852f	,
+0.388345047f	,	0.921514039f	,
+0.382683432f	,	0.923879533f	,
+0.377007410f	,	0.926210242f	,
+0.371317194f	,	0.928506080f	,
+0.365612998f	,	0.930766961f	,
+0.359895037f	,	0.932992799f	,
+0.354163525f	,	0.935183510f	,
+0.348418680f	,	0.937339012f	,
+0.342660717f	,	0.939459224f	,
+0.336889853f	,	0.941544065f	,
+0.331106306f	,	0.943593458f	,
+0.325310292f	,	0.945607325f	,
+0.319502031f	,	0.947585591f	,
+0.313681740f	,	0.949528181f	,
+0.307849640f	,	0.951435021f	,
+0.302005949f	,	0.953306040f	,
+0.296150888f	,	0.955141168f	,
+0.290284677f	,	0.956940336f	,
+0.284407537f	,	0.958703475f	,
+0.278519689f	,	0.960430519f	,
+0.272621355f	,	0.962121404f	,
+0.266712757f	,	0.963776066f	,
+0.260794118f	,	0.965394442f	,
+0.254865660f	,	0.966976471f	,
+0.248927606f	,	0.968522094f	,
+0.242980180f	,	0.970031253f	,
+0.237023606f	,	0.971503891f	,
+0.231058108f	,	0.972939952f	,
+0.225083911f	,	0.974339383f	,
+0.219101240f	,	0.975702130f	,
+0.213110320f	,	0.977028143f	,
+0.207111376f	,	0.978317371f	,
+0.201104635f	,	0.979569766f	,
+0.195090322f	,	0.980785280f	,
+0.189068664f	,	0.981963869f	,
+0.183039888f	,	0.983105487f	,
+0.177004220f	,	0.984210092f	,
+0.170961889f	,	0.985277642f	,
+0.164913120f	,	0.986308097f	,
+0.158858143f	,	0.987301418f	,
+0.152797185f	,	0.988257568f	,
+0.146730474f	,	0.989176510f	,
+0.140658239f	,	0.990058210f	,
+0.134580709f	,	0.990902635f	,
+0.128498111f	,	0.991709754f	,
+0.122410675f	,	0.992479535f	,
+0.116318631f	,	0.993211949f	,
+0.110222207f	,	0.993906970f	,
+0.104121634f	,	0.994564571f	,
+0.098017140f	,	0.995184727f	,
+0.091908956f	,	0.995767414f	,
+0.085797312f	,	0.996312612f	,
+0.079682438f	,	0.996820299f	,
+0.073564564f	,	0.997290457f	,
+0.067443920f	,	0.997723067f	,
+0.061320736f	,	0.998118113f	,
+0.055195244f	,	0.998475581f	,
+0.049067674f	,	0.998795456f	,
+0.042938257f	,	0.999077728f	,
+0.036807223f	,	0.999322385f	,
+0.030674803f	,	0.999529418f	,
+0.024541229f	,	0.999698819f	,
+0.018406730f	,	0.999830582f	,
+0.012271538f	,	0.999924702f	,
+0.006135885f	,	0.999981175f	,
+0.000000000f	,	1.000000000f	,
+-0.006135885f	,	0.999981175f	,
+-0.012271538f	,	0.999924702f	,
+-0.018406730f	,	0.999830582f	,
+-0.024541229f	,	0.999698819f	,
+-0.030674803f	,	0.999529418f	,
+-0.036807223f	,	0.999322385f	,
+-0.042938257f	,	0.999077728f	,
+-0.049067674f	,	0.998795456f	,
+-0.055195244f	,	0.998475581f	,
+-0.061320736f	,	0.998118113f	,
+-0.067443920f	,	0.997723067f	,
+-0.073564564f	,	0.997290457f	,
+-0.079682438f	,	0.996820299f	,
+-0.085797312f	,	0.996312612f	,
+-0.091908956f	,	0.995767414f	,
+-0.098017140f	,	0.995184727f	,
+-0.104121634f	,	0.994564571f	,
+-0.110222207f	,	0.993906970f	,
+-0.116318631f	,	0.993211949f	,
+-0.122410675f	,	0.992479535f	,
+-0.128498111f	,	0.991709754f	,
+-0.134580709f	,	0.990902635f	,
+-0.140658239f	,	0.990058210f	,
+-0.146730474f	,	0.989176510f	,
+-0.152797185f	,	0.988257568f	,
+-0.158858143f	,	0.987301418f	,
+-0.164913120f	,	0.986308097f	,
+-0.170961889f	,	0.985277642f	,
+-0.177004220f	,	0.984210092f	,
+-0.183039888f	,	0.983105487f	,
+-0.189068664f	,	0.981963869f	,
+-0.195090322f	,	0.980785280f	,
+-0.201104635f	,	0.979569766f	,
+-0.207111376f	,	0.978317371f	,
+-0.213110320f	,	0.977028143f	,
+-0.219101240f	,	0.975702130f	,
+-0.225083911f	,	0.974339383f	,
+-0.231058108f	,	0.972939952f	,
+-0.237023606f	,	0.971503891f	,
+-0.242980180f	,	0.970031253f	,
+-0.248927606f	,	0.968522094f	,
+-0.254865660f	,	0.966976471f	,
+-0.260794118f	,	0.965394442f	,
+-0.266712757f	,	0.963776066f	,
+-0.272621355f	,	0.962121404f	,
+-0.278519689f	,	0.960430519f	,
+-0.284407537f	,	0.958703475f	,
+-0.290284677f	,	0.956940336f	,
+-0.296150888f	,	0.955141168f	,
+-0.302005949f	,	0.953306040f	,
+-0.307849640f	,	0.951435021f	,
+-0.313681740f	,	0.949528181f	,
+-0.319502031f	,	0.947585591f	,
+-0.325310292f	,	0.945607325f	,
+-0.331106306f	,	0.943593458f	,
+-0.336889853f	,	0.941544065f	,
+-0.342660717f	,	0.939459224f	,
+-0.348418680f	,	0.937339012f	,
+-0.354163525f	,	0.935183510f	,
+-0.359895037f	,	0.932992799f	,
+-0.365612998f	,	0.930766961f	,
+-0.371317194f	,	0.928506080f	,
+-0.377007410f	,	0.926210242f	,
+-0.382683432f	,	0.923879533f	,
+-0.388345047f	,	0.921514039f	,
+-0.393992040f	,	0.919113852f	,
+-0.399624200f	,	0.916679060f	,
+-0.405241314f	,	0.914209756f	,
+-0.410843171f	,	0.911706032f	,
+-0.416429560f	,	0.909167983f	,
+-0.422000271f	,	0.906595705f	,
+-0.427555093f	,	0.903989293f	,
+-0.433093819f	,	0.901348847f	,
+-0.438616239f	,	0.898674466f	,
+-0.444122145f	,	0.895966250f	,
+-0.449611330f	,	0.893224301f	,
+-0.455083587f	,	0.890448723f	,
+-0.460538711f	,	0.887639620f	,
+-0.465976496f	,	0.884797098f	,
+-0.471396737f	,	0.881921264f	,
+-0.476799230f	,	0.879012226f	,
+-0.482183772f	,	0.876070094f	,
+-0.487550160f	,	0.873094978f	,
+-0.492898192f	,	0.870086991f	,
+-0.498227667f	,	0.867046246f	,
+-0.503538384f	,	0.863972856f	,
+-0.508830143f	,	0.860866939f	,
+-0.514102744f	,	0.857728610f	,
+-0.519355990f	,	0.854557988f	,
+-0.524589683f	,	0.851355193f	,
+-0.529803625f	,	0.848120345f	,
+-0.534997620f	,	0.844853565f	,
+-0.540171473f	,	0.841554977f	,
+-0.545324988f	,	0.838224706f	,
+-0.550457973f	,	0.834862875f	,
+-0.555570233f	,	0.831469612f	,
+-0.560661576f	,	0.828045045f	,
+-0.565731811f	,	0.824589303f	,
+-0.570780746f	,	0.821102515f	,
+-0.575808191f	,	0.817584813f	,
+-0.580813958f	,	0.814036330f	,
+-0.585797857f	,	0.810457198f	,
+-0.590759702f	,	0.806847554f	,
+-0.595699304f	,	0.803207531f	,
+-0.600616479f	,	0.799537269f	,
+-0.605511041f	,	0.795836905f	,
+-0.610382806f	,	0.792106577f	,
+-0.615231591f	,	0.788346428f	,
+-0.620057212f	,	0.784556597f	,
+-0.624859488f	,	0.780737229f	,
+-0.629638239f	,	0.776888466f	,
+-0.634393284f	,	0.773010453f	,
+-0.639124445f	,	0.769103338f	,
+-0.643831543f	,	0.765167266f	,
+-0.648514401f	,	0.761202385f	,
+-0.653172843f	,	0.757208847f	,
+-0.657806693f	,	0.753186799f	,
+-0.662415778f	,	0.749136395f	,
+-0.666999922f	,	0.745057785f	,
+-0.671558955f	,	0.740951125f	,
+-0.676092704f	,	0.736816569f	,
+-0.680600998f	,	0.732654272f	,
+-0.685083668f	,	0.728464390f	,
+-0.689540545f	,	0.724247083f	,
+-0.693971461f	,	0.720002508f	,
+-0.698376249f	,	0.715730825f	,
+-0.702754744f	,	0.711432196f	,
+-0.707106781f	,	0.707106781f	,
+-0.711432196f	,	0.702754744f	,
+-0.715730825f	,	0.698376249f	,
+-0.720002508f	,	0.693971461f	,
+-0.724247083f	,	0.689540545f	,
+-0.728464390f	,	0.685083668f	,
+-0.732654272f	,	0.680600998f	,
+-0.736816569f	,	0.676092704f	,
+-0.740951125f	,	0.671558955f	,
+-0.745057785f	,	0.666999922f	,
+-0.749136395f	,	0.662415778f	,
+-0.753186799f	,	0.657806693f	,
+-0.757208847f	,	0.653172843f	,
+-0.761202385f	,	0.648514401f	,
+-0.765167266f	,	0.643831543f	,
+-0.769103338f	,	0.639124445f	,
+-0.773010453f	,	0.634393284f	,
+-0.776888466f	,	0.629638239f	,
+-0.780737229f	,	0.624859488f	,
+-0.784556597f	,	0.620057212f	,
+-0.788346428f	,	0.615231591f	,
+-0.792106577f	,	0.610382806f	,
+-0.795836905f	,	0.605511041f	,
+-0.799537269f	,	0.600616479f	,
+-0.803207531f	,	0.595699304f	,
+-0.806847554f	,	0.590759702f	,
+-0.810457198f	,	0.585797857f	,
+-0.814036330f	,	0.580813958f	,
+-0.817584813f	,	0.575808191f	,
+-0.821102515f	,	0.570780746f	,
+-0.824589303f	,	0.565731811f	,
+-0.828045045f	,	0.560661576f	,
+-0.831469612f	,	0.555570233f	,
+-0.834862875f	,	0.550457973f	,
+-0.838224706f	,	0.545324988f	,
+-0.841554977f	,	0.540171473f	,
+-0.844853565f	,	0.534997620f	,
+-0.848120345f	,	0.529803625f	,
+-0.851355193f	,	0.524589683f	,
+-0.854557988f	,	0.519355990f	,
+-0.857728610f	,	0.514102744f	,
+-0.860866939f	,	0.508830143f	,
+-0.863972856f	,	0.503538384f	,
+-0.867046246f	,	0.498227667f	,
+-0.870086991f	,	0.492898192f	,
+-0.873094978f	,	0.487550160f	,
+-0.876070094f	,	0.482183772f	,
+-0.879012226f	,	0.476799230f	,
+-0.881921264f	,	0.471396737f	,
+-0.884797098f	,	0.465976496f	,
+-0.887639620f	,	0.460538711f	,
+-0.890448723f	,	0.455083587f	,
+-0.893224301f	,	0.449611330f	,
+-0.895966250f	,	0.444122145f	,
+-0.898674466f	,	0.438616239f	,
+-0.901348847f	,	0.433093819f	,
+-0.903989293f	,	0.427555093f	,
+-0.906595705f	,	0.422000271f	,
+-0.909167983f	,	0.416429560f	,
+-0.911706032f	,	0.410843171f	,
+-0.914209756f	,	0.405241314f	,
+-0.916679060f	,	0.399624200f	,
+-0.919113852f	,	0.393992040f	,
+-0.921514039f	,	0.388345047f	,
+-0.923879533f	,	0.382683432f	,
+-0.926210242f	,	0.377007410f	,
+-0.928506080f	,	0.371317194f	,
+-0.930766961f	,	0.365612998f	,
+-0.932992799f	,	0.359895037f	,
+-0.935183510f	,	0.354163525f	,
+-0.937339012f	,	0.348418680f	,
+-0.939459224f	,	0.342660717f	,
+-0.941544065f	,	0.336889853f	,
+-0.943593458f	,	0.331106306f	,
+-0.945607325f	,	0.325310292f	,
+-0.947585591f	,	0.319502031f	,
+-0.949528181f	,	0.313681740f	,
+-0.951435021f	,	0.307849640f	,
+-0.953306040f	,	0.302005949f	,
+-0.955141168f	,	0.296150888f	,
+-0.956940336f	,	0.290284677f	,
+-0.958703475f	,	0.284407537f	,
+-0.960430519f	,	0.278519689f	,
+-0.962121404f	,	0.272621355f	,
+-0.963776066f	,	0.266712757f	,
+-0.965394442f	,	0.260794118f	,
+-0.966976471f	,	0.254865660f	,
+-0.968522094f	,	0.248927606f	,
+-0.970031253f	,	0.242980180f	,
+-0.971503891f	,	0.237023606f	,
+-0.972939952f	,	0.231058108f	,
+-0.974339383f	,	0.225083911f	,
+-0.975702130f	,	0.219101240f	,
+-0.977028143f	,	0.213110320f	,
+-0.978317371f	,	0.207111376f	,
+-0.979569766f	,	0.201104635f	,
+-0.980785280f	,	0.195090322f	,
+-0.981963869f	,	0.189068664f	,
+-0.983105487f	,	0.183039888f	,
+-0.984210092f	,	0.177004220f	,
+-0.985277642f	,	0.170961889f	,
+-0.986308097f	,	0.164913120f	,
+-0.987301418f	,	0.158858143f	,
+-0.988257568f	,	0.152797185f	,
+-0.989176510f	,	0.146730474f	,
+-0.990058210f	,	0.140658239f	,
+-0.990902635f	,	0.134580709f	,
+-0.991709754f	,	0.128498111f	,
+-0.992479535f	,	0.122410675f	,
+-0.993211949f	,	0.116318631f	,
+-0.993906970f	,	0.110222207f	,
+-0.994564571f	,	0.104121634f	,
+-0.995184727f	,	0.098017140f	,
+-0.995767414f	,	0.091908956f	,
+-0.996312612f	,	0.085797312f	,
+-0.996820299f	,	0.079682438f	,
+-0.997290457f	,	0.073564564f	,
+-0.997723067f	,	0.067443920f	,
+-0.998118113f	,	0.061320736f	,
+-0.998475581f	,	0.055195244f	,
+-0.998795456f	,	0.049067674f	,
+-0.999077728f	,	0.042938257f	,
+-0.999322385f	,	0.036807223f	,
+-0.999529418f	,	0.030674803f	,
+-0.999698819f	,	0.024541229f	,
+-0.999830582f	,	0.018406730f	,
+-0.999924702f	,	0.012271538f	,
+-0.999981175f	,	0.006135885f	,
+-1.000000000f	,	0.000000000f	,
+-0.999981175f	,	-0.006135885f	,
+-0.999924702f	,	-0.012271538f	,
+-0.999830582f	,	-0.018406730f	,
+-0.999698819f	,	-0.024541229f	,
+-0.999529418f	,	-0.030674803f	,
+-0.999322385f	,	-0.036807223f	,
+-0.999077728f	,	-0.042938257f	,
+-0.998795456f	,	-0.049067674f	,
+-0.998475581f	,	-0.055195244f	,
+-0.998118113f	,	-0.061320736f	,
+-0.997723067f	,	-0.067443920f	,
+-0.997290457f	,	-0.073564564f	,
+-0.996820299f	,	-0.079682438f	,
+-0.996312612f	,	-0.085797312f	,
+-0.995767414f	,	-0.091908956f	,
+-0.995184727f	,	-0.098017140f	,
+-0.994564571f	,	-0.104121634f	,
+-0.993906970f	,	-0.110222207f	,
+-0.993211949f	,	-0.116318631f	,
+-0.992479535f	,	-0.122410675f	,
+-0.991709754f	,	-0.128498111f	,
+-0.990902635f	,	-0.134580709f	,
+-0.990058210f	,	-0.140658239f	,
+-0.989176510f	,	-0.146730474f	,
+-0.988257568f	,	-0.152797185f	,
+-0.987301418f	,	-0.158858143f	,
+-0.986308097f	,	-0.164913120f	,
+-0.985277642f	,	-0.170961889f	,
+-0.984210092f	,	-0.177004220f	,
+-0.983105487f	,	-0.183039888f	,
+-0.981963869f	,	-0.189068664f	,
+-0.980785280f	,	-0.195090322f	,
+-0.979569766f	,	-0.201104635f	,
+-0.978317371f	,	-0.207111376f	,
+-0.977028143f	,	-0.213110320f	,
+-0.975702130f	,	-0.219101240f	,
+-0.974339383f	,	-0.225083911f	,
+-0.972939952f	,	-0.231058108f	,
+-0.971503891f	,	-0.237023606f	,
+-0.970031253f	,	-0.242980180f	,
+-0.968522094f	,	-0.248927606f	,
+-0.966976471f	,	-0.254865660f	,
+-0.965394442f	,	-0.260794118f	,
+-0.963776066f	,	-0.266712757f	,
+-0.962121404f	,	-0.272621355f	,
+-0.960430519f	,	-0.278519689f	,
+-0.958703475f	,	-0.284407537f	,
+-0.956940336f	,	-0.290284677f	,
+-0.955141168f	,	-0.296150888f	,
+-0.953306040f	,	-0.302005949f	,
+-0.951435021f	,	-0.307849640f	,
+-0.949528181f	,	-0.313681740f	,
+-0.947585591f	,	-0.319502031f	,
+-0.945607325f	,	-0.325310292f	,
+-0.943593458f	,	-0.331106306f	,
+-0.941544065f	,	-0.336889853f	,
+-0.939459224f	,	-0.342660717f	,
+-0.937339012f	,	-0.348418680f	,
+-0.935183510f	,	-0.354163525f	,
+-0.932992799f	,	-0.359895037f	,
+-0.930766961f	,	-0.365612998f	,
+-0.928506080f	,	-0.371317194f	,
+-0.926210242f	,	-0.377007410f	,
+-0.923879533f	,	-0.382683432f	,
+-0.921514039f	,	-0.388345047f	,
+-0.919113852f	,	-0.393992040f	,
+-0.916679060f	,	-0.399624200f	,
+-0.914209756f	,	-0.405241314f	,
+-0.911706032f	,	-0.410843171f	,
+-0.909167983f	,	-0.416429560f	,
+-0.906595705f	,	-0.422000271f	,
+-0.903989293f	,	-0.427555093f	,
+-0.901348847f	,	-0.433093819f	,
+-0.898674466f	,	-0.438616239f	,
+-0.895966250f	,	-0.444122145f	,
+-0.893224301f	,	-0.449611330f	,
+-0.890448723f	,	-0.455083587f	,
+-0.887639620f	,	-0.460538711f	,
+-0.884797098f	,	-0.465976496f	,
+-0.881921264f	,	-0.471396737f	,
+-0.879012226f	,	-0.476799230f	,
+-0.876070094f	,	-0.482183772f	,
+-0.873094978f	,	-0.487550160f	,
+-0.870086991f	,	-0.492898192f	,
+-0.867046246f	,	-0.498227667f	,
+-0.863972856f	,	-0.503538384f	,
+-0.860866939f	,	-0.508830143f	,
+-0.857728610f	,	-0.514102744f	,
+-0.854557988f	,	-0.519355990f	,
+-0.851355193f	,	-0.524589683f	,
+-0.848120345f	,	-0.529803625f	,
+-0.844853565f	,	-0.534997620f	,
+-0.841554977f	,	-0.540171473f	,
+-0.838224706f	,	-0.545324988f	,
+-0.834862875f	,	-0.550457973f	,
+-0.831469612f	,	-0.555570233f	,
+-0.828045045f	,	-0.560661576f	,
+-0.824589303f	,	-0.565731811f	,
+-0.821102515f	,	-0.570780746f	,
+-0.817584813f	,	-0.575808191f	,
+-0.814036330f	,	-0.580813958f	,
+-0.810457198f	,	-0.585797857f	,
+-0.806847554f	,	-0.590759702f	,
+-0.803207531f	,	-0.595699304f	,
+-0.799537269f	,	-0.600616479f	,
+-0.795836905f	,	-0.605511041f	,
+-0.792106577f	,	-0.610382806f	,
+-0.788346428f	,	-0.615231591f	,
+-0.784556597f	,	-0.620057212f	,
+-0.780737229f	,	-0.624859488f	,
+-0.776888466f	,	-0.629638239f	,
+-0.773010453f	,	-0.634393284f	,
+-0.769103338f	,	-0.639124445f	,
+-0.765167266f	,	-0.643831543f	,
+-0.761202385f	,	-0.648514401f	,
+-0.757208847f	,	-0.653172843f	,
+-0.753186799f	,	-0.657806693f	,
+-0.749136395f	,	-0.662415778f	,
+-0.745057785f	,	-0.666999922f	,
+-0.740951125f	,	-0.671558955f	,
+-0.736816569f	,	-0.676092704f	,
+-0.732654272f	,	-0.680600998f	,
+-0.728464390f	,	-0.685083668f	,
+-0.724247083f	,	-0.689540545f	,
+-0.720002508f	,	-0.693971461f	,
+-0.715730825f	,	-0.698376249f	,
+-0.711432196f	,	-0.702754744f	,
+-0.707106781f	,	-0.707106781f	,
+-0.702754744f	,	-0.711432196f	,
+-0.698376249f	,	-0.715730825f	,
+-0.693971461f	,	-0.720002508f	,
+-0.689540545f	,	-0.724247083f	,
+-0.685083668f	,	-0.728464390f	,
+-0.680600998f	,	-0.732654272f	,
+-0.676092704f	,	-0.736816569f	,
+-0.671558955f	,	-0.740951125f	,
+-0.666999922f	,	-0.745057785f	,
+-0.662415778f	,	-0.749136395f	,
+-0.657806693f	,	-0.753186799f	,
+-0.653172843f	,	-0.757208847f	,
+-0.648514401f	,	-0.761202385f	,
+-0.643831543f	,	-0.765167266f	,
+-0.639124445f	,	-0.769103338f	,
+-0.634393284f	,	-0.773010453f	,
+-0.629638239f	,	-0.776888466f	,
+-0.624859488f	,	-0.780737229f	,
+-0.620057212f	,	-0.784556597f	,
+-0.615231591f	,	-0.788346428f	,
+-0.610382806f	,	-0.792106577f	,
+-0.605511041f	,	-0.795836905f	,
+-0.600616479f	,	-0.799537269f	,
+-0.595699304f	,	-0.803207531f	,
+-0.590759702f	,	-0.806847554f	,
+-0.585797857f	,	-0.810457198f	,
+-0.580813958f	,	-0.814036330f	,
+-0.575808191f	,	-0.817584813f	,
+-0.570780746f	,	-0.821102515f	,
+-0.565731811f	,	-0.824589303f	,
+-0.560661576f	,	-0.828045045f	,
+-0.555570233f	,	-0.831469612f	,
+-0.550457973f	,	-0.834862875f	,
+-0.545324988f	,	-0.838224706f	,
+-0.540171473f	,	-0.841554977f	,
+-0.534997620f	,	-0.844853565f	,
+-0.529803625f	,	-0.848120345f	,
+-0.524589683f	,	-0.851355193f	,
+-0.519355990f	,	-0.854557988f	,
+-0.514102744f	,	-0.857728610f	,
+-0.508830143f	,	-0.860866939f	,
+-0.503538384f	,	-0.863972856f	,
+-0.498227667f	,	-0.867046246f	,
+-0.492898192f	,	-0.870086991f	,
+-0.487550160f	,	-0.873094978f	,
+-0.482183772f	,	-0.876070094f	,
+-0.476799230f	,	-0.879012226f	,
+-0.471396737f	,	-0.881921264f	,
+-0.465976496f	,	-0.884797098f	,
+-0.460538711f	,	-0.887639620f	,
+-0.455083587f	,	-0.890448723f	,
+-0.449611330f	,	-0.893224301f	,
+-0.444122145f	,	-0.895966250f	,
+-0.438616239f	,	-0.898674466f	,
+-0.433093819f	,	-0.901348847f	,
+-0.427555093f	,	-0.903989293f	,
+-0.422000271f	,	-0.906595705f	,
+-0.416429560f	,	-0.909167983f	,
+-0.410843171f	,	-0.911706032f	,
+-0.405241314f	,	-0.914209756f	,
+-0.399624200f	,	-0.916679060f	,
+-0.393992040f	,	-0.919113852f	,
+-0.388345047f	,	-0.921514039f	,
+-0.382683432f	,	-0.923879533f	,
+-0.377007410f	,	-0.926210242f	,
+-0.371317194f	,	-0.928506080f	,
+-0.365612998f	,	-0.930766961f	,
+-0.359895037f	,	-0.932992799f	,
+-0.354163525f	,	-0.935183510f	,
+-0.348418680f	,	-0.937339012f	,
+-0.342660717f	,	-0.939459224f	,
+-0.336889853f	,	-0.941544065f	,
+-0.331106306f	,	-0.943593458f	,
+-0.325310292f	,	-0.945607325f	,
+-0.319502031f	,	-0.947585591f	,
+-0.313681740f	,	-0.949528181f	,
+-0.307849640f	,	-0.951435021f	,
+-0.302005949f	,	-0.953306040f	,
+-0.296150888f	,	-0.955141168f	,
+-0.290284677f	,	-0.956940336f	,
+-0.284407537f	,	-0.958703475f	,
+-0.278519689f	,	-0.960430519f	,
+-0.272621355f	,	-0.962121404f	,
+-0.266712757f	,	-0.963776066f	,
+-0.260794118f	,	-0.965394442f	,
+-0.254865660f	,	-0.966976471f	,
+-0.248927606f	,	-0.968522094f	,
+-0.242980180f	,	-0.970031253f	,
+-0.237023606f	,	-0.971503891f	,
+-0.231058108f	,	-0.972939952f	,
+-0.225083911f	,	-0.974339383f	,
+-0.219101240f	,	-0.975702130f	,
+-0.213110320f	,	-0.977028143f	,
+-0.207111376f	,	-0.978317371f	,
+-0.201104635f	,	-0.979569766f	,
+-0.195090322f	,	-0.980785280f	,
+-0.189068664f	,	-0.981963869f	,
+-0.183039888f	,	-0.983105487f	,
+-0.177004220f	,	-0.984210092f	,
+-0.170961889f	,	-0.985277642f	,
+-0.164913120f	,	-0.986308097f	,
+-0.158858143f	,	-0.987301418f	,
+-0.152797185f	,	-0.988257568f	,
+-0.146730474f	,	-0.989176510f	,
+-0.140658239f	,	-0.990058210f	,
+-0.134580709f	,	-0.990902635f	,
+-0.128498111f	,	-0.991709754f	,
+-0.122410675f	,	-0.992479535f	,
+-0.116318631f	,	-0.993211949f	,
+-0.110222207f	,	-0.993906970f	,
+-0.104121634f	,	-0.994564571f	,
+-0.098017140f	,	-0.995184727f	,
+-0.091908956f	,	-0.995767414f	,
+-0.085797312f	,	-0.996312612f	,
+-0.079682438f	,	-0.996820299f	,
+-0.073564564f	,	-0.997290457f	,
+-0.067443920f	,	-0.997723067f	,
+-0.061320736f	,	-0.998118113f	,
+-0.055195244f	,	-0.998475581f	,
+-0.049067674f	,	-0.998795456f	,
+-0.042938257f	,	-0.999077728f	,
+-0.036807223f	,	-0.999322385f	,
+-0.030674803f	,	-0.999529418f	,
+-0.024541229f	,	-0.999698819f	,
+-0.018406730f	,	-0.999830582f	,
+-0.012271538f	,	-0.999924702f	,
+-0.006135885f	,	-0.999981175f	,
+-0.000000000f	,	-1.000000000f	,
+0.006135885f	,	-0.999981175f	,
+0.012271538f	,	-0.999924702f	,
+0.018406730f	,	-0.999830582f	,
+0.024541229f	,	-0.999698819f	,
+0.030674803f	,	-0.999529418f	,
+0.036807223f	,	-0.999322385f	,
+0.042938257f	,	-0.999077728f	,
+0.049067674f	,	-0.998795456f	,
+0.055195244f	,	-0.998475581f	,
+0.061320736f	,	-0.998118113f	,
+0.067443920f	,	-0.997723067f	,
+0.073564564f	,	-0.997290457f	,
+0.079682438f	,	-0.996820299f	,
+0.085797312f	,	-0.996312612f	,
+0.091908956f	,	-0.995767414f	,
+0.098017140f	,	-0.995184727f	,
+0.104121634f	,	-0.994564571f	,
+0.110222207f	,	-0.993906970f	,
+0.116318631f	,	-0.993211949f	,
+0.122410675f	,	-0.992479535f	,
+0.128498111f	,	-0.991709754f	,
+0.134580709f	,	-0.990902635f	,
+0.140658239f	,	-0.990058210f	,
+0.146730474f	,	-0.989176510f	,
+0.152797185f	,	-0.988257568f	,
+0.158858143f	,	-0.987301418f	,
+0.164913120f	,	-0.986308097f	,
+0.170961889f	,	-0.985277642f	,
+0.177004220f	,	-0.984210092f	,
+0.183039888f	,	-0.983105487f	,
+0.189068664f	,	-0.981963869f	,
+0.195090322f	,	-0.980785280f	,
+0.201104635f	,	-0.979569766f	,
+0.207111376f	,	-0.978317371f	,
+0.213110320f	,	-0.977028143f	,
+0.219101240f	,	-0.975702130f	,
+0.225083911f	,	-0.974339383f	,
+0.231058108f	,	-0.972939952f	,
+0.237023606f	,	-0.971503891f	,
+0.242980180f	,	-0.970031253f	,
+0.248927606f	,	-0.968522094f	,
+0.254865660f	,	-0.966976471f	,
+0.260794118f	,	-0.965394442f	,
+0.266712757f	,	-0.963776066f	,
+0.272621355f	,	-0.962121404f	,
+0.278519689f	,	-0.960430519f	,
+0.284407537f	,	-0.958703475f	,
+0.290284677f	,	-0.956940336f	,
+0.296150888f	,	-0.955141168f	,
+0.302005949f	,	-0.953306040f	,
+0.307849640f	,	-0.951435021f	,
+0.313681740f	,	-0.949528181f	,
+0.319502031f	,	-0.947585591f	,
+0.325310292f	,	-0.945607325f	,
+0.331106306f	,	-0.943593458f	,
+0.336889853f	,	-0.941544065f	,
+0.342660717f	,	-0.939459224f	,
+0.348418680f	,	-0.937339012f	,
+0.354163525f	,	-0.935183510f	,
+0.359895037f	,	-0.932992799f	,
+0.365612998f	,	-0.930766961f	,
+0.371317194f	,	-0.928506080f	,
+0.377007410f	,	-0.926210242f	,
+0.382683432f	,	-0.923879533f	,
+0.388345047f	,	-0.921514039f	,
+0.393992040f	,	-0.919113852f	,
+0.399624200f	,	-0.916679060f	,
+0.405241314f	,	-0.914209756f	,
+0.410843171f	,	-0.911706032f	,
+0.416429560f	,	-0.909167983f	,
+0.422000271f	,	-0.906595705f	,
+0.427555093f	,	-0.903989293f	,
+0.433093819f	,	-0.901348847f	,
+0.438616239f	,	-0.898674466f	,
+0.444122145f	,	-0.895966250f	,
+0.449611330f	,	-0.893224301f	,
+0.455083587f	,	-0.890448723f	,
+0.460538711f	,	-0.887639620f	,
+0.465976496f	,	-0.884797098f	,
+0.471396737f	,	-0.881921264f	,
+0.476799230f	,	-0.879012226f	,
+0.482183772f	,	-0.876070094f	,
+0.487550160f	,	-0.873094978f	,
+0.492898192f	,	-0.870086991f	,
+0.498227667f	,	-0.867046246f	,
+0.503538384f	,	-0.863972856f	,
+0.508830143f	,	-0.860866939f	,
+0.514102744f	,	-0.857728610f	,
+0.519355990f	,	-0.854557988f	,
+0.524589683f	,	-0.851355193f	,
+0.529803625f	,	-0.848120345f	,
+0.534997620f	,	-0.844853565f	,
+0.540171473f	,	-0.841554977f	,
+0.545324988f	,	-0.838224706f	,
+0.550457973f	,	-0.834862875f	,
+0.555570233f	,	-0.831469612f	,
+0.560661576f	,	-0.828045045f	,
+0.565731811f	,	-0.824589303f	,
+0.570780746f	,	-0.821102515f	,
+0.575808191f	,	-0.817584813f	,
+0.580813958f	,	-0.814036330f	,
+0.585797857f	,	-0.810457198f	,
+0.590759702f	,	-0.806847554f	,
+0.595699304f	,	-0.803207531f	,
+0.600616479f	,	-0.799537269f	,
+0.605511041f	,	-0.795836905f	,
+0.610382806f	,	-0.792106577f	,
+0.615231591f	,	-0.788346428f	,
+0.620057212f	,	-0.784556597f	,
+0.624859488f	,	-0.780737229f	,
+0.629638239f	,	-0.776888466f	,
+0.634393284f	,	-0.773010453f	,
+0.639124445f	,	-0.769103338f	,
+0.643831543f	,	-0.765167266f	,
+0.648514401f	,	-0.761202385f	,
+0.653172843f	,	-0.757208847f	,
+0.657806693f	,	-0.753186799f	,
+0.662415778f	,	-0.749136395f	,
+0.666999922f	,	-0.745057785f	,
+0.671558955f	,	-0.740951125f	,
+0.676092704f	,	-0.736816569f	,
+0.680600998f	,	-0.732654272f	,
+0.685083668f	,	-0.728464390f	,
+0.689540545f	,	-0.724247083f	,
+0.693971461f	,	-0.720002508f	,
+0.698376249f	,	-0.715730825f	,
+0.702754744f	,	-0.711432196f	,
+0.707106781f	,	-0.707106781f	,
+0.711432196f	,	-0.702754744f	,
+0.715730825f	,	-0.698376249f	,
+0.720002508f	,	-0.693971461f	,
+0.724247083f	,	-0.689540545f	,
+0.728464390f	,	-0.685083668f	,
+0.732654272f	,	-0.680600998f	,
+0.736816569f	,	-0.676092704f	,
+0.740951125f	,	-0.671558955f	,
+0.745057785f	,	-0.666999922f	,
+0.749136395f	,	-0.662415778f	,
+0.753186799f	,	-0.657806693f	,
+0.757208847f	,	-0.653172843f	,
+0.761202385f	,	-0.648514401f	,
+0.765167266f	,	-0.643831543f	,
+0.769103338f	,	-0.639124445f	,
+0.773010453f	,	-0.634393284f	,
+0.776888466f	,	-0.629638239f	,
+0.780737229f	,	-0.624859488f	,
+0.784556597f	,	-0.620057212f	,
+0.788346428f	,	-0.615231591f	,
+0.792106577f	,	-0.610382806f	,
+0.795836905f	,	-0.605511041f	,
+0.799537269f	,	-0.600616479f	,
+0.803207531f	,	-0.595699304f	,
+0.806847554f	,	-0.590759702f	,
+0.810457198f	,	-0.585797857f	,
+0.814036330f	,	-0.580813958f	,
+0.817584813f	,	-0.575808191f	,
+0.821102515f	,	-0.570780746f	,
+0.824589303f	,	-0.565731811f	,
+0.828045045f	,	-0.560661576f	,
+0.831469612f	,	-0.555570233f	,
+0.834862875f	,	-0.550457973f	,
+0.838224706f	,	-0.545324988f	,
+0.841554977f	,	-0.540171473f	,
+0.844853565f	,	-0.534997620f	,
+0.848120345f	,	-0.529803625f	,
+0.851355193f	,	-0.524589683f	,
+0.854557988f	,	-0.519355990f	,
+0.857728610f	,	-0.514102744f	,
+0.860866939f	,	-0.508830143f	,
+0.863972856f	,	-0.503538384f	,
+0.867046246f	,	-0.498227667f	,
+0.870086991f	,	-0.492898192f	,
+0.873094978f	,	-0.487550160f	,
+0.876070094f	,	-0.482183772f	,
+0.879012226f	,	-0.476799230f	,
+0.881921264f	,	-0.471396737f	,
+0.884797098f	,	-0.465976496f	,
+0.887639620f	,	-0.460538711f	,
+0.890448723f	,	-0.455083587f	,
+0.893224301f	,	-0.449611330f	,
+0.895966250f	,	-0.444122145f	,
+0.898674466f	,	-0.438616239f	,
+0.901348847f	,	-0.433093819f	,
+0.903989293f	,	-0.427555093f	,
+0.906595705f	,	-0.422000271f	,
+0.909167983f	,	-0.416429560f	,
+0.911706032f	,	-0.410843171f	,
+0.914209756f	,	-0.405241314f	,
+0.916679060f	,	-0.399624200f	,
+0.919113852f	,	-0.393992040f	,
+0.921514039f	,	-0.388345047f	,
+0.923879533f	,	-0.382683432f	,
+0.926210242f	,	-0.377007410f	,
+0.928506080f	,	-0.371317194f	,
+0.930766961f	,	-0.365612998f	,
+0.932992799f	,	-0.359895037f	,
+0.935183510f	,	-0.354163525f	,
+0.937339012f	,	-0.348418680f	,
+0.939459224f	,	-0.342660717f	,
+0.941544065f	,	-0.336889853f	,
+0.943593458f	,	-0.331106306f	,
+0.945607325f	,	-0.325310292f	,
+0.947585591f	,	-0.319502031f	,
+0.949528181f	,	-0.313681740f	,
+0.951435021f	,	-0.307849640f	,
+0.953306040f	,	-0.302005949f	,
+0.955141168f	,	-0.296150888f	,
+0.956940336f	,	-0.290284677f	,
+0.958703475f	,	-0.284407537f	,
+0.960430519f	,	-0.278519689f	,
+0.962121404f	,	-0.272621355f	,
+0.963776066f	,	-0.266712757f	,
+0.965394442f	,	-0.260794118f	,
+0.966976471f	,	-0.254865660f	,
+0.968522094f	,	-0.248927606f	,
+0.970031253f	,	-0.242980180f	,
+0.971503891f	,	-0.237023606f	,
+0.972939952f	,	-0.231058108f	,
+0.974339383f	,	-0.225083911f	,
+0.975702130f	,	-0.219101240f	,
+0.977028143f	,	-0.213110320f	,
+0.978317371f	,	-0.207111376f	,
+0.979569766f	,	-0.201104635f	,
+0.980785280f	,	-0.195090322f	,
+0.981963869f	,	-0.189068664f	,
+0.983105487f	,	-0.183039888f	,
+0.984210092f	,	-0.177004220f	,
+0.985277642f	,	-0.170961889f	,
+0.986308097f	,	-0.164913120f	,
+0.987301418f	,	-0.158858143f	,
+0.988257568f	,	-0.152797185f	,
+0.989176510f	,	-0.146730474f	,
+0.990058210f	,	-0.140658239f	,
+0.990902635f	,	-0.134580709f	,
+0.991709754f	,	-0.128498111f	,
+0.992479535f	,	-0.122410675f	,
+0.993211949f	,	-0.116318631f	,
+0.993906970f	,	-0.110222207f	,
+0.994564571f	,	-0.104121634f	,
+0.995184727f	,	-0.098017140f	,
+0.995767414f	,	-0.091908956f	,
+0.996312612f	,	-0.085797312f	,
+0.996820299f	,	-0.079682438f	,
+0.997290457f	,	-0.073564564f	,
+0.997723067f	,	-0.067443920f	,
+0.998118113f	,	-0.061320736f	,
+0.998475581f	,	-0.055195244f	,
+0.998795456f	,	-0.049067674f	,
+0.999077728f	,	-0.042938257f	,
+0.999322385f	,	-0.036807223f	,
+0.999529418f	,	-0.030674803f	,
+0.999698819f	,	-0.024541229f	,
+0.999830582f	,	-0.018406730f	,
+0.999924702f	,	-0.012271538f	,
+0.999981175f	,	-0.006135885f
+};
+
+/**    
+* @} end of CFFT_CIFFT group    
+*/
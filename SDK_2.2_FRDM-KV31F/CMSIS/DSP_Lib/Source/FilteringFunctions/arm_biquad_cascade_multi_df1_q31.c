@@ -0,0 +1,234 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_biquad_cascade_multi_df1_q31.c
+*
+* Description:  Processing function for the Q31 multi-channel Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Processing function for the Q31 multi-channel Biquad cascade filter.
+ * @param[in]  *S         points to an instance of the Q31 multi-channel Biquad cascade structure.
+ * @param[in]  *pSrc      points to the block of interleaved input data.
+ * @param[out] *pDst      points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples to process per channel.
+ * @return     none.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The arithmetic is that of arm_biquad_cascade_df1_q31(): the 5 products of a
+ * sample are accumulated in a 2.62 accumulator, which is shifted by
+ * <code>postShift</code> bits and truncated to 1.31 without saturation.
+ *
+ * \par
+ * The input and output blocks hold <code>blockSize</code> frames of
+ * <code>numChannels</code> interleaved samples and every channel is filtered
+ * by the same cascade.  pSrc and pDst may be the same buffer.
+ */
+
+void arm_biquad_cascade_multi_df1_q31(
+  const arm_biquad_cascade_multi_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize)
+{
+  q31_t *pStageIn = pSrc;                        /*  input of the current stage */
+  q31_t *pIn;                                    /*  source pointer            */
+  q31_t *pOut;                                   /*  destination pointer       */
+  q31_t *pState = S->pState;                     /*  pState pointer            */
+  q31_t *pCoeffs = S->pCoeffs;                   /*  coefficient pointer       */
+  q63_t acc;                                     /*  accumulator               */
+  q31_t b0, b1, b2, a1, a2;                      /*  Filter coefficients       */
+  q31_t Xn1, Xn2, Yn1, Yn2;                      /*  Filter pState variables   */
+  q31_t Xn;                                      /*  temporary input           */
+  uint32_t lShift = 31u - (uint32_t) S->postShift; /*  Shift to be applied to the output */
+  uint32_t numCh = S->numChannels;               /*  number of channels, also the sample stride */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients, shared by all the channels */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    for (ch = 0u; ch < numCh; ch++)
+    {
+      /* Channel ch is every numCh-th sample from offset ch */
+      pIn = pStageIn + ch;
+      pOut = pDst + ch;
+
+      /* Reading the pState values: the stage holds {x[n-1], x[n-2], y[n-1], y[n-2]} of every channel */
+      Xn1 = pState[ch];
+      Xn2 = pState[numCh + ch];
+      Yn1 = pState[(2u * numCh) + ch];
+      Yn2 = pState[(3u * numCh) + ch];
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      /* Apply loop unrolling and compute 4 output values of the channel simultaneously,
+       * rotating the roles of the state variables instead of moving them. */
+      sample = blockSize >> 2u;
+
+      while(sample > 0u)
+      {
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        Xn = *pIn;
+        pIn += numCh;
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+        Yn2 = (q31_t) (acc >> lShift);
+        *pOut = Yn2;
+        pOut += numCh;
+
+        Xn2 = *pIn;
+        pIn += numCh;
+        acc = (q63_t) b0 * Xn2;
+        acc += (q63_t) b1 * Xn;
+        acc += (q63_t) b2 * Xn1;
+        acc += (q63_t) a1 * Yn2;
+        acc += (q63_t) a2 * Yn1;
+        Yn1 = (q31_t) (acc >> lShift);
+        *pOut = Yn1;
+        pOut += numCh;
+
+        Xn1 = *pIn;
+        pIn += numCh;
+        acc = (q63_t) b0 * Xn1;
+        acc += (q63_t) b1 * Xn2;
+        acc += (q63_t) b2 * Xn;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+        Yn2 = (q31_t) (acc >> lShift);
+        *pOut = Yn2;
+        pOut += numCh;
+
+        Xn = *pIn;
+        pIn += numCh;
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn2;
+        acc += (q63_t) a2 * Yn1;
+        Yn1 = (q31_t) (acc >> lShift);
+        *pOut = Yn1;
+        pOut += numCh;
+
+        /* Xn2 = x[n-1], Xn1 = x[n] */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+       ** No loop unrolling is used. */
+      sample = blockSize & 0x3u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+      sample = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY         */
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn = *pIn;
+        pIn += numCh;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = (q63_t) b0 * Xn;
+        acc += (q63_t) b1 * Xn1;
+        acc += (q63_t) b2 * Xn2;
+        acc += (q63_t) a1 * Yn1;
+        acc += (q63_t) a2 * Yn2;
+
+        /* The result is converted to 1.31  */
+        acc = acc >> lShift;
+
+        /* Every time after the output is computed state should be updated. */
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = (q31_t) acc;
+
+        /* Store the output in the destination buffer. */
+        *pOut = (q31_t) acc;
+        pOut += numCh;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /*  Store the updated state variables back into the pState array */
+      pState[ch] = Xn1;
+      pState[numCh + ch] = Xn2;
+      pState[(2u * numCh) + ch] = Yn1;
+      pState[(3u * numCh) + ch] = Yn2;
+    }
+
+    /*  The first stage goes from the input buffer to the output buffer. */
+    /*  Subsequent stages occur in-place in the output buffer */
+    pStageIn = pDst;
+
+    /* State of the next stage */
+    pState += 4u * numCh;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,200 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_biquad_cascade_multi_df2T_f32.c
+*
+* Description:  Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF2T
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+ * @param[in]  *S         points to an instance of the filter data structure.
+ * @param[in]  *pSrc      points to the block of interleaved input data.
+ * @param[out] *pDst      points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples to process per channel.
+ * @return     none.
+ *
+ * \par
+ * The input and output blocks hold <code>blockSize</code> frames of
+ * <code>numChannels</code> interleaved samples and every channel is filtered
+ * by the same cascade, as arm_biquad_cascade_stereo_df2T_f32() does for two
+ * channels.  pSrc and pDst may be the same buffer.
+ */
+
+void arm_biquad_cascade_multi_df2T_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pStageIn = pSrc;                    /*  input of the current stage */
+  float32_t *pIn;                                /*  source pointer            */
+  float32_t *pOut;                               /*  destination pointer       */
+  float32_t *pState = S->pState;                 /*  State pointer             */
+  float32_t *pCoeffs = S->pCoeffs;               /*  coefficient pointer       */
+  float32_t acc1;                                /*  accumulator               */
+  float32_t b0, b1, b2, a1, a2;                  /*  Filter coefficients       */
+  float32_t Xn1;                                 /*  temporary input           */
+  float32_t d1, d2;                              /*  state variables           */
+  uint32_t numCh = S->numChannels;               /*  number of channels, also the sample stride */
+  uint32_t sample, ch, stage = S->numStages;     /*  loop counters             */
+
+  do
+  {
+    /* Reading the coefficients, shared by all the channels */
+    b0 = *pCoeffs++;
+    b1 = *pCoeffs++;
+    b2 = *pCoeffs++;
+    a1 = *pCoeffs++;
+    a2 = *pCoeffs++;
+
+    for (ch = 0u; ch < numCh; ch++)
+    {
+      /* Channel ch is every numCh-th sample from offset ch */
+      pIn = pStageIn + ch;
+      pOut = pDst + ch;
+
+      /* Reading the state values: the stage holds {d1, d2} of every channel */
+      d1 = pState[ch];
+      d2 = pState[numCh + ch];
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+      /* Apply loop unrolling and compute 4 output values of the channel per iteration. */
+      sample = blockSize >> 2u;
+
+      while(sample > 0u)
+      {
+        /* y[n] = b0 * x[n] + d1, d1 = b1 * x[n] + a1 * y[n] + d2, d2 = b2 * x[n] + a2 * y[n] */
+        Xn1 = *pIn;
+        pIn += numCh;
+        acc1 = (b0 * Xn1) + d1;
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+        d2 = (b2 * Xn1) + (a2 * acc1);
+        *pOut = acc1;
+        pOut += numCh;
+
+        Xn1 = *pIn;
+        pIn += numCh;
+        acc1 = (b0 * Xn1) + d1;
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+        d2 = (b2 * Xn1) + (a2 * acc1);
+        *pOut = acc1;
+        pOut += numCh;
+
+        Xn1 = *pIn;
+        pIn += numCh;
+        acc1 = (b0 * Xn1) + d1;
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+        d2 = (b2 * Xn1) + (a2 * acc1);
+        *pOut = acc1;
+        pOut += numCh;
+
+        Xn1 = *pIn;
+        pIn += numCh;
+        acc1 = (b0 * Xn1) + d1;
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+        d2 = (b2 * Xn1) + (a2 * acc1);
+        *pOut = acc1;
+        pOut += numCh;
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+       ** No loop unrolling is used. */
+      sample = blockSize & 0x3u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+      sample = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY         */
+
+      while(sample > 0u)
+      {
+        /* Read the input */
+        Xn1 = *pIn;
+        pIn += numCh;
+
+        /* y[n] = b0 * x[n] + d1 */
+        acc1 = (b0 * Xn1) + d1;
+
+        /* Store the result in the accumulator in the destination buffer. */
+        *pOut = acc1;
+        pOut += numCh;
+
+        /* Every time after the output is computed state should be updated. */
+        /* d1 = b1 * x[n] + a1 * y[n] + d2 */
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+
+        /* d2 = b2 * x[n] + a2 * y[n] */
+        d2 = (b2 * Xn1) + (a2 * acc1);
+
+        /* decrement the loop counter */
+        sample--;
+      }
+
+      /* Store the updated state variables back into the state array */
+      pState[ch] = d1;
+      pState[numCh + ch] = d2;
+    }
+
+    /* The current stage input is given as the output to the next stage */
+    pStageIn = pDst;
+
+    /* State of the next stage */
+    pState += 2u * numCh;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+}
+
+/**
+ * @} end of BiquadCascadeDF2T group
+ */
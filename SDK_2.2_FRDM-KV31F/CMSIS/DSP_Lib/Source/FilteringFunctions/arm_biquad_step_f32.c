@@ -0,0 +1,103 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_biquad_step_f32.c
+*
+* Description:  Single-sample processing function for the floating-point Biquad cascade filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup BiquadCascadeDF1
+ * @{
+ */
+
+/**
+ * @brief Filters one sample with the floating-point Biquad cascade filter.
+ * @param[in]  *S   points to an instance of the floating-point Biquad cascade structure.
+ * @param[in]  in   input sample.
+ * @return     output sample.
+ *
+ * \par
+ * Gives the output of arm_biquad_cascade_df1_f32() with a <code>blockSize</code> of 1 and
+ * updates the same state, so that single samples and blocks may be mixed.  The
+ * output of each stage is passed to the next one in a register instead of
+ * through the output buffer, and there is no block loop to set up, which makes
+ * it the cheaper call for a control loop that filters one sample per period.
+ */
+
+float32_t arm_biquad_step_f32(
+  const arm_biquad_casd_df1_inst_f32 * S,
+  float32_t in)
+{
+  float32_t *pState = S->pState;                 /*  State pointer                */
+  float32_t *pCoeffs = S->pCoeffs;               /*  Coefficient pointer          */
+  float32_t Xn = in;                             /*  Input of the current stage   */
+  float32_t acc;                                 /*  Accumulator                  */
+  uint32_t stage = S->numStages;                 /*  Stage loop counter           */
+
+  do
+  {
+    /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+    acc = (pCoeffs[0] * Xn) + (pCoeffs[1] * pState[0]) + (pCoeffs[2] * pState[1]) +
+      (pCoeffs[3] * pState[2]) + (pCoeffs[4] * pState[3]);
+
+    /* Every time after the output is computed state should be updated. */
+    /* Xn2 = Xn1, Xn1 = Xn, Yn2 = Yn1, Yn1 = acc */
+    pState[1] = pState[0];
+    pState[0] = Xn;
+    pState[3] = pState[2];
+    pState[2] = (float32_t) acc;
+
+    /* The output of the stage is the input of the next one */
+    Xn = (float32_t) acc;
+
+    /* Advance to the next stage */
+    pState += 4u;
+    pCoeffs += 5u;
+
+    /* decrement the loop counter */
+    stage--;
+
+  } while(stage > 0u);
+
+  return (Xn);
+}
+
+/**
+ * @} end of BiquadCascadeDF1 group
+ */
@@ -0,0 +1,222 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_multi_f32.c
+*
+* Description:  Processing function for the floating-point multi-channel FIR filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point multi-channel FIR filter.
+ * @param[in]  *S         points to an instance of the floating-point multi-channel FIR filter structure.
+ * @param[in]  *pSrc      points to the block of interleaved input data.
+ * @param[out] *pDst      points to the block of interleaved output data.
+ * @param[in]  blockSize  number of samples to process per channel.
+ * @return     none.
+ *
+ * \par
+ * The input and output blocks hold <code>blockSize</code> frames of
+ * <code>numChannels</code> interleaved samples, as read from a sensor FIFO, and
+ * every channel is filtered with the same coefficients.  The block is copied
+ * into the state buffer once and each channel is then read with a stride of
+ * <code>numChannels</code>, so no de-interleave copy is needed.
+ */
+
+void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pBase;                              /* Oldest sample of the current channel */
+  float32_t *pOut;                               /* Output pointer of the current channel */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t acc0;                              /* Accumulator */
+  uint32_t numTaps = S->numTaps;           /* Number of filter coefficients in the filter */
+  uint32_t numCh = S->numChannels;         /* Number of channels, also the sample stride */
+  uint32_t ch, tapCnt, blkCnt;             /* Loop counters */
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+  /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+  float32_t acc1, acc2, acc3;                  /* Accumulators */
+  float32_t x0, x1, x2, x3, c0;                  /* Temporary variables to hold state and coefficient values */
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY         */
+
+  /* S->pState holds the previous (numTaps - 1) frames; append the new block behind them */
+  arm_copy_f32(pSrc, pState + ((numTaps - 1u) * numCh), blockSize * numCh);
+
+  for (ch = 0u; ch < numCh; ch++)
+  {
+    /* Channel ch is every numCh-th sample from offset ch */
+    pBase = pState + ch;
+    pOut = pDst + ch;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+    /* Compute 4 output values of the channel simultaneously.
+     * The variables acc0 ... acc3 hold output values that are being computed:
+     *
+     *    acc0 =  b[numTaps-1] * x[n-numTaps-1] + b[numTaps-2] * x[n-numTaps-2] + ... + b[0] * x[0]
+     *    acc1 =  b[numTaps-1] * x[n-numTaps]   + b[numTaps-2] * x[n-numTaps-1] + ... + b[0] * x[1]
+     *    acc2 =  b[numTaps-1] * x[n-numTaps+1] + b[numTaps-2] * x[n-numTaps]   + ... + b[0] * x[2]
+     *    acc3 =  b[numTaps-1] * x[n-numTaps+2] + b[numTaps-2] * x[n-numTaps+1] + ... + b[0] * x[3]
+     */
+    blkCnt = blockSize >> 2u;
+
+    while(blkCnt > 0u)
+    {
+      /* Set all accumulators to zero */
+      acc0 = 0.0f;
+      acc1 = 0.0f;
+      acc2 = 0.0f;
+      acc3 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pBase;
+      pb = pCoeffs;
+
+      /* Read the first three samples of the channel from the state buffer */
+      x0 = *px;
+      px += numCh;
+      x1 = *px;
+      px += numCh;
+      x2 = *px;
+      px += numCh;
+
+      tapCnt = numTaps;
+
+      while(tapCnt > 0u)
+      {
+        /* Read the coefficient and the next sample of the channel */
+        c0 = *pb++;
+        x3 = *px;
+        px += numCh;
+
+        /* Perform the multiply-accumulates */
+        acc0 += x0 * c0;
+        acc1 += x1 * c0;
+        acc2 += x2 * c0;
+        acc3 += x3 * c0;
+
+        /* Slide the window by one sample */
+        x0 = x1;
+        x1 = x2;
+        x2 = x3;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* Store the results in the destination buffer */
+      *pOut = acc0;
+      pOut += numCh;
+      *pOut = acc1;
+      pOut += numCh;
+      *pOut = acc2;
+      pOut += numCh;
+      *pOut = acc3;
+      pOut += numCh;
+
+      /* Advance the channel window by four frames */
+      pBase += 4u * numCh;
+
+      /* Decrement the loop counter */
+      blkCnt--;
+    }
+
+    /* If the blockSize is not a multiple of 4, compute any remaining output samples here.
+     ** No loop unrolling is used. */
+    blkCnt = blockSize & 0x3u;
+
+#else
+
+    /* Run the below code for Cortex-M0 */
+    blkCnt = blockSize;
+
+#endif /*   #ifndef ARM_MATH_CM0_FAMILY         */
+
+    while(blkCnt > 0u)
+    {
+      /* Set the accumulator to zero */
+      acc0 = 0.0f;
+
+      /* Initialize state and coefficient pointers */
+      px = pBase;
+      pb = pCoeffs;
+
+      tapCnt = numTaps;
+
+      /* Perform the multiply-accumulates */
+      while(tapCnt > 0u)
+      {
+        acc0 += *px * *pb++;
+        px += numCh;
+
+        tapCnt--;
+      }
+
+      /* The result is stored in the destination buffer. */
+      *pOut = acc0;
+      pOut += numCh;
+
+      /* Advance the channel window by one frame */
+      pBase += numCh;
+
+      blkCnt--;
+    }
+  }
+
+  /* Processing is complete.
+   ** Now copy the last numTaps - 1 frames to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+  arm_copy_f32(pState + (blockSize * numCh), pState, (numTaps - 1u) * numCh);
+}
+
+/**
+ * @} end of FIR group
+ */
@@ -0,0 +1,247 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_resample_f32.c
+*
+* Description:  FIR rational resampling of floating-point sequences.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @defgroup FIR_Resample Finite Impulse Response (FIR) Rational Resampler
+ *
+ * These functions change the sample rate of a signal by the rational factor <code>L/M</code>.
+ * They are equivalent to an FIR interpolator by <code>L</code> (see \ref FIR_Interpolate)
+ * followed by a decimator by <code>M</code> that keeps the samples <code>0, M, 2*M, ...</code>,
+ * and bring streams sampled at different rates, such as the FIFOs of sensors with
+ * different output data rates, onto a common timebase.
+ * The lowpass filter must have a normalized cutoff frequency of <code>1/max(L, M)</code>
+ * in order to remove both the images of the upsampler and the aliases of the downsampler.
+ * The user of the function is responsible for providing the filter coefficients.
+ *
+ * \par Algorithm:
+ * Only the outputs that are kept are computed, each one with the single polyphase component
+ * of <code>phaseLength=numTaps/L</code> taps that does not meet the stuffed zeros:
+ * <pre>
+ *    y[k] = b[p] * x[n] + b[p+L] * x[n-1] + ... + b[p+L*(phaseLength-1)] * x[n-phaseLength+1]
+ * </pre>
+ * where <code>n*L + p = k*M</code> and <code>0 <= p < L</code>.
+ * This costs <code>phaseLength</code> multiply-accumulates per output whatever the factors.
+ * <code>L</code> and <code>M</code> should be coprime; a common factor only lengthens the filter.
+ * With <code>L=1</code> the outputs are those of the \ref FIR_decimate functions and with
+ * <code>M=1</code> those of the \ref FIR_Interpolate functions.
+ * \par
+ * The number of outputs of a block depends on the position of the previous outputs and is
+ * returned by the functions.  The state holds the last inputs and the position of the next output,
+ * so blocks of varying size, such as the bursts read from a FIFO, give the same outputs as one
+ * long block.  <code>pDst</code> must hold <code>(blockSize*L + M - 1)/M</code> outputs.
+ * \par
+ * <code>pCoeffs</code> points to a coefficient array of size <code>numTaps</code>, stored in time
+ * reversed order as for the FIR interpolator so the same array can be used by both:
+ * <pre>
+ *    {b[numTaps-1], b[numTaps-2], b[N-2], ..., b[1], b[0]}
+ * </pre>
+ * <code>numTaps</code> must be a multiple of the interpolation factor <code>L</code> and this is
+ * checked by the initialization functions.  As for the interpolator, the DC gain of the filter
+ * must be <code>L</code> for a unity gain resampler.
+ * \par
+ * <code>pState</code> points to a state array of size <code>blockSize + phaseLength - 1</code>,
+ * where <code>blockSize</code> is the largest number of input samples processed by one call.
+ *
+ * \par Instance Structure
+ * The coefficients and state variables for a resampler are stored together in an instance data structure.
+ * A separate instance structure must be defined for each stream, for example for each sensor axis.
+ * Coefficient arrays may be shared among several instances while state variable arrays should be allocated separately.
+ * There are separate instance structure declarations for each of the 2 supported data types.
+ *
+ * \par Initialization Functions
+ * There is also an associated initialization function for each data type.
+ * The initialization function performs the following operations:
+ * - Sets the values of the internal structure fields.
+ * - Zeros out the values in the state buffer.
+ * - Checks that the factors are not zero and that the length of the filter is a multiple of <code>L</code>.
+ * To do this manually without calling the init function, assign the follow subfields of the instance structure:
+ * L, M, phaseLength (numTaps / L), phase (0), pCoeffs, pState. Also set all of the values in pState to zero.
+ *
+ * \par Fixed-Point Behavior
+ * Care must be taken when using the fixed-point version of the resampler.
+ * In particular, the overflow and saturation behavior of the accumulator used in each function must be considered.
+ * Refer to the function specific documentation below for usage guidelines.
+ */
+
+/**
+ * @addtogroup FIR_Resample
+ * @{
+ */
+
+/**
+ * @brief Processing function for the floating-point FIR rational resampler.
+ * @param[in,out] *S          points to an instance of the floating-point FIR resampler structure.
+ * @param[in]     *pSrc       points to the block of input data.
+ * @param[out]    *pDst       points to the block of output data.
+ * @param[in]     blockSize   number of input samples to process per call.
+ * @return        number of output samples written to <code>pDst</code>.
+ */
+
+uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  float32_t *pStateCurnt;                        /* Points to the current sample of the state */
+  float32_t *px, *pb;                            /* Temporary pointers for state and coefficient buffers */
+  float32_t sum;                                 /* Accumulator */
+  uint32_t L = S->L;                             /* Interpolation factor */
+  uint32_t M = S->M;                             /* Decimation factor */
+  uint32_t phase = S->phase;                     /* Upsampled position of the next output after the current input */
+  uint32_t phaseLen = S->phaseLength;            /* Length of each polyphase filter component */
+  uint32_t i, tapCnt, blkCnt;                    /* Loop counters */
+  uint32_t outCnt = 0u;                          /* Number of outputs */
+
+  /* S->pState buffer contains previous frame (phaseLen - 1) samples */
+  /* pStateCurnt points to the location where the new input data should be written */
+  pStateCurnt = S->pState + (phaseLen - 1u);
+
+  /* Copy the new input samples into the state buffer */
+  blkCnt = blockSize;
+  while(blkCnt > 0u)
+  {
+    *pStateCurnt++ = *pSrc++;
+    blkCnt--;
+  }
+
+  /* Each input sample ends the window of phaseLen samples starting at pState */
+  blkCnt = blockSize;
+  while(blkCnt > 0u)
+  {
+    /* Compute the outputs that fall between this input and the next one in the upsampled signal */
+    while(phase < L)
+    {
+      /* Set accumulator to zero */
+      sum = 0.0f;
+
+      /* Initialize state pointer */
+      px = pState;
+
+      /* Initialize coefficient pointer on the polyphase component of this output */
+      pb = pCoeffs + (L - 1u - phase);
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+      /* Run the below code for Cortex-M4 and Cortex-M3 */
+
+      /* Loop over the polyphase length. Unroll by a factor of 4. */
+      tapCnt = phaseLen >> 2u;
+      while(tapCnt > 0u)
+      {
+        /* The coefficients of a polyphase component are L apart */
+        sum += *px++ * (*pb);
+        pb += L;
+        sum += *px++ * (*pb);
+        pb += L;
+        sum += *px++ * (*pb);
+        pb += L;
+        sum += *px++ * (*pb);
+        pb += L;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* If the polyphase length is not a multiple of 4, compute the remaining filter taps */
+      tapCnt = phaseLen % 0x4u;
+
+#else
+
+      /* Run the below code for Cortex-M0 */
+
+      tapCnt = phaseLen;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+      while(tapCnt > 0u)
+      {
+        /* Perform the multiply-accumulate */
+        sum += *px++ * (*pb);
+        pb += L;
+
+        /* Decrement the loop counter */
+        tapCnt--;
+      }
+
+      /* The result is in the accumulator, store in the destination buffer. */
+      *pDst++ = sum;
+      outCnt++;
+
+      /* Skip M samples of the upsampled signal to the next output */
+      phase += M;
+    }
+
+    /* Advance to the next input sample */
+    phase -= L;
+    pState = pState + 1;
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  /* Save the position of the next output for the next call */
+  S->phase = (uint16_t) phase;
+
+  /* Processing is complete.
+   ** Now copy the last phaseLen - 1 samples to the start of the state buffer.
+   ** This prepares the state buffer for the next function call. */
+
+  /* Points to the start of the state buffer */
+  pStateCurnt = S->pState;
+
+  i = phaseLen - 1u;
+  while(i > 0u)
+  {
+    *pStateCurnt++ = *pState++;
+    i--;
+  }
+
+  return (outCnt);
+}
+
+/**
+ * @} end of FIR_Resample group
+ */
@@ -0,0 +1,100 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_fir_step_q15.c
+*
+* Description:  Single-sample processing function for the Q15 FIR filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup FIR
+ * @{
+ */
+
+/**
+ * @brief Filters one sample with the Q15 FIR filter.
+ * @param[in]  *S   points to an instance of the Q15 FIR filter structure.
+ * @param[in]  in   input sample.
+ * @return     output sample.
+ *
+ * \par
+ * Gives the output of arm_fir_q15() with a <code>blockSize</code> of 1 and
+ * updates the same state, so that single samples and blocks may be mixed.  The
+ * instance may be initialized with any <code>blockSize</code>; the function
+ * uses the first <code>numTaps</code> samples of the state buffer.  The delay
+ * line is moved by one sample in the same pass as the multiply-accumulates,
+ * instead of in a separate copy after them.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The 64-bit accumulator and its saturation to 1.15 format are those of arm_fir_q15().
+ * Unlike arm_fir_q15() the function accepts any number of taps.
+ */
+
+q15_t arm_fir_step_q15(
+  const arm_fir_instance_q15 * S,
+  q15_t in)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pCoeffs = S->pCoeffs;                   /* Coefficient pointer */
+  q63_t acc = 0;                                 /* Accumulator */
+  q15_t x0, x1;                                  /* Current and next state samples */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t k;                                    /* Loop counter */
+
+  /* The new sample follows the previous numTaps - 1 ones */
+  pState[numTaps - 1u] = in;
+
+  /* acc = b[numTaps-1] * x[n-numTaps+1] + ... + b[0] * x[n], while every
+   ** sample is moved one place towards the start of the delay line */
+  x0 = pState[0];
+  for (k = 0u; k < (numTaps - 1u); k++)
+  {
+    x1 = pState[k + 1u];
+    acc += (q31_t) x0 * pCoeffs[k];
+    pState[k] = x1;
+    x0 = x1;
+  }
+  acc += (q31_t) x0 * pCoeffs[k];
+
+  return ((q15_t) __SSAT((acc >> 15u), 16));
+}
+
+/**
+ * @} end of FIR group
+ */
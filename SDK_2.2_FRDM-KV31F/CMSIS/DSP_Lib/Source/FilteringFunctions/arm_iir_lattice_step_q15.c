@@ -0,0 +1,106 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_iir_lattice_step_q15.c
+*
+* Description:  Single-sample processing function for the Q15 IIR lattice filter.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupFilters
+ */
+
+/**
+ * @addtogroup IIR_Lattice
+ * @{
+ */
+
+/**
+ * @brief Filters one sample with the Q15 IIR lattice filter.
+ * @param[in]  *S   points to an instance of the Q15 IIR lattice structure.
+ * @param[in]  in   input sample.
+ * @return     output sample.
+ *
+ * \par
+ * Gives the output of arm_iir_lattice_q15() with a <code>blockSize</code> of 1 and
+ * updates the same state, so that single samples and blocks may be mixed.  The
+ * instance may be initialized with any <code>blockSize</code>; the function
+ * uses the first <code>numStages</code> values of the state buffer.  Each new
+ * g value is written one place lower as soon as it is computed, which replaces
+ * the copy of the state after the block.
+ *
+ * <b>Scaling and Overflow Behavior:</b>
+ * \par
+ * The intermediate saturation and the 64-bit accumulator are those of arm_iir_lattice_q15().
+ */
+
+q15_t arm_iir_lattice_step_q15(
+  const arm_iir_lattice_instance_q15 * S,
+  q15_t in)
+{
+  q15_t *pState = S->pState;                     /* State pointer */
+  q15_t *pk = S->pkCoeffs;                       /* Reflection coefficient pointer */
+  q15_t *pv = S->pvCoeffs;                       /* Ladder coefficient pointer */
+  q31_t fcurr = in, fnext = 0, gcurr, gnext, k;  /* Lattice stage variables */
+  q63_t acc = 0;                                 /* Accumulator */
+  uint32_t numStages = S->numStages;             /* Number of stages in the filter */
+  uint32_t stage;                                /* Loop counter */
+
+  for (stage = 0u; stage < numStages; stage++)
+  {
+    /* f(n) = f(n+1) - k * g(n-1), g(n) = k * f(n) + g(n-1), acc += v * g(n) */
+    gcurr = pState[stage];
+    k = pk[stage];
+    fnext = __SSAT(fcurr - ((gcurr * k) >> 15), 16);
+    gnext = __SSAT(((fnext * k) >> 15) + gcurr, 16);
+    acc += (q31_t) (gnext * pv[stage]);
+    fcurr = fnext;
+
+    /* The g value of the stage moves one place towards the start of the state */
+    if (stage > 0u)
+    {
+      pState[stage - 1u] = (q15_t) gnext;
+    }
+  }
+
+  /* The output of the last stage goes into the state and the ladder */
+  acc += (q31_t) (fnext * pv[numStages]);
+  pState[numStages - 1u] = (q15_t) fnext;
+
+  return ((q15_t) __SSAT((q31_t) (acc >> 15), 16));
+}
+
+/**
+ * @} end of IIR_Lattice group
+ */
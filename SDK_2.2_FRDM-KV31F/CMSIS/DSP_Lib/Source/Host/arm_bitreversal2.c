@@ -0,0 +1,109 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_bitreversal2.c
+*
+* Description:  C version of the table driven bit reversal in arm_bitreversal2.S.
+*
+* Target Processor: x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/*
+* The assembly version cannot be assembled for a host processor.  These
+* functions walk the same tables: each pair of entries holds the byte
+* offsets of two complex samples to be exchanged, with the offsets of the
+* 16 bit variant scaled for 32 bit samples and halved here.
+*/
+
+/**
+* @brief  In-place bit reversal of 32 bit complex samples.
+* @param[in, out] *pSrc        points to the complex data.
+* @param[in]      bitRevLen    bit reversal table length.
+* @param[in]      *pBitRevTable points to the bit reversal table.
+* @return none.
+*/
+
+void arm_bitreversal_32(
+  uint32_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable)
+{
+  uint32_t i;                                    /* loop counter */
+  uint32_t *pA, *pB;                             /* samples to exchange */
+  uint32_t tmp;                                  /* swap temporary */
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    pA = pSrc + (pBitRevTable[i] >> 2u);
+    pB = pSrc + (pBitRevTable[i + 1u] >> 2u);
+
+    /* exchange the real and the imaginary words */
+    tmp = pA[0];
+    pA[0] = pB[0];
+    pB[0] = tmp;
+    tmp = pA[1];
+    pA[1] = pB[1];
+    pB[1] = tmp;
+  }
+}
+
+/**
+* @brief  In-place bit reversal of 16 bit complex samples.
+* @param[in, out] *pSrc        points to the complex data.
+* @param[in]      bitRevLen    bit reversal table length.
+* @param[in]      *pBitRevTable points to the bit reversal table.
+* @return none.
+*/
+
+void arm_bitreversal_16(
+  uint16_t * pSrc,
+  const uint16_t bitRevLen,
+  const uint16_t * pBitRevTable)
+{
+  uint32_t i;                                    /* loop counter */
+  uint16_t *pA, *pB;                             /* samples to exchange */
+  uint16_t tmp;                                  /* swap temporary */
+
+  for (i = 0u; i < bitRevLen; i += 2u)
+  {
+    pA = pSrc + (pBitRevTable[i] >> 2u);
+    pB = pSrc + (pBitRevTable[i + 1u] >> 2u);
+
+    /* exchange the real and the imaginary halfwords */
+    tmp = pA[0];
+    pA[0] = pB[0];
+    pB[0] = tmp;
+    tmp = pA[1];
+    pA[1] = pB[1];
+    pB[1] = tmp;
+  }
+}
@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_avx2.c
+*
+* Description:  AVX2 kernels of the host build.
+*
+* Target Processor: x86-64 host with AVX2
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include <immintrin.h>
+#include "arm_math.h"
+
+#define HOST_ISA            avx2
+#define HOST_N              8u
+#define HOST_V              __m256
+#define HOST_M              __m256
+#define HOST_ZERO()         _mm256_setzero_ps()
+#define HOST_DUP(x)         _mm256_set1_ps(x)
+#define HOST_LD(p)          _mm256_loadu_ps(p)
+#define HOST_ST(p, v)       _mm256_storeu_ps((p), (v))
+#define HOST_LDM(p)         _mm256_castsi256_ps(_mm256_loadu_si256((const __m256i *) (p)))
+#define HOST_ADD(a, b)      _mm256_add_ps((a), (b))
+#define HOST_SUB(a, b)      _mm256_sub_ps((a), (b))
+#define HOST_MUL(a, b)      _mm256_mul_ps((a), (b))
+#define HOST_SEL(m, a, b)   _mm256_blendv_ps((b), (a), (m))
+#define HOST_SWAPRI(v)      _mm256_permute_ps((v), _MM_SHUFFLE(2, 3, 0, 1))
+#define HOST_SHIFTIN(v, x)  _mm256_blend_ps(_mm256_permutevar8x32_ps((v), _mm256_setr_epi32(0, 0, 1, 2, 3, 4, 5, 6)), \
+                                            _mm256_set1_ps(x), 0x01)
+#define HOST_HSUM(v)        arm_host_hsum_avx2(v)
+
+static inline float32_t arm_host_hsum_avx2(
+  __m256 v)
+{
+  __m128 s = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+
+  s = _mm_add_ps(s, _mm_movehl_ps(s, s));
+  return (_mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1)))));
+}
+
+#include "arm_host_simd_kernels.h"
@@ -0,0 +1,318 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_dispatch.c
+*
+* Description:  Run time selection of the host kernels and the dispatched functions.
+*
+* Target Processor: x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include <stdlib.h>
+#include <string.h>
+#include "arm_common_tables.h"
+#include "arm_host_kernels.h"
+
+/**
+ * @ingroup HostBuild
+ */
+
+/**
+ * @addtogroup HostBuild
+ * @{
+ */
+
+/** Kernel table of the C code */
+const arm_host_kernels arm_host_kernels_generic =
+{
+  arm_fir_f32_generic,
+  arm_biquad_cascade_df1_f32_generic,
+  arm_biquad_cascade_df2T_f32_generic,
+  arm_mat_mult_f32_generic,
+  arm_cfft_f32_generic,
+  arm_dot_prod_f32_generic,
+  arm_add_f32_generic,
+  arm_sub_f32_generic,
+  arm_mult_f32_generic,
+  arm_scale_f32_generic,
+  arm_offset_f32_generic
+};
+
+/** Kernel set in use */
+static arm_host_simd hostSimdLevel = ARM_HOST_SIMD_GENERIC;
+
+/** Kernel table in use */
+static const arm_host_kernels *pHostKernels = &arm_host_kernels_generic;
+
+/** Twiddle factors of the radix-2 stages, 4*half values from offset 4*(half-1) */
+static float32_t hostCfftTwiddle[4u * (4096u - 1u)];
+
+/**
+ * @brief  Returns the kernel table of a set, or NULL if it was not built in.
+ */
+static const arm_host_kernels *arm_host_simd_table(
+  arm_host_simd level)
+{
+  switch (level)
+  {
+  case ARM_HOST_SIMD_GENERIC:
+    return (&arm_host_kernels_generic);
+#ifdef ARM_HOST_HAVE_SSE2
+  case ARM_HOST_SIMD_SSE2:
+    return (__builtin_cpu_supports("sse2") ? &arm_host_kernels_sse2 : NULL);
+#endif
+#ifdef ARM_HOST_HAVE_AVX2
+  case ARM_HOST_SIMD_AVX2:
+    return (__builtin_cpu_supports("avx2") ? &arm_host_kernels_avx2 : NULL);
+#endif
+#ifdef ARM_HOST_HAVE_NEON
+  case ARM_HOST_SIMD_NEON:
+    /* Advanced SIMD is a mandatory part of AArch64 */
+    return (&arm_host_kernels_neon);
+#endif
+  default:
+    return (NULL);
+  }
+}
+
+arm_host_simd arm_host_simd_level(
+  void)
+{
+  return (hostSimdLevel);
+}
+
+arm_status arm_host_simd_select(
+  arm_host_simd level)
+{
+  const arm_host_kernels *pTable = arm_host_simd_table(level);
+
+  if (pTable == NULL)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  pHostKernels = pTable;
+  hostSimdLevel = level;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+const char *arm_host_simd_name(
+  arm_host_simd level)
+{
+  static const char *const names[] = { "generic", "sse2", "avx2", "neon" };
+
+  return (((uint32_t) level < 4u) ? names[level] : "unknown");
+}
+
+const float32_t *arm_host_cfft_twiddle(
+  uint32_t half)
+{
+  return (&hostCfftTwiddle[4u * (half - 1u)]);
+}
+
+void arm_host_cfft_bitreverse(
+  float32_t * p1,
+  uint32_t fftLen)
+{
+  uint32_t i, j = 0u, bit;                       /* Index, reversed index and carry bit */
+  float32_t tmp;                                 /* Swap temporary */
+
+  for (i = 0u; i < fftLen; i++)
+  {
+    if (i < j)
+    {
+      tmp = p1[2u * i];
+      p1[2u * i] = p1[2u * j];
+      p1[2u * j] = tmp;
+      tmp = p1[2u * i + 1u];
+      p1[2u * i + 1u] = p1[2u * j + 1u];
+      p1[2u * j + 1u] = tmp;
+    }
+
+    /* Increment the reversed index */
+    bit = fftLen >> 1u;
+    while ((j & bit) != 0u)
+    {
+      j ^= bit;
+      bit >>= 1u;
+    }
+    j |= bit;
+  }
+}
+
+/**
+ * @brief  Fills the twiddle tables and selects the widest kernel set, or the
+ *         one named by the ARM_HOST_SIMD environment variable.
+ */
+__attribute__((constructor)) static void arm_host_init(
+  void)
+{
+  uint32_t half, k, idx;                         /* Stage span, counter and table index */
+  float32_t *pW;                                 /* Twiddle factors of one stage */
+  const char *pName = getenv("ARM_HOST_SIMD");   /* Requested kernel set */
+  int level;                                     /* Kernel set counter */
+
+#if defined(ARM_HOST_HAVE_SSE2) || defined(ARM_HOST_HAVE_AVX2)
+  /* Constructors may run before the one that fills the processor model */
+  __builtin_cpu_init();
+#endif
+
+  for (half = 1u; half <= 2048u; half <<= 1u)
+  {
+    pW = &hostCfftTwiddle[4u * (half - 1u)];
+    for (k = 0u; k < half; k++)
+    {
+      idx = 2u * (k * (2048u / half));
+      pW[2u * k] = twiddleCoef_4096[idx];
+      pW[2u * k + 1u] = twiddleCoef_4096[idx];
+      pW[2u * half + 2u * k] = twiddleCoef_4096[idx + 1u];
+      pW[2u * half + 2u * k + 1u] = -twiddleCoef_4096[idx + 1u];
+    }
+  }
+
+  for (level = ARM_HOST_SIMD_NEON; level >= ARM_HOST_SIMD_GENERIC; level--)
+  {
+    if ((pName != NULL) && (strcmp(pName, arm_host_simd_name((arm_host_simd) level)) != 0))
+    {
+      continue;
+    }
+    if (arm_host_simd_select((arm_host_simd) level) == ARM_MATH_SUCCESS)
+    {
+      break;
+    }
+  }
+}
+
+/**
+ * @} end of HostBuild group
+ */
+
+/*
+* Dispatched functions, documented with their C versions
+*/
+
+void arm_fir_f32(
+  const arm_fir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->fir_f32(S, pSrc, pDst, blockSize);
+}
+
+void arm_biquad_cascade_df1_f32(
+  const arm_biquad_casd_df1_inst_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->biquad_df1_f32(S, pSrc, pDst, blockSize);
+}
+
+void arm_biquad_cascade_df2T_f32(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->biquad_df2T_f32(S, pSrc, pDst, blockSize);
+}
+
+arm_status arm_mat_mult_f32(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  return (pHostKernels->mat_mult_f32(pSrcA, pSrcB, pDst));
+}
+
+void arm_cfft_f32(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  pHostKernels->cfft_f32(S, p1, ifftFlag, bitReverseFlag);
+}
+
+void arm_dot_prod_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result)
+{
+  pHostKernels->dot_prod_f32(pSrcA, pSrcB, blockSize, result);
+}
+
+void arm_add_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->add_f32(pSrcA, pSrcB, pDst, blockSize);
+}
+
+void arm_sub_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->sub_f32(pSrcA, pSrcB, pDst, blockSize);
+}
+
+void arm_mult_f32(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->mult_f32(pSrcA, pSrcB, pDst, blockSize);
+}
+
+void arm_scale_f32(
+  float32_t * pSrc,
+  float32_t scale,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->scale_f32(pSrc, scale, pDst, blockSize);
+}
+
+void arm_offset_f32(
+  float32_t * pSrc,
+  float32_t offset,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  pHostKernels->offset_f32(pSrc, offset, pDst, blockSize);
+}
@@ -0,0 +1,108 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_kernels.h
+*
+* Description:  Kernel tables shared by the host dispatchers and the vector kernels.
+*
+* Target Processor: x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_HOST_KERNELS_H
+#define _ARM_HOST_KERNELS_H
+
+#include "arm_math_host.h"
+
+/**
+ * @brief Functions of one kernel set.
+ */
+typedef struct
+{
+  void (*fir_f32)(const arm_fir_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+  void (*biquad_df1_f32)(const arm_biquad_casd_df1_inst_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+  void (*biquad_df2T_f32)(const arm_biquad_cascade_df2T_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+  arm_status (*mat_mult_f32)(const arm_matrix_instance_f32 * pSrcA, const arm_matrix_instance_f32 * pSrcB, arm_matrix_instance_f32 * pDst);
+  void (*cfft_f32)(const arm_cfft_instance_f32 * S, float32_t * p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+  void (*dot_prod_f32)(float32_t * pSrcA, float32_t * pSrcB, uint32_t blockSize, float32_t * result);
+  void (*add_f32)(float32_t * pSrcA, float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+  void (*sub_f32)(float32_t * pSrcA, float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+  void (*mult_f32)(float32_t * pSrcA, float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+  void (*scale_f32)(float32_t * pSrc, float32_t scale, float32_t * pDst, uint32_t blockSize);
+  void (*offset_f32)(float32_t * pSrc, float32_t offset, float32_t * pDst, uint32_t blockSize);
+} arm_host_kernels;
+
+/*
+* The C versions keep their source files; the build renames them with a
+* _generic suffix so that the public names belong to the dispatchers.
+*/
+void arm_fir_f32_generic(const arm_fir_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+void arm_biquad_cascade_df1_f32_generic(const arm_biquad_casd_df1_inst_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+void arm_biquad_cascade_df2T_f32_generic(const arm_biquad_cascade_df2T_instance_f32 * S, float32_t * pSrc, float32_t * pDst, uint32_t blockSize);
+arm_status arm_mat_mult_f32_generic(const arm_matrix_instance_f32 * pSrcA, const arm_matrix_instance_f32 * pSrcB, arm_matrix_instance_f32 * pDst);
+void arm_cfft_f32_generic(const arm_cfft_instance_f32 * S, float32_t * p1, uint8_t ifftFlag, uint8_t bitReverseFlag);
+void arm_dot_prod_f32_generic(float32_t * pSrcA, float32_t * pSrcB, uint32_t blockSize, float32_t * result);
+void arm_add_f32_generic(float32_t * pSrcA, float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+void arm_sub_f32_generic(float32_t * pSrcA, float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+void arm_mult_f32_generic(float32_t * pSrcA, float32_t * pSrcB, float32_t * pDst, uint32_t blockSize);
+void arm_scale_f32_generic(float32_t * pSrc, float32_t scale, float32_t * pDst, uint32_t blockSize);
+void arm_offset_f32_generic(float32_t * pSrc, float32_t offset, float32_t * pDst, uint32_t blockSize);
+
+extern const arm_host_kernels arm_host_kernels_generic;
+#ifdef ARM_HOST_HAVE_SSE2
+extern const arm_host_kernels arm_host_kernels_sse2;
+#endif
+#ifdef ARM_HOST_HAVE_AVX2
+extern const arm_host_kernels arm_host_kernels_avx2;
+#endif
+#ifdef ARM_HOST_HAVE_NEON
+extern const arm_host_kernels arm_host_kernels_neon;
+#endif
+
+/**
+ * @brief  Twiddle factors of one radix-2 stage of the vector complex FFT.
+ * @param[in] half  butterfly span of the stage, a power of 2 from 1 to 2048.
+ * @return pointer to 2*half values holding cos(t) twice for each t, followed
+ *         by 2*half values holding sin(t) and -sin(t), for t = pi*k/half and
+ *         k = 0 ... half-1.  The values are copied from twiddleCoef_4096.
+ */
+const float32_t *arm_host_cfft_twiddle(
+  uint32_t half);
+
+/**
+ * @brief  In-place bit reversal permutation of fftLen complex samples.
+ * @param[in, out] *p1     points to the complex data.
+ * @param[in]      fftLen  length of the FFT.
+ * @return none.
+ */
+void arm_host_cfft_bitreverse(
+  float32_t * p1,
+  uint32_t fftLen);
+
+#endif /* _ARM_HOST_KERNELS_H */
@@ -0,0 +1,58 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_neon.c
+*
+* Description:  NEON kernels of the host build.
+*
+* Target Processor: AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include <arm_neon.h>
+#include "arm_math.h"
+
+#define HOST_ISA            neon
+#define HOST_N              4u
+#define HOST_V              float32x4_t
+#define HOST_M              uint32x4_t
+#define HOST_ZERO()         vdupq_n_f32(0.0f)
+#define HOST_DUP(x)         vdupq_n_f32(x)
+#define HOST_LD(p)          vld1q_f32(p)
+#define HOST_ST(p, v)       vst1q_f32((p), (v))
+#define HOST_LDM(p)         vld1q_u32(p)
+#define HOST_ADD(a, b)      vaddq_f32((a), (b))
+#define HOST_SUB(a, b)      vsubq_f32((a), (b))
+#define HOST_MUL(a, b)      vmulq_f32((a), (b))
+#define HOST_SEL(m, a, b)   vbslq_f32((m), (a), (b))
+#define HOST_SWAPRI(v)      vrev64q_f32(v)
+#define HOST_SHIFTIN(v, x)  vextq_f32(vdupq_n_f32(x), (v), 3)
+#define HOST_HSUM(v)        vaddvq_f32(v)
+
+#include "arm_host_simd_kernels.h"
@@ -0,0 +1,742 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_simd_kernels.h
+*
+* Description:  Vector kernels of the host build, written once for all instruction sets.
+*
+* Target Processor: x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+/*
+* This file is included by arm_host_sse2.c, arm_host_avx2.c and
+* arm_host_neon.c after they define the vector operations below for their
+* instruction set.  HOST_N is the number of float32_t values in a vector.
+*
+*   HOST_V            vector type
+*   HOST_M            lane mask type
+*   HOST_ISA          suffix of the function and table names
+*   HOST_ZERO()       all lanes 0.0f
+*   HOST_DUP(x)       all lanes x
+*   HOST_LD(p)        unaligned load
+*   HOST_ST(p, v)     unaligned store
+*   HOST_LDM(p)       load a lane mask from HOST_N uint32_t values of 0 or ~0
+*   HOST_ADD(a, b)    a + b
+*   HOST_SUB(a, b)    a - b
+*   HOST_MUL(a, b)    a * b
+*   HOST_SEL(m, a, b) a in the lanes set in m, b in the others
+*   HOST_SWAPRI(v)    exchange the values in each pair of lanes
+*   HOST_SHIFTIN(v,x) { x, v[0], ... v[HOST_N-2] }
+*   HOST_HSUM(v)      sum of the lanes
+*
+* Every output of the filters, the matrix multiply and the vector arithmetic
+* is formed with the multiplications and additions of the C code, in the
+* same order, so that the results are bit exact.  The build disables the
+* contraction of a multiplication and an addition into a fused
+* multiply-add for the same reason.
+*/
+
+#include <string.h>
+#include "arm_host_kernels.h"
+
+#define HOST_CAT2(a, b)   a ## _ ## b
+#define HOST_CAT(a, b)    HOST_CAT2(a, b)
+#define HOST_FN(name)     HOST_CAT(name, HOST_ISA)
+
+/**
+ * @brief FIR filter: HOST_N outputs per vector, four vectors per pass.
+ */
+static void HOST_FN(arm_host_fir_f32)(
+  const arm_fir_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pState = S->pState;                 /* State pointer */
+  float32_t *pCoeffs = S->pCoeffs;               /* Coefficient pointer */
+  uint32_t numTaps = S->numTaps;                 /* Number of filter coefficients in the filter */
+  uint32_t n = 0u, k;                            /* Output and tap counters */
+  HOST_V acc0, acc1, acc2, acc3, c;              /* Accumulators and coefficient */
+  float32_t acc;                                 /* Accumulator of the remaining outputs */
+
+  /* Append the whole block to the state buffer.  Output n reads the state
+   * from sample n to n + numTaps - 1 only, so this is the same as copying
+   * one sample before each output. */
+  memcpy(pState + (numTaps - 1u), pSrc, blockSize * sizeof(float32_t));
+
+  for (; (n + 4u * HOST_N) <= blockSize; n += 4u * HOST_N)
+  {
+    acc0 = HOST_ZERO();
+    acc1 = HOST_ZERO();
+    acc2 = HOST_ZERO();
+    acc3 = HOST_ZERO();
+
+    for (k = 0u; k < numTaps; k++)
+    {
+      c = HOST_DUP(pCoeffs[k]);
+      acc0 = HOST_ADD(acc0, HOST_MUL(HOST_LD(pState + n + k), c));
+      acc1 = HOST_ADD(acc1, HOST_MUL(HOST_LD(pState + n + k + HOST_N), c));
+      acc2 = HOST_ADD(acc2, HOST_MUL(HOST_LD(pState + n + k + 2u * HOST_N), c));
+      acc3 = HOST_ADD(acc3, HOST_MUL(HOST_LD(pState + n + k + 3u * HOST_N), c));
+    }
+
+    HOST_ST(pDst + n, acc0);
+    HOST_ST(pDst + n + HOST_N, acc1);
+    HOST_ST(pDst + n + 2u * HOST_N, acc2);
+    HOST_ST(pDst + n + 3u * HOST_N, acc3);
+  }
+
+  for (; (n + HOST_N) <= blockSize; n += HOST_N)
+  {
+    acc0 = HOST_ZERO();
+
+    for (k = 0u; k < numTaps; k++)
+    {
+      acc0 = HOST_ADD(acc0, HOST_MUL(HOST_LD(pState + n + k), HOST_DUP(pCoeffs[k])));
+    }
+
+    HOST_ST(pDst + n, acc0);
+  }
+
+  for (; n < blockSize; n++)
+  {
+    acc = 0.0f;
+
+    for (k = 0u; k < numTaps; k++)
+    {
+      acc += pState[n + k] * pCoeffs[k];
+    }
+
+    pDst[n] = acc;
+  }
+
+  /* Keep the last numTaps - 1 samples for the next call */
+  memmove(pState, pState + blockSize, (numTaps - 1u) * sizeof(float32_t));
+}
+
+/*
+* The biquad cascades put one stage in each lane and run the stages as a
+* wavefront: at step t the stage in lane s filters sample t - s, whose input
+* is the output of lane s - 1 at step t - 1.  Each stage still sees its
+* samples in order, so the recursion of every stage is unchanged, and up to
+* HOST_N stages advance per step.  In the first and last HOST_N - 1 steps
+* some lanes have no sample and keep their state.
+*/
+
+/**
+ * @brief Sets the lanes of the stages that have a sample at step t.
+ */
+static HOST_M HOST_FN(arm_host_biquad_mask)(
+  uint32_t t,
+  uint32_t blockSize)
+{
+  uint32_t mask[HOST_N];                         /* Lane masks */
+  uint32_t s;                                    /* Lane counter */
+
+  for (s = 0u; s < HOST_N; s++)
+  {
+    mask[s] = ((t >= s) && ((t - s) < blockSize)) ? 0xFFFFFFFFu : 0u;
+  }
+
+  return (HOST_LDM(mask));
+}
+
+/**
+ * @brief Biquad cascade, direct form I.
+ */
+static void HOST_FN(arm_host_biquad_df1_f32)(
+  const arm_biquad_casd_df1_inst_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Input of the current group of stages */
+  float32_t *pState, *pCoeffs;                   /* State and coefficients of the current group */
+  float32_t lane[9][HOST_N];                     /* Coefficients and state gathered by lane */
+  float32_t out[HOST_N];                         /* Outputs of one step */
+  float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients of a single stage */
+  float32_t Xn, Xn1, Xn2, Yn1, Yn2, acc;         /* Filter state of a single stage */
+  HOST_V vb0, vb1, vb2, va1, va2;                /* Filter coefficients by lane */
+  HOST_V vXn, vXn1, vXn2, vYn1, vYn2, vacc;      /* Filter state by lane */
+  HOST_M m;                                      /* Lanes with a sample */
+  uint32_t stage = 0u, nLanes, last, s, i, t;    /* Stage, lane and sample counters */
+
+  while (stage < S->numStages)
+  {
+    pState = S->pState + 4u * stage;
+    pCoeffs = S->pCoeffs + 5u * stage;
+    nLanes = S->numStages - stage;
+    if (nLanes > HOST_N)
+    {
+      nLanes = HOST_N;
+    }
+
+    if (nLanes == 1u)
+    {
+      /* A single stage gains nothing from the lanes */
+      b0 = pCoeffs[0];
+      b1 = pCoeffs[1];
+      b2 = pCoeffs[2];
+      a1 = pCoeffs[3];
+      a2 = pCoeffs[4];
+      Xn1 = pState[0];
+      Xn2 = pState[1];
+      Yn1 = pState[2];
+      Yn2 = pState[3];
+
+      for (t = 0u; t < blockSize; t++)
+      {
+        Xn = pIn[t];
+        acc = (b0 * Xn) + (b1 * Xn1) + (b2 * Xn2) + (a1 * Yn1) + (a2 * Yn2);
+        pDst[t] = acc;
+        Xn2 = Xn1;
+        Xn1 = Xn;
+        Yn2 = Yn1;
+        Yn1 = acc;
+      }
+
+      pState[0] = Xn1;
+      pState[1] = Xn2;
+      pState[2] = Yn1;
+      pState[3] = Yn2;
+    }
+    else
+    {
+      /* Gather the coefficients and the state, the lanes without a stage filter with zeros */
+      memset(lane, 0, sizeof(lane));
+      for (s = 0u; s < nLanes; s++)
+      {
+        for (i = 0u; i < 5u; i++)
+        {
+          lane[i][s] = pCoeffs[5u * s + i];
+        }
+        for (i = 0u; i < 4u; i++)
+        {
+          lane[5u + i][s] = pState[4u * s + i];
+        }
+      }
+
+      vb0 = HOST_LD(lane[0]);
+      vb1 = HOST_LD(lane[1]);
+      vb2 = HOST_LD(lane[2]);
+      va1 = HOST_LD(lane[3]);
+      va2 = HOST_LD(lane[4]);
+      vXn1 = HOST_LD(lane[5]);
+      vXn2 = HOST_LD(lane[6]);
+      vYn1 = HOST_LD(lane[7]);
+      vYn2 = HOST_LD(lane[8]);
+      vacc = HOST_ZERO();
+      last = nLanes - 1u;
+
+      for (t = 0u; t < (blockSize + last); t++)
+      {
+        /* Lane 0 reads the input, the other lanes the previous output of their neighbour */
+        vXn = HOST_SHIFTIN(vacc, (t < blockSize) ? pIn[t] : 0.0f);
+
+        vacc = HOST_ADD(HOST_ADD(HOST_ADD(HOST_ADD(HOST_MUL(vb0, vXn), HOST_MUL(vb1, vXn1)),
+                                          HOST_MUL(vb2, vXn2)), HOST_MUL(va1, vYn1)), HOST_MUL(va2, vYn2));
+
+        if ((t < last) || (t >= blockSize))
+        {
+          m = HOST_FN(arm_host_biquad_mask)(t, blockSize);
+          vXn2 = HOST_SEL(m, vXn1, vXn2);
+          vXn1 = HOST_SEL(m, vXn, vXn1);
+          vYn2 = HOST_SEL(m, vYn1, vYn2);
+          vYn1 = HOST_SEL(m, vacc, vYn1);
+        }
+        else
+        {
+          vXn2 = vXn1;
+          vXn1 = vXn;
+          vYn2 = vYn1;
+          vYn1 = vacc;
+        }
+
+        /* The last stage of the group finishes sample t - last.  pIn may be
+         * pDst, which is safe because sample t has already been read. */
+        if (t >= last)
+        {
+          HOST_ST(out, vacc);
+          pDst[t - last] = out[last];
+        }
+      }
+
+      HOST_ST(lane[5], vXn1);
+      HOST_ST(lane[6], vXn2);
+      HOST_ST(lane[7], vYn1);
+      HOST_ST(lane[8], vYn2);
+      for (s = 0u; s < nLanes; s++)
+      {
+        for (i = 0u; i < 4u; i++)
+        {
+          pState[4u * s + i] = lane[5u + i][s];
+        }
+      }
+    }
+
+    /* The following stages work in place in the output buffer */
+    pIn = pDst;
+    stage += nLanes;
+  }
+}
+
+/**
+ * @brief Biquad cascade, direct form II transposed.
+ */
+static void HOST_FN(arm_host_biquad_df2T_f32)(
+  const arm_biquad_cascade_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pIn = pSrc;                         /* Input of the current group of stages */
+  float32_t *pState, *pCoeffs;                   /* State and coefficients of the current group */
+  float32_t lane[7][HOST_N];                     /* Coefficients and state gathered by lane */
+  float32_t out[HOST_N];                         /* Outputs of one step */
+  float32_t b0, b1, b2, a1, a2;                  /* Filter coefficients of a single stage */
+  float32_t Xn1, d1, d2, acc1;                   /* Filter state of a single stage */
+  HOST_V vb0, vb1, vb2, va1, va2;                /* Filter coefficients by lane */
+  HOST_V vXn, vd1, vd2, vacc;                    /* Filter state by lane */
+  HOST_V vd1n, vd2n;                             /* Updated state by lane */
+  HOST_M m;                                      /* Lanes with a sample */
+  uint32_t stage = 0u, nLanes, last, s, i, t;    /* Stage, lane and sample counters */
+
+  while (stage < S->numStages)
+  {
+    pState = S->pState + 2u * stage;
+    pCoeffs = S->pCoeffs + 5u * stage;
+    nLanes = S->numStages - stage;
+    if (nLanes > HOST_N)
+    {
+      nLanes = HOST_N;
+    }
+
+    if (nLanes == 1u)
+    {
+      b0 = pCoeffs[0];
+      b1 = pCoeffs[1];
+      b2 = pCoeffs[2];
+      a1 = pCoeffs[3];
+      a2 = pCoeffs[4];
+      d1 = pState[0];
+      d2 = pState[1];
+
+      for (t = 0u; t < blockSize; t++)
+      {
+        Xn1 = pIn[t];
+        acc1 = (b0 * Xn1) + d1;
+        pDst[t] = acc1;
+        d1 = ((b1 * Xn1) + (a1 * acc1)) + d2;
+        d2 = (b2 * Xn1) + (a2 * acc1);
+      }
+
+      pState[0] = d1;
+      pState[1] = d2;
+    }
+    else
+    {
+      memset(lane, 0, sizeof(lane));
+      for (s = 0u; s < nLanes; s++)
+      {
+        for (i = 0u; i < 5u; i++)
+        {
+          lane[i][s] = pCoeffs[5u * s + i];
+        }
+        lane[5][s] = pState[2u * s];
+        lane[6][s] = pState[2u * s + 1u];
+      }
+
+      vb0 = HOST_LD(lane[0]);
+      vb1 = HOST_LD(lane[1]);
+      vb2 = HOST_LD(lane[2]);
+      va1 = HOST_LD(lane[3]);
+      va2 = HOST_LD(lane[4]);
+      vd1 = HOST_LD(lane[5]);
+      vd2 = HOST_LD(lane[6]);
+      vacc = HOST_ZERO();
+      last = nLanes - 1u;
+
+      for (t = 0u; t < (blockSize + last); t++)
+      {
+        vXn = HOST_SHIFTIN(vacc, (t < blockSize) ? pIn[t] : 0.0f);
+
+        vacc = HOST_ADD(HOST_MUL(vb0, vXn), vd1);
+        vd1n = HOST_ADD(HOST_ADD(HOST_MUL(vb1, vXn), HOST_MUL(va1, vacc)), vd2);
+        vd2n = HOST_ADD(HOST_MUL(vb2, vXn), HOST_MUL(va2, vacc));
+
+        if ((t < last) || (t >= blockSize))
+        {
+          m = HOST_FN(arm_host_biquad_mask)(t, blockSize);
+          vd1 = HOST_SEL(m, vd1n, vd1);
+          vd2 = HOST_SEL(m, vd2n, vd2);
+        }
+        else
+        {
+          vd1 = vd1n;
+          vd2 = vd2n;
+        }
+
+        if (t >= last)
+        {
+          HOST_ST(out, vacc);
+          pDst[t - last] = out[last];
+        }
+      }
+
+      HOST_ST(lane[5], vd1);
+      HOST_ST(lane[6], vd2);
+      for (s = 0u; s < nLanes; s++)
+      {
+        pState[2u * s] = lane[5][s];
+        pState[2u * s + 1u] = lane[6][s];
+      }
+    }
+
+    pIn = pDst;
+    stage += nLanes;
+  }
+}
+
+/**
+ * @brief Matrix multiplication: each vector holds HOST_N columns of one output row.
+ */
+static arm_status HOST_FN(arm_host_mat_mult_f32)(
+  const arm_matrix_instance_f32 * pSrcA,
+  const arm_matrix_instance_f32 * pSrcB,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pInA;                               /* Current row of matrix A */
+  float32_t *pInB = pSrcB->pData;                /* Matrix B */
+  float32_t *pOut;                               /* Current row of the output matrix */
+  uint32_t numRowsA = pSrcA->numRows;            /* Number of rows of input matrix A */
+  uint32_t numColsA = pSrcA->numCols;            /* Number of columns of input matrix A */
+  uint32_t numColsB = pSrcB->numCols;            /* Number of columns of input matrix B */
+  uint32_t row, col, k;                          /* Loop counters */
+  HOST_V acc0, acc1, a;                          /* Accumulators and element of A */
+  float32_t sum;                                 /* Accumulator of the remaining columns */
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrcA->numCols != pSrcB->numRows) ||
+     (pSrcA->numRows != pDst->numRows) || (pSrcB->numCols != pDst->numCols))
+  {
+    return (ARM_MATH_SIZE_MISMATCH);
+  }
+
+#endif /*      #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  for (row = 0u; row < numRowsA; row++)
+  {
+    pInA = pSrcA->pData + row * numColsA;
+    pOut = pDst->pData + row * numColsB;
+    col = 0u;
+
+    for (; (col + 2u * HOST_N) <= numColsB; col += 2u * HOST_N)
+    {
+      acc0 = HOST_ZERO();
+      acc1 = HOST_ZERO();
+
+      for (k = 0u; k < numColsA; k++)
+      {
+        a = HOST_DUP(pInA[k]);
+        acc0 = HOST_ADD(acc0, HOST_MUL(a, HOST_LD(pInB + k * numColsB + col)));
+        acc1 = HOST_ADD(acc1, HOST_MUL(a, HOST_LD(pInB + k * numColsB + col + HOST_N)));
+      }
+
+      HOST_ST(pOut + col, acc0);
+      HOST_ST(pOut + col + HOST_N, acc1);
+    }
+
+    for (; (col + HOST_N) <= numColsB; col += HOST_N)
+    {
+      acc0 = HOST_ZERO();
+
+      for (k = 0u; k < numColsA; k++)
+      {
+        acc0 = HOST_ADD(acc0, HOST_MUL(HOST_DUP(pInA[k]), HOST_LD(pInB + k * numColsB + col)));
+      }
+
+      HOST_ST(pOut + col, acc0);
+    }
+
+    for (; col < numColsB; col++)
+    {
+      sum = 0.0f;
+
+      for (k = 0u; k < numColsA; k++)
+      {
+        sum += pInA[k] * pInB[k * numColsB + col];
+      }
+
+      pOut[col] = sum;
+    }
+  }
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @brief Complex FFT: radix-2 decimation in frequency, then bit reversal.
+ */
+static void HOST_FN(arm_host_cfft_f32)(
+  const arm_cfft_instance_f32 * S,
+  float32_t * p1,
+  uint8_t ifftFlag,
+  uint8_t bitReverseFlag)
+{
+  static const float32_t conj[8] = { 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f, 1.0f, -1.0f };
+  uint32_t L = S->fftLen;                        /* Length of the FFT */
+  uint32_t half, j, k;                           /* Butterfly span and counters */
+  const float32_t *pW;                           /* Twiddle factors of the stage */
+  float32_t *pA, *pB;                            /* Inputs of the butterflies */
+  float32_t ar, ai, br, bi, invL;                /* Butterfly temporaries and scale */
+  float32_t scale[HOST_N];                       /* Conjugate and scale factors */
+  HOST_V va, vb, vd, vc;                         /* Butterfly temporaries */
+
+  if (bitReverseFlag == 0u)
+  {
+    /* The unreversed output order is that of the radix-8 C code */
+    arm_cfft_f32_generic(S, p1, ifftFlag, bitReverseFlag);
+    return;
+  }
+
+  if (ifftFlag == 1u)
+  {
+    /* Conjugate input data */
+    vc = HOST_LD(conj);
+    for (k = 0u; k < 2u * L; k += HOST_N)
+    {
+      HOST_ST(p1 + k, HOST_MUL(HOST_LD(p1 + k), vc));
+    }
+  }
+
+  /* Stages that span at least one vector */
+  for (half = L >> 1u; (2u * half) >= HOST_N; half >>= 1u)
+  {
+    pW = arm_host_cfft_twiddle(half);
+
+    for (j = 0u; j < L; j += 2u * half)
+    {
+      pA = p1 + 2u * j;
+      pB = pA + 2u * half;
+
+      for (k = 0u; k < 2u * half; k += HOST_N)
+      {
+        va = HOST_LD(pA + k);
+        vb = HOST_LD(pB + k);
+        HOST_ST(pA + k, HOST_ADD(va, vb));
+
+        /* (a - b) times the conjugate of the twiddle factor */
+        vd = HOST_SUB(va, vb);
+        HOST_ST(pB + k, HOST_ADD(HOST_MUL(vd, HOST_LD(pW + k)),
+                                 HOST_MUL(HOST_SWAPRI(vd), HOST_LD(pW + 2u * half + k))));
+      }
+    }
+  }
+
+  /* Span 2, twiddle factors 1 and -i */
+  if (half == 2u)
+  {
+    for (j = 0u; j < 2u * L; j += 8u)
+    {
+      pA = p1 + j;
+      for (k = 0u; k < 4u; k += 2u)
+      {
+        ar = pA[k];
+        ai = pA[k + 1u];
+        br = pA[k + 4u];
+        bi = pA[k + 5u];
+        pA[k] = ar + br;
+        pA[k + 1u] = ai + bi;
+        if (k == 0u)
+        {
+          pA[k + 4u] = ar - br;
+          pA[k + 5u] = ai - bi;
+        }
+        else
+        {
+          pA[k + 4u] = ai - bi;
+          pA[k + 5u] = br - ar;
+        }
+      }
+    }
+    half = 1u;
+  }
+
+  /* Span 1, twiddle factor 1 */
+  if (half == 1u)
+  {
+    for (j = 0u; j < 2u * L; j += 4u)
+    {
+      ar = p1[j];
+      ai = p1[j + 1u];
+      br = p1[j + 2u];
+      bi = p1[j + 3u];
+      p1[j] = ar + br;
+      p1[j + 1u] = ai + bi;
+      p1[j + 2u] = ar - br;
+      p1[j + 3u] = ai - bi;
+    }
+  }
+
+  arm_host_cfft_bitreverse(p1, L);
+
+  if (ifftFlag == 1u)
+  {
+    /* Conjugate and scale output data */
+    invL = 1.0f / (float32_t) L;
+    for (k = 0u; k < HOST_N; k += 2u)
+    {
+      scale[k] = invL;
+      scale[k + 1u] = -invL;
+    }
+    vc = HOST_LD(scale);
+    for (k = 0u; k < 2u * L; k += HOST_N)
+    {
+      HOST_ST(p1 + k, HOST_MUL(HOST_LD(p1 + k), vc));
+    }
+  }
+}
+
+/**
+ * @brief Dot product with HOST_N partial sums per vector and four vectors.
+ */
+static void HOST_FN(arm_host_dot_prod_f32)(
+  float32_t * pSrcA,
+  float32_t * pSrcB,
+  uint32_t blockSize,
+  float32_t * result)
+{
+  HOST_V acc0 = HOST_ZERO(), acc1 = HOST_ZERO();  /* Partial sums */
+  HOST_V acc2 = HOST_ZERO(), acc3 = HOST_ZERO();
+  float32_t sum;                                  /* Result */
+  uint32_t n = 0u;                                /* Sample counter */
+
+  for (; (n + 4u * HOST_N) <= blockSize; n += 4u * HOST_N)
+  {
+    acc0 = HOST_ADD(acc0, HOST_MUL(HOST_LD(pSrcA + n), HOST_LD(pSrcB + n)));
+    acc1 = HOST_ADD(acc1, HOST_MUL(HOST_LD(pSrcA + n + HOST_N), HOST_LD(pSrcB + n + HOST_N)));
+    acc2 = HOST_ADD(acc2, HOST_MUL(HOST_LD(pSrcA + n + 2u * HOST_N), HOST_LD(pSrcB + n + 2u * HOST_N)));
+    acc3 = HOST_ADD(acc3, HOST_MUL(HOST_LD(pSrcA + n + 3u * HOST_N), HOST_LD(pSrcB + n + 3u * HOST_N)));
+  }
+
+  for (; (n + HOST_N) <= blockSize; n += HOST_N)
+  {
+    acc0 = HOST_ADD(acc0, HOST_MUL(HOST_LD(pSrcA + n), HOST_LD(pSrcB + n)));
+  }
+
+  sum = HOST_HSUM(HOST_ADD(HOST_ADD(acc0, acc1), HOST_ADD(acc2, acc3)));
+
+  for (; n < blockSize; n++)
+  {
+    sum += pSrcA[n] * pSrcB[n];
+  }
+
+  *result = sum;
+}
+
+/*
+* Element by element vector arithmetic
+*/
+
+#define HOST_VECTOR_OP(name, vexpr, expr)                                     \
+static void HOST_FN(name)(                                                    \
+  float32_t * pSrcA,                                                          \
+  float32_t * pSrcB,                                                          \
+  float32_t * pDst,                                                           \
+  uint32_t blockSize)                                                         \
+{                                                                             \
+  HOST_V va, vb;                                 /* Vector operands */        \
+  float32_t a, b;                                /* Scalar operands */        \
+  uint32_t n = 0u;                               /* Sample counter */         \
+                                                                              \
+  for (; (n + HOST_N) <= blockSize; n += HOST_N)                              \
+  {                                                                           \
+    va = HOST_LD(pSrcA + n);                                                  \
+    vb = HOST_LD(pSrcB + n);                                                  \
+    HOST_ST(pDst + n, vexpr);                                                 \
+  }                                                                           \
+                                                                              \
+  for (; n < blockSize; n++)                                                  \
+  {                                                                           \
+    a = pSrcA[n];                                                             \
+    b = pSrcB[n];                                                             \
+    pDst[n] = expr;                                                           \
+  }                                                                           \
+}
+
+#define HOST_SCALAR_OP(name, vexpr, expr)                                     \
+static void HOST_FN(name)(                                                    \
+  float32_t * pSrc,                                                           \
+  float32_t k,                                                                \
+  float32_t * pDst,                                                           \
+  uint32_t blockSize)                                                         \
+{                                                                             \
+  HOST_V va, vb = HOST_DUP(k);                   /* Vector operands */        \
+  float32_t a, b = k;                            /* Scalar operands */        \
+  uint32_t n = 0u;                               /* Sample counter */         \
+                                                                              \
+  for (; (n + HOST_N) <= blockSize; n += HOST_N)                              \
+  {                                                                           \
+    va = HOST_LD(pSrc + n);                                                   \
+    HOST_ST(pDst + n, vexpr);                                                 \
+  }                                                                           \
+                                                                              \
+  for (; n < blockSize; n++)                                                  \
+  {                                                                           \
+    a = pSrc[n];                                                              \
+    pDst[n] = expr;                                                           \
+  }                                                                           \
+}
+
+HOST_VECTOR_OP(arm_host_add_f32, HOST_ADD(va, vb), a + b)
+HOST_VECTOR_OP(arm_host_sub_f32, HOST_SUB(va, vb), a - b)
+HOST_VECTOR_OP(arm_host_mult_f32, HOST_MUL(va, vb), a * b)
+HOST_SCALAR_OP(arm_host_scale_f32, HOST_MUL(va, vb), a * b)
+HOST_SCALAR_OP(arm_host_offset_f32, HOST_ADD(va, vb), a + b)
+
+/**
+ * @brief Kernel table of this instruction set.
+ */
+const arm_host_kernels HOST_FN(arm_host_kernels) =
+{
+  HOST_FN(arm_host_fir_f32),
+  HOST_FN(arm_host_biquad_df1_f32),
+  HOST_FN(arm_host_biquad_df2T_f32),
+  HOST_FN(arm_host_mat_mult_f32),
+  HOST_FN(arm_host_cfft_f32),
+  HOST_FN(arm_host_dot_prod_f32),
+  HOST_FN(arm_host_add_f32),
+  HOST_FN(arm_host_sub_f32),
+  HOST_FN(arm_host_mult_f32),
+  HOST_FN(arm_host_scale_f32),
+  HOST_FN(arm_host_offset_f32)
+};
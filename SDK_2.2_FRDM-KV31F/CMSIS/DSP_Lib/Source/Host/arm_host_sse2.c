@@ -0,0 +1,66 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_host_sse2.c
+*
+* Description:  SSE2 kernels of the host build.
+*
+* Target Processor: x86 host with SSE2
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include <emmintrin.h>
+#include "arm_math.h"
+
+#define HOST_ISA            sse2
+#define HOST_N              4u
+#define HOST_V              __m128
+#define HOST_M              __m128
+#define HOST_ZERO()         _mm_setzero_ps()
+#define HOST_DUP(x)         _mm_set1_ps(x)
+#define HOST_LD(p)          _mm_loadu_ps(p)
+#define HOST_ST(p, v)       _mm_storeu_ps((p), (v))
+#define HOST_LDM(p)         _mm_castsi128_ps(_mm_loadu_si128((const __m128i *) (p)))
+#define HOST_ADD(a, b)      _mm_add_ps((a), (b))
+#define HOST_SUB(a, b)      _mm_sub_ps((a), (b))
+#define HOST_MUL(a, b)      _mm_mul_ps((a), (b))
+#define HOST_SEL(m, a, b)   _mm_or_ps(_mm_and_ps((m), (a)), _mm_andnot_ps((m), (b)))
+#define HOST_SWAPRI(v)      _mm_shuffle_ps((v), (v), _MM_SHUFFLE(2, 3, 0, 1))
+#define HOST_SHIFTIN(v, x)  _mm_move_ss(_mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(v), 4)), _mm_set_ss(x))
+#define HOST_HSUM(v)        arm_host_hsum_sse2(v)
+
+static inline float32_t arm_host_hsum_sse2(
+  __m128 v)
+{
+  __m128 s = _mm_add_ps(v, _mm_movehl_ps(v, v));  /* { v0 + v2, v1 + v3 } */
+
+  return (_mm_cvtss_f32(_mm_add_ss(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 1, 1, 1)))));
+}
+
+#include "arm_host_simd_kernels.h"
@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_math_host.h
+*
+* Description:  Kernel selection for the host build of the DSP library.
+*
+* Target Processor: x86-64/AArch64 host
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#ifndef _ARM_MATH_HOST_H
+#define _ARM_MATH_HOST_H
+
+#include "arm_math.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+  /**
+   * @defgroup HostBuild Host Build
+   *
+   * The library can be built natively for a Linux or macOS workstation with
+   * the CMakeLists.txt in CMSIS/DSP_Lib.  The host build compiles the
+   * Cortex-M0 C code paths and replaces the following functions with
+   * dispatchers that call an SSE2, AVX2 or NEON version when the processor
+   * supports it:
+   *
+   * - arm_fir_f32()
+   * - arm_biquad_cascade_df1_f32() and arm_biquad_cascade_df2T_f32()
+   * - arm_mat_mult_f32()
+   * - arm_cfft_f32(), and through it arm_rfft_fast_f32()
+   * - arm_dot_prod_f32()
+   * - arm_add_f32(), arm_sub_f32(), arm_mult_f32(), arm_scale_f32() and arm_offset_f32()
+   *
+   * The kernel set is chosen once, when the library is loaded, from the
+   * widest instruction set reported by the processor.  Setting the
+   * environment variable ARM_HOST_SIMD to generic, sse2, avx2 or neon
+   * selects a narrower set, and arm_host_simd_select() changes it at run time.
+   *
+   * \par
+   * The vector versions perform the multiplications and additions of each
+   * output in the same order as the C code, so the filters, the matrix
+   * multiply and the vector arithmetic give bit exact results with every
+   * kernel set.  arm_dot_prod_f32() sums in a different order and
+   * arm_cfft_f32() uses a radix-2 algorithm, so their results differ from
+   * the C code by a few rounding errors.  arm_cfft_f32() calls the C code
+   * when <code>bitReverseFlag</code> is 0, because the order of the
+   * unreversed output depends on the algorithm.
+   */
+
+  /**
+   * @addtogroup HostBuild
+   * @{
+   */
+
+  /**
+   * @brief Kernel sets of the host build.
+   */
+  typedef enum
+  {
+    ARM_HOST_SIMD_GENERIC = 0,   /**< Portable C code of the Cortex-M0 build. */
+    ARM_HOST_SIMD_SSE2 = 1,      /**< 128 bit SSE2 kernels (x86). */
+    ARM_HOST_SIMD_AVX2 = 2,      /**< 256 bit AVX2 kernels (x86-64). */
+    ARM_HOST_SIMD_NEON = 3       /**< 128 bit NEON kernels (AArch64). */
+  } arm_host_simd;
+
+  /**
+   * @brief  Returns the kernel set in use.
+   * @return kernel set.
+   */
+  arm_host_simd arm_host_simd_level(
+  void);
+
+  /**
+   * @brief  Selects the kernel set used by the dispatched functions.
+   * @param[in] level  kernel set.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if the set was not
+   *         built in or is not supported by the processor.
+   */
+  arm_status arm_host_simd_select(
+  arm_host_simd level);
+
+  /**
+   * @brief  Returns the name of a kernel set.
+   * @param[in] level  kernel set.
+   * @return "generic", "sse2", "avx2" or "neon".
+   */
+  const char *arm_host_simd_name(
+  arm_host_simd level);
+
+  /**
+   * @} end of HostBuild group
+   */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* _ARM_MATH_HOST_H */
@@ -0,0 +1,194 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_cholesky_f32.c
+*
+* Description:  Floating-point Cholesky decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixChol Cholesky Decomposition
+ *
+ * Computes the Cholesky decomposition of a symmetric positive definite matrix.
+ *
+ * The decomposition writes A as the product of a lower triangular matrix and
+ * its transpose:
+ * <pre>
+ *     A = L * L<sup>T</sup>
+ * </pre>
+ * Solving A * x = b then takes a forward substitution L * y = b and a back
+ * substitution L<sup>T</sup> * x = y, see arm_mat_solve_lower_triangular_f32()
+ * and arm_mat_solve_upper_triangular_f32().  This is about three times fewer
+ * operations than the Gauss-Jordan inverse of arm_mat_inverse_f32(), and the
+ * inverse itself, when needed, follows from the same two substitutions with
+ * the identity matrix as right hand side.
+ *
+ * \par Algorithm
+ * The Cholesky-Banachiewicz method computes L row by row:
+ * <pre>
+ *     L[i][j] = (A[i][j] - sum(L[i][k] * L[j][k], k < j)) / L[j][j]     j < i
+ *     L[i][i] = sqrt(A[i][i] - sum(L[i][k] * L[i][k], k < i))
+ * </pre>
+ * Only the lower triangle of A is read and the upper triangle of L is
+ * cleared, so the input and output matrices may be the same.  If a diagonal
+ * term is not positive, A is not positive definite and the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+ * @addtogroup MatrixChol
+ * @{
+ */
+
+/**
+ * @brief Floating-point Cholesky decomposition.
+ * @param[in]       *pSrc points to the input matrix structure
+ * @param[out]      *pDst points to the output matrix structure
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of the output matrix does not match the size of the input matrix.
+ * If the input matrix is found not to be positive definite, the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ */
+
+arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pA = pSrc->pData;                      /* input data matrix pointer */
+  float32_t *pL = pDst->pData;                      /* output data matrix pointer */
+  float32_t *pRowI, *pRowJ;                         /* rows i and j of the output */
+  float32_t sum;                                    /* accumulator */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k;                              /* loop counters */
+  arm_status status;                             /* status of the decomposition */
+
+#ifndef ARM_MATH_CM0_FAMILY
+  float32_t acc1, acc2, acc3;                       /* additional accumulators */
+  uint32_t blkCnt;                               /* loop counter */
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pDst->numRows != pDst->numCols)
+     || (pSrc->numRows != pDst->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Row i of L only depends on row i of A and on the rows of L above it */
+    for (i = 0u; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+    {
+      pRowI = pL + (i * n);
+
+      for (j = 0u; j <= i; j++)
+      {
+        pRowJ = pL + (j * n);
+
+        /* sum = A[i][j] - L[i][0] * L[j][0] - ... - L[i][j-1] * L[j][j-1] */
+        sum = pA[(i * n) + j];
+        k = 0u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+        /* Loop unrolling: four products per iteration in independent accumulators */
+        acc1 = 0.0f;
+        acc2 = 0.0f;
+        acc3 = 0.0f;
+        blkCnt = j >> 2u;
+
+        while(blkCnt > 0u)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+          acc1 += pRowI[k + 1u] * pRowJ[k + 1u];
+          acc2 += pRowI[k + 2u] * pRowJ[k + 2u];
+          acc3 += pRowI[k + 3u] * pRowJ[k + 3u];
+          k += 4u;
+          blkCnt--;
+        }
+
+        sum -= (acc1 + acc2) + acc3;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        /* Remaining products, or all of them on Cortex-M0 */
+        while(k < j)
+        {
+          sum -= pRowI[k] * pRowJ[k];
+          k++;
+        }
+
+        if(i == j)
+        {
+          /* A zero or negative pivot means A is not positive definite */
+          if(sum <= 0.0f)
+          {
+            status = ARM_MATH_DECOMPOSITION_FAILURE;
+            break;
+          }
+          arm_sqrt_f32(sum, &pRowI[i]);
+        }
+        else
+        {
+          pRowI[j] = sum / pRowJ[j];
+        }
+      }
+
+      /* Clear the upper triangle of the row */
+      for (j = i + 1u; j < n; j++)
+      {
+        pRowI[j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixChol group
+ */
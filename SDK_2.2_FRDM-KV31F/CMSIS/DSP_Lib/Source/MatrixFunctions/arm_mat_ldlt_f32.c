@@ -0,0 +1,256 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_ldlt_f32.c
+*
+* Description:  Floating-point LDL^T decomposition.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @defgroup MatrixLDLT LDL^T Decomposition
+ *
+ * Computes the LDL<sup>T</sup> decomposition of a symmetric positive
+ * semi-definite matrix.
+ *
+ * The decomposition writes a symmetric permutation of A as
+ * <pre>
+ *     P * A * P<sup>T</sup> = L * D * L<sup>T</sup>
+ * </pre>
+ * where L is unit lower triangular, D is diagonal and P is the permutation
+ * matrix given by the vector pp: row i of P * A is row pp[i] of A.  Unlike
+ * the Cholesky decomposition it needs no square root and it also handles
+ * singular covariance matrices, for which the trailing terms of D are zero.
+ *
+ * \par Algorithm
+ * Each step brings the largest remaining diagonal term to the pivot position
+ * by swapping a row and a column, divides the pivot column by the pivot to
+ * get a column of L and subtracts the rank one update from the trailing
+ * block.  The decomposition ends early when the largest remaining diagonal
+ * term is zero and the trailing block is zero; otherwise a negative or zero
+ * pivot means that A is not positive semi-definite and the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.
+ */
+
+/**
+ * @addtogroup MatrixLDLT
+ * @{
+ */
+
+/**
+ * @brief Floating-point LDL^T decomposition.
+ * @param[in]       *pSrc points to the input matrix structure
+ * @param[out]      *pl   points to the unit lower triangular output matrix structure
+ * @param[out]      *pd   points to the diagonal output matrix structure
+ * @param[out]      *pp   points to the permutation vector, numRows elements
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the input matrix is not square or if the size
+ * of an output matrix does not match the size of the input matrix.
+ * If the input matrix is found not to be positive semi-definite, the function returns
+ * <code>ARM_MATH_DECOMPOSITION_FAILURE</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * The input matrix is copied to pl, which is the work area of the decomposition,
+ * so pSrc and pl may be the same matrix.
+ */
+
+arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * pSrc,
+  arm_matrix_instance_f32 * pl,
+  arm_matrix_instance_f32 * pd,
+  uint16_t * pp)
+{
+  float32_t *pA = pl->pData;                     /* working matrix, becomes L */
+  float32_t *pD = pd->pData;                     /* diagonal output pointer */
+  float32_t *pRowK, *pRowI;                      /* pivot row and updated row */
+  float32_t pivot, lik, tmp;                     /* pivot, multiplier and swap temporary */
+  uint32_t n = pSrc->numRows;                    /* size of the matrix */
+  uint32_t i, j, k, m;                           /* loop counters and pivot index */
+  uint16_t idx;                                  /* permutation swap temporary */
+  arm_status status;                             /* status of the decomposition */
+
+#ifndef ARM_MATH_CM0_FAMILY
+  uint32_t blkCnt;                               /* loop counter */
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pSrc->numRows != pSrc->numCols) || (pl->numRows != pl->numCols)
+     || (pd->numRows != pd->numCols) || (pSrc->numRows != pl->numRows)
+     || (pSrc->numRows != pd->numRows))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* The decomposition works in place in L */
+    if(pA != pSrc->pData)
+    {
+      arm_copy_f32(pSrc->pData, pA, n * n);
+    }
+
+    for (i = 0u; i < n; i++)
+    {
+      pp[i] = (uint16_t) i;
+    }
+
+    for (k = 0u; k < n; k++)
+    {
+      /* Bring the largest remaining diagonal term to the pivot position */
+      m = k;
+      for (i = k + 1u; i < n; i++)
+      {
+        if(pA[(i * n) + i] > pA[(m * n) + m])
+        {
+          m = i;
+        }
+      }
+
+      if(m != k)
+      {
+        /* Swap rows k and m, including the columns of L already computed */
+        for (j = 0u; j < n; j++)
+        {
+          tmp = pA[(k * n) + j];
+          pA[(k * n) + j] = pA[(m * n) + j];
+          pA[(m * n) + j] = tmp;
+        }
+
+        /* Swap columns k and m */
+        for (i = 0u; i < n; i++)
+        {
+          tmp = pA[(i * n) + k];
+          pA[(i * n) + k] = pA[(i * n) + m];
+          pA[(i * n) + m] = tmp;
+        }
+
+        idx = pp[k];
+        pp[k] = pp[m];
+        pp[m] = idx;
+      }
+
+      pRowK = pA + (k * n);
+      pivot = pRowK[k];
+
+      if(pivot <= 0.0f)
+      {
+        /* A zero pivot is only valid if the whole trailing block is zero */
+        if(pivot < 0.0f)
+        {
+          status = ARM_MATH_DECOMPOSITION_FAILURE;
+        }
+
+        for (i = k; (i < n) && (status == ARM_MATH_SUCCESS); i++)
+        {
+          for (j = k; j < n; j++)
+          {
+            if(pA[(i * n) + j] != 0.0f)
+            {
+              status = ARM_MATH_DECOMPOSITION_FAILURE;
+              break;
+            }
+          }
+        }
+
+        break;
+      }
+
+      /* Column k of L and rank one update of the trailing block with row k */
+      for (i = k + 1u; i < n; i++)
+      {
+        pRowI = pA + (i * n);
+        lik = pRowI[k] / pivot;
+        pRowI[k] = lik;
+        j = k + 1u;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+        /* Loop unrolling: four elements per iteration */
+        blkCnt = (n - j) >> 2u;
+
+        while(blkCnt > 0u)
+        {
+          pRowI[j] -= lik * pRowK[j];
+          pRowI[j + 1u] -= lik * pRowK[j + 1u];
+          pRowI[j + 2u] -= lik * pRowK[j + 2u];
+          pRowI[j + 3u] -= lik * pRowK[j + 3u];
+          j += 4u;
+          blkCnt--;
+        }
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        /* Remaining elements, or all of them on Cortex-M0 */
+        while(j < n)
+        {
+          pRowI[j] -= lik * pRowK[j];
+          j++;
+        }
+      }
+    }
+
+    /* Split the working matrix into L and D */
+    for (i = 0u; i < n; i++)
+    {
+      for (j = 0u; j < n; j++)
+      {
+        pD[(i * n) + j] = 0.0f;
+      }
+
+      pD[(i * n) + i] = pA[(i * n) + i];
+      pA[(i * n) + i] = 1.0f;
+
+      for (j = i + 1u; j < n; j++)
+      {
+        pA[(i * n) + j] = 0.0f;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixLDLT group
+ */
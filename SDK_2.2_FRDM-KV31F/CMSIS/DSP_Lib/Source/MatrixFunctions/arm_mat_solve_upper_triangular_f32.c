@@ -0,0 +1,163 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_mat_solve_upper_triangular_f32.c
+*
+* Description:  Floating-point upper triangular solver.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupMatrix
+ */
+
+/**
+ * @addtogroup MatrixSolve
+ * @{
+ */
+
+/**
+ * @brief Floating-point upper triangular solver.
+ * @param[in]       *pUT  points to the upper triangular matrix structure
+ * @param[in]       *pA   points to the right hand side matrix structure
+ * @param[out]      *pDst points to the solution matrix structure
+ * @return     		The function returns
+ * <code>ARM_MATH_SIZE_MISMATCH</code> if the triangular matrix is not square or if the
+ * sizes of the right hand side and solution matrices do not match it.
+ * If a diagonal element of the triangular matrix is zero, the function returns
+ * <code>ARM_MATH_SINGULAR</code>.  Otherwise, the function returns <code>ARM_MATH_SUCCESS</code>.
+ *
+ * Only the upper triangle of the triangular matrix is read.  pA and pDst may be the same matrix.
+ */
+
+arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * pUT,
+  const arm_matrix_instance_f32 * pA,
+  arm_matrix_instance_f32 * pDst)
+{
+  float32_t *pT = pUT->pData;                    /* triangular matrix pointer */
+  float32_t *pB = pA->pData;                     /* right hand side pointer */
+  float32_t *pX = pDst->pData;                   /* solution pointer */
+  float32_t *pRow, *pCol;                        /* row of the triangular matrix and column of the solution */
+  float32_t sum, invDiag;                        /* accumulator and inverse of the diagonal element */
+  uint32_t n = pUT->numRows;                     /* size of the triangular matrix */
+  uint32_t numCols = pA->numCols;                /* number of right hand sides */
+  uint32_t i, c, k, cnt;                         /* loop counters */
+  arm_status status;                             /* status of the solver */
+
+#ifndef ARM_MATH_CM0_FAMILY
+  float32_t acc1, acc2, acc3;                    /* additional accumulators */
+  uint32_t blkCnt;                               /* loop counter */
+#endif
+
+#ifdef ARM_MATH_MATRIX_CHECK
+
+  /* Check for matrix mismatch condition */
+  if((pUT->numRows != pUT->numCols) || (pA->numRows != n)
+     || (pDst->numRows != n) || (pDst->numCols != numCols))
+  {
+    /* Set status as ARM_MATH_SIZE_MISMATCH */
+    status = ARM_MATH_SIZE_MISMATCH;
+  }
+  else
+#endif /*    #ifdef ARM_MATH_MATRIX_CHECK    */
+
+  {
+    status = ARM_MATH_SUCCESS;
+
+    /* Row by row, so that each diagonal element is inverted once */
+    for (i = n; i-- > 0u; )
+    {
+      pRow = pT + (i * n);
+
+      if(pRow[i] == 0.0f)
+      {
+        status = ARM_MATH_SINGULAR;
+        break;
+      }
+
+      invDiag = 1.0f / pRow[i];
+
+      for (c = 0u; c < numCols; c++)
+      {
+        pCol = pX + c;
+
+        /* x[i] = (a[i] - UT[i][i+1] * x[i+1] - ... - UT[i][n-1] * x[n-1]) / UT[i][i] */
+        sum = pB[(i * numCols) + c];
+        k = i + 1u;
+        cnt = n - 1u - i;
+
+#ifndef ARM_MATH_CM0_FAMILY
+
+        /* Run the below code for Cortex-M4 and Cortex-M3 */
+        /* Loop unrolling: four products per iteration in independent accumulators */
+        acc1 = 0.0f;
+        acc2 = 0.0f;
+        acc3 = 0.0f;
+        blkCnt = cnt >> 2u;
+        cnt -= blkCnt << 2u;
+
+        while(blkCnt > 0u)
+        {
+          sum -= pRow[k] * pCol[k * numCols];
+          acc1 += pRow[k + 1u] * pCol[(k + 1u) * numCols];
+          acc2 += pRow[k + 2u] * pCol[(k + 2u) * numCols];
+          acc3 += pRow[k + 3u] * pCol[(k + 3u) * numCols];
+          k += 4u;
+          blkCnt--;
+        }
+
+        sum -= (acc1 + acc2) + acc3;
+
+#endif /* #ifndef ARM_MATH_CM0_FAMILY */
+
+        /* Remaining products, or all of them on Cortex-M0 */
+        while(cnt > 0u)
+        {
+          sum -= pRow[k] * pCol[k * numCols];
+          k++;
+          cnt--;
+        }
+
+        pCol[i * numCols] = sum * invDiag;
+      }
+    }
+  }
+
+  /* Return to application */
+  return (status);
+}
+
+/**
+ * @} end of MatrixSolve group
+ */
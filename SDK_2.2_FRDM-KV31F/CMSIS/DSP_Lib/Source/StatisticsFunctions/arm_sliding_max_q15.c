@@ -0,0 +1,140 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sliding_max_q15.c
+*
+* Description:  Sliding-window maximum of Q15 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Sliding-window maximum of Q15 data.
+ * @param[in,out] *S          points to an instance of the Q15 sliding-window minimum or maximum structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of maxima, one per input sample.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ */
+
+void arm_sliding_max_q15(
+  arm_sliding_min_max_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize)
+{
+  q15_t *pWindow = S->pWindow;                /* Window buffer */
+  uint16_t *pDeque = S->pDeque;                  /* Slots of the candidates, oldest first */
+  q15_t in;                                   /* Input sample */
+  uint32_t windowSize = S->windowSize;           /* Window length */
+  uint32_t count = S->count;                     /* Samples in the window */
+  uint32_t index = S->index;                     /* Slot of the next sample */
+  uint32_t head = S->head;                       /* Position of the oldest candidate */
+  uint32_t size = S->size;                       /* Number of candidates */
+  uint32_t back;                                 /* Position of the newest candidate */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(count < windowSize)
+    {
+      count++;
+    }
+    else if(pDeque[head] == index)
+    {
+      /* The oldest sample leaves the window and was the maximum */
+      head++;
+      if(head == windowSize)
+      {
+        head = 0u;
+      }
+      size--;
+    }
+
+    pWindow[index] = in;
+
+    /* The candidates that are not greater than the new sample
+     ** leave the window before it and can no longer be the maximum */
+    while(size > 0u)
+    {
+      back = head + size - 1u;
+      if(back >= windowSize)
+      {
+        back -= windowSize;
+      }
+      if(pWindow[pDeque[back]] > in)
+      {
+        break;
+      }
+      size--;
+    }
+
+    back = head + size;
+    if(back >= windowSize)
+    {
+      back -= windowSize;
+    }
+    pDeque[back] = (uint16_t) index;
+    size++;
+
+    *pDst++ = pWindow[pDeque[head]];
+
+    index++;
+    if(index == windowSize)
+    {
+      index = 0u;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = (uint16_t) count;
+  S->index = (uint16_t) index;
+  S->head = (uint16_t) head;
+  S->size = (uint16_t) size;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
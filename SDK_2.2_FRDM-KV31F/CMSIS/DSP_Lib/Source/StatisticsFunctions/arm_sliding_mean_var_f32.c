@@ -0,0 +1,191 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sliding_mean_var_f32.c
+*
+* Description:  Sliding-window mean and variance of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @defgroup SlidingStats Sliding Window Statistics
+ *
+ * Mean, variance, RMS, minimum and maximum of the last <code>windowSize</code>
+ * samples of a stream, given for every input sample at a cost that does not
+ * depend on the window length.
+ *
+ * Each instance keeps the last <code>windowSize</code> samples in the ring
+ * buffer <code>pWindow</code> supplied by the caller, together with running
+ * values that are updated with the sample entering and the sample leaving the
+ * window.  Until the window has filled, the statistics cover the samples
+ * received so far.  Blocks of any length may follow each other; the window
+ * carries over from one call to the next.
+ *
+ * \par Fixed-point functions
+ * The Q31 and Q15 running sums are integers and are updated exactly.  Each
+ * output is the result of arm_mean_q31(), arm_var_q31(), arm_rms_q31() and the
+ * Q15 versions applied to the samples in the window, bit for bit, and the
+ * scaling and overflow rules of those functions apply to the window.
+ *
+ * \par Floating-point functions
+ * The floating-point mean and variance use Welford's update for one sample
+ * removed and one added, and the RMS a running sum of squares.  The rounding
+ * errors of the removals would grow without bound, so a second set of values
+ * is accumulated, with additions only, from the samples written since the ring
+ * buffer last wrapped, and replaces the running values each time it wraps.
+ * The error therefore stays that of at most two windows of updates, without a
+ * periodic recomputation over the whole window.
+ *
+ * \par Minimum and maximum
+ * The slots of the samples that may still become the extreme value are kept
+ * in the queue <code>pDeque</code>, oldest first, so that the extreme value is
+ * always at its head.  Each sample enters and leaves the queue once, which
+ * gives a constant cost per sample on average.  One instance follows either
+ * the minimum or the maximum of a stream.
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Sliding-window mean and variance of floating-point data.
+ * @param[in,out] *S          points to an instance of the floating-point sliding-window mean and variance structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pMean      points to the block of means, one per input sample.
+ * @param[out]    *pVar       points to the block of variances, one per input sample.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ *
+ * \par
+ * The variance is that of arm_var_f32(), with <code>count - 1</code> in the
+ * denominator, and is 0 while the window holds a single sample.
+ */
+
+void arm_sliding_mean_var_f32(
+  arm_sliding_mean_var_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMean,
+  float32_t * pVar,
+  uint32_t blockSize)
+{
+  float32_t *pWindow = S->pWindow;               /* Window buffer */
+  float32_t mean = S->mean;                      /* Mean of the window */
+  float32_t m2 = S->m2;                          /* Sum of squared deviations in the window */
+  float32_t shadowMean = S->shadowMean;          /* Mean of the samples since the last wrap */
+  float32_t shadowM2 = S->shadowM2;              /* Sum of their squared deviations */
+  float32_t invSize, invSizeM1;                  /* Reciprocals of windowSize and windowSize - 1 */
+  float32_t in, out, delta, newMean;             /* Temporary variables */
+  uint32_t windowSize = S->windowSize;           /* Window length */
+  uint32_t count = S->count;                     /* Samples in the window */
+  uint32_t index = S->index;                     /* Slot of the next sample */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  invSize = 1.0f / (float32_t) windowSize;
+  invSizeM1 = (windowSize > 1u) ? 1.0f / (float32_t) (windowSize - 1u) : 0.0f;
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    /* Welford update with additions only, over the slots 0 to index */
+    delta = in - shadowMean;
+    shadowMean += delta / (float32_t) (index + 1u);
+    shadowM2 += delta * (in - shadowMean);
+
+    if(count < windowSize)
+    {
+      /* While the window fills, the slots 0 to index hold all the samples */
+      count++;
+      mean = shadowMean;
+      m2 = shadowM2;
+    }
+    else
+    {
+      /* The new sample replaces the oldest one, held in the same slot */
+      out = pWindow[index];
+      delta = in - out;
+      newMean = mean + delta * invSize;
+      m2 += delta * ((in - newMean) + (out - mean));
+      mean = newMean;
+    }
+
+    pWindow[index] = in;
+    index++;
+
+    if(index == windowSize)
+    {
+      /* The values accumulated since the last wrap now cover the whole
+       ** window and replace the running ones */
+      index = 0u;
+      mean = shadowMean;
+      m2 = shadowM2;
+      shadowMean = 0.0f;
+      shadowM2 = 0.0f;
+    }
+
+    *pMean++ = mean;
+
+    if((count < 2u) || (m2 <= 0.0f))
+    {
+      *pVar++ = 0.0f;
+    }
+    else if(count == windowSize)
+    {
+      *pVar++ = m2 * invSizeM1;
+    }
+    else
+    {
+      *pVar++ = m2 / (float32_t) (count - 1u);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = (uint16_t) count;
+  S->index = (uint16_t) index;
+  S->mean = mean;
+  S->m2 = m2;
+  S->shadowMean = shadowMean;
+  S->shadowM2 = shadowM2;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
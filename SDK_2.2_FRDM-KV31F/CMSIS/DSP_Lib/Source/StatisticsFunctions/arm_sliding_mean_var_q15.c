@@ -0,0 +1,137 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sliding_mean_var_q15.c
+*
+* Description:  Sliding-window mean and variance of Q15 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Sliding-window mean and variance of Q15 data.
+ * @param[in,out] *S          points to an instance of the Q15 sliding-window mean and variance structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pMean      points to the block of means, one per input sample.
+ * @param[out]    *pVar       points to the block of variances, one per input sample.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * Each mean is that of arm_mean_q15() and each variance that of arm_var_q15()
+ * over the samples in the window.  The sum of the samples is kept in 32 bits and
+ * their sum of squares in 64 bits, as in those functions.
+ */
+
+void arm_sliding_mean_var_q15(
+  arm_sliding_mean_var_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMean,
+  q15_t * pVar,
+  uint32_t blockSize)
+{
+  q15_t *pWindow = S->pWindow;                   /* Window buffer */
+  q31_t sum = S->sum;                            /* Sum of the window */
+  q63_t sumOfSquares = S->sumOfSquares;          /* Sum of squares of the window */
+  q31_t meanOfSquares, squareOfMean;             /* Mean of squares and square of mean */
+  q15_t in, out;                                 /* Entering and leaving samples */
+  uint32_t windowSize = S->windowSize;           /* Window length */
+  uint32_t count = S->count;                     /* Samples in the window */
+  uint32_t index = S->index;                     /* Slot of the next sample */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(count < windowSize)
+    {
+      count++;
+    }
+    else
+    {
+      /* Remove the oldest sample, held in the slot of the new one */
+      out = pWindow[index];
+      sum -= out;
+      sumOfSquares -= ((q31_t) out * out);
+    }
+
+    pWindow[index] = in;
+    sum += in;
+    sumOfSquares += ((q31_t) in * in);
+
+    index++;
+    if(index == windowSize)
+    {
+      index = 0u;
+    }
+
+    /* Mean as in arm_mean_q15() */
+    *pMean++ = (q15_t) (sum / (q31_t) count);
+
+    /* Variance as in arm_var_q15() */
+    if(count == 1u)
+    {
+      *pVar++ = 0;
+    }
+    else
+    {
+      meanOfSquares = (q31_t) (sumOfSquares / (q63_t) (count - 1u));
+      squareOfMean = (q31_t) ((q63_t) sum * sum / (q63_t) (count * (count - 1u)));
+      *pVar++ = (meanOfSquares - squareOfMean) >> 15;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = (uint16_t) count;
+  S->index = (uint16_t) index;
+  S->sum = sum;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
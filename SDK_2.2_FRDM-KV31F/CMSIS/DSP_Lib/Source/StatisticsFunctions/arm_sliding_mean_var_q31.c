@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sliding_mean_var_q31.c
+*
+* Description:  Sliding-window mean and variance of Q31 data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Sliding-window mean and variance of Q31 data.
+ * @param[in,out] *S          points to an instance of the Q31 sliding-window mean and variance structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pMean      points to the block of means, one per input sample.
+ * @param[out]    *pVar       points to the block of variances, one per input sample.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ *
+ * @details
+ * <b>Scaling and Overflow Behavior:</b>
+ *
+ * \par
+ * Each mean is that of arm_mean_q31() and each variance that of arm_var_q31()
+ * over the samples in the window.  As in arm_var_q31(), the samples are shifted
+ * right by 8 bits before they are squared, and the input must be scaled down by
+ * log2(windowSize) - 8 bits for windows longer than 256 samples.
+ */
+
+void arm_sliding_mean_var_q31(
+  arm_sliding_mean_var_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pMean,
+  q31_t * pVar,
+  uint32_t blockSize)
+{
+  q31_t *pWindow = S->pWindow;                   /* Window buffer */
+  q63_t sum = S->sum;                            /* Sum of the window */
+  q63_t sumShift = S->sumShift;                  /* Sum of the shifted samples */
+  q63_t sumOfSquares = S->sumOfSquares;          /* Sum of squares of the shifted samples */
+  q63_t meanOfSquares, squareOfMean;             /* Mean of squares and square of mean */
+  q31_t in, out;                                 /* Entering and leaving samples */
+  uint32_t windowSize = S->windowSize;           /* Window length */
+  uint32_t count = S->count;                     /* Samples in the window */
+  uint32_t index = S->index;                     /* Slot of the next sample */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+
+    if(count < windowSize)
+    {
+      count++;
+    }
+    else
+    {
+      /* Remove the oldest sample, held in the slot of the new one */
+      out = pWindow[index];
+      sum -= out;
+      out = out >> 8;
+      sumShift -= out;
+      sumOfSquares -= ((q63_t) (out) * (out));
+    }
+
+    pWindow[index] = in;
+    sum += in;
+    in = in >> 8;
+    sumShift += in;
+    sumOfSquares += ((q63_t) (in) * (in));
+
+    index++;
+    if(index == windowSize)
+    {
+      index = 0u;
+    }
+
+    /* Mean as in arm_mean_q31() */
+    *pMean++ = (q31_t) (sum / (int32_t) count);
+
+    /* Variance as in arm_var_q31() */
+    if(count == 1u)
+    {
+      *pVar++ = 0;
+    }
+    else
+    {
+      meanOfSquares = sumOfSquares / (q63_t) (count - 1u);
+      squareOfMean = sumShift * sumShift / (q63_t) (count * (count - 1u));
+      *pVar++ = (meanOfSquares - squareOfMean) >> 15;
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = (uint16_t) count;
+  S->index = (uint16_t) index;
+  S->sum = sum;
+  S->sumShift = sumShift;
+  S->sumOfSquares = sumOfSquares;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
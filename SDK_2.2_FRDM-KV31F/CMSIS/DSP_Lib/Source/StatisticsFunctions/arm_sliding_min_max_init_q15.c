@@ -0,0 +1,79 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sliding_min_max_init_q15.c
+*
+* Description:  Q15 sliding-window minimum and maximum initialization function.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief  Initialization function for the Q15 sliding-window minimum or maximum.
+ * @param[out] *S           points to an instance of the Q15 sliding-window minimum or maximum structure.
+ * @param[in]  windowSize   number of samples in the window, at least 1.
+ * @param[in]  *pWindow     points to the window buffer of length <code>windowSize</code>.
+ * @param[in]  *pDeque      points to the candidate buffer of length <code>windowSize</code>.
+ * @return     none.
+ *
+ * \par
+ * The instance may then be used with either arm_sliding_min_q15() or
+ * arm_sliding_max_q15(), but not with both.
+ */
+
+void arm_sliding_min_max_init_q15(
+  arm_sliding_min_max_instance_q15 * S,
+  uint16_t windowSize,
+  q15_t * pWindow,
+  uint16_t * pDeque)
+{
+  S->windowSize = windowSize;
+  S->count = 0u;
+  S->index = 0u;
+  S->head = 0u;
+  S->size = 0u;
+  S->pWindow = pWindow;
+  S->pDeque = pDeque;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
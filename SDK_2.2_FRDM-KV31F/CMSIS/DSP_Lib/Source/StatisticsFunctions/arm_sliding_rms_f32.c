@@ -0,0 +1,128 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_sliding_rms_f32.c
+*
+* Description:  Sliding-window RMS of floating-point data.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupStats
+ */
+
+/**
+ * @addtogroup SlidingStats
+ * @{
+ */
+
+/**
+ * @brief Sliding-window RMS of floating-point data.
+ * @param[in,out] *S          points to an instance of the floating-point sliding-window RMS structure.
+ * @param[in]     *pSrc       points to the block of input samples.
+ * @param[out]    *pDst       points to the block of RMS values, one per input sample.
+ * @param[in]     blockSize   number of samples to process.
+ * @return none.
+ */
+
+void arm_sliding_rms_f32(
+  arm_sliding_rms_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize)
+{
+  float32_t *pWindow = S->pWindow;               /* Window buffer */
+  float32_t sumOfSquares = S->sumOfSquares;      /* Sum of squares of the window */
+  float32_t shadowSumOfSquares = S->shadowSumOfSquares;  /* Sum of squares since the last wrap */
+  float32_t invSize;                             /* Reciprocal of windowSize */
+  float32_t in, out, sq;                         /* Temporary variables */
+  uint32_t windowSize = S->windowSize;           /* Window length */
+  uint32_t count = S->count;                     /* Samples in the window */
+  uint32_t index = S->index;                     /* Slot of the next sample */
+  uint32_t blkCnt = blockSize;                   /* Loop counter */
+
+  invSize = 1.0f / (float32_t) windowSize;
+
+  while(blkCnt > 0u)
+  {
+    in = *pSrc++;
+    sq = in * in;
+    shadowSumOfSquares += sq;
+
+    if(count < windowSize)
+    {
+      /* While the window fills, the slots 0 to index hold all the samples */
+      count++;
+      sumOfSquares = shadowSumOfSquares;
+    }
+    else
+    {
+      /* The new sample replaces the oldest one, held in the same slot */
+      out = pWindow[index];
+      sumOfSquares += sq - out * out;
+    }
+
+    pWindow[index] = in;
+    index++;
+
+    if(index == windowSize)
+    {
+      /* The sum accumulated since the last wrap now covers the whole window */
+      index = 0u;
+      sumOfSquares = shadowSumOfSquares;
+      shadowSumOfSquares = 0.0f;
+    }
+
+    /* arm_sqrt_f32() gives 0 for the small negative sums left by rounding */
+    if(count == windowSize)
+    {
+      arm_sqrt_f32(sumOfSquares * invSize, pDst++);
+    }
+    else
+    {
+      arm_sqrt_f32(sumOfSquares / (float32_t) count, pDst++);
+    }
+
+    /* Decrement the loop counter */
+    blkCnt--;
+  }
+
+  S->count = (uint16_t) count;
+  S->index = (uint16_t) index;
+  S->sumOfSquares = sumOfSquares;
+  S->shadowSumOfSquares = shadowSumOfSquares;
+}
+
+/**
+ * @} end of SlidingStats group
+ */
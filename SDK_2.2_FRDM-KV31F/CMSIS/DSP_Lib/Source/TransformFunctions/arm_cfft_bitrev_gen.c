@@ -0,0 +1,165 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_cfft_bitrev_gen.c
+*
+* Description:  Generation of the CFFT bit reversal index tables.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief Digit reverses an index of the CFFT output.
+ * @param[in]  i          index.
+ * @param[in]  log2Len    log2 of the FFT length.
+ * @param[in]  firstBits  width of the first (least significant) digit of the index.
+ * @param[in]  digitBits  width of the other digits.
+ * @return     digit reversed index.
+ */
+
+static uint32_t arm_cfft_digit_reverse(
+  uint32_t i,
+  uint32_t log2Len,
+  uint32_t firstBits,
+  uint32_t digitBits)
+{
+  uint32_t bits = firstBits;                     /* Width of the current digit */
+  uint32_t shift = log2Len;                      /* Position of the current digit in the result */
+  uint32_t r = 0u;                               /* Reversed index */
+
+  while (shift > 0u)
+  {
+    shift -= bits;
+    r |= (i & ((1u << bits) - 1u)) << shift;
+    i >>= bits;
+    bits = digitBits;
+  }
+
+  return (r);
+}
+
+/**
+ * @brief Generates the bit reversal index table of a CFFT.
+ * @param[out] *pBitRevTable  points to the table to fill.
+ * @param[in]  fftLen         length of the FFT, 16, 32, 64, ..., 4096.
+ * @param[in]  fixedFlag      0 for the table of arm_cfft_f32(), 1 for the table
+ *                            of arm_cfft_q31() and arm_cfft_q15().
+ * @return     number of values written, the <code>bitRevLength</code> of the
+ *             instance, or 0 if <code>fftLen</code> is not supported.
+ *
+ * \par
+ * The Q31 and Q15 transforms leave their output in bit reversed order.  The
+ * floating-point transform is built from radix-8 stages preceded by one radix-2
+ * or radix-4 stage when log2(<code>fftLen</code>) is not a multiple of 3, and
+ * leaves its output in the matching mixed-radix digit reversed order.  The table
+ * lists, as byte offsets of complex samples, the swaps that restore the natural
+ * order: every cycle of the permutation is walked once, from its smallest index,
+ * giving one swap per element moved.
+ * \par
+ * The tables have as many values as the flash tables, so
+ * <code>pBitRevTable</code> can be sized with the length macros of
+ * arm_common_tables.h, for example ARMBITREVINDEXTABLE_256_TABLE_LENGTH or
+ * ARMBITREVINDEXTABLE_FIXED__256_TABLE_LENGTH.  The swaps are not listed in the
+ * same order as in the flash tables but give the same permutation.
+ */
+
+uint16_t arm_cfft_bitrev_gen(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint8_t fixedFlag)
+{
+  uint32_t log2Len = 0u;                         /* log2 of the FFT length */
+  uint32_t firstBits, digitBits;                 /* Digit widths of the output order */
+  uint32_t s, pos, t;                            /* Cycle start, current and next index */
+  uint16_t n = 0u;                               /* Number of values written */
+
+  /* Only the powers of two from 16 to 4096 are supported */
+  if ((fftLen < 16u) || (fftLen > 4096u) || ((fftLen & (fftLen - 1u)) != 0u))
+  {
+    return (0u);
+  }
+
+  while ((1u << log2Len) < fftLen)
+  {
+    log2Len++;
+  }
+
+  if (fixedFlag != 0u)
+  {
+    firstBits = 1u;
+    digitBits = 1u;
+  }
+  else
+  {
+    firstBits = ((log2Len % 3u) == 0u) ? 3u : (log2Len % 3u);
+    digitBits = 3u;
+  }
+
+  for (s = 1u; s < fftLen; s++)
+  {
+    /* Walk the cycle of s, and skip it unless s is its smallest index */
+    t = arm_cfft_digit_reverse(s, log2Len, firstBits, digitBits);
+    while (t > s)
+    {
+      t = arm_cfft_digit_reverse(t, log2Len, firstBits, digitBits);
+    }
+
+    if (t == s)
+    {
+      /* Each swap brings the sample that belongs at pos there */
+      pos = s;
+      t = arm_cfft_digit_reverse(s, log2Len, firstBits, digitBits);
+      while (t != s)
+      {
+        pBitRevTable[n++] = (uint16_t) (pos * 8u);
+        pBitRevTable[n++] = (uint16_t) (t * 8u);
+        pos = t;
+        t = arm_cfft_digit_reverse(t, log2Len, firstBits, digitBits);
+      }
+    }
+  }
+
+  return (n);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
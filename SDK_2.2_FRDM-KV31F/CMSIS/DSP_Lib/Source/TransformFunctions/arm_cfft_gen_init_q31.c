@@ -0,0 +1,121 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_cfft_gen_init_q31.c
+*
+* Description:  Initialization of the Q31 CFFT with tables generated in RAM.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_twiddle_sincos_f64(
+  uint32_t k,
+  uint32_t n,
+  float64_t * pCos,
+  float64_t * pSin);
+
+/* Rounds x, -1 <= x <= 1, to the nearest Q31 value */
+static q31_t arm_twiddle_to_q31(
+  float64_t x)
+{
+  float64_t y = floor((x * 2147483648.0) + 0.5);
+
+  return ((y >= 2147483647.0) ? 0x7FFFFFFF : (q31_t) y);
+}
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup ComplexFFT
+ * @{
+ */
+
+/**
+ * @brief Initializes the Q31 CFFT with tables generated in RAM.
+ * @param[out] *S             points to an instance of the Q31 CFFT structure.
+ * @param[in]  fftLen         length of the FFT, 16, 32, 64, ..., 4096.
+ * @param[out] *pTwiddle      points to the twiddle factor table to fill, of 3*fftLen/2 values.
+ * @param[out] *pBitRevTable  points to the bit reversal index table to fill, see
+ *                            arm_cfft_bitrev_gen() for its length.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code>
+ *             is not supported.
+ *
+ * \par
+ * An alternative to the constant instances of arm_const_structs.h for firmware
+ * that would rather spend RAM than flash: the instance points to
+ * <code>pTwiddle</code> and <code>pBitRevTable</code>, which must stay allocated
+ * while it is used, and none of the flash tables is linked.  The tables are
+ * computed once, in float64_t, at a cost of one cosine and one sine per twiddle
+ * factor.
+ * \par
+ * The transform uses the twiddle factors of the first three quarters of the turn.
+ * The values are rounded to the nearest Q31 value and saturated at 0x7FFFFFFF,
+ * and can differ from the twiddleCoef_N_q31 tables in the last bit.
+ */
+
+arm_status arm_cfft_gen_init_q31(
+  arm_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable)
+{
+  float64_t c, s;                                /* Cosine and sine of the twiddle factor */
+  uint32_t i;                                    /* Loop counter */
+  uint16_t bitRevLength;                         /* Length of the bit reversal table */
+
+  bitRevLength = arm_cfft_bitrev_gen(pBitRevTable, fftLen, 1u);
+  if (bitRevLength == 0u)
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  /* twiddle[2*i] = cos(2*pi*i/fftLen), twiddle[2*i+1] = sin(2*pi*i/fftLen) */
+  for (i = 0u; i < ((3u * fftLen) / 4u); i++)
+  {
+    arm_twiddle_sincos_f64(i, fftLen, &c, &s);
+    pTwiddle[2u * i] = arm_twiddle_to_q31(c);
+    pTwiddle[(2u * i) + 1u] = arm_twiddle_to_q31(s);
+  }
+
+  S->fftLen = fftLen;
+  S->pTwiddle = pTwiddle;
+  S->pBitRevTable = pBitRevTable;
+  S->bitRevLength = bitRevLength;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of ComplexFFT group
+ */
@@ -0,0 +1,111 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_rfft_fast_gen_init_f32.c
+*
+* Description:  Initialization of the floating-point fast RFFT with tables generated in RAM.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+extern void arm_twiddle_sincos_f64(
+  uint32_t k,
+  uint32_t n,
+  float64_t * pCos,
+  float64_t * pSin);
+
+/**
+ * @ingroup groupTransforms
+ */
+
+/**
+ * @addtogroup RealFFT
+ * @{
+ */
+
+/**
+ * @brief Initializes the floating-point fast RFFT with tables generated in RAM.
+ * @param[out] *S             points to an arm_rfft_fast_instance_f32 structure.
+ * @param[in]  fftLen         length of the real sequence, 32, 64, 128, ..., 4096.
+ * @param[out] *pTwiddle      points to the twiddle factor table of the inner
+ *                            fftLen/2 point CFFT to fill, of fftLen values.
+ * @param[out] *pTwiddleRFFT  points to the twiddle factor table of the real
+ *                            stage to fill, of fftLen values.
+ * @param[out] *pBitRevTable  points to the bit reversal index table of the inner
+ *                            CFFT to fill, see arm_cfft_bitrev_gen() for its length.
+ * @return     ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if <code>fftLen</code>
+ *             is not supported.
+ *
+ * \par
+ * arm_rfft_fast_init_f32() selects its tables at run time and so links those
+ * of every length.  This function generates the tables of one length in RAM
+ * instead, with arm_cfft_gen_init_f32() for the inner CFFT, and links none of
+ * the flash tables.  The buffers must stay allocated while the instance is used.
+ * \par
+ * The real stage uses twiddleRFFT[2*k] = sin(2*pi*k/fftLen) and
+ * twiddleRFFT[2*k+1] = cos(2*pi*k/fftLen), k = 0 ... fftLen/2-1, rounded to the
+ * nearest float32_t.
+ */
+
+arm_status arm_rfft_fast_gen_init_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pTwiddleRFFT,
+  uint16_t * pBitRevTable)
+{
+  float64_t c, s;                                /* Cosine and sine of the twiddle factor */
+  uint32_t k;                                    /* Loop counter */
+
+  /* The inner CFFT supports 16 to 4096 points */
+  if ((fftLen < 32u) || (fftLen > 4096u) ||
+      (arm_cfft_gen_init_f32(&(S->Sint), fftLen / 2u, pTwiddle, pBitRevTable) != ARM_MATH_SUCCESS))
+  {
+    return (ARM_MATH_ARGUMENT_ERROR);
+  }
+
+  for (k = 0u; k < (fftLen / 2u); k++)
+  {
+    arm_twiddle_sincos_f64(k, fftLen, &c, &s);
+    pTwiddleRFFT[2u * k] = (float32_t) s;
+    pTwiddleRFFT[(2u * k) + 1u] = (float32_t) c;
+  }
+
+  S->fftLenRFFT = fftLen;
+  S->pTwiddleRFFT = pTwiddleRFFT;
+
+  return (ARM_MATH_SUCCESS);
+}
+
+/**
+ * @} end of RealFFT group
+ */
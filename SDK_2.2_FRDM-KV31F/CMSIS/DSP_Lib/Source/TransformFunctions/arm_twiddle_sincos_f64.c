@@ -0,0 +1,98 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_twiddle_sincos_f64.c
+*
+* Description:  Cosine and sine of a twiddle factor angle, used by the table generators.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+#include "arm_math.h"
+
+/* pi to the precision of float64_t; PI of arm_math.h is float32_t */
+#define ARM_TWIDDLE_PI_F64    3.14159265358979323846
+
+/**
+ * @brief Cosine and sine of the twiddle factor angle 2*pi*k/n.
+ * @param[in]  k      index of the angle, 0 <= k < n.
+ * @param[in]  n      number of angles in a turn, a multiple of 8.
+ * @param[out] *pCos  cos(2*pi*k/n).
+ * @param[out] *pSin  sin(2*pi*k/n).
+ *
+ * \par
+ * The angle is reduced to the first octant and the result rebuilt by symmetry,
+ * so that the generated tables are exactly symmetric and hold exact zeros and
+ * ones at the multiples of pi/2.  Used by the twiddle factor generators of the
+ * CFFT and RFFT.
+ */
+
+void arm_twiddle_sincos_f64(
+  uint32_t k,
+  uint32_t n,
+  float64_t * pCos,
+  float64_t * pSin)
+{
+  uint32_t quarter = n / 4u;                     /* Angles in a quadrant */
+  uint32_t q = k / quarter;                      /* Quadrant of the angle */
+  uint32_t m = k - (q * quarter);                /* Index within the quadrant */
+  float64_t c, s;                                /* Cosine and sine within the quadrant */
+
+  if ((2u * m) <= quarter)
+  {
+    c = cos((2.0 * ARM_TWIDDLE_PI_F64 * (float64_t) m) / (float64_t) n);
+    s = sin((2.0 * ARM_TWIDDLE_PI_F64 * (float64_t) m) / (float64_t) n);
+  }
+  else
+  {
+    c = sin((2.0 * ARM_TWIDDLE_PI_F64 * (float64_t) (quarter - m)) / (float64_t) n);
+    s = cos((2.0 * ARM_TWIDDLE_PI_F64 * (float64_t) (quarter - m)) / (float64_t) n);
+  }
+
+  switch (q)
+  {
+  case 0u:
+    *pCos = c;
+    *pSin = s;
+    break;
+  case 1u:
+    *pCos = -s;
+    *pSin = c;
+    break;
+  case 2u:
+    *pCos = -c;
+    *pSin = -s;
+    break;
+  default:
+    *pCos = s;
+    *pSin = -c;
+    break;
+  }
+}
@@ -378,7 +378,8 @@ extern "C"
     ARM_MATH_SIZE_MISMATCH = -3,         /**< Size of matrices is not compatible with the operation. */
     ARM_MATH_NANINF = -4,                /**< Not-a-number (NaN) or infinity is generated */
     ARM_MATH_SINGULAR = -5,              /**< Generated by matrix inversion if the input matrix is singular and cannot be inverted. */
-    ARM_MATH_TEST_FAILURE = -6           /**< Test Failed  */
+    ARM_MATH_TEST_FAILURE = -6,          /**< Test Failed  */
+    ARM_MATH_DECOMPOSITION_FAILURE = -7  /**< Generated by the Cholesky and LDLT decompositions if the input matrix is not positive definite. */
   } arm_status;
 
   /**
@@ -1214,6 +1215,39 @@ extern "C"
   uint32_t blockSize);
 
 
+  /**
+   * @brief Filters one sample with the floating-point FIR filter.
+   * @param[in] S   points to an instance of the floating-point FIR filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  float32_t arm_fir_step_f32(
+  const arm_fir_instance_f32 * S,
+  float32_t in);
+
+
+  /**
+   * @brief Filters one sample with the Q31 FIR filter.
+   * @param[in] S   points to an instance of the Q31 FIR filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  q31_t arm_fir_step_q31(
+  const arm_fir_instance_q31 * S,
+  q31_t in);
+
+
+  /**
+   * @brief Filters one sample with the Q15 FIR filter.
+   * @param[in] S   points to an instance of the Q15 FIR filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  q15_t arm_fir_step_q15(
+  const arm_fir_instance_q15 * S,
+  q15_t in);
+
+
   /**
    * @brief Instance structure for the Q15 Biquad cascade filter.
    */
@@ -1363,6 +1397,39 @@ extern "C"
   float32_t * pState);
 
 
+  /**
+   * @brief Filters one sample with the floating-point Biquad cascade filter.
+   * @param[in] S   points to an instance of the floating-point Biquad cascade filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  float32_t arm_biquad_step_f32(
+  const arm_biquad_casd_df1_inst_f32 * S,
+  float32_t in);
+
+
+  /**
+   * @brief Filters one sample with the Q31 Biquad cascade filter.
+   * @param[in] S   points to an instance of the Q31 Biquad cascade filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  q31_t arm_biquad_step_q31(
+  const arm_biquad_casd_df1_inst_q31 * S,
+  q31_t in);
+
+
+  /**
+   * @brief Filters one sample with the Q15 Biquad cascade filter.
+   * @param[in] S   points to an instance of the Q15 Biquad cascade filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  q15_t arm_biquad_step_q15(
+  const arm_biquad_casd_df1_inst_q15 * S,
+  q15_t in);
+
+
   /**
    * @brief Instance structure for the floating-point matrix structure.
    */
@@ -2152,6 +2219,60 @@ void arm_cfft_q31(
   uint8_t ifftFlag,
   uint8_t bitReverseFlag);
 
+  /**
+   * @brief Generates the bit reversal index table of a CFFT.
+   * @param[out] pBitRevTable  points to the table to fill.
+   * @param[in]  fftLen        length of the FFT.
+   * @param[in]  fixedFlag     0 for arm_cfft_f32(), 1 for arm_cfft_q31() and arm_cfft_q15().
+   * @return number of values written, or 0 if fftLen is not supported.
+   */
+  uint16_t arm_cfft_bitrev_gen(
+  uint16_t * pBitRevTable,
+  uint16_t fftLen,
+  uint8_t fixedFlag);
+
+  /**
+   * @brief Initializes the floating-point CFFT with tables generated in RAM.
+   * @param[out] S             points to an instance of the floating-point CFFT structure.
+   * @param[in]  fftLen        length of the FFT.
+   * @param[out] pTwiddle      points to the twiddle factor table to fill, of 2*fftLen values.
+   * @param[out] pBitRevTable  points to the bit reversal index table to fill.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_cfft_gen_init_f32(
+  arm_cfft_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  uint16_t * pBitRevTable);
+
+  /**
+   * @brief Initializes the Q31 CFFT with tables generated in RAM.
+   * @param[out] S             points to an instance of the Q31 CFFT structure.
+   * @param[in]  fftLen        length of the FFT.
+   * @param[out] pTwiddle      points to the twiddle factor table to fill, of 3*fftLen/2 values.
+   * @param[out] pBitRevTable  points to the bit reversal index table to fill.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_cfft_gen_init_q31(
+  arm_cfft_instance_q31 * S,
+  uint16_t fftLen,
+  q31_t * pTwiddle,
+  uint16_t * pBitRevTable);
+
+  /**
+   * @brief Initializes the Q15 CFFT with tables generated in RAM.
+   * @param[out] S             points to an instance of the Q15 CFFT structure.
+   * @param[in]  fftLen        length of the FFT.
+   * @param[out] pTwiddle      points to the twiddle factor table to fill, of 3*fftLen/2 values.
+   * @param[out] pBitRevTable  points to the bit reversal index table to fill.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+  arm_status arm_cfft_gen_init_q15(
+  arm_cfft_instance_q15 * S,
+  uint16_t fftLen,
+  q15_t * pTwiddle,
+  uint16_t * pBitRevTable);
+
   /**
    * @brief Instance structure for the Q15 RFFT/RIFFT function.
    */
@@ -2248,6 +2369,22 @@ void arm_rfft_fast_f32(
   float32_t * p, float32_t * pOut,
   uint8_t ifftFlag);
 
+  /**
+   * @brief Initializes the floating-point fast RFFT with tables generated in RAM.
+   * @param[out] S             points to an arm_rfft_fast_instance_f32 structure.
+   * @param[in]  fftLen        length of the real sequence.
+   * @param[out] pTwiddle      points to the twiddle factor table of the inner CFFT to fill, of fftLen values.
+   * @param[out] pTwiddleRFFT  points to the twiddle factor table of the real stage to fill, of fftLen values.
+   * @param[out] pBitRevTable  points to the bit reversal index table of the inner CFFT to fill.
+   * @return ARM_MATH_SUCCESS, or ARM_MATH_ARGUMENT_ERROR if fftLen is not supported.
+   */
+arm_status arm_rfft_fast_gen_init_f32(
+  arm_rfft_fast_instance_f32 * S,
+  uint16_t fftLen,
+  float32_t * pTwiddle,
+  float32_t * pTwiddleRFFT,
+  uint16_t * pBitRevTable);
+
   /**
    * @brief Instance structure for the floating-point DCT4/IDCT4 function.
    */
@@ -3562,6 +3699,107 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Instance structure for the Q31 FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< position of the next output in the upsampled signal, from the next input sample. */
+    q31_t *pCoeffs;                 /**< points to the coefficient array. The array is of length L*phaseLength. */
+    q31_t *pState;                  /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point FIR rational resampler.
+   */
+  typedef struct
+  {
+    uint8_t L;                      /**< upsample factor. */
+    uint8_t M;                      /**< downsample factor. */
+    uint16_t phaseLength;           /**< length of each polyphase filter component. */
+    uint16_t phase;                 /**< position of the next output in the upsampled signal, from the next input sample. */
+    float32_t *pCoeffs;             /**< points to the coefficient array. The array is of length L*phaseLength. */
+    float32_t *pState;              /**< points to the state variable array. The array is of length blockSize+phaseLength-1. */
+  } arm_fir_resample_instance_f32;
+
+
+  /**
+   * @brief Processing function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of length (blockSize*L+M-1)/M.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_q31(
+  arm_fir_resample_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 FIR rational resampler.
+   * @param[in,out] S          points to an instance of the Q31 FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * a factor is zero or the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_q31(
+  arm_fir_resample_instance_q31 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data, of length (blockSize*L+M-1)/M.
+   * @param[in]     blockSize  number of input samples to process per call.
+   * @return        number of output samples written to pDst.
+   */
+  uint32_t arm_fir_resample_f32(
+  arm_fir_resample_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point FIR rational resampler.
+   * @param[in,out] S          points to an instance of the floating-point FIR resampler structure.
+   * @param[in]     L          upsample factor.
+   * @param[in]     M          downsample factor.
+   * @param[in]     numTaps    number of filter coefficients in the filter.
+   * @param[in]     pCoeffs    points to the filter coefficient buffer.
+   * @param[in]     pState     points to the state buffer.
+   * @param[in]     blockSize  largest number of input samples processed per call.
+   * @return        The function returns ARM_MATH_SUCCESS if initialization is successful or ARM_MATH_LENGTH_ERROR if
+   * a factor is zero or the filter length <code>numTaps</code> is not a multiple of the interpolation factor <code>L</code>.
+   */
+  arm_status arm_fir_resample_init_f32(
+  arm_fir_resample_instance_f32 * S,
+  uint8_t L,
+  uint8_t M,
+  uint16_t numTaps,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the high precision Q31 Biquad cascade filter.
    */
@@ -3717,6 +3955,220 @@ void arm_rfft_fast_f32(
   float64_t * pState);
 
 
+  /**
+   * @brief Instance structure for the floating-point multi-channel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients, shared by all channels.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multi_df1_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 multi-channel Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint8_t postShift;         /**< additional shift, in bits, applied to each output sample. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    q31_t *pState;             /**< points to the array of state coefficients.  The array is of length 4*numStages*numChannels. */
+    q31_t *pCoeffs;            /**< points to the array of coefficients, shared by all channels.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multi_df1_instance_q31;
+
+  /**
+   * @brief Instance structure for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   */
+  typedef struct
+  {
+    uint8_t numStages;         /**< number of 2nd order stages in the filter.  Overall order is 2*numStages. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the array of state coefficients.  The array is of length 2*numStages*numChannels. */
+    float32_t *pCoeffs;        /**< points to the array of coefficients, shared by all channels.  The array is of length 5*numStages. */
+  } arm_biquad_cascade_multi_df2T_instance_f32;
+
+
+  /**
+   * @brief Processing function for the floating-point multi-channel Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_multi_df1_f32(
+  const arm_biquad_cascade_multi_df1_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_multi_df1_init_f32(
+  arm_biquad_cascade_multi_df1_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief Processing function for the Q31 multi-channel Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_multi_df1_q31(
+  const arm_biquad_cascade_multi_df1_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 multi-channel Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     postShift    Shift to be applied to the output. Varies according to the coefficients format
+   */
+  void arm_biquad_cascade_multi_df1_init_q31(
+  arm_biquad_cascade_multi_df1_instance_q31 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  int8_t postShift);
+
+
+  /**
+   * @brief Processing function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_biquad_cascade_multi_df2T_f32(
+  const arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel transposed direct form II Biquad cascade filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numStages    number of 2nd order stages in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   */
+  void arm_biquad_cascade_multi_df2T_init_f32(
+  arm_biquad_cascade_multi_df2T_instance_f32 * S,
+  uint8_t numStages,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState);
+
+
+  /**
+   * @brief Instance structure for the floating-point multi-channel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    float32_t *pState;         /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    float32_t *pCoeffs;        /**< points to the coefficient array, shared by all channels. The array is of length numTaps. */
+  } arm_fir_multi_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 multi-channel FIR filter.
+   */
+  typedef struct
+  {
+    uint16_t numTaps;          /**< number of filter coefficients in the filter. */
+    uint16_t numChannels;      /**< number of interleaved channels. */
+    q31_t *pState;             /**< points to the state variable array. The array is of length (numTaps+blockSize-1)*numChannels. */
+    q31_t *pCoeffs;            /**< points to the coefficient array, shared by all channels. The array is of length numTaps. */
+  } arm_fir_multi_instance_q31;
+
+
+  /**
+   * @brief Processing function for the floating-point multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_multi_f32(
+  const arm_fir_multi_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the floating-point multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   */
+  void arm_fir_multi_init_f32(
+  arm_fir_multi_instance_f32 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  float32_t * pCoeffs,
+  float32_t * pState,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief Processing function for the Q31 multi-channel FIR filter.
+   * @param[in]  S          points to an instance of the filter data structure.
+   * @param[in]  pSrc       points to the block of interleaved input data.
+   * @param[out] pDst       points to the block of interleaved output data.
+   * @param[in]  blockSize  number of samples to process per channel.
+   */
+  void arm_fir_multi_q31(
+  const arm_fir_multi_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Initialization function for the Q31 multi-channel FIR filter.
+   * @param[in,out] S            points to an instance of the filter data structure.
+   * @param[in]     numTaps      Number of filter coefficients in the filter.
+   * @param[in]     numChannels  number of interleaved channels.
+   * @param[in]     pCoeffs      points to the filter coefficients.
+   * @param[in]     pState       points to the state buffer.
+   * @param[in]     blockSize    number of samples per channel that are processed at a time.
+   */
+  void arm_fir_multi_init_q31(
+  arm_fir_multi_instance_q31 * S,
+  uint16_t numTaps,
+  uint16_t numChannels,
+  q31_t * pCoeffs,
+  q31_t * pState,
+  uint32_t blockSize);
+
+
   /**
    * @brief Instance structure for the Q15 FIR lattice filter.
    */
@@ -3962,6 +4414,39 @@ void arm_rfft_fast_f32(
   uint32_t blockSize);
 
 
+  /**
+   * @brief Filters one sample with the floating-point IIR lattice filter.
+   * @param[in] S   points to an instance of the floating-point IIR lattice filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  float32_t arm_iir_lattice_step_f32(
+  const arm_iir_lattice_instance_f32 * S,
+  float32_t in);
+
+
+  /**
+   * @brief Filters one sample with the Q31 IIR lattice filter.
+   * @param[in] S   points to an instance of the Q31 IIR lattice filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  q31_t arm_iir_lattice_step_q31(
+  const arm_iir_lattice_instance_q31 * S,
+  q31_t in);
+
+
+  /**
+   * @brief Filters one sample with the Q15 IIR lattice filter.
+   * @param[in] S   points to an instance of the Q15 IIR lattice filter structure.
+   * @param[in] in  input sample.
+   * @return output sample.
+   */
+  q15_t arm_iir_lattice_step_q15(
+  const arm_iir_lattice_instance_q15 * S,
+  q15_t in);
+
+
   /**
    * @brief Instance structure for the floating-point LMS filter.
    */
@@ -4944,6 +5429,74 @@ void arm_rfft_fast_f32(
   arm_matrix_instance_f64 * dst);
 
 
+  /**
+   * @brief Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure, the lower triangular factor.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Floating-point Cholesky decomposition of a symmetric positive definite matrix.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] dst   points to the instance of the output floating-point matrix structure, the lower triangular factor.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive definite, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_cholesky_f64(
+  const arm_matrix_instance_f64 * src,
+  arm_matrix_instance_f64 * dst);
+
+
+  /**
+   * @brief Floating-point LDL^T decomposition with diagonal pivoting of a symmetric positive semi-definite matrix.
+   * @param[in]  src   points to the instance of the input floating-point matrix structure.
+   * @param[out] l     points to the instance of the unit lower triangular output matrix structure.
+   * @param[out] d     points to the instance of the diagonal output matrix structure.
+   * @param[out] pp    points to the permutation vector, numRows elements.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If the input matrix is not positive semi-definite, the function returns ARM_MATH_DECOMPOSITION_FAILURE.
+   */
+  arm_status arm_mat_ldlt_f32(
+  const arm_matrix_instance_f32 * src,
+  arm_matrix_instance_f32 * l,
+  arm_matrix_instance_f32 * d,
+  uint16_t * pp);
+
+
+  /**
+   * @brief Solves LT * dst = a by forward substitution.
+   * @param[in]  lt    points to the instance of the lower triangular matrix structure.
+   * @param[in]  a     points to the instance of the right hand side matrix structure.
+   * @param[out] dst   points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of lt is zero, the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_lower_triangular_f32(
+  const arm_matrix_instance_f32 * lt,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+
+  /**
+   * @brief Solves UT * dst = a by back substitution.
+   * @param[in]  ut    points to the instance of the upper triangular matrix structure.
+   * @param[in]  a     points to the instance of the right hand side matrix structure.
+   * @param[out] dst   points to the instance of the solution matrix structure.
+   * @return The function returns ARM_MATH_SIZE_MISMATCH, if the dimensions do not match.
+   * If a diagonal element of ut is zero, the function returns ARM_MATH_SINGULAR.
+   */
+  arm_status arm_mat_solve_upper_triangular_f32(
+  const arm_matrix_instance_f32 * ut,
+  const arm_matrix_instance_f32 * a,
+  arm_matrix_instance_f32 * dst);
+
+
 
   /**
    * @ingroup groupController
@@ -5859,12 +6412,13 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0u;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    int32_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5877,7 +6431,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (int32_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -5958,13 +6512,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q15_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -5977,7 +6532,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q15_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6058,13 +6613,14 @@ void arm_rfft_fast_f32(
   uint32_t blockSize)
   {
     uint32_t i = 0;
-    int32_t rOffset, dst_end;
+    int32_t rOffset;
+    q7_t *dst_end;
 
     /* Copy the value of Index pointer that points
      * to the current location from where the input samples to be read */
     rOffset = *readOffset;
 
-    dst_end = (int32_t) (dst_base + dst_length);
+    dst_end = dst_base + dst_length;
 
     /* Loop over the blockSize */
     i = blockSize;
@@ -6077,7 +6633,7 @@ void arm_rfft_fast_f32(
       /* Update the input pointer */
       dst += dstInc;
 
-      if(dst == (q7_t *) dst_end)
+      if(dst == dst_end)
       {
         dst = dst_base;
       }
@@ -6540,6 +7096,406 @@ void arm_rfft_fast_f32(
   float32_t * pResult,
   uint32_t * pIndex);
 
+  /**
+   * @brief Instance structure for the floating-point sliding-window mean and variance.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    float32_t *pWindow;      /**< points to the window buffer of length windowSize. */
+    float32_t mean;            /**< mean of the window. */
+    float32_t m2;              /**< sum of the squared deviations from the mean. */
+    float32_t shadowMean;      /**< mean of the samples written since pWindow last wrapped. */
+    float32_t shadowM2;        /**< sum of the squared deviations of those samples. */
+  } arm_sliding_mean_var_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding-window mean and variance.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    q31_t *pWindow;          /**< points to the window buffer of length windowSize. */
+    q63_t sum;                 /**< sum of the samples in the window. */
+    q63_t sumShift;            /**< sum of the samples shifted right by 8 bits, as in arm_var_q31(). */
+    q63_t sumOfSquares;        /**< sum of the squares of the shifted samples. */
+  } arm_sliding_mean_var_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding-window mean and variance.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    q15_t *pWindow;          /**< points to the window buffer of length windowSize. */
+    q31_t sum;                 /**< sum of the samples in the window. */
+    q63_t sumOfSquares;        /**< sum of the squares of the samples. */
+  } arm_sliding_mean_var_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point sliding-window RMS.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    float32_t *pWindow;      /**< points to the window buffer of length windowSize. */
+    float32_t sumOfSquares;        /**< sum of the squares of the samples in the window. */
+    float32_t shadowSumOfSquares;  /**< sum of the squares of the samples written since pWindow last wrapped. */
+  } arm_sliding_rms_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding-window RMS.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    q31_t *pWindow;          /**< points to the window buffer of length windowSize. */
+    q63_t sumOfSquares;        /**< sum of the squares of the samples in the window. */
+  } arm_sliding_rms_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding-window RMS.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    q15_t *pWindow;          /**< points to the window buffer of length windowSize. */
+    q63_t sumOfSquares;        /**< sum of the squares of the samples in the window. */
+  } arm_sliding_rms_instance_q15;
+
+  /**
+   * @brief Instance structure for the floating-point sliding-window minimum or maximum.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    float32_t *pWindow;      /**< points to the window buffer of length windowSize. */
+    uint16_t head;             /**< position in pDeque of the oldest candidate. */
+    uint16_t size;             /**< number of candidates in pDeque. */
+    uint16_t *pDeque;          /**< points to the candidate slots, a buffer of length windowSize. */
+  } arm_sliding_min_max_instance_f32;
+
+  /**
+   * @brief Instance structure for the Q31 sliding-window minimum or maximum.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    q31_t *pWindow;          /**< points to the window buffer of length windowSize. */
+    uint16_t head;             /**< position in pDeque of the oldest candidate. */
+    uint16_t size;             /**< number of candidates in pDeque. */
+    uint16_t *pDeque;          /**< points to the candidate slots, a buffer of length windowSize. */
+  } arm_sliding_min_max_instance_q31;
+
+  /**
+   * @brief Instance structure for the Q15 sliding-window minimum or maximum.
+   */
+  typedef struct
+  {
+    uint16_t windowSize;       /**< number of samples in the window. */
+    uint16_t count;            /**< number of samples received, up to windowSize. */
+    uint16_t index;            /**< slot of pWindow that takes the next sample. */
+    q15_t *pWindow;          /**< points to the window buffer of length windowSize. */
+    uint16_t head;             /**< position in pDeque of the oldest candidate. */
+    uint16_t size;             /**< number of candidates in pDeque. */
+    uint16_t *pDeque;          /**< points to the candidate slots, a buffer of length windowSize. */
+  } arm_sliding_min_max_instance_q15;
+
+  /**
+   * @brief  Initialization function for the floating-point sliding-window mean and variance.
+   * @param[out] S           points to an instance of the floating-point sliding-window mean and variance structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   */
+  void arm_sliding_mean_var_init_f32(
+  arm_sliding_mean_var_instance_f32 * S,
+  uint16_t windowSize,
+  float32_t * pWindow);
+
+
+  /**
+   * @brief  Sliding-window mean and variance of floating-point data.
+   * @param[in,out] S          points to an instance of the floating-point sliding-window mean and variance structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pMean      points to the block of means, one per input sample.
+   * @param[out]    pVar       points to the block of variances, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_mean_var_f32(
+  arm_sliding_mean_var_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pMean,
+  float32_t * pVar,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding-window mean and variance.
+   * @param[out] S           points to an instance of the Q31 sliding-window mean and variance structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   */
+  void arm_sliding_mean_var_init_q31(
+  arm_sliding_mean_var_instance_q31 * S,
+  uint16_t windowSize,
+  q31_t * pWindow);
+
+
+  /**
+   * @brief  Sliding-window mean and variance of Q31 data.
+   * @param[in,out] S          points to an instance of the Q31 sliding-window mean and variance structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pMean      points to the block of means, one per input sample.
+   * @param[out]    pVar       points to the block of variances, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_mean_var_q31(
+  arm_sliding_mean_var_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pMean,
+  q31_t * pVar,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding-window mean and variance.
+   * @param[out] S           points to an instance of the Q15 sliding-window mean and variance structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   */
+  void arm_sliding_mean_var_init_q15(
+  arm_sliding_mean_var_instance_q15 * S,
+  uint16_t windowSize,
+  q15_t * pWindow);
+
+
+  /**
+   * @brief  Sliding-window mean and variance of Q15 data.
+   * @param[in,out] S          points to an instance of the Q15 sliding-window mean and variance structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pMean      points to the block of means, one per input sample.
+   * @param[out]    pVar       points to the block of variances, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_mean_var_q15(
+  arm_sliding_mean_var_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pMean,
+  q15_t * pVar,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sliding-window RMS.
+   * @param[out] S           points to an instance of the floating-point sliding-window RMS structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   */
+  void arm_sliding_rms_init_f32(
+  arm_sliding_rms_instance_f32 * S,
+  uint16_t windowSize,
+  float32_t * pWindow);
+
+
+  /**
+   * @brief  Sliding-window RMS of floating-point data.
+   * @param[in,out] S          points to an instance of the floating-point sliding-window RMS structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of RMS values, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_rms_f32(
+  arm_sliding_rms_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding-window RMS.
+   * @param[out] S           points to an instance of the Q31 sliding-window RMS structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   */
+  void arm_sliding_rms_init_q31(
+  arm_sliding_rms_instance_q31 * S,
+  uint16_t windowSize,
+  q31_t * pWindow);
+
+
+  /**
+   * @brief  Sliding-window RMS of Q31 data.
+   * @param[in,out] S          points to an instance of the Q31 sliding-window RMS structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of RMS values, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_rms_q31(
+  arm_sliding_rms_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding-window RMS.
+   * @param[out] S           points to an instance of the Q15 sliding-window RMS structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   */
+  void arm_sliding_rms_init_q15(
+  arm_sliding_rms_instance_q15 * S,
+  uint16_t windowSize,
+  q15_t * pWindow);
+
+
+  /**
+   * @brief  Sliding-window RMS of Q15 data.
+   * @param[in,out] S          points to an instance of the Q15 sliding-window RMS structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of RMS values, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_rms_q15(
+  arm_sliding_rms_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the floating-point sliding-window minimum or maximum.
+   * @param[out] S           points to an instance of the floating-point sliding-window minimum or maximum structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   * @param[in]  pDeque      points to the candidate buffer of length windowSize.
+   */
+  void arm_sliding_min_max_init_f32(
+  arm_sliding_min_max_instance_f32 * S,
+  uint16_t windowSize,
+  float32_t * pWindow,
+  uint16_t * pDeque);
+
+
+  /**
+   * @brief  Sliding-window minimum of floating-point data.
+   * @param[in,out] S          points to an instance of the floating-point sliding-window minimum or maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of minima, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_min_f32(
+  arm_sliding_min_max_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sliding-window maximum of floating-point data.
+   * @param[in,out] S          points to an instance of the floating-point sliding-window minimum or maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of maxima, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_max_f32(
+  arm_sliding_min_max_instance_f32 * S,
+  float32_t * pSrc,
+  float32_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q31 sliding-window minimum or maximum.
+   * @param[out] S           points to an instance of the Q31 sliding-window minimum or maximum structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   * @param[in]  pDeque      points to the candidate buffer of length windowSize.
+   */
+  void arm_sliding_min_max_init_q31(
+  arm_sliding_min_max_instance_q31 * S,
+  uint16_t windowSize,
+  q31_t * pWindow,
+  uint16_t * pDeque);
+
+
+  /**
+   * @brief  Sliding-window minimum of Q31 data.
+   * @param[in,out] S          points to an instance of the Q31 sliding-window minimum or maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of minima, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_min_q31(
+  arm_sliding_min_max_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sliding-window maximum of Q31 data.
+   * @param[in,out] S          points to an instance of the Q31 sliding-window minimum or maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of maxima, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_max_q31(
+  arm_sliding_min_max_instance_q31 * S,
+  q31_t * pSrc,
+  q31_t * pDst,
+  uint32_t blockSize);
+
+  /**
+   * @brief  Initialization function for the Q15 sliding-window minimum or maximum.
+   * @param[out] S           points to an instance of the Q15 sliding-window minimum or maximum structure.
+   * @param[in]  windowSize  number of samples in the window.
+   * @param[in]  pWindow     points to the window buffer of length windowSize.
+   * @param[in]  pDeque      points to the candidate buffer of length windowSize.
+   */
+  void arm_sliding_min_max_init_q15(
+  arm_sliding_min_max_instance_q15 * S,
+  uint16_t windowSize,
+  q15_t * pWindow,
+  uint16_t * pDeque);
+
+
+  /**
+   * @brief  Sliding-window minimum of Q15 data.
+   * @param[in,out] S          points to an instance of the Q15 sliding-window minimum or maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of minima, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_min_q15(
+  arm_sliding_min_max_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
+
+  /**
+   * @brief  Sliding-window maximum of Q15 data.
+   * @param[in,out] S          points to an instance of the Q15 sliding-window minimum or maximum structure.
+   * @param[in]     pSrc       points to the block of input samples.
+   * @param[out]    pDst       points to the block of maxima, one per input sample.
+   * @param[in]     blockSize  number of samples to process.
+   */
+  void arm_sliding_max_q15(
+  arm_sliding_min_max_instance_q15 * S,
+  q15_t * pSrc,
+  q15_t * pDst,
+  uint32_t blockSize);
+
 
   /**
    * @brief  Q15 complex-by-complex multiplication
@@ -0,0 +1,715 @@
+/* ----------------------------------------------------------------------
+* Copyright 2017 NXP. All rights reserved.
+*
+* Project:      CMSIS DSP Library
+* Title:        arm_math.hpp
+*
+* Description:  C++ templates of the CMSIS DSP filters and matrices for compile-time sizes.
+*
+* Target Processor: Cortex-M4/Cortex-M3/Cortex-M0
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions
+* are met:
+*   - Redistributions of source code must retain the above copyright
+*     notice, this list of conditions and the following disclaimer.
+*   - Redistributions in binary form must reproduce the above copyright
+*     notice, this list of conditions and the following disclaimer in
+*     the documentation and/or other materials provided with the
+*     distribution.
+*   - Neither the name of NXP nor the names of its contributors
+*     may be used to endorse or promote products derived from this
+*     software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+* BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+* CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+* LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+* ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+* -------------------------------------------------------------------- */
+
+
+/*
+* Fixed-size filters and matrices for C++ applications.  The instance
+* structures of the C library take their tap, stage and matrix sizes at run
+* time, so the inner loops are counted loops even for the short filters of a
+* control loop.  The templates below take the sizes as template arguments
+* and expand the inner loops completely for sizes up to the limits below;
+* larger sizes call the C functions of arm_math.h.
+*
+*   arm_dsp::Fir<N, T>          N tap FIR filter, T float32_t or q31_t
+*   arm_dsp::Biquad<Stages, T>  direct form I biquad cascade, T float32_t or q31_t
+*   arm_dsp::Mat<R, C>          R x C float32_t matrix
+*
+* The coefficient layouts are those of arm_fir_init_f32() and
+* arm_biquad_cascade_df1_init_f32(), and each output is computed with the
+* same operations in the same order as the Cortex-M0 code of the C library.
+* Requires C++11.
+*/
+
+#ifndef _ARM_MATH_HPP
+#define _ARM_MATH_HPP
+
+#include "arm_math.h"
+
+/** FIR filters up to this many taps are expanded */
+#ifndef ARM_MATH_HPP_FIR_UNROLL
+#define ARM_MATH_HPP_FIR_UNROLL       32u
+#endif
+
+/** Biquad cascades up to this many stages are expanded */
+#ifndef ARM_MATH_HPP_BIQUAD_UNROLL
+#define ARM_MATH_HPP_BIQUAD_UNROLL    8u
+#endif
+
+/** Matrix operations up to this many multiply-accumulates or elements are expanded */
+#ifndef ARM_MATH_HPP_MAT_UNROLL
+#define ARM_MATH_HPP_MAT_UNROLL       512u
+#endif
+
+/** Frames per call of the C FIR functions used for larger filters */
+#ifndef ARM_MATH_HPP_FIR_BLOCK
+#define ARM_MATH_HPP_FIR_BLOCK        32u
+#endif
+
+/* The expanded loops rely on every step being inlined into its caller */
+#if defined(__GNUC__) || defined(__clang__)
+#define ARM_MATH_HPP_INLINE           inline __attribute__((always_inline))
+#define ARM_MATH_HPP_LAMBDA_INLINE    __attribute__((always_inline))
+#else
+#define ARM_MATH_HPP_INLINE           inline
+#define ARM_MATH_HPP_LAMBDA_INLINE
+#endif
+
+namespace arm_dsp
+{
+  namespace detail
+  {
+    /**
+     * @brief Calls f(I), f(I + 1), ... f(N - 1) with constant arguments.
+     */
+    template<uint32_t I, uint32_t N>
+    struct Unroll
+    {
+      template<typename F>
+      static ARM_MATH_HPP_INLINE void run(F &f)
+      {
+        f(I);
+        Unroll<I + 1u, N>::run(f);
+      }
+    };
+
+    template<uint32_t N>
+    struct Unroll<N, N>
+    {
+      template<typename F>
+      static ARM_MATH_HPP_INLINE void run(F &)
+      {
+      }
+    };
+
+    /**
+     * @brief Accumulator and C functions of each sample type.
+     */
+    template<typename T>
+    struct Traits;
+
+    template<>
+    struct Traits<float32_t>
+    {
+      typedef float32_t acc_t;
+      typedef arm_fir_instance_f32 fir_t;
+      typedef arm_biquad_casd_df1_inst_f32 biquad_t;
+
+      static ARM_MATH_HPP_INLINE acc_t mul(float32_t a, float32_t b) { return (a * b); }
+      static ARM_MATH_HPP_INLINE float32_t out(acc_t acc, uint32_t) { return (acc); }
+
+      static void firInit(fir_t *S, uint16_t numTaps, float32_t *pCoeffs, float32_t *pState, uint32_t blockSize)
+      {
+        arm_fir_init_f32(S, numTaps, pCoeffs, pState, blockSize);
+      }
+      static void fir(const fir_t *S, float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+      {
+        arm_fir_f32(S, pSrc, pDst, blockSize);
+      }
+      static void biquadInit(biquad_t *S, uint8_t numStages, float32_t *pCoeffs, float32_t *pState, int8_t)
+      {
+        arm_biquad_cascade_df1_init_f32(S, numStages, pCoeffs, pState);
+      }
+      static void biquad(const biquad_t *S, float32_t *pSrc, float32_t *pDst, uint32_t blockSize)
+      {
+        arm_biquad_cascade_df1_f32(S, pSrc, pDst, blockSize);
+      }
+    };
+
+    template<>
+    struct Traits<q31_t>
+    {
+      typedef q63_t acc_t;
+      typedef arm_fir_instance_q31 fir_t;
+      typedef arm_biquad_casd_df1_inst_q31 biquad_t;
+
+      static ARM_MATH_HPP_INLINE acc_t mul(q31_t a, q31_t b) { return ((q63_t) a * b); }
+      static ARM_MATH_HPP_INLINE q31_t out(acc_t acc, uint32_t shift) { return ((q31_t) (acc >> shift)); }
+
+      static void firInit(fir_t *S, uint16_t numTaps, q31_t *pCoeffs, q31_t *pState, uint32_t blockSize)
+      {
+        arm_fir_init_q31(S, numTaps, pCoeffs, pState, blockSize);
+      }
+      static void fir(const fir_t *S, q31_t *pSrc, q31_t *pDst, uint32_t blockSize)
+      {
+        arm_fir_q31(S, pSrc, pDst, blockSize);
+      }
+      static void biquadInit(biquad_t *S, uint8_t numStages, q31_t *pCoeffs, q31_t *pState, int8_t postShift)
+      {
+        arm_biquad_cascade_df1_init_q31(S, numStages, pCoeffs, pState, postShift);
+      }
+      static void biquad(const biquad_t *S, q31_t *pSrc, q31_t *pDst, uint32_t blockSize)
+      {
+        arm_biquad_cascade_df1_q31(S, pSrc, pDst, blockSize);
+      }
+    };
+  }
+
+  /**
+   * @brief N tap FIR filter.
+   *
+   * The coefficients are time reversed, as for arm_fir_init_f32(), and are
+   * copied into the filter.  The q31_t filter scales its output as
+   * arm_fir_q31() does.  Up to ARM_MATH_HPP_FIR_UNROLL taps the delay line
+   * holds the last N - 1 inputs followed by room for ARM_MATH_HPP_FIR_BLOCK
+   * new ones, so that each output is an expanded dot product over contiguous
+   * samples and the delay line is only moved once every
+   * ARM_MATH_HPP_FIR_BLOCK inputs.  process() computes four outputs per pass
+   * over the coefficients.
+   */
+  template<uint32_t N, typename T = float32_t, bool Unrolled = (N <= ARM_MATH_HPP_FIR_UNROLL)>
+  class Fir
+  {
+  public:
+    typedef detail::Traits<T> traits;
+    typedef typename traits::acc_t acc_t;
+
+    explicit Fir(const T *pCoeffs)
+    {
+      for (uint32_t k = 0u; k < N; k++)
+      {
+        m_coeffs[k] = pCoeffs[k];
+      }
+      reset();
+    }
+
+    /** @brief Clears the delay line. */
+    void reset()
+    {
+      memset(m_state, 0, sizeof(m_state));
+      m_fill = 0u;
+    }
+
+    /** @brief Filters one sample. */
+    ARM_MATH_HPP_INLINE T step(T x)
+    {
+      T y;
+
+      m_state[(N - 1u) + m_fill] = x;
+      y = dot(&m_state[m_fill]);
+      m_fill++;
+      if (m_fill == ARM_MATH_HPP_FIR_BLOCK)
+      {
+        shift();
+      }
+
+      return (y);
+    }
+
+    /** @brief Filters blockSize samples; pSrc and pDst may be the same buffer. */
+    void process(const T *pSrc, T *pDst, uint32_t blockSize)
+    {
+      const T *px;
+      uint32_t n, i;
+
+      while (blockSize > 0u)
+      {
+        /* Append as many inputs as the delay line has room for */
+        n = ARM_MATH_HPP_FIR_BLOCK - m_fill;
+        n = (blockSize < n) ? blockSize : n;
+        for (i = 0u; i < n; i++)
+        {
+          m_state[(N - 1u) + m_fill + i] = pSrc[i];
+        }
+
+        px = &m_state[m_fill];
+        for (i = 0u; (i + 4u) <= n; i += 4u)
+        {
+          dot4(&px[i], &pDst[i]);
+        }
+        for (; i < n; i++)
+        {
+          pDst[i] = dot(&px[i]);
+        }
+
+        m_fill += n;
+        if (m_fill == ARM_MATH_HPP_FIR_BLOCK)
+        {
+          shift();
+        }
+        pSrc += n;
+        pDst += n;
+        blockSize -= n;
+      }
+    }
+
+  private:
+    /* y[n] from px[0] .. px[N - 1], which hold x[n-N+1] .. x[n] */
+    ARM_MATH_HPP_INLINE T dot(const T *px) const
+    {
+      acc_t acc = 0;
+
+      auto mac = [&](uint32_t k) ARM_MATH_HPP_LAMBDA_INLINE { acc += traits::mul(px[k], m_coeffs[k]); };
+      detail::Unroll<0u, N>::run(mac);
+
+      return (traits::out(acc, 31u));
+    }
+
+    /* Four consecutive outputs, each coefficient is loaded once */
+    ARM_MATH_HPP_INLINE void dot4(const T *px, T *pDst) const
+    {
+      acc_t acc0 = 0, acc1 = 0, acc2 = 0, acc3 = 0;
+
+      auto mac = [&](uint32_t k) ARM_MATH_HPP_LAMBDA_INLINE
+      {
+        T c = m_coeffs[k];
+
+        acc0 += traits::mul(px[k], c);
+        acc1 += traits::mul(px[k + 1u], c);
+        acc2 += traits::mul(px[k + 2u], c);
+        acc3 += traits::mul(px[k + 3u], c);
+      };
+      detail::Unroll<0u, N>::run(mac);
+
+      pDst[0] = traits::out(acc0, 31u);
+      pDst[1] = traits::out(acc1, 31u);
+      pDst[2] = traits::out(acc2, 31u);
+      pDst[3] = traits::out(acc3, 31u);
+    }
+
+    /* Moves the last N - 1 inputs to the start of the delay line */
+    void shift()
+    {
+      for (uint32_t k = 0u; k < (N - 1u); k++)
+      {
+        m_state[k] = m_state[ARM_MATH_HPP_FIR_BLOCK + k];
+      }
+      m_fill = 0u;
+    }
+
+    T m_coeffs[N];                                      /* time reversed coefficients */
+    T m_state[(N - 1u) + ARM_MATH_HPP_FIR_BLOCK];       /* last N - 1 inputs and the new ones */
+    uint32_t m_fill;                                    /* new inputs in the delay line */
+  };
+
+  /**
+   * @brief FIR filter above ARM_MATH_HPP_FIR_UNROLL taps, on arm_fir_f32() or arm_fir_q31().
+   */
+  template<uint32_t N, typename T>
+  class Fir<N, T, false>
+  {
+  public:
+    typedef detail::Traits<T> traits;
+
+    explicit Fir(const T *pCoeffs)
+    {
+      for (uint32_t k = 0u; k < N; k++)
+      {
+        m_coeffs[k] = pCoeffs[k];
+      }
+      reset();
+    }
+
+    /** @brief Clears the delay line. */
+    void reset()
+    {
+      traits::firInit(&m_instance, (uint16_t) N, m_coeffs, m_state, ARM_MATH_HPP_FIR_BLOCK);
+    }
+
+    /** @brief Filters one sample. */
+    T step(T x)
+    {
+      T y;
+
+      traits::fir(&m_instance, &x, &y, 1u);
+      return (y);
+    }
+
+    /** @brief Filters blockSize samples in calls of up to ARM_MATH_HPP_FIR_BLOCK frames. */
+    void process(const T *pSrc, T *pDst, uint32_t blockSize)
+    {
+      uint32_t n;
+
+      while (blockSize > 0u)
+      {
+        n = (blockSize < ARM_MATH_HPP_FIR_BLOCK) ? blockSize : ARM_MATH_HPP_FIR_BLOCK;
+        traits::fir(&m_instance, const_cast<T *>(pSrc), pDst, n);
+        pSrc += n;
+        pDst += n;
+        blockSize -= n;
+      }
+    }
+
+  private:
+    typename traits::fir_t m_instance;
+    T m_coeffs[N];
+    T m_state[N + ARM_MATH_HPP_FIR_BLOCK - 1u];
+  };
+
+  /**
+   * @brief Direct form I cascade of Stages biquads.
+   *
+   * The coefficients are {b10, b11, b12, a11, a12, b20, ...}, as for
+   * arm_biquad_cascade_df1_init_f32(), and are copied into the filter.  The
+   * q31_t cascade takes the postShift of arm_biquad_cascade_df1_init_q31().
+   * Up to ARM_MATH_HPP_BIQUAD_UNROLL stages process() keeps the state of
+   * every stage in local variables for the whole block.
+   */
+  template<uint32_t Stages, typename T = float32_t, bool Unrolled = (Stages <= ARM_MATH_HPP_BIQUAD_UNROLL)>
+  class Biquad
+  {
+  public:
+    typedef detail::Traits<T> traits;
+    typedef typename traits::acc_t acc_t;
+
+    explicit Biquad(const T *pCoeffs, int8_t postShift = 0)
+    {
+      for (uint32_t k = 0u; k < 5u * Stages; k++)
+      {
+        m_coeffs[k] = pCoeffs[k];
+      }
+      m_shift = 31u - (uint32_t) postShift;
+      reset();
+    }
+
+    /** @brief Clears the state of every stage. */
+    void reset()
+    {
+      memset(m_state, 0, sizeof(m_state));
+    }
+
+    /** @brief Filters one sample. */
+    ARM_MATH_HPP_INLINE T step(T x)
+    {
+      return (kernel(m_state, x));
+    }
+
+    /** @brief Filters blockSize samples; pSrc and pDst may be the same buffer. */
+    void process(const T *pSrc, T *pDst, uint32_t blockSize)
+    {
+      T state[4u * Stages];
+
+      memcpy(state, m_state, sizeof(state));
+      while (blockSize > 0u)
+      {
+        *pDst++ = kernel(state, *pSrc++);
+        blockSize--;
+      }
+      memcpy(m_state, state, sizeof(state));
+    }
+
+  private:
+    /* One sample through every stage; pState holds {x[n-1], x[n-2], y[n-1], y[n-2]} of each stage */
+    ARM_MATH_HPP_INLINE T kernel(T *pState, T x) const
+    {
+      auto stage = [&](uint32_t s) ARM_MATH_HPP_LAMBDA_INLINE
+      {
+        const T *c = &m_coeffs[5u * s];
+        T *st = &pState[4u * s];
+        acc_t acc;
+        T y;
+
+        /* acc =  b0 * x[n] + b1 * x[n-1] + b2 * x[n-2] + a1 * y[n-1] + a2 * y[n-2] */
+        acc = traits::mul(c[0], x) + traits::mul(c[1], st[0]) + traits::mul(c[2], st[1]) +
+              traits::mul(c[3], st[2]) + traits::mul(c[4], st[3]);
+        y = traits::out(acc, m_shift);
+
+        st[1] = st[0];
+        st[0] = x;
+        st[3] = st[2];
+        st[2] = y;
+
+        /* The output of a stage is the input of the next one */
+        x = y;
+      };
+      detail::Unroll<0u, Stages>::run(stage);
+
+      return (x);
+    }
+
+    T m_coeffs[5u * Stages];        /* {b0, b1, b2, a1, a2} of each stage */
+    T m_state[4u * Stages];         /* {x[n-1], x[n-2], y[n-1], y[n-2]} of each stage */
+    uint32_t m_shift;               /* right shift of the q31_t accumulator */
+  };
+
+  /**
+   * @brief Biquad cascade above ARM_MATH_HPP_BIQUAD_UNROLL stages, on arm_biquad_cascade_df1_f32() or _q31().
+   */
+  template<uint32_t Stages, typename T>
+  class Biquad<Stages, T, false>
+  {
+  public:
+    typedef detail::Traits<T> traits;
+
+    explicit Biquad(const T *pCoeffs, int8_t postShift = 0)
+    {
+      for (uint32_t k = 0u; k < 5u * Stages; k++)
+      {
+        m_coeffs[k] = pCoeffs[k];
+      }
+      m_postShift = postShift;
+      reset();
+    }
+
+    /** @brief Clears the state of every stage. */
+    void reset()
+    {
+      traits::biquadInit(&m_instance, (uint8_t) Stages, m_coeffs, m_state, m_postShift);
+    }
+
+    /** @brief Filters one sample. */
+    T step(T x)
+    {
+      T y;
+
+      traits::biquad(&m_instance, &x, &y, 1u);
+      return (y);
+    }
+
+    /** @brief Filters blockSize samples; pSrc and pDst may be the same buffer. */
+    void process(const T *pSrc, T *pDst, uint32_t blockSize)
+    {
+      traits::biquad(&m_instance, const_cast<T *>(pSrc), pDst, blockSize);
+    }
+
+  private:
+    typename traits::biquad_t m_instance;
+    T m_coeffs[5u * Stages];
+    T m_state[4u * Stages];
+    int8_t m_postShift;
+  };
+
+  /**
+   * @brief R x C float32_t matrix stored row by row.
+   *
+   * Products, sums and transposes of up to ARM_MATH_HPP_MAT_UNROLL
+   * multiply-accumulates or elements are expanded; larger ones call
+   * arm_mat_mult_f32(), arm_mat_add_f32(), arm_mat_sub_f32(),
+   * arm_mat_scale_f32() and arm_mat_trans_f32() through instance().
+   */
+  template<uint32_t R, uint32_t C>
+  class Mat
+  {
+  public:
+    float32_t data[R * C];
+
+    ARM_MATH_HPP_INLINE float32_t &operator()(uint32_t i, uint32_t j) { return (data[i * C + j]); }
+    ARM_MATH_HPP_INLINE const float32_t &operator()(uint32_t i, uint32_t j) const { return (data[i * C + j]); }
+
+    /** @brief C library view of the matrix. */
+    arm_matrix_instance_f32 instance() const
+    {
+      arm_matrix_instance_f32 m;
+
+      arm_mat_init_f32(&m, (uint16_t) R, (uint16_t) C, const_cast<float32_t *>(data));
+      return (m);
+    }
+
+    /** @brief Matrix with every element zero. */
+    static Mat zeros()
+    {
+      Mat m;
+
+      memset(m.data, 0, sizeof(m.data));
+      return (m);
+    }
+
+    /** @brief Identity matrix; square matrices only. */
+    static Mat identity()
+    {
+      Mat m = zeros();
+
+      static_assert(R == C, "identity() needs a square matrix");
+      for (uint32_t i = 0u; i < R; i++)
+      {
+        m.data[i * C + i] = 1.0f;
+      }
+      return (m);
+    }
+  };
+
+  namespace detail
+  {
+    /** Selects the expanded or the C library version of a matrix operation */
+    template<bool Expand>
+    struct MatOps;
+
+    template<>
+    struct MatOps<true>
+    {
+      template<uint32_t R, uint32_t K, uint32_t C>
+      static ARM_MATH_HPP_INLINE void mult(const Mat<R, K> &a, const Mat<K, C> &b, Mat<R, C> &dst)
+      {
+        auto row = [&](uint32_t i) ARM_MATH_HPP_LAMBDA_INLINE
+        {
+          auto col = [&](uint32_t j) ARM_MATH_HPP_LAMBDA_INLINE
+          {
+            float32_t sum = 0.0f;
+            auto mac = [&](uint32_t k) ARM_MATH_HPP_LAMBDA_INLINE { sum += a.data[i * K + k] * b.data[k * C + j]; };
+            Unroll<0u, K>::run(mac);
+            dst.data[i * C + j] = sum;
+          };
+          Unroll<0u, C>::run(col);
+        };
+        Unroll<0u, R>::run(row);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static ARM_MATH_HPP_INLINE void add(const Mat<R, C> &a, const Mat<R, C> &b, Mat<R, C> &dst)
+      {
+        auto op = [&](uint32_t k) ARM_MATH_HPP_LAMBDA_INLINE { dst.data[k] = a.data[k] + b.data[k]; };
+        Unroll<0u, R * C>::run(op);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static ARM_MATH_HPP_INLINE void sub(const Mat<R, C> &a, const Mat<R, C> &b, Mat<R, C> &dst)
+      {
+        auto op = [&](uint32_t k) ARM_MATH_HPP_LAMBDA_INLINE { dst.data[k] = a.data[k] - b.data[k]; };
+        Unroll<0u, R * C>::run(op);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static ARM_MATH_HPP_INLINE void scale(const Mat<R, C> &a, float32_t scale, Mat<R, C> &dst)
+      {
+        auto op = [&](uint32_t k) ARM_MATH_HPP_LAMBDA_INLINE { dst.data[k] = a.data[k] * scale; };
+        Unroll<0u, R * C>::run(op);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static ARM_MATH_HPP_INLINE void trans(const Mat<R, C> &a, Mat<C, R> &dst)
+      {
+        auto op = [&](uint32_t k) ARM_MATH_HPP_LAMBDA_INLINE { dst.data[(k % C) * R + (k / C)] = a.data[k]; };
+        Unroll<0u, R * C>::run(op);
+      }
+    };
+
+    template<>
+    struct MatOps<false>
+    {
+      template<uint32_t R, uint32_t K, uint32_t C>
+      static void mult(const Mat<R, K> &a, const Mat<K, C> &b, Mat<R, C> &dst)
+      {
+        arm_matrix_instance_f32 ma = a.instance(), mb = b.instance(), md = dst.instance();
+        (void) arm_mat_mult_f32(&ma, &mb, &md);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static void add(const Mat<R, C> &a, const Mat<R, C> &b, Mat<R, C> &dst)
+      {
+        arm_matrix_instance_f32 ma = a.instance(), mb = b.instance(), md = dst.instance();
+        (void) arm_mat_add_f32(&ma, &mb, &md);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static void sub(const Mat<R, C> &a, const Mat<R, C> &b, Mat<R, C> &dst)
+      {
+        arm_matrix_instance_f32 ma = a.instance(), mb = b.instance(), md = dst.instance();
+        (void) arm_mat_sub_f32(&ma, &mb, &md);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static void scale(const Mat<R, C> &a, float32_t scale, Mat<R, C> &dst)
+      {
+        arm_matrix_instance_f32 ma = a.instance(), md = dst.instance();
+        (void) arm_mat_scale_f32(&ma, scale, &md);
+      }
+
+      template<uint32_t R, uint32_t C>
+      static void trans(const Mat<R, C> &a, Mat<C, R> &dst)
+      {
+        arm_matrix_instance_f32 ma = a.instance(), md = dst.instance();
+        (void) arm_mat_trans_f32(&ma, &md);
+      }
+    };
+  }
+
+  /** @brief dst = A * B; dst must not be A or B */
+  template<uint32_t R, uint32_t K, uint32_t C>
+  ARM_MATH_HPP_INLINE void mult(const Mat<R, K> &a, const Mat<K, C> &b, Mat<R, C> &dst)
+  {
+    detail::MatOps<(R * K * C) <= ARM_MATH_HPP_MAT_UNROLL>::mult(a, b, dst);
+  }
+
+  /** @brief dst = A + B */
+  template<uint32_t R, uint32_t C>
+  ARM_MATH_HPP_INLINE void add(const Mat<R, C> &a, const Mat<R, C> &b, Mat<R, C> &dst)
+  {
+    detail::MatOps<(R * C) <= ARM_MATH_HPP_MAT_UNROLL>::add(a, b, dst);
+  }
+
+  /** @brief dst = A - B */
+  template<uint32_t R, uint32_t C>
+  ARM_MATH_HPP_INLINE void sub(const Mat<R, C> &a, const Mat<R, C> &b, Mat<R, C> &dst)
+  {
+    detail::MatOps<(R * C) <= ARM_MATH_HPP_MAT_UNROLL>::sub(a, b, dst);
+  }
+
+  /** @brief dst = scale * A */
+  template<uint32_t R, uint32_t C>
+  ARM_MATH_HPP_INLINE void scale(const Mat<R, C> &a, float32_t scale, Mat<R, C> &dst)
+  {
+    detail::MatOps<(R * C) <= ARM_MATH_HPP_MAT_UNROLL>::scale(a, scale, dst);
+  }
+
+  /** @brief dst = transpose of A; dst must not be A */
+  template<uint32_t R, uint32_t C>
+  ARM_MATH_HPP_INLINE void trans(const Mat<R, C> &a, Mat<C, R> &dst)
+  {
+    detail::MatOps<(R * C) <= ARM_MATH_HPP_MAT_UNROLL>::trans(a, dst);
+  }
+
+  /** @brief A * B */
+  template<uint32_t R, uint32_t K, uint32_t C>
+  ARM_MATH_HPP_INLINE Mat<R, C> operator*(const Mat<R, K> &a, const Mat<K, C> &b)
+  {
+    Mat<R, C> dst;
+
+    mult(a, b, dst);
+    return (dst);
+  }
+
+  /** @brief A + B */
+  template<uint32_t R, uint32_t C>
+  ARM_MATH_HPP_INLINE Mat<R, C> operator+(const Mat<R, C> &a, const Mat<R, C> &b)
+  {
+    Mat<R, C> dst;
+
+    add(a, b, dst);
+    return (dst);
+  }
+
+  /** @brief A - B */
+  template<uint32_t R, uint32_t C>
+  ARM_MATH_HPP_INLINE Mat<R, C> operator-(const Mat<R, C> &a, const Mat<R, C> &b)
+  {
+    Mat<R, C> dst;
+
+    sub(a, b, dst);
+    return (dst);
+  }
+}
+
+#endif /* _ARM_MATH_HPP */
@@ -32,14 +32,14 @@
 
 /*Driver name mapping*/
 #define RTE_I2C0 1
-#define RTE_I2C0_DMA_EN 0
+#define RTE_I2C0_DMA_EN 1
 #define RTE_I2C1 1
-#define RTE_I2C1_DMA_EN 0
+#define RTE_I2C1_DMA_EN 1
 
 #define RTE_SPI0 1
-#define RTE_SPI0_DMA_EN 0
+#define RTE_SPI0_DMA_EN 1
 #define RTE_SPI1 1
-#define RTE_SPI1_DMA_EN 0
+#define RTE_SPI1_DMA_EN 1
 
 #define RTE_USART0 1
 #define RTE_USART0_DMA_EN 0
@@ -60,36 +60,36 @@
 #define RTE_I2C2_Master_DMAMUX_BASE DMAMUX0
 #define RTE_I2C2_Master_PERI_SEL kDmaRequestMux0I2C2
 
-/* DSPI configuration. */
+/* DSPI configuration. eDMA channels 0 and 1 are taken by I2C0 and I2C1. */
 #define RTE_SPI0_PCS_TO_SCK_DELAY 1000
 #define RTE_SPI0_SCK_TO_PSC_DELAY 1000
 #define RTE_SPI0_BETWEEN_TRANSFER_DELAY 1000
 #define RTE_SPI0_MASTER_PCS_PIN_SEL kDSPI_MasterPcs0
-#define RTE_SPI0_DMA_TX_CH 0
+#define RTE_SPI0_DMA_TX_CH 2
 #define RTE_SPI0_DMA_TX_PERI_SEL (uint8_t) kDmaRequestMux0SPI0Tx
 #define RTE_SPI0_DMA_TX_DMAMUX_BASE DMAMUX0
 #define RTE_SPI0_DMA_TX_DMA_BASE DMA0
-#define RTE_SPI0_DMA_RX_CH 1
+#define RTE_SPI0_DMA_RX_CH 3
 #define RTE_SPI0_DMA_RX_PERI_SEL (uint8_t) kDmaRequestMux0SPI0Rx
 #define RTE_SPI0_DMA_RX_DMAMUX_BASE DMAMUX0
 #define RTE_SPI0_DMA_RX_DMA_BASE DMA0
 #define RTE_SPI0_DMA_LINK_DMA_BASE DMA0
-#define RTE_SPI0_DMA_LINK_CH 2
+#define RTE_SPI0_DMA_LINK_CH 4
 
 #define RTE_SPI1_PCS_TO_SCK_DELAY 1000
 #define RTE_SPI1_SCK_TO_PSC_DELAY 1000
 #define RTE_SPI1_BETWEEN_TRANSFER_DELAY 1000
 #define RTE_SPI1_MASTER_PCS_PIN_SEL kDSPI_MasterPcs0
-#define RTE_SPI1_DMA_TX_CH 0
+#define RTE_SPI1_DMA_TX_CH 5
 #define RTE_SPI1_DMA_TX_PERI_SEL (uint8_t) kDmaRequestMux0SPI1
 #define RTE_SPI1_DMA_TX_DMAMUX_BASE DMAMUX0
 #define RTE_SPI1_DMA_TX_DMA_BASE DMA0
-#define RTE_SPI1_DMA_RX_CH 1
+#define RTE_SPI1_DMA_RX_CH 6
 #define RTE_SPI1_DMA_RX_PERI_SEL (uint8_t) kDmaRequestMux0SPI1
 #define RTE_SPI1_DMA_RX_DMAMUX_BASE DMAMUX0
 #define RTE_SPI1_DMA_RX_DMA_BASE DMA0
 #define RTE_SPI1_DMA_LINK_DMA_BASE DMA0
-#define RTE_SPI1_DMA_LINK_CH 2
+#define RTE_SPI1_DMA_LINK_CH 7
 
 #define RTE_SPI2_PCS_TO_SCK_DELAY 1000
 #define RTE_SPI2_SCK_TO_PSC_DELAY 1000
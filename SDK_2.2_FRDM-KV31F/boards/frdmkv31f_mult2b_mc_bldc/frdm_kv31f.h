@@ -160,6 +160,8 @@ extern gpioHandleKSDK_t BLUE_LED;
 #define WIRED_UART_IRQn UART0_RX_TX_IRQn             ///< The interrupt number associated with this IRQ
 #define WIRED_UART_CLKSRC UART0_CLK_SRC              ///< KSDK instance name for the clock feeding this module
 #define WIRED_UART_IRQn UART0_RX_TX_IRQn             ///< KSDK interrupt vector number
+#define WIRED_UART_DMA_CHANNEL 4U                    ///< eDMA channel used to transmit (0 to 3 are used by RTE_Device.h)
+#define WIRED_UART_DMA_REQUEST kDmaRequestMux0UART0Tx ///< DMAMUX source for the transmit requests
 ///@}
 
 /// @name Wireless UART Parameters
@@ -176,6 +178,8 @@ extern gpioHandleKSDK_t BLUE_LED;
 #define WIRELESS_UART_IRQn UART1_RX_TX_IRQn             ///< The interrupt number associated with this IRQ
 #define WIRELESS_UART_CLKSRC UART1_CLK_SRC              ///< KSDK instance name for the clock feeding this module
 #define WIRELESS_UART_IRQn UART1_RX_TX_IRQn             ///< KSDK interrupt vector number
+#define WIRELESS_UART_DMA_CHANNEL 5U                    ///< eDMA channel used to transmit
+#define WIRELESS_UART_DMA_REQUEST kDmaRequestMux0UART1Tx ///< DMAMUX source for the transmit requests
 ///@}
 
 ///@name Miscellaneous Hardware Configuration Parameters
@@ -191,6 +195,10 @@ extern gpioHandleKSDK_t BLUE_LED;
 #define MAG_NVM_OFFSET 0     // 68 bytes used
 #define GYRO_NVM_OFFSET 100  // 16 bytes used
 #define ACCEL_NVM_OFFSET 140 // 88 bytes used
+
+// wear leveled calibration journal (CALIBRATION_JOURNAL) immediately below the NVM block
+#define CALJOURNAL_NVM_ADDR 0x0007D000 ///< start of the four 2KB flash sectors holding the calibration journal
+#define CALJOURNAL_NVM_SECTORS 4       ///< number of sectors the journal rotates through
 ///@}
 
 // FXOS8700 Sensor Information of the mother board
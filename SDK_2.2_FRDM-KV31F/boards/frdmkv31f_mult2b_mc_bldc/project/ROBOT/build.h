@@ -87,15 +87,45 @@
 /// @name SensorParameters
 /// FIFO sizes effect the size of the sensor data structures.  ODR refers to "Output Data Rate"
 ///@{
+#ifndef COMPACT_GLOBALS
+#define COMPACT_GLOBALS 1          ///< shared calibration scratch, 16 bit magnetic buffer ages, FIFOs sized from ODR / fusion rate
+#endif
+#if COMPACT_GLOBALS
+/// one fusion period at the worst ratio of the governor profiles (governor.c): Parked accel
+/// PARKED_ACCEL_ODR_HZ / PARKED_FUSION_HZ, Cruising gyro GYRO_ODR_HZ / FUSION_HZ, and one mag sample
+/// per fast loop read
+#define ACCEL_FIFO_SIZE SW_FIFO_DEPTH(PARKED_ACCEL_ODR_HZ, PARKED_FUSION_HZ, 32)
+#define MAG_FIFO_SIZE SW_FIFO_DEPTH(FAST_LOOP_HZ, FUSION_HZ, 16)
+#define GYRO_FIFO_SIZE SW_FIFO_DEPTH(GYRO_ODR_HZ, FUSION_HZ, 32)
+#else
 #define ACCEL_FIFO_SIZE 32 ///< FXOS8700 (accel), MMA8652, FXLS8952 all have 32 element FIFO
 #define MAG_FIFO_SIZE 16   ///< FXOS8700 (mag), MAG3110 have no FIFO so equivalent to 1 element FIFO
 #define GYRO_FIFO_SIZE 32  ///< FXAX21000, FXAS21002 have 32 element FIFO
+#endif
 #define ACCEL_ODR_HZ 200   ///< (int) requested accelerometer ODR Hz (over-rides MAG_ODR_HZ for FXOS8700)
 #define MAG_ODR_HZ 200     ///< (int) requested magnetometer ODR Hz (over-ridden by ACCEL_ODR_HZ for FXOS8700)
 #define GYRO_ODR_HZ 400    ///< (int) requested gyroscope ODR Hz
 #define FUSION_HZ 50       ///< (int) actual rate of fusion algorithm execution and sensor FIFO reads
 #define FAST_LOOP_HZ 100   ///< Over Sample Ratio * FUSION_HZ when using no FIFO
 #define OVERSAMPLE_RATE FAST_LOOP_HZ / FUSION_HZ
+#define PARKED_ACCEL_ODR_HZ 25     ///< (int) accelerometer ODR Hz of the governor Parked profile
+#define PARKED_FUSION_HZ 5         ///< (int) fusion rate of the governor Parked profile
+#define MAGCAL_BACKGROUND 1        ///< magnetic calibration solvers run in the low priority MAGCAL task
+#define MAGBUFFER_FASTINDEX 1      ///< constant time magnetic buffer oldest bin retirement
+#define MAGCAL_INVERSE_ITERATION 1 ///< 10 element magnetic calibration solves only the smallest eigenpair
+#define CALIBRATION_JOURNAL 1      ///< calibrations are appended to a wear leveled flash journal
+#define F_NUM_SENSOR_INSTANCES 2  ///< shield FXOS8700 (instance 0) averaged with the mother-board FXOS8700 (instance 1)
+#define RATE_GOVERNOR 1            ///< fusion rate, PIT period and sensor ODR follow the motor command and motion (governor.c)
+#define SPECTRUM_ANALYSIS 1        ///< accelerometer STFT in the low priority SPECTRUM task, exported over HDLC (spectrum.c)
+#ifndef FIFO_RESAMPLE
+#define FIFO_RESAMPLE 0            ///< 1 to resample the accel and mag FIFOs to the fusion rate, needs a libarm_cortexM4lf_math.a with arm_fir_resample_f32
+#endif
+#ifndef LAZY_ORIENTATION
+#define LAZY_ORIENTATION 1         ///< Euler angles and rotation vector are computed only when com.c or the stream reads them
+#endif
+#ifndef FAST_MATH
+#define FAST_MATH 1                ///< orientation and fusion trigonometry and normalization on the fastmath.c kernels
+#endif
 ///@}
 
 #define INCLUDE_DEBUG_FUNCTIONS // Comment this line to disable the ApplyPerturbation function
@@ -18,6 +18,9 @@
 /* filter*/
 #include "filter.h"
 #include "motors.h"
+#if SPECTRUM_ANALYSIS
+#include "spectrum.h"
+#endif
 
 /*******************************************************************************
  * Definitions
@@ -25,6 +28,9 @@
 /* Task priorities. */
 #define uart_task_PRIORITY (tskIDLE_PRIORITY)
 #define COM_FLAG1 (TickType_t)1
+#if SPECTRUM_ANALYSIS
+#define COM_U8_PSD_PER_FRAME 7U    ///< PSD bins in one 'p' frame: 4 header bytes + 7 floats = 32 bytes
+#endif
 
 /*******************************************************************************
  * Prototypes
@@ -52,6 +58,16 @@ float gfAccGlOutput[3];
 float gfVelGl[3];
 float gfPosition[3];
 extern SensorFusionGlobals sfg;
+#if SPECTRUM_ANALYSIS
+extern SPECTRUM_tsEngine spectrum;
+
+/* spectrum export requested by the master, sent after the 's' frame:
+ * - 'f' summary frame: frames averaged, dropped, band and RMS of the watched lines
+ * - 'p' summary frame, then the band PSD 7 bins per frame
+ * - 'q' nothing */
+static UI08 u8SpectrumCmd = 'q';
+static UI08 u8PsdIndex = 0;      ///< first bin of the next 'p' frame, 0 to send the summary frame
+#endif
 
 
 static float f32Cap = 0;
@@ -102,6 +118,78 @@ static void CalculateNewMotorCommand(MOTOR_eMotorsOrders eMotorCommand,
     /**/
 }
 
+#if SPECTRUM_ANALYSIS
+/* summary frame of the spectrum: 32 bytes
+ * [0..1] life bytes, [2] 'f', [3] frames averaged, [4] frames dropped (both saturated at 255),
+ * [5] bins in the band, [6..7] first bin, [8..11] bin width (Hz), [12..31] RMS of the 5 watched lines (g) */
+static UI08 u8BuildSpectrumSummary(uint8_t *pu8Frame)
+{
+	union
+	{
+		float    f32Value;
+		uint16_t u16Value;
+		uint8_t  au8Data[4];
+	}Convert32Bits;
+	uint32_t u32Count;
+	uint8_t  i;
+
+	pu8Frame[0] = COM_gu8TxLifeByteFrame;
+	pu8Frame[1] = COM_gu8RxLifeByteFrame;
+	COM_gu8TxLifeByteFrame++;
+	pu8Frame[2] = 'f';
+	u32Count = spectrum.u32Frames;
+	pu8Frame[3] = (u32Count > 255U) ? 255U : (uint8_t)u32Count;
+	u32Count = spectrum.u32Dropped;
+	pu8Frame[4] = (u32Count > 255U) ? 255U : (uint8_t)u32Count;
+	pu8Frame[5] = (uint8_t)spectrum.u16NbBins;
+	Convert32Bits.u16Value = spectrum.u16FirstBin;
+	pu8Frame[6] = Convert32Bits.au8Data[0];
+	pu8Frame[7] = Convert32Bits.au8Data[1];
+	Convert32Bits.f32Value = SPECTRUM_f32BinHz(&spectrum);
+	pu8Frame[8]  = Convert32Bits.au8Data[0];
+	pu8Frame[9]  = Convert32Bits.au8Data[1];
+	pu8Frame[10] = Convert32Bits.au8Data[2];
+	pu8Frame[11] = Convert32Bits.au8Data[3];
+	for (i = 0; i < SPECTRUM_NB_WATCH; i++)
+	{
+		Convert32Bits.f32Value = sqrtf(spectrum.af32WatchPower[i]);
+		pu8Frame[12 + 4*i] = Convert32Bits.au8Data[0];
+		pu8Frame[13 + 4*i] = Convert32Bits.au8Data[1];
+		pu8Frame[14 + 4*i] = Convert32Bits.au8Data[2];
+		pu8Frame[15 + 4*i] = Convert32Bits.au8Data[3];
+	}
+	return (12U + 4U*SPECTRUM_NB_WATCH);
+}
+
+/* PSD frame of the spectrum: 32 bytes
+ * [0..1] life bytes, [2] 'p', [3] index in the band of the first bin, [4..31] 7 PSD bins (g^2/Hz) */
+static UI08 u8BuildSpectrumPsd(uint8_t *pu8Frame, uint8_t u8Index)
+{
+	union
+	{
+		float    f32Value;
+		uint8_t  au8Data[4];
+	}Convert32Bits;
+	uint8_t i;
+
+	pu8Frame[0] = COM_gu8TxLifeByteFrame;
+	pu8Frame[1] = COM_gu8RxLifeByteFrame;
+	COM_gu8TxLifeByteFrame++;
+	pu8Frame[2] = 'p';
+	pu8Frame[3] = u8Index;
+	for (i = 0; i < COM_U8_PSD_PER_FRAME; i++)
+	{
+		/* bins after the end of the band are sent as 0 */
+		Convert32Bits.f32Value = ((u8Index + i) < SPECTRUM_MAX_BAND_BINS) ? spectrum.af32Psd[u8Index + i] : 0.0F;
+		pu8Frame[4 + 4*i] = Convert32Bits.au8Data[0];
+		pu8Frame[5 + 4*i] = Convert32Bits.au8Data[1];
+		pu8Frame[6 + 4*i] = Convert32Bits.au8Data[2];
+		pu8Frame[7 + 4*i] = Convert32Bits.au8Data[3];
+	}
+	return (4U + 4U*COM_U8_PSD_PER_FRAME);
+}
+#endif
+
 /*!
  * @brief Task responsible for controlling com with PC/master board with bluetooth.
  */
@@ -192,6 +280,31 @@ static void com_TxTask(void *pvParameters)
     	    u8TxFrameSize = 26;
     	    HDLC_bPutFrame(&au8TxFrame[0],&u8TxFrameSize);
         }
+
+#if SPECTRUM_ANALYSIS
+        /* one spectrum frame per period, after the motor update */
+        if(u8SpectrumCmd == 'f')
+        {
+        	u8TxFrameSize = u8BuildSpectrumSummary(&au8TxFrame[0]);
+        	HDLC_bPutFrame(&au8TxFrame[0],&u8TxFrameSize);
+        }
+        else if(u8SpectrumCmd == 'p')
+        {
+        	/* u8PsdIndex 0: summary, so the master knows the band of the following PSD frames */
+        	if(u8PsdIndex == 0)
+        	{
+        		u8TxFrameSize = u8BuildSpectrumSummary(&au8TxFrame[0]);
+        		u8PsdIndex = 1;
+        	}
+        	else
+        	{
+        		u8TxFrameSize = u8BuildSpectrumPsd(&au8TxFrame[0], u8PsdIndex - 1U);
+        		u8PsdIndex += COM_U8_PSD_PER_FRAME;
+        		if((u8PsdIndex - 1U) >= spectrum.u16NbBins) u8PsdIndex = 0;
+        	}
+        	HDLC_bPutFrame(&au8TxFrame[0],&u8TxFrameSize);
+        }
+#endif
     }
 }
 
@@ -225,8 +338,54 @@ static void com_RxTask(void *pvParameters)
         if((bFrameReceived == TRUE) &&
            (u8RxFrameSize==1))
         {
+#if SPECTRUM_ANALYSIS
+        	/* spectrum export command, the 's' stream keeps running */
+        	if((au8RxFrame[0] == 'f') || (au8RxFrame[0] == 'p') || (au8RxFrame[0] == 'q'))
+        	{
+        		u8SpectrumCmd = au8RxFrame[0];
+        		u8PsdIndex = 0;
+        	}
+        	else
+#endif
         	u8CmdReceived = au8RxFrame[0];
         }
+#if SPECTRUM_ANALYSIS
+        /* received a band command: 'B', low (Hz), high (Hz) */
+        else if((bFrameReceived == TRUE) &&
+                (u8RxFrameSize==9) && (au8RxFrame[0] == 'B'))
+        {
+        	float f32Low;
+
+        	Convert32Bits.au8Data[0] = au8RxFrame[1];
+        	Convert32Bits.au8Data[1] = au8RxFrame[2];
+        	Convert32Bits.au8Data[2] = au8RxFrame[3];
+        	Convert32Bits.au8Data[3] = au8RxFrame[4];
+        	f32Low = Convert32Bits.f32Value;
+        	Convert32Bits.au8Data[0] = au8RxFrame[5];
+        	Convert32Bits.au8Data[1] = au8RxFrame[6];
+        	Convert32Bits.au8Data[2] = au8RxFrame[7];
+        	Convert32Bits.au8Data[3] = au8RxFrame[8];
+        	SPECTRUM_SetBand(&spectrum, f32Low, Convert32Bits.f32Value);
+        	u8PsdIndex = 0;
+        }
+        /* received a watch command: 'W', line index, center (Hz), half width (Hz), 0 disables the line */
+        else if((bFrameReceived == TRUE) &&
+                (u8RxFrameSize==10) && (au8RxFrame[0] == 'W'))
+        {
+        	float f32Center;
+
+        	Convert32Bits.au8Data[0] = au8RxFrame[2];
+        	Convert32Bits.au8Data[1] = au8RxFrame[3];
+        	Convert32Bits.au8Data[2] = au8RxFrame[4];
+        	Convert32Bits.au8Data[3] = au8RxFrame[5];
+        	f32Center = Convert32Bits.f32Value;
+        	Convert32Bits.au8Data[0] = au8RxFrame[6];
+        	Convert32Bits.au8Data[1] = au8RxFrame[7];
+        	Convert32Bits.au8Data[2] = au8RxFrame[8];
+        	Convert32Bits.au8Data[3] = au8RxFrame[9];
+        	SPECTRUM_SetWatch(&spectrum, au8RxFrame[1], f32Center, Convert32Bits.f32Value);
+        }
+#endif
         /* received a motor command */
         else if((bFrameReceived == TRUE) &&
                 (u8RxFrameSize==7))
@@ -0,0 +1,172 @@
+#include "sensor_fusion.h"
+#include "fusion.h"
+#include "drivers.h"
+#include "driver_pit.h"
+#include "motors.h"
+#include "governor.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* motionCheck tolerances on the calibrated accel (g) and the gyro (deg/s) */
+#define GOVERNOR_ACCEL_TOLERANCE 0.02F
+#define GOVERNOR_GYRO_TOLERANCE  2.0F
+
+typedef struct
+{
+    uint16_t u16FusionHz;    /* fusion rate, the PIT runs OVERSAMPLE_RATE times faster */
+    uint16_t u16AccelODRHz;  /* FXOS8700 hybrid ODR */
+    uint16_t u16GyroODRHz;   /* FXAS21002 ODR, 0 puts the gyro in standby */
+    bool bAuxSensors;        /* mother board FXOS8700 and MPL3115 running */
+} GOVERNOR_tsProfile;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+bool motionCheck(float sample[3], float baseline[3], float tolerance, uint32_t winLength, uint32_t *count);  /* defined in motionCheck.c */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+/* 200 Hz fusion does not fit the 2 I2C buses and the 9DOF Kalman at 120 MHz, driving is 100 Hz */
+static const GOVERNOR_tsProfile GOVERNOR_asProfiles[GOVERNOR_eNbProfiles] =
+{
+    /* GOVERNOR_eDriving  */ { 100U,             200U,                400U,        true  },
+    /* GOVERNOR_eCruising */ { FUSION_HZ,        ACCEL_ODR_HZ,        GYRO_ODR_HZ, true  },
+    /* GOVERNOR_eParked   */ { PARKED_FUSION_HZ, PARKED_ACCEL_ODR_HZ, 0U,          false },
+};
+
+static struct PhysicalSensor *GOVERNOR_psAccelMag;
+static struct PhysicalSensor *GOVERNOR_psGyro;
+static struct PhysicalSensor *GOVERNOR_psPressure;
+static struct PhysicalSensor *GOVERNOR_psBoardAccelMag;
+
+/* written by the fusion task, applied to the sensors by the read task */
+static volatile GOVERNOR_eProfiles GOVERNOR_eProfile = GOVERNOR_eCruising;
+static GOVERNOR_eProfiles GOVERNOR_eSensorProfile = GOVERNOR_eCruising;
+
+static float GOVERNOR_af32AccelBaseline[3];
+static float GOVERNOR_af32GyroBaseline[3];
+static uint32_t GOVERNOR_u32AccelCount = 0;
+static uint32_t GOVERNOR_u32GyroCount = 0;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+static void GOVERNOR_SetRate(SensorFusionGlobals *sfg, const GOVERNOR_tsProfile *psProfile)
+{
+    fSetFusionRate(sfg, psProfile->u16FusionHz);
+#if FIFO_RESAMPLE
+    /* GOVERNOR_ApplySensors clears the FIFOs before the next read, so the next burst is at the new rates */
+    fSetResampleRates(sfg, psProfile->u16AccelODRHz, psProfile->u16FusionHz * (OVERSAMPLE_RATE));
+#endif
+    pit_set_period(1000000U / (psProfile->u16FusionHz * OVERSAMPLE_RATE));
+}
+
+void GOVERNOR_Initialization(SensorFusionGlobals *sfg,
+                             struct PhysicalSensor *psAccelMag,
+                             struct PhysicalSensor *psGyro,
+                             struct PhysicalSensor *psPressure,
+                             struct PhysicalSensor *psBoardAccelMag)
+{
+    GOVERNOR_psAccelMag = psAccelMag;
+    GOVERNOR_psGyro = psGyro;
+    GOVERNOR_psPressure = psPressure;
+    GOVERNOR_psBoardAccelMag = psBoardAccelMag;
+    /* the sensors were initialized with the build ODR, which is the cruising profile */
+    GOVERNOR_eProfile = GOVERNOR_eCruising;
+    GOVERNOR_eSensorProfile = GOVERNOR_eCruising;
+    fSetFusionRate(sfg, GOVERNOR_asProfiles[GOVERNOR_eCruising].u16FusionHz);
+}
+
+bool GOVERNOR_bUpdate(SensorFusionGlobals *sfg)
+{
+    GOVERNOR_eProfiles eProfile;
+    MOTOR_eMotorsOrders eCommand = MOTORS_eGetCommand();
+    uint32_t u32WinLength = GOVERNOR_PARK_SECS * sfg->iFusionHz;
+    bool bStationary;
+
+    /* both checks run every pass so that their baselines stay current */
+    bStationary = motionCheck(sfg->Accel.fGc, GOVERNOR_af32AccelBaseline, GOVERNOR_ACCEL_TOLERANCE,
+                              u32WinLength, &GOVERNOR_u32AccelCount);
+#if F_USING_GYRO
+    if (sfg->Gyro.isEnabled)
+    {
+        bStationary &= motionCheck(sfg->Gyro.fYs, GOVERNOR_af32GyroBaseline, GOVERNOR_GYRO_TOLERANCE,
+                                   u32WinLength, &GOVERNOR_u32GyroCount);
+    }
+#endif
+
+    if ((eCommand != MOTOR_eStop) && (MOTORS_u16GetPWMLevel() > 0U))
+    {
+        eProfile = GOVERNOR_eDriving;
+    }
+    else if (bStationary)
+    {
+        eProfile = GOVERNOR_eParked;
+    }
+    else
+    {
+        eProfile = GOVERNOR_eCruising;
+    }
+
+    if (eProfile != GOVERNOR_eProfile)
+    {
+        /* the windows count fusion passes.  Parking keeps the counts, which already exceed the
+           shorter window at the parked rate, so the robot stays parked until it moves; leaving
+           Parked restarts them at the new rate */
+        if (eProfile != GOVERNOR_eParked)
+        {
+            GOVERNOR_u32AccelCount = 0;
+            GOVERNOR_u32GyroCount = 0;
+        }
+        GOVERNOR_SetRate(sfg, &GOVERNOR_asProfiles[eProfile]);
+        GOVERNOR_eProfile = eProfile;
+    }
+    return (eProfile == GOVERNOR_eParked);
+}
+
+void GOVERNOR_ApplySensors(SensorFusionGlobals *sfg)
+{
+    GOVERNOR_eProfiles eProfile = GOVERNOR_eProfile;
+    const GOVERNOR_tsProfile *psProfile = &GOVERNOR_asProfiles[eProfile];
+
+    if (eProfile == GOVERNOR_eSensorProfile) return;
+
+    /* sensors leaving standby restart with the build ODR, SetODR below corrects it */
+    if (psProfile->bAuxSensors)
+    {
+        if (!GOVERNOR_psBoardAccelMag->isInitialized) GOVERNOR_psBoardAccelMag->initialize(GOVERNOR_psBoardAccelMag, sfg);
+        if (!GOVERNOR_psPressure->isInitialized) GOVERNOR_psPressure->initialize(GOVERNOR_psPressure, sfg);
+    }
+    else
+    {
+        if (GOVERNOR_psBoardAccelMag->isInitialized) FXOS8700_Idle(GOVERNOR_psBoardAccelMag, sfg);
+        if (GOVERNOR_psPressure->isInitialized) MPL3115_Idle(GOVERNOR_psPressure, sfg);
+    }
+    if (psProfile->u16GyroODRHz)
+    {
+        if (!GOVERNOR_psGyro->isInitialized) GOVERNOR_psGyro->initialize(GOVERNOR_psGyro, sfg);
+        FXAS21002_SetODR(GOVERNOR_psGyro, sfg, psProfile->u16GyroODRHz);
+    }
+    else if (GOVERNOR_psGyro->isInitialized)
+    {
+        FXAS21002_Idle(GOVERNOR_psGyro, sfg);
+    }
+    FXOS8700_SetODR(GOVERNOR_psAccelMag, sfg, psProfile->u16AccelODRHz);
+    if (psProfile->bAuxSensors) FXOS8700_SetODR(GOVERNOR_psBoardAccelMag, sfg, psProfile->u16AccelODRHz);
+
+    /* samples taken at the old ODR and rate are not mixed with the new ones */
+    sfg->clearFIFOs(sfg);
+    GOVERNOR_eSensorProfile = eProfile;
+}
+
+GOVERNOR_eProfiles GOVERNOR_eGetProfile(void)
+{
+    return (GOVERNOR_eProfile);
+}
+
+uint16_t GOVERNOR_u16GetAccelODRHz(void)
+{
+    return (GOVERNOR_asProfiles[GOVERNOR_eSensorProfile].u16AccelODRHz);
+}
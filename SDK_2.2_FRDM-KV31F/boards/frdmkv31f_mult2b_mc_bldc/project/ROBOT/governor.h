@@ -0,0 +1,38 @@
+
+#ifndef GOVERNOR_H_
+#define GOVERNOR_H_
+
+#include "sensor_fusion.h"
+
+/*! @brief rate profiles selected from the motor command and the motion of the robot */
+typedef enum
+{
+    GOVERNOR_eDriving = 0U,  /*!< motors running: highest fusion rate and ODR */
+    GOVERNOR_eCruising,      /*!< motors stopped but robot moving: FUSION_HZ and build ODR */
+    GOVERNOR_eParked,        /*!< motors stopped and robot stationary: accel only, slowest rate */
+    GOVERNOR_eNbProfiles
+} GOVERNOR_eProfiles;
+
+/** seconds the accel and gyro must be stable before the robot is considered parked */
+#define GOVERNOR_PARK_SECS 3
+
+/** init the governor with the sensors it may idle, PIT and fusion rate start in cruising profile */
+void GOVERNOR_Initialization(SensorFusionGlobals *sfg,
+                             struct PhysicalSensor *psAccelMag,
+                             struct PhysicalSensor *psGyro,
+                             struct PhysicalSensor *psPressure,
+                             struct PhysicalSensor *psBoardAccelMag);
+
+/** fusion task: select the profile after conditionSensorReadings, retune fusion constants and PIT.
+ *  returns true when parked, the caller then skips runFusion */
+bool GOVERNOR_bUpdate(SensorFusionGlobals *sfg);
+
+/** read task: apply the sensor ODR and power changes of the selected profile, before the buses are read */
+void GOVERNOR_ApplySensors(SensorFusionGlobals *sfg);
+
+GOVERNOR_eProfiles GOVERNOR_eGetProfile(void);
+
+/** accelerometer ODR of the profile applied to the sensors, the rate of the samples in the accel FIFO */
+uint16_t GOVERNOR_u16GetAccelODRHz(void);
+
+#endif /* GOVERNOR_H_ */
@@ -0,0 +1,127 @@
+/*! \file spectrum_trace.c
+    \brief Host build of the ROBOT spectrum engine for logged accelerometer traces
+
+    Runs spectrum.c on a trace and prints the averaged band PSD and the RMS of
+    the watched lines, as the SPECTRUM task would export them over HDLC.  The
+    trace is a text file with one sample per line, either "ax ay az" or
+    "t ax ay az" with the acceleration in g; empty lines and lines starting
+    with '#' are skipped.  The samples are fed in bursts of one FIFO read.
+
+    Build from the ROBOT directory against the host CMSIS DSP library:
+
+    cmake -S ../../../../CMSIS/DSP_Lib -B dsp && cmake --build dsp
+    gcc -O2 -DARM_MATH_CM0 -I. -I../../../../CMSIS/Include \
+        host/spectrum_trace.c spectrum.c dsp/libarm_host_math.a -lm -o spectrum_trace
+
+    spectrum_trace [-r rate_hz] [-c x|y|z|n] [-b low_hz high_hz] [-w center_hz half_width_hz]... trace.txt
+
+    -r  sample rate of the trace, 200 Hz by default (ACCEL_ODR_HZ)
+    -c  analyzed signal, the norm of the acceleration by default
+    -b  band of the PSD, 0 Hz to Nyquist by default
+    -w  watched line, up to SPECTRUM_NB_WATCH times
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spectrum.h"
+
+#define TRACE_BURST 4U      // samples per FIFO read, 200 Hz ODR and 50 Hz fusion
+
+static SPECTRUM_tsEngine engine;
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: spectrum_trace [-r rate_hz] [-c x|y|z|n] [-b low_hz high_hz] "
+                    "[-w center_hz half_width_hz]... trace.txt\n");
+    exit(2);
+}
+
+int main(int argc, char *argv[])
+{
+    float rateHz = 200.0F;                  // sample rate of the trace
+    SPECTRUM_eChannels channel = SPECTRUM_eNorm;
+    float bandLow = 0.0F, bandHigh = -1.0F; // negative: up to Nyquist
+    SPECTRUM_tsWatch watch[SPECTRUM_NB_WATCH];
+    uint8_t nWatch = 0;
+    const char *path = NULL;
+    float burst[TRACE_BURST][3];            // one FIFO read
+    uint32_t nBurst = 0, nSamples = 0;
+    char line[256];
+    float v[4];
+    FILE *f;
+    int i, n;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (!strcmp(argv[i], "-r") && i + 1 < argc) rateHz = strtof(argv[++i], NULL);
+        else if (!strcmp(argv[i], "-c") && i + 1 < argc)
+        {
+            i++;
+            if (argv[i][0] == 'x') channel = SPECTRUM_eAxisX;
+            else if (argv[i][0] == 'y') channel = SPECTRUM_eAxisY;
+            else if (argv[i][0] == 'z') channel = SPECTRUM_eAxisZ;
+            else channel = SPECTRUM_eNorm;
+        }
+        else if (!strcmp(argv[i], "-b") && i + 2 < argc)
+        {
+            bandLow = strtof(argv[++i], NULL);
+            bandHigh = strtof(argv[++i], NULL);
+        }
+        else if (!strcmp(argv[i], "-w") && i + 2 < argc && nWatch < SPECTRUM_NB_WATCH)
+        {
+            watch[nWatch].f32CenterHz = strtof(argv[++i], NULL);
+            watch[nWatch].f32HalfWidthHz = strtof(argv[++i], NULL);
+            nWatch++;
+        }
+        else if (argv[i][0] != '-' && path == NULL) path = argv[i];
+        else usage();
+    }
+    if (path == NULL || rateHz <= 0.0F) usage();
+    if ((f = fopen(path, "r")) == NULL)
+    {
+        perror(path);
+        return (1);
+    }
+
+    if (!SPECTRUM_bInitialize(&engine, channel, rateHz))
+    {
+        fprintf(stderr, "SPECTRUM_FFT_LEN %u is not supported by arm_rfft_fast_f32\n", (unsigned) SPECTRUM_FFT_LEN);
+        return (1);
+    }
+    if (bandHigh >= 0.0F) SPECTRUM_SetBand(&engine, bandLow, bandHigh);
+    for (i = 0; i < nWatch; i++) SPECTRUM_SetWatch(&engine, (uint8_t) i, watch[i].f32CenterHz, watch[i].f32HalfWidthHz);
+
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        if (line[0] == '#') continue;
+        n = sscanf(line, "%f %f %f %f", &v[0], &v[1], &v[2], &v[3]);
+        if (n < 3) continue;
+        memcpy(burst[nBurst], (n == 4) ? &v[1] : &v[0], sizeof(burst[0]));
+        nSamples++;
+        if (++nBurst == TRACE_BURST)
+        {
+            SPECTRUM_PushG(&engine, (const float (*)[3]) burst, nBurst);
+            nBurst = 0;
+            while (SPECTRUM_bProcess(&engine)) ;
+        }
+    }
+    fclose(f);
+    SPECTRUM_PushG(&engine, (const float (*)[3]) burst, nBurst);
+    while (SPECTRUM_bProcess(&engine)) ;
+
+    printf("# %lu samples at %.3f Hz, bin %.4f Hz, %lu frames averaged, %lu dropped\n",
+           (unsigned long) nSamples, rateHz, SPECTRUM_f32BinHz(&engine),
+           (unsigned long) engine.u32Frames, (unsigned long) engine.u32Dropped);
+    printf("# freq_hz psd_g2_per_hz\n");
+    for (i = 0; i < engine.u16NbBins; i++)
+    {
+        printf("%.4f %.6e\n", (engine.u16FirstBin + i) * SPECTRUM_f32BinHz(&engine), engine.af32Psd[i]);
+    }
+    for (i = 0; i < nWatch; i++)
+    {
+        printf("# watch %d: %.3f +/- %.3f Hz, rms %.6e g\n", i, watch[i].f32CenterHz, watch[i].f32HalfWidthHz,
+               sqrtf(engine.af32WatchPower[i]));
+    }
+    return (engine.u32Frames > 0U) ? 0 : 1;
+}
@@ -53,6 +53,8 @@
 #include "mpl3115.h"            // register address and bit field definitions
 #include "fxos8700.h"           // register address and bit field definitions
 #include "fsl_i2c_cmsis.h"
+#include "fsl_dmamux.h"         // KSDK header file for the DMA request multiplexer
+#include "fsl_edma.h"           // KSDK header file for the eDMA used by the sensor buses
 #include "register_io_i2c.h"
 #include "fsl_smc.h"
 
@@ -67,14 +69,42 @@
 #include "com.h" // com headers
 #endif
 #include "motors.h"
+#if RATE_GOVERNOR
+#include "governor.h"
+#endif
+#if SPECTRUM_ANALYSIS
+#include "spectrum.h"
+#endif
 
 // Global data structures
 SensorFusionGlobals sfg;                ///< This is the primary sensor fusion data structure
 ControlSubsystem controlSubsystem;      ///< used for serial communications
 StatusSubsystem statusSubsystem;        ///< provides visual (usually LED) status indicator
-struct PhysicalSensor sensors[3];              ///< This implementation uses three physical sensors
+struct PhysicalSensor sensors[4];              ///< This implementation uses four physical sensors
 EventGroupHandle_t event_group = NULL;
 EventGroupHandle_t event_PIT = NULL; ///<used to call cyclically the read_task
+EventGroupHandle_t event_bus_start = NULL; ///<read task releases the other sensor bus tasks
+EventGroupHandle_t event_bus_done = NULL;  ///<each sensor bus task reports the end of its reads
+
+/// One reader per I2C bus so that both buses transfer at the same time.
+/// sensorBus[0] is served by read_task itself, the others by a bus_task.
+typedef struct
+{
+    void *bus_driver;                   ///< driver the sensors were installed with
+    uint8_t deviceInstance;             ///< matches registerDeviceInfo_t.deviceInstance
+    EventBits_t bit;                    ///< start/done bit in event_bus_start/event_bus_done
+    TaskHandle_t task;                  ///< task reading this bus (NULL if no sensor on it)
+} SensorBus;
+
+#define NUM_SENSOR_BUS 2
+static SensorBus sensorBus[NUM_SENSOR_BUS];
+static EventBits_t busTaskBits = 0;     ///< bits of the bus tasks started for this board
+static uint16_t read_loop_counter = 0;  ///< shared by all sensor bus readers for one PIT period
+static TaskHandle_t magcal_task_handle = NULL;  ///< runs the magnetic calibration solvers when the CPU is idle
+#if SPECTRUM_ANALYSIS
+SPECTRUM_tsEngine spectrum;                     ///< accelerometer STFT, fed by fusion_task and exported by com.c
+static TaskHandle_t spectrum_task_handle = NULL;    ///< transforms the accelerometer frames when the CPU is idle
+#endif
 
 registerDeviceInfo_t i2cBusInfo_frdm_fxs_mul2b_shield = {
     .deviceInstance     = I2C_S_DEVICE_INDEX,
@@ -90,7 +120,32 @@ registerDeviceInfo_t i2cBusInfo_frdm_kv31f = {
 
 static void read_task(void *pvParameters);              // FreeRTOS Task definition
 static void fusion_task(void *pvParameters);            // FreeRTOS Task definition
+static void bus_task(void *pvParameters);               // FreeRTOS Task definition, one per extra sensor bus
+static bool BusHasSensors(void *bus_driver);            // true if a sensor was installed on this bus
+static void magcal_task(void *pvParameters);            // FreeRTOS Task definition, background magnetic calibration
+#if SPECTRUM_ANALYSIS
+static void spectrum_task(void *pvParameters);          // FreeRTOS Task definition, background accelerometer spectrum
+static void FeedSpectrum(void);                         // passes the accel FIFO of this fusion period to the spectrum
+#endif
+static void SignalMagCal(SensorFusionGlobals *sfg);     // wakes magcal_task when a calibration is queued
 static void WakeUp(void);                               // function used to wake up read task
+static void WaitSensorBus(SensorFusionGlobals *sfg, uint8_t deviceInstance);   // blocks read task during a sensor read
+static void SignalSensorBus(SensorFusionGlobals *sfg, uint8_t deviceInstance); // sensor read completion (ISR)
+
+/// The CPU sleeps (Wait mode) whenever no task is ready.  The magnetic calibration and spectrum
+/// tasks share the idle priority, so the core only sleeps while those tasks are blocked.
+void vApplicationIdleHook(void)
+{
+    bool bBusy;
+
+    __disable_irq();                    // a pending interrupt still ends the WFI
+    bBusy = (eTaskGetState(magcal_task_handle) != eBlocked);
+#if SPECTRUM_ANALYSIS
+    bBusy = bBusy || (eTaskGetState(spectrum_task_handle) != eBlocked);
+#endif
+    if (!bBusy) SMC_SetPowerModeWait(SMC);
+    __enable_irq();
+}
 
 /// This is a FreeRTOS (dual task) implementation of the NXP sensor fusion demo build.
 int main(void)
@@ -99,6 +154,17 @@ int main(void)
     BOARD_BootClockRUN();               // defined in clock_config.c, initializes clocks
     BOARD_InitDebugConsole();           // defined in board.c, initializes the OpenSDA port
 
+    edma_config_t edmaConfig;
+    DMAMUX_Init(DMAMUX0);                               // sensor bus reads are moved by eDMA (see RTE_Device.h)
+    EDMA_GetDefaultConfig(&edmaConfig);
+    EDMA_Init(DMA0, &edmaConfig);
+    NVIC_SetPriority(DMA0_IRQn, 5);                     // I2C0 eDMA channel, may call FreeRTOS FromISR functions
+    NVIC_SetPriority(DMA1_IRQn, 5);                     // I2C1 eDMA channel
+    NVIC_SetPriority(DMA3_IRQn, 5);                     // SPI0 eDMA receive channel
+    NVIC_SetPriority(DMA6_IRQn, 5);                     // SPI1 eDMA receive channel
+    NVIC_SetPriority(I2C0_IRQn, 5);
+    NVIC_SetPriority(I2C1_IRQn, 5);
+
     ARM_DRIVER_I2C* I2Cdrv1 = &I2C_S_DRIVER;           // defined in the <shield>.h file
     ARM_DRIVER_I2C* I2Cdrv0 = &I2C_BB_DRIVER;          // defined in the frdm_kv31f.h file
 
@@ -120,16 +186,52 @@ int main(void)
     initSensorFusionGlobals(&sfg, &statusSubsystem, &controlSubsystem); // Initialize sensor fusion structures
     // "install" the sensors we will be using
     sfg.installSensor(&sfg, &sensors[0], FXOS8700_I2C_ADDR,              1, (void*) I2Cdrv1, &i2cBusInfo_frdm_fxs_mul2b_shield, FXOS8700_Init,  FXOS8700_Read);
-    //sfg.installSensor(&sfg, &sensors[0], MOTHER_BOARD_FXOS8700_I2C_ADDR, 1, (void*) I2Cdrv0, &i2cBusInfo_frdm_kv31f,            FXOS8700_Init,  FXOS8700_Read);
+    sfg.installSensor(&sfg, &sensors[3], MOTHER_BOARD_FXOS8700_I2C_ADDR, 1, (void*) I2Cdrv0, &i2cBusInfo_frdm_kv31f,            FXOS8700_Init,  FXOS8700_Read);
+    sensors[3].instance = 1;                    // redundant accel/mag, averaged with the shield FXOS8700
+    // The mother-board FXOS8700 is mounted like the shield one: give it the same NED mapping
+    // as the shield HAL (hal_frdm_fxs_mult2_b.c), which only applies to instance 0.
+    // The magnetometer offset is the hard iron difference to the shield part, learned at run time.
+    sfg.AccelSet.Cal[1] = (struct SensorInstanceCal) { .iAxis = { 2,  1,  3}, .fOffset = {0.0F, 0.0F, 0.0F}, .fWeight = 1.0F };
+    sfg.MagSet.Cal[1]   = (struct SensorInstanceCal) { .iAxis = {-2, -1, -3}, .fOffset = {0.0F, 0.0F, 0.0F}, .fWeight = 1.0F };
     sfg.installSensor(&sfg, &sensors[1], FXAS21002_I2C_ADDR,             1, (void*) I2Cdrv1, &i2cBusInfo_frdm_fxs_mul2b_shield, FXAS21002_Init, FXAS21002_Read);
     sfg.installSensor(&sfg, &sensors[2], MPL3115_I2C_ADDR,               2, (void*) I2Cdrv1, &i2cBusInfo_frdm_fxs_mul2b_shield, MPL3115_Init,   MPL3115_Read);
     sfg.initializeFusionEngine(&sfg);	        // This will initialize sensors and magnetic calibration
+    sfg.waitForBus = WaitSensorBus;             // read task sleeps while FIFO data is in flight
+    sfg.signalBus = SignalSensorBus;
+    sfg.signalMagCal = SignalMagCal;            // magnetic calibration runs in magcal_task, not in fusion_task
+#if RATE_GOVERNOR
+    GOVERNOR_Initialization(&sfg, &sensors[0], &sensors[1], &sensors[2], &sensors[3]);
+#endif
+#if SPECTRUM_ANALYSIS
+    SPECTRUM_bInitialize(&spectrum, SPECTRUM_eNorm, ACCEL_ODR_HZ);  // vibration seen in any orientation
+#endif
 
     event_group = xEventGroupCreate();
     event_PIT   = xEventGroupCreate();
-
-    xTaskCreate(read_task, "READ", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, NULL);
+    event_bus_start = xEventGroupCreate();
+    event_bus_done  = xEventGroupCreate();
+
+    sensorBus[0].bus_driver = (void*) I2Cdrv1;
+    sensorBus[0].deviceInstance = I2C_S_DEVICE_INDEX;
+    sensorBus[0].bit = B0;
+    sensorBus[1].bus_driver = (void*) I2Cdrv0;
+    sensorBus[1].deviceInstance = I2C_B_DEVICE_INDEX;
+    sensorBus[1].bit = B1;
+
+    xTaskCreate(read_task, "READ", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 2, &sensorBus[0].task);
+    for (int b = 1; b < NUM_SENSOR_BUS; b++)
+    {
+        if (BusHasSensors(sensorBus[b].bus_driver))
+        {
+            xTaskCreate(bus_task, "BUS", configMINIMAL_STACK_SIZE, &sensorBus[b], tskIDLE_PRIORITY + 2, &sensorBus[b].task);
+            busTaskBits |= sensorBus[b].bit;
+        }
+    }
     xTaskCreate(fusion_task, "FUSION", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1, NULL);
+    xTaskCreate(magcal_task, "MAGCAL", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, &magcal_task_handle);
+#if SPECTRUM_ANALYSIS
+    xTaskCreate(spectrum_task, "SPECTRUM", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY, &spectrum_task_handle);
+#endif
 
 #ifdef COM_TG
     COM_InitializeTask();
@@ -155,8 +257,16 @@ static void read_task(void *pvParameters)
                             pdTRUE,         /* BIT_0 and BIT_4 will be cleared automatically. */
                             pdFALSE,        /* Don't wait for both bits, either bit unblock task. */
                             portMAX_DELAY); /* Block indefinitely to wait for the condition to be met. */
+#if RATE_GOVERNOR
+        GOVERNOR_ApplySensors(&sfg);        // ODR and standby changes of a new profile, buses are still free here
+#endif
         i++;
-        sfg.readSensors(&sfg, i);           // Reads sensors, applies HAL and does averaging (if applicable)
+        read_loop_counter = i;
+        if (busTaskBits)                    // release the other buses, they read while we read ours
+            xEventGroupSetBits(event_bus_start, busTaskBits);
+        sfg.readSensorsOnBus(&sfg, sensorBus[0].bus_driver, i);
+        if (busTaskBits)                    // merge: every bus must be done before the FIFOs are consumed
+            xEventGroupWaitBits(event_bus_done, busTaskBits, pdTRUE, pdTRUE, portMAX_DELAY);
         if(i==OVERSAMPLE_RATE)
         {
             xEventGroupSetBits(event_group, B0);
@@ -165,9 +275,21 @@ static void read_task(void *pvParameters)
     }
 }
 
+static void bus_task(void *pvParameters)
+{
+    SensorBus *bus = (SensorBus *) pvParameters;
+    while (1)
+    {
+        xEventGroupWaitBits(event_bus_start, bus->bit, pdTRUE, pdTRUE, portMAX_DELAY);
+        sfg.readSensorsOnBus(&sfg, bus->bus_driver, read_loop_counter);
+        xEventGroupSetBits(event_bus_done, bus->bit);
+    }
+}
+
 static void fusion_task(void *pvParameters)
 {
     uint16_t i=0;  // general counter variable
+    bool parked = false;
     while (1)
     {
         xEventGroupWaitBits(event_group,    /* The event group handle. */
@@ -177,6 +299,15 @@ static void fusion_task(void *pvParameters)
                             portMAX_DELAY); /* Block indefinitely to wait for the condition to be met. */
 
         sfg.conditionSensorReadings(&sfg);  // magCal is run as part of this
+#if SPECTRUM_ANALYSIS
+        FeedSpectrum();                     // before the FIFOs are cleared by runFusion or clearFIFOs
+#endif
+#if RATE_GOVERNOR
+        parked = GOVERNOR_bUpdate(&sfg);    // selects the profile, retunes fdeltat and the PIT period
+        if (parked)
+            sfg.clearFIFOs(&sfg);           // orientation is frozen while the robot is parked
+        else
+#endif
         sfg.runFusion(&sfg);                // Run the actual fusion algorithms
 
         sfg.loopcounter++;                  // The loop counter is used to "serialize" mag cal operations
@@ -187,10 +318,15 @@ static void fusion_task(void *pvParameters)
             sfg.updateStatus(&sfg);         // This is where pending status updates are made visible
 
 #ifdef COM_TG
+#if LAZY_ORIENTATION
+        // roll, pitch and compass are derived here rather than in the lower priority COM task,
+        // which could otherwise be preempted by the next fusion pass halfway through
+        fUpdateOrientationOutputs((SV_ptr) &sfg.SV_9DOF_GBY_KALMAN, ORIENT_EULER);
+#endif
         COM_WakeUp();                       // wake-up task COM
 #endif
         }
-        sfg.queueStatus(&sfg, NORMAL);      // assume NORMAL status for next pass through the loop
+        sfg.queueStatus(&sfg, parked ? LOWPOWER : NORMAL);  // assume this status for next pass through the loop
 
 
 #ifndef COM_TG
@@ -199,6 +335,42 @@ static void fusion_task(void *pvParameters)
     }
 }
 
+static void magcal_task(void *pvParameters)
+{
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);        // wait for fusion_task to queue a solver
+        fRunMagCalibrationJob(&sfg.MagCalBackground);   // preempted by every other task
+    }
+}
+
+static void SignalMagCal(SensorFusionGlobals *sfg)
+{
+    xTaskNotifyGive(magcal_task_handle);
+}
+
+#if SPECTRUM_ANALYSIS
+static void spectrum_task(void *pvParameters)
+{
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);        // wait for fusion_task to complete a frame
+        // SPECTRUM_FRAMES_PER_RUN frames per notification: a backlog is dropped, not caught up
+        SPECTRUM_bProcess(&spectrum);
+    }
+}
+
+static void FeedSpectrum(void)
+{
+#if RATE_GOVERNOR
+    SPECTRUM_SetSampleRate(&spectrum, GOVERNOR_u16GetAccelODRHz());
+#endif
+    if (sfg.Accel.iFIFOExceeded > 0) SPECTRUM_Gap(&spectrum);    // samples were lost before this burst
+    SPECTRUM_PushCounts(&spectrum, (const int16_t (*)[3]) sfg.Accel.iGsFIFO, sfg.Accel.iFIFOCount, sfg.Accel.fgPerCount);
+    if (SPECTRUM_bFrameReady(&spectrum)) xTaskNotifyGive(spectrum_task_handle);
+}
+#endif
+
 static void WakeUp(void)
 {
     BaseType_t xHigherPriorityTaskWoken, xResult;
@@ -214,6 +386,38 @@ static void WakeUp(void)
     }
 
 }
+
+static void WaitSensorBus(SensorFusionGlobals *sfg, uint8_t deviceInstance)
+{
+    // the fusion task runs while the read task is blocked here
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+
+static void SignalSensorBus(SensorFusionGlobals *sfg, uint8_t deviceInstance)
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    for (int b = 0; b < NUM_SENSOR_BUS; b++)
+    {
+        if (sensorBus[b].deviceInstance == deviceInstance && sensorBus[b].task != NULL)
+        {
+            vTaskNotifyGiveFromISR(sensorBus[b].task, &xHigherPriorityTaskWoken);
+            break;
+        }
+    }
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+static bool BusHasSensors(void *bus_driver)
+{
+    struct PhysicalSensor *pSensor;
+
+    for (pSensor = sfg.pSensors; pSensor != NULL; pSensor = pSensor->next)
+    {
+        if (pSensor->bus_driver == bus_driver && pSensor->isInitialized) return (true);
+    }
+    return (false);
+}
 /// \endcode
 
 
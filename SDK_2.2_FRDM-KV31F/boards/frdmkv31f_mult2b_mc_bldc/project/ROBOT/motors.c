@@ -37,6 +37,8 @@
 /*******************************************************************************
  * Variables
  ******************************************************************************/
+static MOTOR_eMotorsOrders MOTORS_eCommand = MOTOR_eStop;
+static uint16_t MOTORS_u16PWMLevel = 0U;
 
 
 /*******************************************************************************
@@ -188,6 +190,10 @@ void MOTORS_UpdateCommand(MOTOR_eMotorsOrders eMotorCommand, uint16_t u16PWMLeve
 	}
     /* Software trigger to update registers. */
     FTM_SetSoftwareTrigger(BOARD_FTM_BASEADDR, true);
+
+    MOTORS_eCommand = eMotorCommand;
+    MOTORS_u16PWMLevel = (eMotorCommand == MOTOR_eStop) ? 0U :
+                         ((u16PWMLevelLeft > u16PWMLevelRight) ? u16PWMLevelLeft : u16PWMLevelRight);
 }
 
 uint16_t MOTORS_u16GetMaxPWMLevel(void)
@@ -196,3 +202,13 @@ uint16_t MOTORS_u16GetMaxPWMLevel(void)
 	return(u16MaxPWMLevel);
 }
 
+MOTOR_eMotorsOrders MOTORS_eGetCommand(void)
+{
+	return(MOTORS_eCommand);
+}
+
+uint16_t MOTORS_u16GetPWMLevel(void)
+{
+	return(MOTORS_u16PWMLevel);
+}
+
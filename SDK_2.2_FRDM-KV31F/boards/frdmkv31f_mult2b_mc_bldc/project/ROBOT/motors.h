@@ -20,4 +20,10 @@ void MOTORS_UpdateCommand(MOTOR_eMotorsOrders eMotorCommand, uint16_t u16PWMLeve
 
 uint16_t MOTORS_u16GetMaxPWMLevel(void);
 
+/** last command applied by MOTORS_UpdateCommand */
+MOTOR_eMotorsOrders MOTORS_eGetCommand(void);
+
+/** highest of the left and right PWM levels applied by MOTORS_UpdateCommand */
+uint16_t MOTORS_u16GetPWMLevel(void);
+
 #endif /* MOTORS_H_ */
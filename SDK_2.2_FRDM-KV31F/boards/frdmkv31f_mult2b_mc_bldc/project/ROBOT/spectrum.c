@@ -0,0 +1,291 @@
+#include <string.h>
+#include "spectrum.h"
+#include "arm_common_tables.h"
+#include "arm_const_structs.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define SPECTRUM_RING_MASK (SPECTRUM_RING_LEN - 1U)
+#define SPECTRUM_NB_BINS   (SPECTRUM_FFT_LEN / 2U + 1U)   /* DC to Nyquist */
+
+#if (SPECTRUM_RING_LEN & SPECTRUM_RING_MASK) || (SPECTRUM_RING_LEN <= SPECTRUM_FFT_LEN)
+#error "SPECTRUM_RING_LEN must be a power of 2 larger than SPECTRUM_FFT_LEN"
+#endif
+#if SPECTRUM_FFT_LEN != 256U
+#error "SPECTRUM_bInitialize sets up the FFT from the 256 point real FFT tables"
+#endif
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+/* bins of the band within the current sample rate, the averages restart */
+static void SPECTRUM_ApplyBand(SPECTRUM_tsEngine *psEngine)
+{
+    float f32BinHz = SPECTRUM_f32BinHz(psEngine);
+    int32_t s32First = (int32_t) ceilf(psEngine->f32BandLowHz / f32BinHz);
+    int32_t s32Last = (int32_t) floorf(psEngine->f32BandHighHz / f32BinHz);
+
+    if (s32First < 0) s32First = 0;
+    if (s32Last > (int32_t) (SPECTRUM_NB_BINS - 1U)) s32Last = SPECTRUM_NB_BINS - 1U;
+    if (s32Last - s32First + 1 > (int32_t) SPECTRUM_MAX_BAND_BINS) s32Last = s32First + SPECTRUM_MAX_BAND_BINS - 1U;
+
+    psEngine->u16FirstBin = (uint16_t) s32First;
+    psEngine->u16NbBins = (s32Last >= s32First) ? (uint16_t) (s32Last - s32First + 1) : 0U;
+}
+
+static void SPECTRUM_ResetAverages(SPECTRUM_tsEngine *psEngine)
+{
+    psEngine->u32Frames = 0U;
+    memset(psEngine->af32Psd, 0, sizeof(psEngine->af32Psd));
+    memset(psEngine->af32WatchPower, 0, sizeof(psEngine->af32WatchPower));
+}
+
+/* consumer: follow a new epoch of the producer, keep the averages if the sample rate did not change */
+static void SPECTRUM_Restart(SPECTRUM_tsEngine *psEngine)
+{
+    float f32WindowPower;
+
+    psEngine->u16FrameEpoch = psEngine->u16Epoch;
+    psEngine->u32NextFrame = psEngine->u32EpochStart;
+    if (psEngine->f32SampleHz != psEngine->f32FrameHz)
+    {
+        psEngine->f32FrameHz = psEngine->f32SampleHz;
+        arm_power_f32(psEngine->af32Window, SPECTRUM_FFT_LEN, &f32WindowPower);
+        psEngine->f32WindowScale = 1.0F / (psEngine->f32FrameHz * f32WindowPower);
+        SPECTRUM_ApplyBand(psEngine);
+        SPECTRUM_ResetAverages(psEngine);
+    }
+}
+
+/* one-sided PSD (g^2/Hz) of the frame starting at u32Start into af32Frame[0 .. SPECTRUM_NB_BINS - 1],
+ * false if the producer overwrote the frame while it was copied */
+static bool SPECTRUM_bTransform(SPECTRUM_tsEngine *psEngine, uint32_t u32Start)
+{
+    float *pf32Frame = psEngine->af32Frame;
+    float *pf32Fft = psEngine->af32Fft;
+    float f32Mean, f32Nyquist;
+    uint32_t i;
+
+    for (i = 0U; i < SPECTRUM_FFT_LEN; i++)
+    {
+        pf32Frame[i] = psEngine->af32Ring[(u32Start + i) & SPECTRUM_RING_MASK];
+    }
+    /* the producer is about to overwrite sample u32Written - SPECTRUM_RING_LEN */
+    if (psEngine->u32Written - u32Start >= SPECTRUM_RING_LEN) return (false);
+
+    /* gravity and sensor offset would leak into the low bins through the window */
+    arm_mean_f32(pf32Frame, SPECTRUM_FFT_LEN, &f32Mean);
+    arm_offset_f32(pf32Frame, -f32Mean, pf32Frame, SPECTRUM_FFT_LEN);
+    arm_mult_f32(pf32Frame, psEngine->af32Window, pf32Frame, SPECTRUM_FFT_LEN);
+    arm_rfft_fast_f32(&psEngine->sFft, pf32Frame, pf32Fft, 0U);
+
+    /* pf32Fft[1] holds the real Nyquist bin, not the imaginary part of DC */
+    f32Nyquist = pf32Fft[1];
+    pf32Fft[1] = 0.0F;
+    arm_cmplx_mag_squared_f32(pf32Fft, pf32Frame, SPECTRUM_FFT_LEN / 2U);
+    pf32Frame[SPECTRUM_FFT_LEN / 2U] = f32Nyquist * f32Nyquist;
+
+    /* the bins between DC and Nyquist also hold the power of the negative frequencies */
+    arm_scale_f32(pf32Frame, psEngine->f32WindowScale, pf32Frame, SPECTRUM_NB_BINS);
+    arm_scale_f32(&pf32Frame[1], 2.0F, &pf32Frame[1], SPECTRUM_NB_BINS - 2U);
+    return (true);
+}
+
+static void SPECTRUM_Average(SPECTRUM_tsEngine *psEngine)
+{
+    const float *pf32Power = psEngine->af32Frame;
+    float f32BinHz = SPECTRUM_f32BinHz(psEngine);
+    float f32Weight, f32Sum;
+    int32_t s32Lo, s32Hi, k;
+    uint32_t i;
+
+    /* mean of the first SPECTRUM_AVERAGES frames, then exponential average */
+    f32Weight = 1.0F / (float) ((psEngine->u32Frames < SPECTRUM_AVERAGES) ? psEngine->u32Frames + 1U : SPECTRUM_AVERAGES);
+
+    for (i = 0U; i < psEngine->u16NbBins; i++)
+    {
+        psEngine->af32Psd[i] += (pf32Power[psEngine->u16FirstBin + i] - psEngine->af32Psd[i]) * f32Weight;
+    }
+
+    for (i = 0U; i < SPECTRUM_NB_WATCH; i++)
+    {
+        const SPECTRUM_tsWatch *psWatch = &psEngine->asWatch[i];
+
+        if (psWatch->f32HalfWidthHz <= 0.0F) continue;
+        s32Lo = (int32_t) ceilf((psWatch->f32CenterHz - psWatch->f32HalfWidthHz) / f32BinHz);
+        s32Hi = (int32_t) floorf((psWatch->f32CenterHz + psWatch->f32HalfWidthHz) / f32BinHz);
+        if (s32Lo < 0) s32Lo = 0;
+        if (s32Hi > (int32_t) (SPECTRUM_NB_BINS - 1U)) s32Hi = SPECTRUM_NB_BINS - 1U;
+        f32Sum = 0.0F;
+        for (k = s32Lo; k <= s32Hi; k++)
+        {
+            f32Sum += pf32Power[k];
+        }
+        psEngine->af32WatchPower[i] += (f32Sum * f32BinHz - psEngine->af32WatchPower[i]) * f32Weight;
+    }
+
+    psEngine->u32Frames = psEngine->u32Frames + 1U;
+}
+
+bool SPECTRUM_bInitialize(SPECTRUM_tsEngine *psEngine, SPECTRUM_eChannels eChannel, float f32SampleHz)
+{
+    uint32_t i;
+
+    memset(psEngine, 0, sizeof(*psEngine));
+    /* the 128 point complex FFT and the 256 point real stage tables only: arm_rfft_fast_init_f32
+       selects its tables at run time and so would link those of every length */
+    psEngine->sFft.Sint = arm_cfft_sR_f32_len128;
+    psEngine->sFft.fftLenRFFT = SPECTRUM_FFT_LEN;
+    psEngine->sFft.pTwiddleRFFT = (float32_t *) twiddleCoef_rfft_256;
+
+    /* periodic Hann window: the frames overlapping by half sum to a constant */
+    for (i = 0U; i < SPECTRUM_FFT_LEN; i++)
+    {
+        psEngine->af32Window[i] = 0.5F - 0.5F * arm_cos_f32(2.0F * PI * (float) i / (float) SPECTRUM_FFT_LEN);
+    }
+
+    psEngine->eChannel = eChannel;
+    psEngine->f32SampleHz = f32SampleHz;
+    psEngine->f32BandLowHz = 0.0F;
+    psEngine->f32BandHighHz = 0.5F * f32SampleHz;
+    /* the first SPECTRUM_bProcess starts the averages at the sample rate */
+    psEngine->u16FrameEpoch = psEngine->u16Epoch - 1U;
+    return (true);
+}
+
+void SPECTRUM_SetSampleRate(SPECTRUM_tsEngine *psEngine, float f32SampleHz)
+{
+    if (f32SampleHz == psEngine->f32SampleHz) return;
+
+    psEngine->f32SampleHz = f32SampleHz;
+    SPECTRUM_Gap(psEngine);
+}
+
+void SPECTRUM_Gap(SPECTRUM_tsEngine *psEngine)
+{
+    /* the consumer reads u16Epoch first, a late increment only restarts it once more */
+    psEngine->u32EpochStart = psEngine->u32Written;
+    psEngine->u16Epoch = psEngine->u16Epoch + 1U;
+}
+
+static void SPECTRUM_PushSample(SPECTRUM_tsEngine *psEngine, float f32X, float f32Y, float f32Z)
+{
+    float f32Value;
+    uint32_t u32Written = psEngine->u32Written;
+
+    switch (psEngine->eChannel)
+    {
+    case SPECTRUM_eAxisX:
+        f32Value = f32X;
+        break;
+    case SPECTRUM_eAxisY:
+        f32Value = f32Y;
+        break;
+    case SPECTRUM_eAxisZ:
+        f32Value = f32Z;
+        break;
+    default:
+        arm_sqrt_f32(f32X * f32X + f32Y * f32Y + f32Z * f32Z, &f32Value);
+        break;
+    }
+    psEngine->af32Ring[u32Written & SPECTRUM_RING_MASK] = f32Value;
+    /* published sample by sample, see SPECTRUM_bTransform */
+    psEngine->u32Written = u32Written + 1U;
+}
+
+void SPECTRUM_PushCounts(SPECTRUM_tsEngine *psEngine, const int16_t ai16FIFO[][3], uint32_t u32Count, float f32gPerCount)
+{
+    uint32_t i;
+
+    for (i = 0U; i < u32Count; i++)
+    {
+        SPECTRUM_PushSample(psEngine, (float) ai16FIFO[i][0] * f32gPerCount, (float) ai16FIFO[i][1] * f32gPerCount,
+                            (float) ai16FIFO[i][2] * f32gPerCount);
+    }
+}
+
+void SPECTRUM_PushG(SPECTRUM_tsEngine *psEngine, const float af32G[][3], uint32_t u32Count)
+{
+    uint32_t i;
+
+    for (i = 0U; i < u32Count; i++)
+    {
+        SPECTRUM_PushSample(psEngine, af32G[i][0], af32G[i][1], af32G[i][2]);
+    }
+}
+
+bool SPECTRUM_bFrameReady(const SPECTRUM_tsEngine *psEngine)
+{
+    /* a new epoch always has its first frame at u32EpochStart */
+    uint32_t u32Next = (psEngine->u16FrameEpoch == psEngine->u16Epoch) ? psEngine->u32NextFrame : psEngine->u32EpochStart;
+
+    return ((psEngine->u32Written - u32Next) >= SPECTRUM_FFT_LEN);
+}
+
+bool SPECTRUM_bProcess(SPECTRUM_tsEngine *psEngine)
+{
+    uint32_t u32Run = 0U;
+    uint32_t u32Backlog, u32Skip;
+
+    if (psEngine->u16FrameEpoch != psEngine->u16Epoch) SPECTRUM_Restart(psEngine);
+    if (psEngine->bBandPending || psEngine->bWatchPending)
+    {
+        psEngine->bBandPending = false;
+        if (psEngine->bWatchPending)
+        {
+            psEngine->bWatchPending = false;
+            memcpy(psEngine->asWatch, psEngine->asWatchRequest, sizeof(psEngine->asWatch));
+        }
+        SPECTRUM_ApplyBand(psEngine);
+        SPECTRUM_ResetAverages(psEngine);
+    }
+
+    while (u32Run < SPECTRUM_FRAMES_PER_RUN)
+    {
+        if (psEngine->u16FrameEpoch != psEngine->u16Epoch) SPECTRUM_Restart(psEngine);
+
+        u32Backlog = psEngine->u32Written - psEngine->u32NextFrame;
+        if (u32Backlog < SPECTRUM_FFT_LEN) return (false);
+
+        /* too late for the oldest frames: continue with the most recent one */
+        if (u32Backlog >= SPECTRUM_RING_LEN)
+        {
+            u32Skip = (u32Backlog - SPECTRUM_FFT_LEN) / SPECTRUM_HOP;
+            psEngine->u32Dropped = psEngine->u32Dropped + u32Skip;
+            psEngine->u32NextFrame += u32Skip * SPECTRUM_HOP;
+        }
+
+        if (SPECTRUM_bTransform(psEngine, psEngine->u32NextFrame))
+        {
+            SPECTRUM_Average(psEngine);
+        }
+        else
+        {
+            psEngine->u32Dropped = psEngine->u32Dropped + 1U;
+        }
+        psEngine->u32NextFrame += SPECTRUM_HOP;
+        u32Run++;
+    }
+    return (SPECTRUM_bFrameReady(psEngine));
+}
+
+void SPECTRUM_SetBand(SPECTRUM_tsEngine *psEngine, float f32LowHz, float f32HighHz)
+{
+    psEngine->f32BandLowHz = f32LowHz;
+    psEngine->f32BandHighHz = f32HighHz;
+    psEngine->bBandPending = true;
+}
+
+void SPECTRUM_SetWatch(SPECTRUM_tsEngine *psEngine, uint8_t u8Index, float f32CenterHz, float f32HalfWidthHz)
+{
+    if (u8Index >= SPECTRUM_NB_WATCH) return;
+    psEngine->asWatchRequest[u8Index].f32CenterHz = f32CenterHz;
+    psEngine->asWatchRequest[u8Index].f32HalfWidthHz = f32HalfWidthHz;
+    psEngine->bWatchPending = true;
+}
+
+float SPECTRUM_f32BinHz(const SPECTRUM_tsEngine *psEngine)
+{
+    return (psEngine->f32FrameHz / (float) SPECTRUM_FFT_LEN);
+}
@@ -0,0 +1,113 @@
+#ifndef SPECTRUM_H_
+#define SPECTRUM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "arm_math.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/** samples per STFT frame, a length supported by arm_rfft_fast_f32 */
+#define SPECTRUM_FFT_LEN 256U
+/** samples between the starts of two frames: 50 % overlap with the Hann window */
+#define SPECTRUM_HOP (SPECTRUM_FFT_LEN / 2U)
+/** samples kept for the background task, a power of 2 larger than SPECTRUM_FFT_LEN */
+#define SPECTRUM_RING_LEN 512U
+/** most bins of the averaged band PSD */
+#define SPECTRUM_MAX_BAND_BINS 64U
+/** watched frequencies (motor fault and wheel slip lines) */
+#define SPECTRUM_NB_WATCH 5U
+/** CPU budget: most frames transformed per call of SPECTRUM_bProcess */
+#define SPECTRUM_FRAMES_PER_RUN 1U
+/** frames in the average: linear over the first ones, then exponential with this time constant */
+#define SPECTRUM_AVERAGES 16U
+
+/*! @brief accelerometer signal analyzed */
+typedef enum
+{
+    SPECTRUM_eAxisX = 0U,   /*!< sensor X axis */
+    SPECTRUM_eAxisY,        /*!< sensor Y axis */
+    SPECTRUM_eAxisZ,        /*!< sensor Z axis */
+    SPECTRUM_eNorm          /*!< norm of the acceleration, independent of the orientation */
+} SPECTRUM_eChannels;
+
+/*! @brief a watched frequency, disabled while f32HalfWidthHz is 0 */
+typedef struct
+{
+    float f32CenterHz;      /* center of the line */
+    float f32HalfWidthHz;   /* the bins within f32CenterHz +/- f32HalfWidthHz are summed */
+} SPECTRUM_tsWatch;
+
+/*! @brief STFT engine: written by one producer (SPECTRUM_Push*), read by one consumer (SPECTRUM_bProcess) */
+typedef struct
+{
+    /* producer side */
+    float af32Ring[SPECTRUM_RING_LEN];                  /* latest samples (g), oldest overwritten */
+    volatile uint32_t u32Written;                       /* samples written since the start, wraps */
+    volatile uint32_t u32EpochStart;                    /* u32Written when the sample rate last changed */
+    volatile uint16_t u16Epoch;                         /* incremented on every sample rate change or gap */
+    volatile float f32SampleHz;                         /* sample rate of the samples from u32EpochStart */
+    SPECTRUM_eChannels eChannel;
+
+    /* requests from other tasks, applied by the consumer before the next frame */
+    volatile bool bBandPending;
+    volatile bool bWatchPending;
+    float f32BandLowHz;
+    float f32BandHighHz;
+    SPECTRUM_tsWatch asWatchRequest[SPECTRUM_NB_WATCH];
+
+    /* consumer side */
+    uint16_t u16FrameEpoch;                             /* u16Epoch of the frames being processed */
+    uint32_t u32NextFrame;                              /* u32Written of the first sample of the next frame */
+    float f32FrameHz;                                   /* sample rate of the averages */
+    float f32WindowScale;                               /* 1 / (sample rate * sum of the squared window) */
+    float af32Window[SPECTRUM_FFT_LEN];                 /* Hann window */
+    float af32Frame[SPECTRUM_FFT_LEN];                  /* windowed frame, then its power per bin */
+    float af32Fft[SPECTRUM_FFT_LEN];                    /* arm_rfft_fast_f32 output */
+    arm_rfft_fast_instance_f32 sFft;
+    SPECTRUM_tsWatch asWatch[SPECTRUM_NB_WATCH];
+
+    /* averaged results, read by the exporter without locking: a reader may mix two frames */
+    volatile uint32_t u32Frames;                        /* frames averaged since the last reset */
+    volatile uint32_t u32Dropped;                       /* frames overwritten before they were processed */
+    uint16_t u16FirstBin;                               /* FFT bin of af32Psd[0] */
+    uint16_t u16NbBins;                                 /* bins in af32Psd */
+    float af32Psd[SPECTRUM_MAX_BAND_BINS];              /* one-sided PSD of the band (g^2/Hz) */
+    float af32WatchPower[SPECTRUM_NB_WATCH];            /* mean square acceleration of each watched line (g^2) */
+} SPECTRUM_tsEngine;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+/** init the engine for a sample rate, the band covers 0 Hz to Nyquist within SPECTRUM_MAX_BAND_BINS */
+bool SPECTRUM_bInitialize(SPECTRUM_tsEngine *psEngine, SPECTRUM_eChannels eChannel, float f32SampleHz);
+
+/** producer: sample rate of the next samples, a change restarts the averages */
+void SPECTRUM_SetSampleRate(SPECTRUM_tsEngine *psEngine, float f32SampleHz);
+
+/** producer: samples were lost, the next frame starts with the next sample */
+void SPECTRUM_Gap(SPECTRUM_tsEngine *psEngine);
+
+/** producer: append a FIFO burst in counts, as read into AccelSensor.iGsFIFO */
+void SPECTRUM_PushCounts(SPECTRUM_tsEngine *psEngine, const int16_t ai16FIFO[][3], uint32_t u32Count, float f32gPerCount);
+
+/** producer: append samples in g */
+void SPECTRUM_PushG(SPECTRUM_tsEngine *psEngine, const float af32G[][3], uint32_t u32Count);
+
+/** true when a full frame waits for SPECTRUM_bProcess */
+bool SPECTRUM_bFrameReady(const SPECTRUM_tsEngine *psEngine);
+
+/** consumer: transform and average up to SPECTRUM_FRAMES_PER_RUN frames, true if more are waiting */
+bool SPECTRUM_bProcess(SPECTRUM_tsEngine *psEngine);
+
+/** any task: band of the averaged PSD, applied before the next frame */
+void SPECTRUM_SetBand(SPECTRUM_tsEngine *psEngine, float f32LowHz, float f32HighHz);
+
+/** any task: watched line u8Index, a zero half width disables it, applied before the next frame */
+void SPECTRUM_SetWatch(SPECTRUM_tsEngine *psEngine, uint8_t u8Index, float f32CenterHz, float f32HalfWidthHz);
+
+/** width of one FFT bin (Hz) of the averages */
+float SPECTRUM_f32BinHz(const SPECTRUM_tsEngine *psEngine);
+
+#endif /* SPECTRUM_H_ */
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2015 - 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2017 NXP
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * o Redistributions of source code must retain the above copyright notice, this list
+ *   of conditions and the following disclaimer.
+ *
+ * o Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * o Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*! \file eigen10_replay.c
+    \brief Host benchmark of the 10 element magnetic calibration eigensolvers
+
+    Builds the 10x10 measurement matrix of the 10 element magnetic calibration
+    from synthetic magnetic buffers (random hard and soft iron and noise) and
+    compares the full Jacobi decomposition fEigenCompute10 with the inverse
+    iteration fEigenSmallest10, both in one shot and slice by slice as
+    fUpdateMagCalibration10Slice runs them.  Accuracy is measured against a
+    double precision Jacobi decomposition of the same matrix.
+
+    Built as the eigen10_replay target of CMakeLists.txt in this directory:
+
+    cmake -S . -B build && cmake --build build --target eigen10_replay
+
+    An optional argument sets the number of matrices (default 2000).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sensor_fusion.h"
+
+#define NMEASUREMENTS MAXMEASUREMENTS  ///< measurements in each synthetic buffer
+#define COUNTS_PER_UT 10               ///< FXOS8700 magnetometer sensitivity
+
+// simple deterministic generator so that every run uses the same matrices
+static uint32_t iSeed = 12345;
+static float fRandom(void)
+{
+    iSeed = iSeed * 1664525U + 1013904223U;
+    return ((float) (iSeed >> 8) / 16777216.0F - 0.5F);
+}
+
+// fill the on and below diagonal 10x10 measurement matrix as fComputeMagCalibration10 does
+static void fSyntheticMatrix(float fmatA[10][10], float fnoisecounts)
+{
+    float   fW[3][3];   // soft iron matrix
+    float   fV[3];      // hard iron offset (counts)
+    float   fu[3];      // random unit vector
+    float   fB[3];      // measurement (counts)
+    float   fvec[10];   // measurement vector
+    float   fOffset[3]; // first measurement used as the offset
+    float   fscaling = 1.0F / (COUNTS_PER_UT * DEFAULTB);
+    float   fnorm;
+    int32_t i, j, m, n;
+
+    for (i = 0; i < 3; i++)
+    {
+        for (j = 0; j < 3; j++)
+            fW[i][j] = ((i == j) ? 1.0F : 0.0F) + 0.2F * fRandom();
+        fV[i] = 1000.0F * fRandom();
+    }
+
+    for (m = 0; m < 10; m++)
+        for (n = 0; n < 10; n++)
+            fmatA[m][n] = 0.0F;
+
+    for (i = 0; i < NMEASUREMENTS; i++)
+    {
+        do
+        {
+            fnorm = 0.0F;
+            for (j = 0; j < 3; j++)
+            {
+                fu[j] = 2.0F * fRandom();
+                fnorm += fu[j] * fu[j];
+            }
+        } while ((fnorm > 1.0F) || (fnorm < 0.01F));
+        fnorm = 1.0F / sqrtf(fnorm);
+
+        for (j = 0; j < 3; j++)
+        {
+            fB[j] = fV[j] + fnoisecounts * fRandom();
+            for (m = 0; m < 3; m++)
+                fB[j] += fW[j][m] * fu[m] * fnorm * DEFAULTB * COUNTS_PER_UT;
+            fB[j] = floorf(fB[j]);
+            if (i == 0) fOffset[j] = fB[j];
+            fvec[j + 6] = (fB[j] - fOffset[j]) * fscaling;
+        }
+        fvec[0] = fvec[6] * fvec[6];
+        fvec[1] = 2.0F * fvec[6] * fvec[7];
+        fvec[2] = 2.0F * fvec[6] * fvec[8];
+        fvec[3] = fvec[7] * fvec[7];
+        fvec[4] = 2.0F * fvec[7] * fvec[8];
+        fvec[5] = fvec[8] * fvec[8];
+        fvec[9] = 1.0F;
+
+        for (m = 0; m < 10; m++)
+            for (n = 0; n <= m; n++)
+                fmatA[m][n] += fvec[m] * fvec[n];
+    }
+
+    for (m = 0; m < 10; m++)
+        for (n = m + 1; n < 10; n++)
+            fmatA[m][n] = fmatA[n][m];
+}
+
+// double precision cyclic Jacobi reference returning the smallest eigenpair and the largest eigenvalue
+static double fReferenceSmallest(float fmatA[10][10], double dvec[10], double *pdmax)
+{
+    double  A[10][10], V[10][10];
+    double  theta, t, c, s, ftmp;
+    int32_t i, j, k, isweep, imin, imax;
+
+    for (i = 0; i < 10; i++)
+        for (j = 0; j < 10; j++)
+        {
+            A[i][j] = fmatA[i][j];
+            V[i][j] = (i == j) ? 1.0 : 0.0;
+        }
+
+    for (isweep = 0; isweep < 50; isweep++)
+    {
+        for (i = 0; i < 9; i++)
+            for (j = i + 1; j < 10; j++)
+            {
+                if (A[i][j] == 0.0) continue;
+                theta = 0.5 * (A[j][j] - A[i][i]) / A[i][j];
+                t = 1.0 / (fabs(theta) + sqrt(1.0 + theta * theta));
+                if (theta < 0.0) t = -t;
+                c = 1.0 / sqrt(1.0 + t * t);
+                s = t * c;
+                for (k = 0; k < 10; k++)
+                {
+                    ftmp = A[k][i];
+                    A[k][i] = c * ftmp - s * A[k][j];
+                    A[k][j] = s * ftmp + c * A[k][j];
+                }
+                for (k = 0; k < 10; k++)
+                {
+                    ftmp = A[i][k];
+                    A[i][k] = c * ftmp - s * A[j][k];
+                    A[j][k] = s * ftmp + c * A[j][k];
+                }
+                for (k = 0; k < 10; k++)
+                {
+                    ftmp = V[k][i];
+                    V[k][i] = c * ftmp - s * V[k][j];
+                    V[k][j] = s * ftmp + c * V[k][j];
+                }
+            }
+    }
+
+    imin = imax = 0;
+    for (i = 1; i < 10; i++)
+    {
+        if (A[i][i] < A[imin][imin]) imin = i;
+        if (A[i][i] > A[imax][imax]) imax = i;
+    }
+    for (i = 0; i < 10; i++)
+        dvec[i] = V[i][imin];
+    *pdmax = A[imax][imax];
+
+    return (A[imin][imin]);
+}
+
+// sine of the angle between a float eigenvector in column icol of fmatB and the reference
+static double fVectorError(float fmatB[10][10], int32_t icol, const double dvec[10])
+{
+    double  fdot = 0.0, fnorm = 0.0;
+    int32_t i;
+
+    for (i = 0; i < 10; i++)
+    {
+        fdot += fmatB[i][icol] * dvec[i];
+        fnorm += (double) fmatB[i][icol] * fmatB[i][icol];
+    }
+    fdot = fabs(fdot) / sqrt(fnorm);
+
+    return (sqrt(fabs(1.0 - fdot * fdot)));
+}
+
+static double fElapsedns(const struct timespec *pStart, const struct timespec *pEnd)
+{
+    return ((pEnd->tv_sec - pStart->tv_sec) * 1e9 + (pEnd->tv_nsec - pStart->tv_nsec));
+}
+
+int main(int argc, char *argv[])
+{
+    static float fmatSource[10][10], fmatA[10][10], fmatB[10][10];
+    float   fvecA[10];
+    double  dvec[10], deigval, deigmax;
+    double  fjacobins = 0.0, finversens = 0.0, ffactorns = 0.0, fiteratens = 0.0;
+    double  fjacobierr = 0.0, finverseerr = 0.0, fjacobilambda = 0.0, finverselambda = 0.0;
+    int32_t iMatrices = (argc > 1) ? atoi(argv[1]) : 2000;
+    int32_t iSlices, iMaxSlices = 0, iTotalSlices = 0;
+    int32_t t, i, imin;
+    struct timespec start, end;
+
+    for (t = 0; t < iMatrices; t++)
+    {
+        // alternate between a clean buffer and one with 2uT of noise
+        fSyntheticMatrix(fmatSource, (t & 1) ? 20.0F : 2.0F);
+        deigval = fReferenceSmallest(fmatSource, dvec, &deigmax);
+
+        // full Jacobi decomposition as used by fComputeMagCalibration10
+        memcpy(fmatA, fmatSource, sizeof(fmatA));
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        fEigenCompute10(fmatA, fvecA, fmatB, 10);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        fjacobins += fElapsedns(&start, &end);
+        imin = 0;
+        for (i = 1; i < 10; i++)
+            if (fvecA[i] < fvecA[imin]) imin = i;
+        if (fVectorError(fmatB, imin, dvec) > fjacobierr) fjacobierr = fVectorError(fmatB, imin, dvec);
+        if (fabs(fvecA[imin] - deigval) / deigmax > fjacobilambda) fjacobilambda = fabs(fvecA[imin] - deigval) / deigmax;
+
+        // inverse iteration in one shot
+        memcpy(fmatA, fmatSource, sizeof(fmatA));
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        fEigenSmallest10(fmatA, fvecA, fmatB, 10);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        finversens += fElapsedns(&start, &end);
+        if (fVectorError(fmatB, 0, dvec) > finverseerr) finverseerr = fVectorError(fmatB, 0, dvec);
+        if (fabs(fvecA[0] - deigval) / deigmax > finverselambda) finverselambda = fabs(fvecA[0] - deigval) / deigmax;
+
+        // inverse iteration slice by slice with the same limit of 44 iterations as fUpdateMagCalibration10Slice
+        memcpy(fmatA, fmatSource, sizeof(fmatA));
+        iSlices = 0;
+        do
+        {
+            clock_gettime(CLOCK_MONOTONIC, &start);
+            i = fComputeEigSmallestSlice(fmatA, fmatB, fvecA, (int8) iSlices, 10);
+            clock_gettime(CLOCK_MONOTONIC, &end);
+            if (iSlices == 0)
+                ffactorns += fElapsedns(&start, &end);
+            else
+                fiteratens += fElapsedns(&start, &end);
+            iSlices++;
+        } while (!i && (iSlices <= 44));
+        iTotalSlices += iSlices;
+        if (iSlices > iMaxSlices) iMaxSlices = iSlices;
+    }
+
+    printf("%ld measurement matrices of %d measurements\n", (long) iMatrices, NMEASUREMENTS);
+    printf("worst eigenvector error is the sine of the angle to the reference, eigenvalue error is relative to the largest eigenvalue\n");
+    printf("fEigenCompute10:  mean %.0f ns, eigenvector error %.2e, eigenvalue error %.2e\n",
+           fjacobins / iMatrices, fjacobierr, fjacobilambda);
+    printf("fEigenSmallest10: mean %.0f ns, eigenvector error %.2e, eigenvalue error %.2e\n",
+           finversens / iMatrices, finverseerr, finverselambda);
+    printf("sliced inverse iteration: mean %.1f slices, max %ld slices, factorization %.0f ns, iteration %.0f ns\n",
+           (double) iTotalSlices / iMatrices, (long) iMaxSlices, ffactorns / iMatrices,
+           fiteratens / (iTotalSlices - iMatrices));
+
+    return (0);
+}
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2015 - 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2017 NXP
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * o Redistributions of source code must retain the above copyright notice, this list
+ *   of conditions and the following disclaimer.
+ *
+ * o Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * o Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*! \file fastmath_bench.c
+    \brief Host accuracy and throughput benchmark for the fast-math kernels
+
+    Sweeps every kernel of fastmath.c over its full input domain against the
+    double precision C library, printing the maximum absolute (or relative for
+    the reciprocal square roots) error, then times each kernel against the
+    single precision C library and the approximations.c functions it replaces.
+    Q15 kernels of one argument are tested exhaustively, Q15 atan2 on every
+    4th value of each argument, and the Q31 and float kernels on dense strided
+    sweeps.  Host timings only rank the kernels; the target speedup depends on
+    the VSQRT / VDIV latency of the Cortex-M4F.  Built as the fastmath_bench
+    target of CMakeLists.txt in this directory:
+
+    cmake -S . -B build && cmake --build build --target fastmath_bench
+*/
+
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include "fastmath.h"
+#include "approximations.h"
+
+#define NTIMED 4000000          // calls per throughput measurement
+
+static double dmaxerr;          // largest error of the current sweep
+static double dworstarg;        // argument of the largest error
+
+static void resetErr(void)
+{
+    dmaxerr = 0.0;
+    dworstarg = 0.0;
+}
+
+static void noteErr(double derr, double darg)
+{
+    derr = fabs(derr);
+    if (derr > dmaxerr)
+    {
+        dmaxerr = derr;
+        dworstarg = darg;
+    }
+}
+
+static void report(const char *name, const char *units)
+{
+    printf("  %-22s max error %10.3e %-6s at %.9g\n", name, dmaxerr, units, dworstarg);
+}
+
+// wrap an angle error onto -pi to pi so +pi and -pi compare equal
+static double angleDiff(double da, double db)
+{
+    double d = da - db;
+
+    while (d > M_PI) d -= 2.0 * M_PI;
+    while (d < -M_PI) d += 2.0 * M_PI;
+    return d;
+}
+
+static void accuracyFloat(void)
+{
+    int32_t i, j;
+    float fs, fc, fx, fy;
+    double dx;
+
+    printf("float kernels\n");
+
+    // sin and cos over -100 to 100 rad
+    resetErr();
+    for (i = -10000000; i <= 10000000; i++)
+    {
+        fx = (float) i * 1.0E-5F;
+        ffastsincos(fx, &fs, &fc);
+        noteErr(fs - sin(fx), fx);
+        noteErr(fc - cos(fx), fx);
+    }
+    report("ffastsincos", "");
+
+    // atan2 around the circle at radii from 1E-30 to 1E30
+    resetErr();
+    for (j = -30; j <= 30; j += 3)
+    {
+        for (i = 0; i < 1000000; i++)
+        {
+            dx = -M_PI + 2.0 * M_PI * i / 1000000.0;
+            fx = (float) (pow(10.0, j) * cos(dx));
+            fy = (float) (pow(10.0, j) * sin(dx));
+            noteErr(angleDiff(ffastatan2(fy, fx), atan2(fy, fx)), dx);
+        }
+    }
+    report("ffastatan2", "rad");
+
+    // asin and acos over -1 to 1 and on every float in the last 1E-3 before +-1
+    resetErr();
+    for (i = -1000000; i <= 1000000; i++)
+    {
+        fx = (float) i * 1.0E-6F;
+        noteErr(ffastasin(fx) - asin(fx), fx);
+        noteErr(ffastacos(fx) - acos(fx), fx);
+    }
+    for (fx = 0.999F; fx <= 1.0F; fx = nextafterf(fx, 2.0F))
+    {
+        noteErr(ffastasin(fx) - asin(fx), fx);
+        noteErr(ffastasin(-fx) - asin(-fx), -fx);
+        noteErr(ffastacos(fx) - acos(fx), fx);
+        noteErr(ffastacos(-fx) - acos(-fx), -fx);
+    }
+    report("ffastasin / ffastacos", "rad");
+
+    // degree wrappers
+    resetErr();
+    for (i = -1000000; i <= 1000000; i++)
+    {
+        fx = (float) i * 1.0E-6F;
+        noteErr(ffastasin_deg(fx) - asin(fx) * 180.0 / M_PI, fx);
+        noteErr(ffastacos_deg(fx) - acos(fx) * 180.0 / M_PI, fx);
+        noteErr(ffastatan_deg(fx * 1000.0F) - atan(fx * 1000.0F) * 180.0 / M_PI, fx * 1000.0F);
+    }
+    report("degree wrappers", "deg");
+
+    // reciprocal square root on every 61st positive normal float
+    resetErr();
+    {
+        union { float f; uint32_t i; } u;
+        uint32_t ui;
+
+        for (ui = 0x00800000U; ui < 0x7F800000U; ui += 61U)
+        {
+            u.i = ui;
+            noteErr((ffastrsqrt(u.f) - 1.0 / sqrt(u.f)) * sqrt(u.f), u.f);
+        }
+    }
+    report("ffastrsqrt", "rel");
+}
+
+static void accuracyFixed(void)
+{
+    int32_t i, j;
+    int64_t k;
+    int8_t ishift;
+    double dref, dx, dy;
+
+    printf("Q31 kernels (LSB = 4.66e-10)\n");
+
+    // sin and cos on every 257th angle
+    resetErr();
+    for (k = -2147483648LL; k <= 2147483647LL; k += 257)
+    {
+        dx = (double) k / 2147483648.0 * M_PI;
+        noteErr(ifastsin_q31((int32_t) k) / 2147483648.0 - sin(dx), k);
+        noteErr(ifastcos_q31((int32_t) k) / 2147483648.0 - cos(dx), k);
+    }
+    report("ifastsin/cos_q31", "");
+
+    // atan2 around the circle at radii from full scale down to 2^-24
+    resetErr();
+    for (j = 0; j <= 24; j += 4)
+    {
+        for (i = 0; i < 400000; i++)
+        {
+            dx = -M_PI + 2.0 * M_PI * i / 400000.0;
+            dy = ldexp(2147483647.0, -j);
+            dref = atan2(floor(dy * sin(dx)), floor(dy * cos(dx)));
+            noteErr(angleDiff(ifastatan2_q31((int32_t) floor(dy * sin(dx)), (int32_t) floor(dy * cos(dx))) *
+                              M_PI / 2147483648.0, dref), dx);
+        }
+    }
+    report("ifastatan2_q31", "rad");
+
+    // asin on every 257th argument, reported separately inside and beyond |x| = 0.999
+    resetErr();
+    for (k = -2147483648LL; k <= 2147483647LL; k += 257)
+    {
+        dx = (double) k / 2147483648.0;
+        if (fabs(dx) <= 0.999) noteErr(ifastasin_q31((int32_t) k) * M_PI / 2147483648.0 - asin(dx), dx);
+    }
+    report("ifastasin_q31 |x|<=.999", "rad");
+    resetErr();
+    for (k = -2147483648LL; k <= 2147483647LL; k += 257)
+    {
+        dx = (double) k / 2147483648.0;
+        noteErr(ifastasin_q31((int32_t) k) * M_PI / 2147483648.0 - asin(dx), dx);
+    }
+    report("ifastasin_q31", "rad");
+
+    // reciprocal square root on every 127th positive argument
+    resetErr();
+    for (k = 1; k <= 2147483647LL; k += 127)
+    {
+        dx = (double) k / 2147483648.0;
+        dref = ifastrsqrt_q31((int32_t) k, &ishift) / 2147483648.0 * ldexp(1.0, ishift);
+        noteErr((dref - 1.0 / sqrt(dx)) * sqrt(dx), dx);
+    }
+    report("ifastrsqrt_q31", "rel");
+
+    printf("Q15 kernels (LSB = 3.05e-5)\n");
+
+    resetErr();
+    for (i = -32768; i <= 32767; i++)
+    {
+        dx = i / 32768.0 * M_PI;
+        noteErr(ifastsin_q15((int16_t) i) / 32768.0 - sin(dx), i);
+        noteErr(ifastcos_q15((int16_t) i) / 32768.0 - cos(dx), i);
+    }
+    report("ifastsin/cos_q15", "");
+
+    resetErr();
+    for (i = -32768; i <= 32767; i += 4)
+    {
+        for (j = -32768; j <= 32767; j += 4)
+        {
+            if (i == 0 && j == 0) continue;
+            noteErr(angleDiff(ifastatan2_q15((int16_t) i, (int16_t) j) * M_PI / 32768.0, atan2(i, j)), atan2(i, j));
+        }
+    }
+    report("ifastatan2_q15", "rad");
+
+    resetErr();
+    for (i = -32768; i <= 32767; i++)
+        noteErr(ifastasin_q15((int16_t) i) * M_PI / 32768.0 - asin(i / 32768.0), i / 32768.0);
+    report("ifastasin_q15", "rad");
+
+    resetErr();
+    for (i = 1; i <= 32767; i++)
+    {
+        dx = i / 32768.0;
+        dref = ifastrsqrt_q15((int16_t) i, &ishift) / 32768.0 * ldexp(1.0, ishift);
+        noteErr((dref - 1.0 / sqrt(dx)) * sqrt(dx), dx);
+    }
+    report("ifastrsqrt_q15", "rel");
+}
+
+// throughput: the sink keeps the calls from being optimized away
+static volatile float fsink;
+static volatile int32_t isink;
+static float fargs[1024];
+static int32_t iargs[1024];
+
+static double nsPerCall(clock_t t0)
+{
+    return (double) (clock() - t0) / CLOCKS_PER_SEC * 1.0E9 / NTIMED;
+}
+
+#define TIME_FLOAT(label, expr)                                         \
+    do                                                                  \
+    {                                                                   \
+        clock_t t0 = clock();                                           \
+        float facc = 0.0F;                                              \
+        for (i = 0; i < NTIMED; i++)                                    \
+        {                                                               \
+            float x = fargs[i & 1023], y = fargs[(i + 7) & 1023];       \
+            (void) y;                                                   \
+            facc += (expr);                                             \
+        }                                                               \
+        fsink = facc;                                                   \
+        printf("  %-26s %7.2f ns\n", label, nsPerCall(t0));            \
+    } while (0)
+
+#define TIME_FIXED(label, expr)                                         \
+    do                                                                  \
+    {                                                                   \
+        clock_t t0 = clock();                                           \
+        int32_t iacc = 0;                                               \
+        for (i = 0; i < NTIMED; i++)                                    \
+        {                                                               \
+            int32_t x = iargs[i & 1023], y = iargs[(i + 7) & 1023];     \
+            (void) y;                                                   \
+            iacc += (expr);                                             \
+        }                                                               \
+        isink = iacc;                                                   \
+        printf("  %-26s %7.2f ns\n", label, nsPerCall(t0));            \
+    } while (0)
+
+static void throughput(void)
+{
+    int32_t i;
+    int8_t ishift;
+
+    for (i = 0; i < 1024; i++)
+    {
+        fargs[i] = (float) (((i * 7919) % 2001) - 1000) / 1000.0F;
+        iargs[i] = (int32_t) ((uint32_t) i * 2654435761U);
+    }
+
+    printf("throughput (host, arguments in -1 to 1 or full scale)\n");
+    TIME_FLOAT("sinf", sinf(3.0F * x));
+    TIME_FLOAT("ffastsin", ffastsin(3.0F * x));
+    TIME_FLOAT("acosf", acosf(x));
+    TIME_FLOAT("ffastacos", ffastacos(x));
+    TIME_FLOAT("atan2f", atan2f(y, x));
+    TIME_FLOAT("fatan2_deg", fatan2_deg(y, x));
+    TIME_FLOAT("ffastatan2_deg", ffastatan2_deg(y, x));
+    TIME_FLOAT("fasin_deg", fasin_deg(x));
+    TIME_FLOAT("ffastasin_deg", ffastasin_deg(x));
+    TIME_FLOAT("1 / sqrtf", 1.0F / sqrtf(2.0F + x));
+    TIME_FLOAT("ffastrsqrt", ffastrsqrt(2.0F + x));
+    TIME_FIXED("ifastsin_q31", ifastsin_q31(x));
+    TIME_FIXED("ifastatan2_q31", ifastatan2_q31(y, x));
+    TIME_FIXED("ifastasin_q31", ifastasin_q31(x));
+    TIME_FIXED("ifastrsqrt_q31", ifastrsqrt_q31(x & 0x7FFFFFFF, &ishift));
+    TIME_FIXED("ifastsin_q15", ifastsin_q15((int16_t) x));
+    TIME_FIXED("ifastatan2_q15", ifastatan2_q15((int16_t) y, (int16_t) x));
+}
+
+int main(void)
+{
+    accuracyFloat();
+    accuracyFixed();
+    throughput();
+
+    return (0);
+}
@@ -0,0 +1,494 @@
+/*
+ * Copyright (c) 2015 - 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2017 NXP
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * o Redistributions of source code must retain the above copyright notice, this list
+ *   of conditions and the following disclaimer.
+ *
+ * o Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * o Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*! \file fusion_batch.c
+    \brief Host batch runner for tuning the 9DOF Kalman filter noise constants
+
+    Runs the unmodified fusion.c, magnetic.c, orientation.c and matrix.c over
+    recorded traces for every line of a parameter file, one independent
+    SensorFusionGlobals per (trace, parameter set) job, on a pool of threads,
+    and reports the orientation error against the reference orientation of
+    each trace.
+
+    A trace is a text file with one gyro rate sample per line:
+
+        t ax ay az mx my mz gx gy gz q0 q1 q2 q3
+
+    t in seconds, accelerometer (g), uncalibrated magnetometer (uT) and gyro
+    (deg/s) already mapped to the build coordinate system (as after the HAL),
+    and the reference orientation quaternion in the convention of fqPl.  The
+    fusion rate is the nearest integer division of the trace rate to FUSION_HZ.
+    Without trace arguments, -s synthetic traces of a tumbling board with gyro
+    offset, hard iron and noise are generated.
+
+    A parameter file has one "fQvY fQvG fQvB fQwb" set per line (# starts a
+    comment).  Without -p, a 3x3x3x3 grid around the fusion.h defaults is run.
+
+    Output is one CSV line per job on stdout and the best parameter set by
+    mean RMS error over all traces on stderr.  Built as the fusion_batch
+    target of CMakeLists.txt in this directory:
+
+    cmake -S . -B build && cmake --build build --target fusion_batch
+
+    configure with -DCMAKE_C_FLAGS=-DFAST_MATH=1 to run the orientation and
+    fusion math on the fastmath.c kernels.  Usage:
+
+    fusion_batch [-j threads] [-p params.txt] [-w warmup_secs] [-s synthetic_traces] [trace ...]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "sensor_fusion.h"
+#include "fusion.h"
+#include "magnetic.h"
+#include "orientation.h"
+
+#define SYNTHETIC_HZ 200            ///< gyro rate of the synthetic traces
+#define SYNTHETIC_SECS 120          ///< length of each synthetic trace
+#define GYRO_COUNTS_PER_DPS 16      ///< FXAS21002 at 2000 deg/s full scale
+#define MAG_COUNTS_PER_UT 10        ///< FXOS8700 magnetometer sensitivity
+#define TIMESTAMP_HZ 1000000        ///< trace time is converted to microsecond FIFO timestamps
+
+/// one gyro rate sample of a trace
+typedef struct
+{
+    double  t;                      ///< time (s)
+    float   fG[3];                  ///< accelerometer (g)
+    float   fB[3];                  ///< uncalibrated magnetometer (uT)
+    float   fY[3];                  ///< gyro (deg/s)
+    Quaternion fqRef;               ///< reference orientation
+} TraceSample;
+
+typedef struct
+{
+    const char  *pName;
+    TraceSample *pSamples;
+    int32_t     iSamples;
+    int32_t     iOversample;        ///< trace samples per fusion step
+} Trace;
+
+/// tunable noise variances of SV_9DOF_GBY_KALMAN
+typedef struct
+{
+    float   fQvY, fQvG, fQvB, fQwb;
+} KalmanParams;
+
+typedef struct
+{
+    double  fRmsDeg;                ///< RMS orientation error after the warm up (deg)
+    double  fMeanDeg;               ///< mean orientation error after the warm up (deg)
+    double  fMaxDeg;                ///< largest orientation error after the warm up (deg)
+    int32_t iSteps;                 ///< fusion steps run
+} JobResult;
+
+static Trace        *pTraces;
+static int32_t      iTraces;
+static KalmanParams *pParams;
+static int32_t      iParams;
+static JobResult    *pResults;      ///< iParams x iTraces, indexed by job number
+static double       fWarmupSecs = 10.0;
+static int32_t      iNextJob;
+static pthread_mutex_t jobLock = PTHREAD_MUTEX_INITIALIZER;
+
+// host replacements for the target timer functions referenced by fusion.c
+void ARM_systick_start_ticks(int32_t *pstart)
+{
+    *pstart = 0;
+}
+
+int32_t ARM_systick_elapsed_ticks(int32_t start_ticks)
+{
+    (void) start_ticks;
+    return (0);
+}
+
+uint32_t ARM_timestamp_hz(void)
+{
+    return (TIMESTAMP_HZ);
+}
+
+// simple deterministic generator so that every build replays the same synthetic traces
+static uint32_t iSeed = 12345;
+static float fRandom(void)
+{
+    iSeed = iSeed * 1664525U + 1013904223U;
+    return ((float) (iSeed >> 8) / 16777216.0F - 0.5F);
+}
+
+// generate a board tumbling at a slowly varying angular rate.  The orientation is integrated with
+// the same quaternion functions as the Kalman filter so the reference uses the fqPl convention.
+static int32_t iSyntheticTrace(Trace *pTrace, int32_t iIndex)
+{
+    int32_t     iSamples = SYNTHETIC_SECS * SYNTHETIC_HZ;
+    TraceSample *pSamples = malloc(iSamples * sizeof(*pSamples));
+    const float fGGl[3] = { 0.0F, 0.0F, 1.0F };     // gravity in the NED global frame (g)
+    const float fBGl[3] = { 20.0F, 0.0F, 40.0F };   // geomagnetic field in the NED global frame (uT)
+    float       fOffset[3], fHardIron[3];
+    float       fOmega[3] = { 0.0F, 0.0F, 0.0F };   // angular rate (deg/s)
+    float       fR[3][3];
+    Quaternion  fq = { 1.0F, 0.0F, 0.0F, 0.0F };
+    Quaternion  ftmpq;
+    char        *pName = malloc(32);
+    int32_t     i, j, k;
+
+    for (j = CHX; j <= CHZ; j++)
+    {
+        fOffset[j] = 4.0F * fRandom();              // gyro offset within +/-2 deg/s
+        fHardIron[j] = 60.0F * fRandom();           // hard iron within +/-30 uT
+    }
+    for (i = 0; i < iSamples; i++)
+    {
+        // random walk on the angular rate limited to around 100 deg/s
+        for (j = CHX; j <= CHZ; j++) fOmega[j] = 0.999F * fOmega[j] + 10.0F * fRandom();
+        fQuaternionFromRotationVectorDeg(&ftmpq, fOmega, 1.0F / SYNTHETIC_HZ);
+        qAeqAxB(&fq, &ftmpq);
+        fqAeqNormqA(&fq);
+        fRotationMatrixFromQuaternion(fR, &fq);
+
+        pSamples[i].t = (double) i / SYNTHETIC_HZ;
+        pSamples[i].fqRef = fq;
+        for (j = CHX; j <= CHZ; j++)
+        {
+            pSamples[i].fG[j] = 0.01F * fRandom();
+            pSamples[i].fB[j] = fHardIron[j] + 0.6F * fRandom();
+            pSamples[i].fY[j] = fOmega[j] + fOffset[j] + 0.2F * fRandom();
+            for (k = CHX; k <= CHZ; k++)
+            {
+                pSamples[i].fG[j] += fR[j][k] * fGGl[k];
+                pSamples[i].fB[j] += fR[j][k] * fBGl[k];
+            }
+        }
+    }
+
+    snprintf(pName, 32, "synthetic%ld", (long) iIndex);
+    pTrace->pName = pName;
+    pTrace->pSamples = pSamples;
+    pTrace->iSamples = iSamples;
+    return (iSamples);
+}
+
+// read a recorded trace, one "t ax ay az mx my mz gx gy gz q0 q1 q2 q3" sample per line
+static int32_t iReadTrace(Trace *pTrace, const char *pFileName)
+{
+    FILE        *pFile = fopen(pFileName, "r");
+    int32_t     iSize = 4096;
+    int32_t     iSamples = 0;
+    TraceSample *pSamples, *p;
+
+    if (pFile == NULL) return (-1);
+    pSamples = malloc(iSize * sizeof(*pSamples));
+    for (;;)
+    {
+        if (iSamples == iSize)
+        {
+            iSize *= 2;
+            pSamples = realloc(pSamples, iSize * sizeof(*pSamples));
+        }
+        p = &pSamples[iSamples];
+        if (fscanf(pFile, " %lf%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f"
+                          "%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f",
+                   &p->t, &p->fG[CHX], &p->fG[CHY], &p->fG[CHZ], &p->fB[CHX], &p->fB[CHY], &p->fB[CHZ],
+                   &p->fY[CHX], &p->fY[CHY], &p->fY[CHZ],
+                   &p->fqRef.q0, &p->fqRef.q1, &p->fqRef.q2, &p->fqRef.q3) != 14)
+            break;
+        iSamples++;
+    }
+    fclose(pFile);
+
+    pTrace->pName = pFileName;
+    pTrace->pSamples = pSamples;
+    pTrace->iSamples = iSamples;
+    return (iSamples);
+}
+
+// read "fQvY fQvG fQvB fQwb" parameter sets, one per line
+static int32_t iReadParams(const char *pFileName, KalmanParams **ppParams)
+{
+    FILE        *pFile = fopen(pFileName, "r");
+    int32_t     iSize = 256;
+    int32_t     iCount = 0;
+    char        sLine[256];
+    KalmanParams *pList;
+
+    if (pFile == NULL) return (-1);
+    pList = malloc(iSize * sizeof(*pList));
+    while (fgets(sLine, sizeof(sLine), pFile) != NULL)
+    {
+        if (strchr(sLine, '#')) *strchr(sLine, '#') = '\0';
+        if (iCount == iSize)
+        {
+            iSize *= 2;
+            pList = realloc(pList, iSize * sizeof(*pList));
+        }
+        if (sscanf(sLine, " %f%*[ ,;\t]%f%*[ ,;\t]%f%*[ ,;\t]%f", &pList[iCount].fQvY, &pList[iCount].fQvG,
+                   &pList[iCount].fQvB, &pList[iCount].fQwb) == 4)
+            iCount++;
+    }
+    fclose(pFile);
+
+    *ppParams = pList;
+    return (iCount);
+}
+
+// 3 values per parameter, a quarter, one and four times the fusion.h default
+static int32_t iDefaultParams(KalmanParams **ppParams)
+{
+    static const float fScale[3] = { 0.25F, 1.0F, 4.0F };
+    KalmanParams *pList = malloc(81 * sizeof(*pList));
+    int32_t     i;
+
+    for (i = 0; i < 81; i++)
+    {
+        pList[i].fQvY = FQVY_9DOF_GBY_KALMAN * fScale[i % 3];
+        pList[i].fQvG = FQVG_9DOF_GBY_KALMAN * fScale[(i / 3) % 3];
+        pList[i].fQvB = FQVB_9DOF_GBY_KALMAN * fScale[(i / 9) % 3];
+        pList[i].fQwb = FQWB_9DOF_GBY_KALMAN * fScale[i / 27];
+    }
+    *ppParams = pList;
+    return (81);
+}
+
+// orientation error between two quaternions (deg)
+static double fQuaternionErrorDeg(const Quaternion *pA, const Quaternion *pB)
+{
+    double fdot = fabs((double) pA->q0 * pB->q0 + (double) pA->q1 * pB->q1 +
+                       (double) pA->q2 * pB->q2 + (double) pA->q3 * pB->q3);
+    if (fdot > 1.0) fdot = 1.0;
+    return (2.0 * acos(fdot) * 180.0 / M_PI);
+}
+
+// run one trace with one parameter set in a private SensorFusionGlobals
+static void RunJob(const Trace *pTrace, const KalmanParams *pParam, JobResult *pResult)
+{
+    SensorFusionGlobals *sfg = calloc(1, sizeof(*sfg));
+    const TraceSample *p;
+    int32_t iSum[3];
+    float   fSum[3];
+    double  fErr, fSumErr = 0.0, fSumSqErr = 0.0, fMaxErr = 0.0;
+    int32_t iScored = 0;
+    int32_t iStep, i, j;
+
+    sfg->Gyro.fDegPerSecPerCount = 1.0F / GYRO_COUNTS_PER_DPS;
+    sfg->Gyro.iCountsPerDegPerSec = GYRO_COUNTS_PER_DPS;
+    sfg->Mag.fuTPerCount = 1.0F / MAG_COUNTS_PER_UT;
+    sfg->Mag.fCountsPeruT = (float) MAG_COUNTS_PER_UT;
+    sfg->Mag.iCountsPeruT = MAG_COUNTS_PER_UT;
+    sfg->iFusionHz = (uint16_t) lround((pTrace->iSamples - 1) / (pTrace->pSamples[pTrace->iSamples - 1].t -
+                                       pTrace->pSamples[0].t) / pTrace->iOversample);
+    fInitializeFusion(sfg);
+#if COMPACT_GLOBALS
+    fAttachMagCalScratch(&(sfg->MagCal), &(sfg->CalScratch));
+#endif
+    fInitializeMagCalibration(&(sfg->MagCal), &(sfg->MagBuffer));
+    sfg->SV_9DOF_GBY_KALMAN.fQvY = pParam->fQvY;
+    sfg->SV_9DOF_GBY_KALMAN.fQvG = pParam->fQvG;
+    sfg->SV_9DOF_GBY_KALMAN.fQvB = pParam->fQvB;
+    sfg->SV_9DOF_GBY_KALMAN.fQwb = pParam->fQwb;
+    fSetFusionRate(sfg, sfg->iFusionHz);
+
+    for (iStep = 0; (iStep + 1) * pTrace->iOversample <= pTrace->iSamples; iStep++)
+    {
+        p = &pTrace->pSamples[iStep * pTrace->iOversample];
+
+        // gyro FIFO in counts with microsecond timestamps, as the FXAS21002 driver delivers it
+        sfg->Gyro.iFIFOCount = (uint8_t) pTrace->iOversample;
+        for (j = CHX; j <= CHZ; j++) iSum[j] = 0;
+        for (i = 0; i < pTrace->iOversample; i++)
+        {
+            sfg->Gyro.iYsTime[i] = (uint32_t) llround(p[i].t * TIMESTAMP_HZ);
+            for (j = CHX; j <= CHZ; j++)
+            {
+                sfg->Gyro.iYsFIFO[i][j] = (int16_t) lrintf(p[i].fY[j] * GYRO_COUNTS_PER_DPS);
+                iSum[j] += sfg->Gyro.iYsFIFO[i][j];
+            }
+        }
+        for (j = CHX; j <= CHZ; j++)
+        {
+            sfg->Gyro.iYs[j] = (int16_t) (iSum[j] / pTrace->iOversample);
+            sfg->Gyro.fYs[j] = (float) sfg->Gyro.iYs[j] * sfg->Gyro.fDegPerSecPerCount;
+        }
+
+        // averaged accelerometer, taken as calibrated
+        for (j = CHX; j <= CHZ; j++) fSum[j] = 0.0F;
+        for (i = 0; i < pTrace->iOversample; i++)
+            for (j = CHX; j <= CHZ; j++) fSum[j] += p[i].fG[j];
+        for (j = CHX; j <= CHZ; j++) sfg->Accel.fGs[j] = sfg->Accel.fGc[j] = fSum[j] / pTrace->iOversample;
+
+        // averaged magnetometer in counts, calibrated as processMagData() does without a background task
+        for (j = CHX; j <= CHZ; j++) fSum[j] = 0.0F;
+        for (i = 0; i < pTrace->iOversample; i++)
+            for (j = CHX; j <= CHZ; j++) fSum[j] += p[i].fB[j];
+        for (j = CHX; j <= CHZ; j++)
+        {
+            sfg->Mag.iBs[j] = (int16_t) lrintf(fSum[j] / pTrace->iOversample * MAG_COUNTS_PER_UT);
+            sfg->Mag.fBs[j] = (float) sfg->Mag.iBs[j] * sfg->Mag.fuTPerCount;
+        }
+        fInvertMagCal(&(sfg->Mag), &(sfg->MagCal));
+        if (!sfg->MagCal.iMagBufferReadOnly)
+            iUpdateMagBuffer(&(sfg->MagBuffer), &(sfg->Mag), sfg->loopcounter);
+        fRunMagCalibration(&(sfg->MagCal), &(sfg->MagBuffer), &(sfg->Mag), sfg->loopcounter);
+
+        fRun_9DOF_GBY_KALMAN(&(sfg->SV_9DOF_GBY_KALMAN), &(sfg->Accel), &(sfg->Mag), &(sfg->Gyro), &(sfg->MagCal));
+        sfg->loopcounter++;
+
+        // score against the reference at the last sample of the step
+        p = &p[pTrace->iOversample - 1];
+        if (p->t - pTrace->pSamples[0].t >= fWarmupSecs)
+        {
+            fErr = fQuaternionErrorDeg(&(sfg->SV_9DOF_GBY_KALMAN.fqPl), &(p->fqRef));
+            fSumErr += fErr;
+            fSumSqErr += fErr * fErr;
+            if (fErr > fMaxErr) fMaxErr = fErr;
+            iScored++;
+        }
+    }
+
+    pResult->iSteps = iStep;
+    pResult->fMeanDeg = iScored ? fSumErr / iScored : 0.0;
+    pResult->fRmsDeg = iScored ? sqrt(fSumSqErr / iScored) : 0.0;
+    pResult->fMaxDeg = fMaxErr;
+    free(sfg);
+}
+
+static void *pWorker(void *pArg)
+{
+    int32_t iJob;
+
+    (void) pArg;
+    for (;;)
+    {
+        pthread_mutex_lock(&jobLock);
+        iJob = iNextJob++;
+        pthread_mutex_unlock(&jobLock);
+        if (iJob >= iParams * iTraces) break;
+        RunJob(&pTraces[iJob % iTraces], &pParams[iJob / iTraces], &pResults[iJob]);
+    }
+    return (NULL);
+}
+
+static double fElapseds(const struct timespec *pStart, const struct timespec *pEnd)
+{
+    return ((pEnd->tv_sec - pStart->tv_sec) + (pEnd->tv_nsec - pStart->tv_nsec) * 1e-9);
+}
+
+int main(int argc, char *argv[])
+{
+    int32_t     iThreads = (int32_t) sysconf(_SC_NPROCESSORS_ONLN);
+    int32_t     iSynthetic = 4;
+    const char  *pParamFile = NULL;
+    pthread_t   *pThreads;
+    struct timespec start, end;
+    double      fRate, fMean, fBestMean;
+    int32_t     iBest, iSteps;
+    int32_t     i, j;
+    int         opt;
+
+    while ((opt = getopt(argc, argv, "j:p:w:s:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'j': iThreads = atoi(optarg); break;
+        case 'p': pParamFile = optarg; break;
+        case 'w': fWarmupSecs = atof(optarg); break;
+        case 's': iSynthetic = atoi(optarg); break;
+        default:
+            fprintf(stderr, "usage: %s [-j threads] [-p params.txt] [-w warmup_secs] [-s synthetic_traces] [trace ...]\n", argv[0]);
+            return (1);
+        }
+    }
+    if (iThreads < 1) iThreads = 1;
+
+    iTraces = (optind < argc) ? argc - optind : iSynthetic;
+    pTraces = calloc(iTraces, sizeof(*pTraces));
+    for (i = 0; i < iTraces; i++)
+    {
+        if (((optind < argc) ? iReadTrace(&pTraces[i], argv[optind + i]) : iSyntheticTrace(&pTraces[i], i)) < 2)
+        {
+            fprintf(stderr, "no samples in trace %s\n", (optind < argc) ? argv[optind + i] : "");
+            return (1);
+        }
+        fRate = (pTraces[i].iSamples - 1) / (pTraces[i].pSamples[pTraces[i].iSamples - 1].t - pTraces[i].pSamples[0].t);
+        pTraces[i].iOversample = (int32_t) lround(fRate / FUSION_HZ);
+        if (pTraces[i].iOversample < 1) pTraces[i].iOversample = 1;
+        if (pTraces[i].iOversample > GYRO_FIFO_SIZE) pTraces[i].iOversample = GYRO_FIFO_SIZE;
+    }
+
+    iParams = pParamFile ? iReadParams(pParamFile, &pParams) : iDefaultParams(&pParams);
+    if (iParams <= 0)
+    {
+        fprintf(stderr, "no parameter sets in %s\n", pParamFile);
+        return (1);
+    }
+
+    pResults = calloc(iParams * iTraces, sizeof(*pResults));
+    pThreads = malloc(iThreads * sizeof(*pThreads));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < iThreads; i++) pthread_create(&pThreads[i], NULL, pWorker, NULL);
+    for (i = 0; i < iThreads; i++) pthread_join(pThreads[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    printf("trace,fQvY,fQvG,fQvB,fQwb,steps,rms_deg,mean_deg,max_deg\n");
+    iBest = 0;
+    fBestMean = 1e30;
+    iSteps = 0;
+    for (i = 0; i < iParams; i++)
+    {
+        fMean = 0.0;
+        for (j = 0; j < iTraces; j++)
+        {
+            JobResult *pResult = &pResults[i * iTraces + j];
+            printf("%s,%g,%g,%g,%g,%ld,%.3f,%.3f,%.3f\n", pTraces[j].pName, pParams[i].fQvY, pParams[i].fQvG,
+                   pParams[i].fQvB, pParams[i].fQwb, (long) pResult->iSteps, pResult->fRmsDeg, pResult->fMeanDeg,
+                   pResult->fMaxDeg);
+            fMean += pResult->fRmsDeg / iTraces;
+            iSteps += pResult->iSteps;
+        }
+        if (fMean < fBestMean)
+        {
+            fBestMean = fMean;
+            iBest = i;
+        }
+    }
+
+    fprintf(stderr, "%ld jobs (%ld parameter sets x %ld traces) on %ld threads in %.2fs, %.0f fusion steps/s\n",
+            (long) (iParams * iTraces), (long) iParams, (long) iTraces, (long) iThreads, fElapseds(&start, &end),
+            iSteps / fElapseds(&start, &end));
+    fprintf(stderr, "best: fQvY=%g fQvG=%g fQvB=%g fQwb=%g mean RMS error %.3f deg\n", pParams[iBest].fQvY,
+            pParams[iBest].fQvG, pParams[iBest].fQvB, pParams[iBest].fQwb, fBestMean);
+
+    free(pThreads);
+    free(pResults);
+    return (0);
+}
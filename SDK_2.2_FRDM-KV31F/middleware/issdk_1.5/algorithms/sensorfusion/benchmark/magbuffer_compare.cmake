@@ -0,0 +1,16 @@
+# Runs two magbuffer_replay builds and fails unless their buffer and retired bin checksums agree.
+#
+#   cmake -DREFERENCE=<replay> -DCANDIDATE=<replay> -P magbuffer_compare.cmake
+
+foreach(build REFERENCE CANDIDATE)
+  execute_process(COMMAND ${${build}} RESULT_VARIABLE result OUTPUT_VARIABLE output)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "${${build}} failed: ${result}")
+  endif()
+  string(REGEX MATCH "checksum=[0-9a-f]+ retired=[0-9]+ retired checksum=[0-9a-f]+" ${build}_SUMS "${output}")
+  message(STATUS "${output}")
+endforeach()
+
+if(NOT REFERENCE_SUMS OR NOT REFERENCE_SUMS STREQUAL CANDIDATE_SUMS)
+  message(FATAL_ERROR "magnetic buffers differ: '${REFERENCE_SUMS}' against '${CANDIDATE_SUMS}'")
+endif()
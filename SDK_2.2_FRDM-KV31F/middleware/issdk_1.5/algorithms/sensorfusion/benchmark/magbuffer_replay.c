@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2015 - 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2017 NXP
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * o Redistributions of source code must retain the above copyright notice, this list
+ *   of conditions and the following disclaimer.
+ *
+ * o Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * o Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*! \file magbuffer_replay.c
+    \brief Host benchmark of the magnetometer measurement buffer update
+
+    Replays a magnetometer trace through iUpdateMagBuffer() at the 200Hz
+    magnetometer rate and reports the cost per sample.  The trace is a text
+    file with one "x y z" sample in calibrated counts per line; without an
+    argument a 10 minute synthetic trace of a tumbling board is generated.
+
+    CMakeLists.txt in this directory builds both buffer implementations,
+    magbuffer_scan (oldest bin by scan) and magbuffer_fast (MAGBUFFER_FASTINDEX):
+
+    cmake -S . -B build && cmake --build build
+
+    The checksums cover the occupied bins with their readings and the sample
+    and bin of every measurement retired as the oldest.  magbuffer_scan_compact replays the
+    buffer with the 16 bit relative time indices of COMPACT_GLOBALS; the 10
+    minute trace runs past MAGINDEX_MAX loops several times and CTest checks
+    that it gives the checksums of magbuffer_scan.
+
+    MAGBUFFER_FASTINDEX only changes how the oldest bin is found, so both
+    builds bin every sample with the same tangent search and CTest checks
+    that they give the same checksums.  Over 15 interleaved runs of the
+    synthetic trace on the host the median of the mean insert time was
+    49.1 ns with the scan and 51.7 ns with the fast index, within the run to
+    run spread (37 to 66 ns), and timing whole replays without the per
+    sample clock reads gives 29 to 30 ns for both.  The median 99th
+    percentile fell from 842 ns to 577 ns with the retirement no longer
+    scanning all the time indices.  Fixed point atan2 binning and a
+    division free search of tanarray both measured 15 to 20 ns slower than
+    the single division and the linear tangent search and are not used.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "sensor_fusion.h"
+
+#define REPLAY_HZ 200           ///< magnetometer sample rate being modelled
+#define SYNTHETIC_SECS 600      ///< length of the synthetic trace
+#define COUNTS_PER_UT 10        ///< FXOS8700 magnetometer sensitivity
+
+static struct MagBuffer thisMagBuffer;
+static struct MagCalibration thisMagCal;
+static struct MagSensor thisMag;
+static int8_t iOccupied[MAGBUFFSIZEX * MAGBUFFSIZEY];   ///< bins occupied after the previous sample
+
+// simple deterministic generator so that every build replays the same synthetic trace
+static uint32_t iSeed = 12345;
+static float fRandom(void)
+{
+    iSeed = iSeed * 1664525U + 1013904223U;
+    return ((float) (iSeed >> 8) / 16777216.0F - 0.5F);
+}
+
+// generate a board tumbling at a slowly varying angular rate in a 50uT field
+static int32_t iSyntheticTrace(int16_t (**ppTrace)[3])
+{
+    int32_t iSamples = SYNTHETIC_SECS * REPLAY_HZ;
+    int16_t (*pTrace)[3] = malloc(iSamples * sizeof(*pTrace));
+    float   fB[3] = { 20.0F, 0.0F, 46.0F };  // field in the board frame (uT)
+    float   fOmega[3] = { 0.0F, 0.0F, 0.0F };  // angular rate (rad/s)
+    float   fdt = 1.0F / REPLAY_HZ;
+    float   fdB[3];
+    float   fnorm;
+    int32_t i, j;
+
+    for (i = 0; i < iSamples; i++)
+    {
+        // random walk on the angular rate limited to around 2 rad/s
+        for (j = 0; j < 3; j++)
+        {
+            fOmega[j] = 0.999F * fOmega[j] + 0.2F * fRandom();
+        }
+
+        // rotate the field vector by -omega x dt and renormalize to 50uT
+        fdB[0] = fB[1] * fOmega[2] - fB[2] * fOmega[1];
+        fdB[1] = fB[2] * fOmega[0] - fB[0] * fOmega[2];
+        fdB[2] = fB[0] * fOmega[1] - fB[1] * fOmega[0];
+        fnorm = 0.0F;
+        for (j = 0; j < 3; j++)
+        {
+            fB[j] += fdB[j] * fdt;
+            fnorm += fB[j] * fB[j];
+        }
+        fnorm = 50.0F / sqrtf(fnorm);
+        for (j = 0; j < 3; j++)
+        {
+            fB[j] *= fnorm;
+            pTrace[i][j] = (int16_t) (fB[j] * COUNTS_PER_UT + 6.0F * fRandom());
+        }
+    }
+
+    *ppTrace = pTrace;
+    return (iSamples);
+}
+
+// read a recorded trace of "x y z" counts, one sample per line
+static int32_t iReadTrace(const char *pFileName, int16_t (**ppTrace)[3])
+{
+    FILE    *pFile = fopen(pFileName, "r");
+    int32_t iSize = 4096;
+    int32_t iSamples = 0;
+    int     x, y, z;
+    int16_t (*pTrace)[3];
+
+    if (pFile == NULL) return (-1);
+    pTrace = malloc(iSize * sizeof(*pTrace));
+    while (fscanf(pFile, " %d%*[ ,;\t]%d%*[ ,;\t]%d", &x, &y, &z) == 3)
+    {
+        if (iSamples == iSize)
+        {
+            iSize *= 2;
+            pTrace = realloc(pTrace, iSize * sizeof(*pTrace));
+        }
+        pTrace[iSamples][0] = (int16_t) x;
+        pTrace[iSamples][1] = (int16_t) y;
+        pTrace[iSamples][2] = (int16_t) z;
+        iSamples++;
+    }
+    fclose(pFile);
+
+    *ppTrace = pTrace;
+    return (iSamples);
+}
+
+static double fElapsedns(const struct timespec *pStart, const struct timespec *pEnd)
+{
+    return ((pEnd->tv_sec - pStart->tv_sec) * 1e9 + (pEnd->tv_nsec - pStart->tv_nsec));
+}
+
+static int iCompareDouble(const void *pA, const void *pB)
+{
+    double fA = *(const double *) pA;
+    double fB = *(const double *) pB;
+    return ((fA > fB) - (fA < fB));
+}
+
+int main(int argc, char *argv[])
+{
+    int16_t (*pTrace)[3];
+    int32_t iSamples;
+    int32_t i, j, k;
+    uint32_t iChecksum;         // occupied bins and their readings at the end of the trace
+    uint32_t iRetired;          // sample and bin of every retired measurement, in order
+    int32_t iRetiredCount;      // number of retired measurements
+    magindex_t *pindex = &thisMagBuffer.index[0][0];
+    double  *pTime;
+    double  ftotal, foverhead;
+    struct timespec start, end;
+
+    iSamples = (argc > 1) ? iReadTrace(argv[1], &pTrace) : iSyntheticTrace(&pTrace);
+    if (iSamples <= 0)
+    {
+        fprintf(stderr, "no samples in trace %s\n", (argc > 1) ? argv[1] : "");
+        return (1);
+    }
+
+    pTime = malloc(iSamples * sizeof(*pTime));
+
+    // cost of the timer itself, subtracted from every sample
+    foverhead = 1e9;
+    for (i = 0; i < 1000; i++)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        if (fElapsedns(&start, &end) < foverhead) foverhead = fElapsedns(&start, &end);
+    }
+
+    fInitializeMagCalibration(&thisMagCal, &thisMagBuffer);
+    ftotal = 0.0;
+    iRetired = 0;
+    iRetiredCount = 0;
+    for (i = 0; i < iSamples; i++)
+    {
+        // the synthetic trace has no hard iron offset so calibrated and uncalibrated counts are equal
+        for (j = CHX; j <= CHZ; j++)
+        {
+            thisMag.iBs[j] = thisMag.iBc[j] = pTrace[i][j];
+        }
+
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        iUpdateMagBuffer(&thisMagBuffer, &thisMag, i);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+
+        pTime[i] = fElapsedns(&start, &end) - foverhead;
+        ftotal += pTime[i];
+
+        // the bins emptied by this sample are the retired oldest measurements
+        for (j = 0; j < MAGBUFFSIZEX * MAGBUFFSIZEY; j++)
+        {
+            if (iOccupied[j] && (pindex[j] == -1))
+            {
+                iRetired = iRetired * 31U + (uint32_t) i;
+                iRetired = iRetired * 31U + (uint32_t) j;
+                iRetiredCount++;
+            }
+            iOccupied[j] = (pindex[j] != -1);
+        }
+    }
+    qsort(pTime, iSamples, sizeof(*pTime), iCompareDouble);
+
+    // checksum of the occupied bins and their readings so the implementations can be compared.  The
+    // time indices are left out since COMPACT_GLOBALS renumbers them; their order shows in the retirements.
+    iChecksum = 0;
+    for (j = 0; j < MAGBUFFSIZEX; j++)
+        for (k = 0; k < MAGBUFFSIZEY; k++)
+        {
+            iChecksum = iChecksum * 31U + (uint32_t) (thisMagBuffer.index[j][k] != -1);
+            if (thisMagBuffer.index[j][k] != -1)
+                for (i = CHX; i <= CHZ; i++)
+                    iChecksum = iChecksum * 31U + (uint32_t) thisMagBuffer.iBs[i][j][k];
+        }
+
+    printf("MAGBUFFER_FASTINDEX=%d COMPACT_GLOBALS=%d samples=%ld (%.1fs at %dHz) measurements=%d\n",
+           MAGBUFFER_FASTINDEX, COMPACT_GLOBALS, (long) iSamples, (double) iSamples / REPLAY_HZ, REPLAY_HZ,
+           thisMagBuffer.iMagBufferCount);
+    printf("checksum=%08lx retired=%ld retired checksum=%08lx\n",
+           (unsigned long) iChecksum, (long) iRetiredCount, (unsigned long) iRetired);
+    printf("per sample: mean %.1f ns, 99%% %.1f ns, 99.9%% %.1f ns, max %.1f ns\n",
+           ftotal / iSamples, pTime[iSamples * 99 / 100], pTime[iSamples * 999 / 1000], pTime[iSamples - 1]);
+    printf("mean load %.4f%% of the %dHz sample period\n", 100.0 * ftotal / iSamples * REPLAY_HZ / 1e9, REPLAY_HZ);
+
+    free(pTime);
+    free(pTrace);
+    return (0);
+}
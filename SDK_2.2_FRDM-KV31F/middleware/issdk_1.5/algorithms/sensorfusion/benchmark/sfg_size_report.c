@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2015 - 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2017 NXP
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * o Redistributions of source code must retain the above copyright notice, this list
+ *   of conditions and the following disclaimer.
+ *
+ * o Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * o Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*! \file sfg_size_report.c
+    \brief Host report of the SensorFusionGlobals memory layout
+
+    Prints the offset and size of every member of SensorFusionGlobals, and of
+    the large members of the sensor and calibration structures, for the
+    build.h found first on the include path.  Unlike the other tools in this
+    directory it is built against the application build.h of the ROBOT
+    project, once for each layout, as the sfg_size_compact and sfg_size_full
+    targets of CMakeLists.txt in this directory:
+
+    cmake -S . -B build && cmake --build build --target sfg_size_compact sfg_size_full
+
+    The targets are built with -m32 when the host has a 32 bit C library,
+    which gives the 4 byte pointers of the Cortex-M target; without it the
+    pointer members are reported at 8 bytes.
+*/
+
+#include <stdio.h>
+#include <stddef.h>
+#include "sensor_fusion.h"
+
+/// one row of the report
+typedef struct
+{
+    const char *name;           ///< member name
+    size_t offset;              ///< offset in the parent structure (bytes)
+    size_t size;                ///< size (bytes)
+} SizeRow;
+
+#define ROW(type, member) { #member, offsetof(type, member), sizeof(((type *) 0)->member) }
+#define DETAIL(type, member) { #type "." #member, offsetof(type, member), sizeof(((type *) 0)->member) }
+
+static const SizeRow sfgRows[] =
+{
+    ROW(SensorFusionGlobals, pControlSubsystem),
+    ROW(SensorFusionGlobals, pStatusSubsystem),
+    ROW(SensorFusionGlobals, iFlags),
+    ROW(SensorFusionGlobals, pSensors),
+    ROW(SensorFusionGlobals, iPerturbation),
+#ifdef INCLUDE_DEBUG_FUNCTIONS
+    ROW(SensorFusionGlobals, iTestProgress),
+    ROW(SensorFusionGlobals, iTestDelay),
+    ROW(SensorFusionGlobals, fTestThreshold),
+    ROW(SensorFusionGlobals, fqTestStart),
+#endif
+    ROW(SensorFusionGlobals, loopcounter),
+    ROW(SensorFusionGlobals, iFusionHz),
+    ROW(SensorFusionGlobals, systick_I2C),
+    ROW(SensorFusionGlobals, systick_Spare),
+#if COMPACT_GLOBALS && (F_USING_ACCEL || F_USING_MAG)
+    ROW(SensorFusionGlobals, CalScratch),
+#endif
+#if F_1DOF_P_BASIC
+    ROW(SensorFusionGlobals, Pressure),
+#endif
+#if F_USING_ACCEL
+    ROW(SensorFusionGlobals, Accel),
+    ROW(SensorFusionGlobals, AccelCal),
+    ROW(SensorFusionGlobals, AccelBuffer),
+#if F_NUM_SENSOR_INSTANCES > 1
+    ROW(SensorFusionGlobals, AccelInstance),
+    ROW(SensorFusionGlobals, AccelSet),
+#endif
+#endif
+#if F_USING_MAG
+    ROW(SensorFusionGlobals, Mag),
+    ROW(SensorFusionGlobals, MagCal),
+    ROW(SensorFusionGlobals, MagBuffer),
+#if MAGCAL_BACKGROUND
+    ROW(SensorFusionGlobals, MagCalBackground),
+#endif
+#if F_NUM_SENSOR_INSTANCES > 1
+    ROW(SensorFusionGlobals, MagInstance),
+    ROW(SensorFusionGlobals, MagSet),
+#endif
+#endif
+#if F_USING_GYRO
+    ROW(SensorFusionGlobals, Gyro),
+#if F_NUM_SENSOR_INSTANCES > 1
+    ROW(SensorFusionGlobals, GyroInstance),
+    ROW(SensorFusionGlobals, GyroSet),
+#endif
+#endif
+#if F_1DOF_P_BASIC
+    ROW(SensorFusionGlobals, SV_1DOF_P_BASIC),
+#endif
+#if F_3DOF_G_BASIC
+    ROW(SensorFusionGlobals, SV_3DOF_G_BASIC),
+#endif
+#if F_3DOF_B_BASIC
+    ROW(SensorFusionGlobals, SV_3DOF_B_BASIC),
+#endif
+#if F_3DOF_Y_BASIC
+    ROW(SensorFusionGlobals, SV_3DOF_Y_BASIC),
+#endif
+#if F_6DOF_GB_BASIC
+    ROW(SensorFusionGlobals, SV_6DOF_GB_BASIC),
+#endif
+#if F_6DOF_GY_KALMAN
+    ROW(SensorFusionGlobals, SV_6DOF_GY_KALMAN),
+#endif
+#if F_9DOF_GBY_KALMAN
+    ROW(SensorFusionGlobals, SV_9DOF_GBY_KALMAN),
+#endif
+    ROW(SensorFusionGlobals, installSensor),
+    ROW(SensorFusionGlobals, signalMagCal),
+};
+
+// the members that depend on the layout mode, reported inside their own structures
+static const SizeRow detailRows[] =
+{
+#if F_USING_ACCEL
+    DETAIL(struct AccelSensor, iGsFIFO),
+    DETAIL(struct AccelCalibration, fmatA),
+#endif
+#if F_USING_MAG
+    DETAIL(struct MagSensor, iBsFIFO),
+    DETAIL(struct MagBuffer, iBs),
+    DETAIL(struct MagBuffer, index),
+    DETAIL(struct MagCalibration, fmatA),
+    DETAIL(struct MagCalibration, fmatB),
+#endif
+#if F_USING_GYRO
+    DETAIL(struct GyroSensor, iYsFIFO),
+    DETAIL(struct GyroSensor, iYsTime),
+#endif
+};
+
+static void printRows(const char *title, const SizeRow *pRows, size_t nRows)
+{
+    size_t  i;          // row counter
+
+    printf("%s\n", title);
+    printf("  %-36s %8s %8s\n", "member", "offset", "bytes");
+    for (i = 0; i < nRows; i++)
+        printf("  %-36s %8lu %8lu\n", pRows[i].name, (unsigned long) pRows[i].offset, (unsigned long) pRows[i].size);
+}
+
+int main(void)
+{
+    size_t  i;          // row counter
+    size_t  isum = 0;   // sum of the listed members
+
+    printf("COMPACT_GLOBALS=%d FUSION_HZ=%d ACCEL_FIFO_SIZE=%d MAG_FIFO_SIZE=%d GYRO_FIFO_SIZE=%d\n",
+           COMPACT_GLOBALS, FUSION_HZ, (int) ACCEL_FIFO_SIZE, (int) MAG_FIFO_SIZE, (int) GYRO_FIFO_SIZE);
+
+    // the function pointers from installSensor to signalMagCal are listed as their first and last members
+    printRows("SensorFusionGlobals", sfgRows, sizeof(sfgRows) / sizeof(sfgRows[0]));
+    for (i = 0; i < sizeof(sfgRows) / sizeof(sfgRows[0]); i++) isum += sfgRows[i].size;
+    isum += offsetof(SensorFusionGlobals, signalMagCal) - offsetof(SensorFusionGlobals, installSensor) -
+            sizeof(((SensorFusionGlobals *) 0)->installSensor);
+    printf("  %-36s %8s %8lu\n", "padding", "", (unsigned long) (sizeof(SensorFusionGlobals) - isum));
+    printf("  %-36s %8s %8lu\n", "total", "", (unsigned long) sizeof(SensorFusionGlobals));
+
+    printRows("layout dependent members", detailRows, sizeof(detailRows) / sizeof(detailRows[0]));
+
+    return (0);
+}
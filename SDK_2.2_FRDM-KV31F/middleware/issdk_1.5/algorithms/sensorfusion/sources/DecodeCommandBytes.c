@@ -191,6 +191,9 @@ void DecodeCommandBytes(SensorFusionGlobals *sfg, char iCommandBuffer[], uint8 s
                     // reset magnetic calibration and magnetometer data buffer
 #if F_USING_MAG
                     fInitializeMagCalibration(&sfg->MagCal, &sfg->MagBuffer);
+#if MAGCAL_BACKGROUND
+                    fInitializeMagCalBackground(&sfg->MagCalBackground);
+#endif
 #endif
                     // reset precision accelerometer calibration and accelerometer measurements
 #if F_USING_ACCEL
@@ -36,13 +36,302 @@
     in place of those defined here.
 */
 #include <stdio.h>
+#include <string.h>
 #include "sensor_fusion.h"
 #include "driver_KSDK_NVM.h"
 #include "calibration_storage.h"
 
+#if CALIBRATION_JOURNAL
+// The journal spans CALJOURNAL_NVM_SECTORS flash sectors starting at CALJOURNAL_NVM_ADDR. Every save appends one
+// record to the active sector and nothing is erased until the active sector is full. The sector is then compacted:
+// the next sector (the oldest) is erased and the latest record of each calibration type is copied into it ahead of
+// further appends. At boot the sectors are scanned and the record with the highest sequence number wins.
+#define CALJOURNAL_MAGIC 0xCA1B          ///< record header magic (erased flash reads 0xFFFF)
+#define CALJOURNAL_MAG 0                 ///< record type for the magnetic calibration
+#define CALJOURNAL_GYRO 1                ///< record type for the gyro offsets
+#define CALJOURNAL_ACCEL 2               ///< record type for the precision accelerometer calibration
+#define CALJOURNAL_TYPES 3               ///< number of record types
+#define CALJOURNAL_MAX_PAYLOAD 84        ///< largest payload (precision accelerometer calibration)
+#define CALJOURNAL_WRITE_UNIT 8          ///< record alignment: covers longword (FTFA) and phrase (FTFE) programming
+#define CALJOURNAL_RECORD_BYTES(n) ((sizeof(CalJournalRecord) + (n) + CALJOURNAL_WRITE_UNIT - 1) & ~(CALJOURNAL_WRITE_UNIT - 1))
+
+/// Journal record header. The payload follows immediately and the record is padded with 0xFF to the write unit.
+typedef struct
+{
+	uint16_t iMagic;					///< CALJOURNAL_MAGIC
+	uint8_t iType;						///< CALJOURNAL_MAG, CALJOURNAL_GYRO or CALJOURNAL_ACCEL
+	uint8_t iBytes;						///< payload bytes: 0 records an erased calibration
+	uint32_t iSequence;					///< journal sequence number, incremented for every record written
+	uint32_t iChecksum;					///< checksum over iMagic to iSequence and the payload
+} CalJournalRecord;
+
+/// Journal state rebuilt by the boot scan
+static struct
+{
+	int8 iScanned;						///< true once the sectors have been scanned
+	uint8_t iSector;					///< index of the active sector receiving appends
+	uint32_t iSectorSize;					///< flash sector size in bytes
+	uint32_t iWriteOffset;					///< offset of the next record in the active sector
+	uint32_t iSequence;					///< sequence number of the next record
+	const CalJournalRecord *pLatest[CALJOURNAL_TYPES];	///< latest record of each type or NULL if none
+} calJournal;
+
+// record image buffer used for appends and compaction (static to keep the caller stacks small).  It is word
+// storage since it is read as CalJournalRecord headers and the flash driver programs it a word at a time.
+static uint32_t iJournalBuffer[CALJOURNAL_TYPES * CALJOURNAL_RECORD_BYTES(CALJOURNAL_MAX_PAYLOAD) / sizeof(uint32_t)];
+
+static uint32_t iCalJournalChecksum(const CalJournalRecord *pRecord)
+{
+	const uint8_t *pSrc;					// scratch pointer
+	uint32_t iSum = 0x12345678;				// checksum seed
+	int16_t i;						// loop counter
+
+	// header words ahead of the checksum followed by the payload
+	pSrc = (const uint8_t *) pRecord;
+	for (i = 0; i < 8; i++)
+		iSum = ((iSum << 5) | (iSum >> 27)) ^ *(pSrc++);
+	pSrc = (const uint8_t *) (pRecord + 1);
+	for (i = 0; i < pRecord->iBytes; i++)
+		iSum = ((iSum << 5) | (iSum >> 27)) ^ *(pSrc++);
+
+	return (iSum);
+}
+
+static const CalJournalRecord *pCalJournalSector(uint8_t iSector)
+{
+	return ((const CalJournalRecord *) (CALJOURNAL_NVM_ADDR + iSector * calJournal.iSectorSize));
+}
+
+// returns the size of a valid record starting iOffset bytes into the sector or 0 if there is none
+static uint32_t iCalJournalRecordSize(const CalJournalRecord *pRecord, uint32_t iOffset)
+{
+	if ((iOffset + sizeof(CalJournalRecord)) > calJournal.iSectorSize) return (0);
+	if ((pRecord->iMagic != CALJOURNAL_MAGIC) || (pRecord->iType >= CALJOURNAL_TYPES) ||
+		(pRecord->iBytes > CALJOURNAL_MAX_PAYLOAD)) return (0);
+	if ((iOffset + CALJOURNAL_RECORD_BYTES(pRecord->iBytes)) > calJournal.iSectorSize) return (0);
+	if (pRecord->iChecksum != iCalJournalChecksum(pRecord)) return (0);
+
+	return (CALJOURNAL_RECORD_BYTES(pRecord->iBytes));
+}
+
+// true if the iBytes bytes starting at pStart read as erased flash
+static int8 fCalJournalBlank(const uint32_t *pStart, uint32_t iBytes)
+{
+	for (; iBytes; iBytes -= 4)
+		if (*(pStart++) != 0xFFFFFFFF) return (false);
+
+	return (true);
+}
+
+// erase the oldest sector and copy the latest record of each type into it: the only time the journal erases
+static byte iCompactCalJournal(void)
+{
+	const CalJournalRecord *pLatest[CALJOURNAL_TYPES];	// record locations in the new sector
+	CalJournalRecord *pRecord;				// record copy in the buffer
+	uint32_t iSequence;					// sequence number of the next record
+	uint32_t iBytes = 0;					// bytes copied to the buffer
+	uint32_t iRecordBytes;					// size of one record
+	uint8_t iSector;					// sector being compacted into
+	int16_t i;						// loop counter
+
+	// the latest records are copied to RAM first since they may live in the sector about to be erased.
+	// the copies are given new sequence numbers so the new sector is unambiguously the most recent.
+	iSector = (calJournal.iSector + 1) % CALJOURNAL_NVM_SECTORS;
+	iSequence = calJournal.iSequence;
+	for (i = 0; i < CALJOURNAL_TYPES; i++)
+	{
+		pLatest[i] = NULL;
+		if (calJournal.pLatest[i] != NULL)
+		{
+			iRecordBytes = CALJOURNAL_RECORD_BYTES(calJournal.pLatest[i]->iBytes);
+			pRecord = (CalJournalRecord *) ((uint8_t *) iJournalBuffer + iBytes);
+			memcpy(pRecord, calJournal.pLatest[i], iRecordBytes);
+			pRecord->iSequence = iSequence++;
+			pRecord->iChecksum = iCalJournalChecksum(pRecord);
+			pLatest[i] = (const CalJournalRecord *) ((uint32_t) pCalJournalSector(iSector) + iBytes);
+			iBytes += iRecordBytes;
+		}
+	}
+
+	// any failure forces a rescan before the journal is next used
+	if ((NVM_EraseSectorFlash((uint32_t) pCalJournalSector(iSector)) != 0) ||
+		(iBytes && (NVM_ProgramFlash((uint8_t *) iJournalBuffer, (uint32_t) pCalJournalSector(iSector), iBytes) != 0)))
+	{
+		calJournal.iScanned = false;
+		return (1);
+	}
+
+	calJournal.iSector = iSector;
+	calJournal.iWriteOffset = iBytes;
+	calJournal.iSequence = iSequence;
+	for (i = 0; i < CALJOURNAL_TYPES; i++)
+		calJournal.pLatest[i] = pLatest[i];
+
+	return (0);
+}
+
+// rebuild the journal state from flash: the latest record of each type and the append position
+static void fScanCalJournal(void)
+{
+	const CalJournalRecord *pRecord;			// record being checked
+	uint32_t iOffset;					// offset of pRecord into its sector
+	uint32_t iRecordBytes;					// size of pRecord
+	int8 iFound = false;					// true once any record has been found
+	uint8_t iSector;					// sector loop counter
+	int16_t i;						// loop counter
+
+	calJournal.iSectorSize = NVM_GetSectorSize();
+	calJournal.iSector = 0;
+	calJournal.iWriteOffset = 0;
+	calJournal.iSequence = 0;
+	for (i = 0; i < CALJOURNAL_TYPES; i++)
+		calJournal.pLatest[i] = NULL;
+
+	for (iSector = 0; iSector < CALJOURNAL_NVM_SECTORS; iSector++)
+	{
+		// records are contiguous from the start of each sector so stop at the first invalid one
+		for (iOffset = 0; ; iOffset += iRecordBytes)
+		{
+			pRecord = (const CalJournalRecord *) ((uint32_t) pCalJournalSector(iSector) + iOffset);
+			iRecordBytes = iCalJournalRecordSize(pRecord, iOffset);
+			if (!iRecordBytes) break;
+
+			// the most recent record of all defines the active sector and append position
+			if (!iFound || (pRecord->iSequence >= calJournal.iSequence))
+			{
+				iFound = true;
+				calJournal.iSector = iSector;
+				calJournal.iWriteOffset = iOffset + iRecordBytes;
+				calJournal.iSequence = pRecord->iSequence + 1;
+			}
+			if ((calJournal.pLatest[pRecord->iType] == NULL) ||
+				(pRecord->iSequence > calJournal.pLatest[pRecord->iType]->iSequence))
+				calJournal.pLatest[pRecord->iType] = pRecord;
+		}
+	}
+	calJournal.iScanned = true;
+
+	// compaction guarantees the active sector holds every latest record so the oldest sector can be erased safely.
+	// a reset during compaction can leave that untrue so complete it now.
+	for (i = 0; i < CALJOURNAL_TYPES; i++)
+	{
+		pRecord = calJournal.pLatest[i];
+		if ((pRecord != NULL) && (((uint32_t) pRecord < (uint32_t) pCalJournalSector(calJournal.iSector)) ||
+			((uint32_t) pRecord >= (uint32_t) pCalJournalSector(calJournal.iSector) + calJournal.iSectorSize)))
+		{
+			iCompactCalJournal();
+			break;
+		}
+	}
+
+	return;
+}
+
+// append a record of iBytes payload bytes from pSrc (iBytes = 0 records an erased calibration)
+static byte iAppendCalJournal(uint8_t iType, const void *pSrc, uint8_t iBytes)
+{
+	CalJournalRecord *pRecord;				// record under construction
+	uint32_t iRecordBytes;					// size of the record
+	uint32_t iDst;						// flash address of the record
+
+	if (!calJournal.iScanned) fScanCalJournal();
+
+	// an erase of a calibration that is not present needs no record
+	if ((iBytes == 0) && ((calJournal.pLatest[iType] == NULL) || (calJournal.pLatest[iType]->iBytes == 0)))
+		return (0);
+
+	// build the record image padded with the erased flash value
+	iRecordBytes = CALJOURNAL_RECORD_BYTES(iBytes);
+	memset(iJournalBuffer, 0xFF, iRecordBytes);
+	pRecord = (CalJournalRecord *) iJournalBuffer;
+	pRecord->iMagic = CALJOURNAL_MAGIC;
+	pRecord->iType = iType;
+	pRecord->iBytes = iBytes;
+	pRecord->iSequence = calJournal.iSequence;
+	if (iBytes) memcpy(pRecord + 1, pSrc, iBytes);
+	pRecord->iChecksum = iCalJournalChecksum(pRecord);
+
+	// compact if the record does not fit or the space after the last record is not blank (eg interrupted write).
+	// the buffer is rebuilt since compaction reuses it.
+	iDst = (uint32_t) pCalJournalSector(calJournal.iSector) + calJournal.iWriteOffset;
+	if (((calJournal.iWriteOffset + iRecordBytes) > calJournal.iSectorSize) ||
+		!fCalJournalBlank((const uint32_t *) iDst, iRecordBytes))
+	{
+		if (iCompactCalJournal() != 0) return (1);
+		return (iAppendCalJournal(iType, pSrc, iBytes));
+	}
+
+	if (NVM_ProgramFlash((uint8_t *) iJournalBuffer, iDst, iRecordBytes) != 0)
+	{
+		calJournal.iScanned = false;
+		return (1);
+	}
+	calJournal.pLatest[iType] = (const CalJournalRecord *) iDst;
+	calJournal.iWriteOffset += iRecordBytes;
+	calJournal.iSequence++;
+
+	return (0);
+}
+
+// returns true if the journal holds a record of the given type with *ppCal set to its payload (NULL if erased)
+static int8 fFindCalJournal(uint8_t iType, float **ppCal)
+{
+	if (!calJournal.iScanned) fScanCalJournal();
+	if (calJournal.pLatest[iType] == NULL) return (false);
+
+	*ppCal = calJournal.pLatest[iType]->iBytes ? (float *) (calJournal.pLatest[iType] + 1) : NULL;
+	return (true);
+}
+#endif // CALIBRATION_JOURNAL
+
+// returns the calibration stored at iOffset in the NVM block or NULL if none is present
+static float *pNVMBlockCalibration(uint32_t iOffset)
+{
+	uint32_t *pFlash = (uint32_t *) (CALIBRATION_NVM_ADDR + iOffset);
+
+	// the standard value for erased flash is 0xFF in each byte but for portability check against 0x12345678
+	if (*pFlash == 0x12345678) return ((float *) (pFlash + 1));
+	return (NULL);
+}
+
+// the journal takes precedence and the NVM block is used until a calibration of that type is first journaled
+float *GetMagCalibrationFromNVM(void)
+{
+#if CALIBRATION_JOURNAL
+	float *pCal;
+
+	if (fFindCalJournal(CALJOURNAL_MAG, &pCal)) return (pCal);
+#endif
+	return (pNVMBlockCalibration(MAG_NVM_OFFSET));
+}
+
+float *GetGyroCalibrationFromNVM(void)
+{
+#if CALIBRATION_JOURNAL
+	float *pCal;
+
+	if (fFindCalJournal(CALJOURNAL_GYRO, &pCal)) return (pCal);
+#endif
+	return (pNVMBlockCalibration(GYRO_NVM_OFFSET));
+}
+
+float *GetAccelCalibrationFromNVM(void)
+{
+#if CALIBRATION_JOURNAL
+	float *pCal;
+
+	if (fFindCalJournal(CALJOURNAL_ACCEL, &pCal)) return (pCal);
+#endif
+	return (pNVMBlockCalibration(ACCEL_NVM_OFFSET));
+}
+
 void SaveMagCalibrationToNVM(SensorFusionGlobals *sfg)
 {
 #if F_USING_MAG
+#if CALIBRATION_JOURNAL
+	// magnetic calibration: 15x float + 1x int32 total 64 bytes
+	iAppendCalJournal(CALJOURNAL_MAG, &(sfg->MagCal), 64);
+#else
 	uint8_t *pSrc, *pDst;					// scratch pointers
 	int16_t i;						// loop counter
 	uint8_t iNVMBuffer[256];				// NVM write buffer (smallest size writeable to flash)
@@ -70,6 +359,7 @@ void SaveMagCalibrationToNVM(SensorFusionGlobals *sfg)
 
 	// write the whole buffer contents to NVM
 	NVM_SetBlockFlash(iNVMBuffer, CALIBRATION_NVM_ADDR, 256);
+#endif // CALIBRATION_JOURNAL
 #endif // if F_USING_MAG
 	return;
 }
@@ -77,6 +367,14 @@ void SaveMagCalibrationToNVM(SensorFusionGlobals *sfg)
 void SaveGyroCalibrationToNVM(SensorFusionGlobals *sfg)
 {
 #if F_USING_GYRO && (F_9DOF_GBY_KALMAN || F_6DOF_GY_KALMAN)
+#if CALIBRATION_JOURNAL
+	// 3 gyro offset floats totalling 12 bytes
+#if F_9DOF_GBY_KALMAN
+	iAppendCalJournal(CALJOURNAL_GYRO, sfg->SV_9DOF_GBY_KALMAN.fbPl, 12);
+#elif F_6DOF_GY_KALMAN
+	iAppendCalJournal(CALJOURNAL_GYRO, sfg->SV_6DOF_GY_KALMAN.fbPl, 12);
+#endif
+#else
 	uint8_t *pSrc, *pDst;					// scratch pointers
 	int16_t i;						// loop counter
 	uint8_t iNVMBuffer[256];				// NVM write buffer
@@ -109,6 +407,7 @@ void SaveGyroCalibrationToNVM(SensorFusionGlobals *sfg)
 
 	// write the buffer contents to NVM
 	NVM_SetBlockFlash(iNVMBuffer, CALIBRATION_NVM_ADDR, 256);
+#endif // CALIBRATION_JOURNAL
 #endif
 	return;
 }
@@ -116,6 +415,10 @@ void SaveGyroCalibrationToNVM(SensorFusionGlobals *sfg)
 void SaveAccelCalibrationToNVM(SensorFusionGlobals *sfg)
 {
 #if F_USING_ACCEL
+#if CALIBRATION_JOURNAL
+	// 21 precision accelerometer calibration floats totalling 84 bytes
+	iAppendCalJournal(CALJOURNAL_ACCEL, &(sfg->AccelCal), 84);
+#else
 	uint8_t *pSrc, *pDst;					// scratch pointers
 	int16_t i;							// loop counter
 	uint8_t iNVMBuffer[256];				// NVM write buffer
@@ -143,12 +446,16 @@ void SaveAccelCalibrationToNVM(SensorFusionGlobals *sfg)
 
 	// write the buffer contents to NVM
 	NVM_SetBlockFlash(iNVMBuffer, CALIBRATION_NVM_ADDR, 256);
+#endif // CALIBRATION_JOURNAL
 #endif
 	return;
 }
 
 void EraseMagCalibrationFromNVM(void)
 {
+#if CALIBRATION_JOURNAL
+	iAppendCalJournal(CALJOURNAL_MAG, NULL, 0);
+#else
 	uint8_t *pSrc, *pDst;					// scratch pointers
 	int16_t i;						// loop counter
 	uint8_t iNVMBuffer[256];				// NVM write buffer
@@ -164,12 +471,16 @@ void EraseMagCalibrationFromNVM(void)
 
 	// write the buffer to flash
 	NVM_SetBlockFlash(iNVMBuffer, CALIBRATION_NVM_ADDR, 256);
+#endif // CALIBRATION_JOURNAL
 
 	return;
 }
 
 void EraseGyroCalibrationFromNVM(void)
 {
+#if CALIBRATION_JOURNAL
+	iAppendCalJournal(CALJOURNAL_GYRO, NULL, 0);
+#else
 	uint8_t *pSrc, *pDst;					// scratch pointers
 	int16_t i;							// loop counter
 	uint8_t iNVMBuffer[256];				// NVM write buffer
@@ -185,12 +496,16 @@ void EraseGyroCalibrationFromNVM(void)
 
 	// write the buffer to flash
 	NVM_SetBlockFlash(iNVMBuffer, CALIBRATION_NVM_ADDR, 256);
+#endif // CALIBRATION_JOURNAL
 
 	return;
 }
 
 void EraseAccelCalibrationFromNVM(void)
 {
+#if CALIBRATION_JOURNAL
+	iAppendCalJournal(CALJOURNAL_ACCEL, NULL, 0);
+#else
 	uint8_t *pSrc, *pDst;					// scratch pointers
 	int16_t i;							// loop counter
 	uint8_t iNVMBuffer[256];				// NVM write buffer
@@ -206,6 +521,7 @@ void EraseAccelCalibrationFromNVM(void)
 
 	// write the buffer to flash
 	NVM_SetBlockFlash(iNVMBuffer, CALIBRATION_NVM_ADDR, 256);
+#endif // CALIBRATION_JOURNAL
 
 	return;
 }
@@ -40,10 +40,17 @@
     in place of those defined here.
 */
 
+#ifndef CALIBRATION_JOURNAL
+#define CALIBRATION_JOURNAL 0   ///< 1 to append calibrations to a wear leveled flash journal instead of rewriting the NVM block
+#endif
+
 void SaveMagCalibrationToNVM(SensorFusionGlobals *sfg);
 void SaveGyroCalibrationToNVM(SensorFusionGlobals *sfg);
 void SaveAccelCalibrationToNVM(SensorFusionGlobals *sfg);
 void EraseMagCalibrationFromNVM(void);
 void EraseGyroCalibrationFromNVM(void);
 void EraseAccelCalibrationFromNVM(void);
+float *GetMagCalibrationFromNVM(void);     ///< stored magnetic calibration (15x float + 1x int32) or NULL if none
+float *GetGyroCalibrationFromNVM(void);    ///< stored gyro offsets (3x float) or NULL if none
+float *GetAccelCalibrationFromNVM(void);   ///< stored precision accelerometer calibration (21x float) or NULL if none
 #endif
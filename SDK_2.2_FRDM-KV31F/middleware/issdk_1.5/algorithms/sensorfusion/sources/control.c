@@ -40,6 +40,8 @@
 #include "board.h"
 #include "pin_mux.h"
 #include "fsl_uart.h"
+#include "fsl_uart_edma.h"
+#include "fsl_dmamux.h"
 #include "fsl_port.h"
 #include "sensor_fusion.h"
 #include "control.h"
@@ -51,6 +53,9 @@
 #ifndef F_USE_WIRED_UART
 #define F_USE_WIRED_UART        0x0002	///< 0x0002 to include, 0x0000 otherwise
 #endif
+#ifndef F_USE_UART_DMA
+#define F_USE_UART_DMA          0x0004	///< 0x0004 to transmit packets by eDMA, 0x0000 for blocking writes
+#endif
 
 #define CONTROL_BAUDRATE        115200  ///< Baudrate to be used for serial communications
 
@@ -61,11 +66,38 @@ uart_handle_t   wireless_uartHandle;
 // global structures
 uint8_t           sUARTOutputBuffer[256];             // larger than the nominal 124 byte size for outgoing packets
 
-// direct access to sfg here is the only place in the entire library where we cannot simply
-// pass a pointer.  This is because it is needed by the UART interrupt handlers.  Since this
-// only occurs here, in a subsystem which is defined to be application dependent, that is
-// considered acceptable.
-extern SensorFusionGlobals sfg;
+#if F_USE_UART_DMA
+#define NUM_TX_SLOTS            2       ///< one packet being transmitted and one waiting
+#define NO_TX_SLOT              0xFF    ///< txActive / txPending value when there is no packet
+
+// packets are copied into a slot and transmitted from there by one eDMA channel per UART,
+// so both UARTs read the same slot.  A slot is released when every UART has finished with it.
+static struct
+{
+    uint8_t     buffer[256];
+    uint16_t    nbytes;
+} txSlot[NUM_TX_SLOTS];
+static volatile uint8_t txActive = NO_TX_SLOT;      // slot owned by the eDMA
+static volatile uint8_t txPending = NO_TX_SLOT;     // slot to transmit when the active one completes
+static volatile uint8_t txBusyUarts;                // UARTs still transmitting the active slot
+volatile uint32_t       txDroppedPackets;           // packets replaced before the UARTs could take them
+
+#if F_USE_WIRED_UART
+uart_edma_handle_t      wired_uartEdmaHandle;
+edma_handle_t           wired_txEdmaHandle;
+#endif
+#ifndef COM_TG
+#if F_USE_WIRELESS_UART
+uart_edma_handle_t      wireless_uartEdmaHandle;
+edma_handle_t           wireless_txEdmaHandle;
+#endif
+#endif //COM_TG
+#endif
+
+// The UART interrupt handlers cannot be passed a pointer, so initializeControlPort records
+// the control subsystem bound to the UART hardware here.  Commands are applied to the fusion
+// instance that initSensorFusionGlobals attached to that control subsystem.
+static ControlSubsystem *pControlPort;
 
 // Blocking function to write a single byte to a specified UART
 void myUART_WriteByte(UART_Type *base, uint8_t data)
@@ -78,6 +110,88 @@ void myUART_WriteByte(UART_Type *base, uint8_t data)
     UART_WriteByte(base, data);
 }
 
+#if F_USE_UART_DMA
+// Start transmitting a slot on every UART.  Called with interrupts disabled or from the eDMA callback.
+static void startControlPortTransfer(uint8_t slot)
+{
+    uart_transfer_t xfer;
+
+    xfer.data = txSlot[slot].buffer;
+    xfer.dataSize = txSlot[slot].nbytes;
+    txActive = slot;
+
+    // count the UARTs before starting any of them so that an early completion cannot release the slot
+    txBusyUarts = 0;
+#if F_USE_WIRED_UART
+    txBusyUarts++;
+#endif
+#ifndef COM_TG
+#if F_USE_WIRELESS_UART
+    txBusyUarts++;
+#endif
+#endif //COM_TG
+
+#if F_USE_WIRED_UART
+    UART_SendEDMA(WIRED_UART, &wired_uartEdmaHandle, &xfer);
+#endif
+#ifndef COM_TG
+#if F_USE_WIRELESS_UART
+    UART_SendEDMA(WIRELESS_UART, &wireless_uartEdmaHandle, &xfer);
+#endif
+#endif //COM_TG
+}
+
+// eDMA completion callback shared by both UARTs: releases the slot and starts any pending packet
+static void controlPortTxCallback(UART_Type *base, uart_edma_handle_t *handle, status_t status, void *userData)
+{
+    uint8_t slot;
+
+    if ((kStatus_UART_TxIdle == status) && (--txBusyUarts == 0))
+    {
+        txActive = NO_TX_SLOT;
+        if (txPending != NO_TX_SLOT)
+        {
+            slot = txPending;
+            txPending = NO_TX_SLOT;
+            startControlPortTransfer(slot);
+        }
+    }
+}
+
+// Non-blocking function queues a copy of the specified buffer for both output UARTS.
+// If a packet is still waiting for the UARTs it is replaced by this newer one.
+int8_t writeControlPort(ControlSubsystem *pComm, uint8_t buffer[], uint16_t nbytes)
+{
+    uint32_t    primask;
+    uint8_t     slot;
+
+    if (nbytes == 0) return (0);
+    if (nbytes > sizeof(txSlot[0].buffer)) nbytes = sizeof(txSlot[0].buffer);
+
+    // claim the slot which the eDMA is not reading, withdrawing it if it was queued
+    primask = DisableGlobalIRQ();
+    slot = (txActive == 0) ? 1 : 0;
+    if (txPending == slot)
+    {
+        txPending = NO_TX_SLOT;
+        txDroppedPackets++;
+    }
+    EnableGlobalIRQ(primask);
+
+    memcpy(txSlot[slot].buffer, buffer, nbytes);
+    txSlot[slot].nbytes = nbytes;
+
+    // start now if the UARTs are idle, otherwise when the active slot completes
+    primask = DisableGlobalIRQ();
+    if (txActive == NO_TX_SLOT)
+        startControlPortTransfer(slot);
+    else
+        txPending = slot;
+    EnableGlobalIRQ(primask);
+
+    return (0);
+}
+#else
 // Blocking function pipes specified buffer to both output UARTS
 int8_t writeControlPort(ControlSubsystem *pComm, uint8_t buffer[], uint16_t nbytes)
 {
@@ -96,6 +210,7 @@ int8_t writeControlPort(ControlSubsystem *pComm, uint8_t buffer[], uint16_t nbyt
 
     return (0);
 }
+#endif
 
 #if F_USE_WIRELESS_UART
 // writeWirelessPort() is called from BlueRadios_Init(), which is used to
@@ -119,8 +234,8 @@ void WIRELESS_UART_IRQHandler(void)
     status_t    sts;
     uint32_t    nbytes;				// number of bytes received
     uint32_t    flags;
-    static char iCommandBuffer_B[5] = "~~~~";	// 5 bytes long to include the unused terminating \0
-    sfg.setStatus(&sfg, RECEIVING_WIRELESS);
+    SensorFusionGlobals *sfg = pControlPort ? pControlPort->sfg : NULL;
+    if (sfg) sfg->setStatus(sfg, RECEIVING_WIRELESS);
     flags = UART_GetStatusFlags(WIRELESS_UART);
     /* If new data arrived. */
     if ((kUART_RxDataRegFullFlag | kUART_RxOverrunFlag) & flags)
@@ -129,7 +244,7 @@ void WIRELESS_UART_IRQHandler(void)
         if (sts == kStatus_Success)
         {
             data = UART_ReadByte(WIRELESS_UART);
-            DecodeCommandBytes(&sfg, iCommandBuffer_B, &data, 1);
+            if (sfg) DecodeCommandBytes(sfg, pControlPort->iCommandBuffer_B, &data, 1);
         }
     }
 }
@@ -168,9 +283,9 @@ void WIRED_UART_IRQHandler(void)
     status_t    sts;
     uint32_t    nbytes;		   // number of bytes received
     uint32_t    flags;
-    static char iCommandBuffer_A[5] = "~~~~";	// 5 bytes long to include the unused terminating \0
+    SensorFusionGlobals *sfg = pControlPort ? pControlPort->sfg : NULL;
 
-    sfg.setStatus(&sfg, RECEIVING_WIRED);
+    if (sfg) sfg->setStatus(sfg, RECEIVING_WIRED);
     flags = UART_GetStatusFlags(WIRED_UART);
     /* If new data arrived. */
     if ((kUART_RxDataRegFullFlag | kUART_RxOverrunFlag) & flags)
@@ -179,7 +294,7 @@ void WIRED_UART_IRQHandler(void)
         if (sts == kStatus_Success)
         {
             data = UART_ReadByte(WIRED_UART);
-            DecodeCommandBytes(&sfg, iCommandBuffer_A, &data, 1);
+            if (sfg) DecodeCommandBytes(sfg, pControlPort->iCommandBuffer_A, &data, 1);
         }
     }
 }
@@ -191,6 +306,9 @@ int8_t initializeControlPort(
 )
 {
     uart_config_t   config;
+#if F_USE_UART_DMA
+    edma_config_t   edmaConfig;
+#endif
     if (pComm)
     {
         pComm->DefaultQuaternionPacketType = Q3;    // default to simplest algorithm
@@ -202,6 +320,20 @@ int8_t initializeControlPort(
         pComm->AccelCalPacketOn = 0;
         pComm->write = writeControlPort;
         pComm->stream = CreateAndSendPackets;
+        pComm->sfg = NULL;                          // attached by initSensorFusionGlobals
+        strcpy(pComm->iCommandBuffer_A, "~~~~");
+        strcpy(pComm->iCommandBuffer_B, "~~~~");
+        pComm->iTimeStamp = 0;
+        pComm->iThrottle = 0;
+        pComm->MagneticPacketID = 0;
+        pComm->iPacketNumber = 0;
+        pControlPort = pComm;                       // bind the UART interrupt handlers to this port
+
+#if F_USE_UART_DMA
+        DMAMUX_Init(DMAMUX0);
+        EDMA_GetDefaultConfig(&edmaConfig);
+        EDMA_Init(DMA0, &edmaConfig);
+#endif
 
 #if F_USE_WIRED_UART
         /* Initialize WIRED UART pins below - currently duplicates code in pin_mux.c */
@@ -215,6 +347,13 @@ int8_t initializeControlPort(
         config.enableRx = true;
         config.rxFifoWatermark = 1;
         UART_Init(WIRED_UART, &config, CLOCK_GetFreq(WIRED_UART_CLKSRC));
+#if F_USE_UART_DMA
+        DMAMUX_SetSource(DMAMUX0, WIRED_UART_DMA_CHANNEL, WIRED_UART_DMA_REQUEST);
+        DMAMUX_EnableChannel(DMAMUX0, WIRED_UART_DMA_CHANNEL);
+        EDMA_CreateHandle(&wired_txEdmaHandle, DMA0, WIRED_UART_DMA_CHANNEL);
+        UART_TransferCreateHandleEDMA(WIRED_UART, &wired_uartEdmaHandle, controlPortTxCallback, NULL,
+                                      &wired_txEdmaHandle, NULL);
+#endif
 
         /* Enable RX interrupt. */
         UART_EnableInterrupts(WIRED_UART, kUART_RxDataRegFullInterruptEnable |
@@ -231,7 +370,14 @@ int8_t initializeControlPort(
                        WIRELESS_UART_MUX);
 
         UART_Init(WIRELESS_UART, &config, CLOCK_GetFreq(WIRELESS_UART_CLKSRC));
-        BlueRadios_Init();
+        BlueRadios_Init();     // blocking writes, before the transmitter is handed to the eDMA
+#if F_USE_UART_DMA
+        DMAMUX_SetSource(DMAMUX0, WIRELESS_UART_DMA_CHANNEL, WIRELESS_UART_DMA_REQUEST);
+        DMAMUX_EnableChannel(DMAMUX0, WIRELESS_UART_DMA_CHANNEL);
+        EDMA_CreateHandle(&wireless_txEdmaHandle, DMA0, WIRELESS_UART_DMA_CHANNEL);
+        UART_TransferCreateHandleEDMA(WIRELESS_UART, &wireless_uartEdmaHandle, controlPortTxCallback, NULL,
+                                      &wireless_txEdmaHandle, NULL);
+#endif
 
         /* Enable RX interrupt. */
         UART_EnableInterrupts(WIRELESS_UART, kUART_RxDataRegFullInterruptEnable |
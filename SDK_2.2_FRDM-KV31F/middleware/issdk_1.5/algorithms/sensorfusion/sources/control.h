@@ -71,6 +71,13 @@ typedef struct ControlSubsystem {
 	volatile int8_t  AccelCalPacketOn;              ///< variable used to coordinate accelerometer calibration
 	writePort_t      *write;                        ///< low level function to write a char buffer to the serial stream
 	streamData_t	 *stream;                       ///< function to create packets for serial stream
+	SensorFusionGlobals *sfg;                       ///< fusion instance controlled by this port (set by initSensorFusionGlobals)
+	char             iCommandBuffer_A[5];           ///< last wired UART command bytes (with unused terminating \0)
+	char             iCommandBuffer_B[5];           ///< last wireless UART command bytes (with unused terminating \0)
+	uint32_t         iTimeStamp;                    ///< 1MHz time stamp of the streamed packets
+	int32_t          iThrottle;                     ///< packet rate limiter accumulator
+	int16_t          MagneticPacketID;              ///< magnetic packet number
+	uint8_t          iPacketNumber;                 ///< streamed packet number
 } ControlSubsystem;
 
 int8_t initializeControlPort(ControlSubsystem *pComm);  ///< Call this once to initialize structures, ports, etc.
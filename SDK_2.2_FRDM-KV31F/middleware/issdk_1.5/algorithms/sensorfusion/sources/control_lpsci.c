@@ -56,11 +56,10 @@
 // global structures
 uint8_t           sUARTOutputBuffer[256];             // larger than the nominal 124 byte size for outgoing packets
 
-// direct access to sfg here is the only place in the entire library where we cannot simply
-// pass a pointer.  This is because it is needed by the UART interrupt handlers.  Since this
-// only occurs here, in a subsystem which is defined to be application dependent, that is
-// considered acceptable.
-extern SensorFusionGlobals sfg;
+// The UART interrupt handler cannot be passed a pointer, so initializeControlPort records
+// the control subsystem bound to the LPSCI hardware here.  Commands are applied to the fusion
+// instance that initSensorFusionGlobals attached to that control subsystem.
+static ControlSubsystem *pControlPort;
 
 // Blocking function to write a single byte to a specified UART
 void myUART_WriteByte(UART0_Type *base, uint8_t data)
@@ -105,13 +104,13 @@ void BlueRadios_Init(void)
 void CONTROL_UART_IRQHandler(void)
 {
     uint8_t     data;
-    static char iCommandBuffer_A[5] = "~~~~";	// 5 bytes long to include the unused terminating \0
+    SensorFusionGlobals *sfg = pControlPort ? pControlPort->sfg : NULL;
 
-    sfg.setStatus(&sfg, RECEIVING_WIRED);
+    if (sfg) sfg->setStatus(sfg, RECEIVING_WIRED);
     if ((kLPSCI_RxDataRegFullFlag)&LPSCI_GetStatusFlags(CONTROL_UART))
     {
         data = LPSCI_ReadByte(CONTROL_UART);
-        DecodeCommandBytes(&sfg, iCommandBuffer_A, &data, 1);
+        if (sfg) DecodeCommandBytes(sfg, pControlPort->iCommandBuffer_A, &data, 1);
     }
 }
 
@@ -132,6 +131,14 @@ int8_t initializeControlPort(
         pComm->AccelCalPacketOn = 0;
         pComm->write = writeControlPort;
         pComm->stream = CreateAndSendPackets;
+        pComm->sfg = NULL;                          // attached by initSensorFusionGlobals
+        strcpy(pComm->iCommandBuffer_A, "~~~~");
+        strcpy(pComm->iCommandBuffer_B, "~~~~");
+        pComm->iTimeStamp = 0;
+        pComm->iThrottle = 0;
+        pComm->MagneticPacketID = 0;
+        pComm->iPacketNumber = 0;
+        pControlPort = pComm;                       // bind the UART interrupt handler to this port
 
         /* Initialize WIRED UART pins below - currently duplicates code in pin_mux.c */
         CLOCK_SetLpsci0Clock(0x1U);
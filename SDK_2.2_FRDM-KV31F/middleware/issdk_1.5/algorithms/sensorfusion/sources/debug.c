@@ -58,20 +58,10 @@
 void ApplyPerturbation(SensorFusionGlobals *sfg)
 {
 #ifdef INCLUDE_DEBUG_FUNCTIONS
-    // volatile keyword used to force compiler not to optimize out these
-    // variables.  this does unfortunately result in a couple of warnings (which
-    // can be ignored) farther down in this code.
-    volatile static uint16_t iTestProgress;        ///< Perturbation test status
-    volatile static uint16_t iTestDelay = 0;       ///< Measured delay
-    //volatile static uint16_t iTestAngle = 0;       ///< Integer Residual angle associated with measured delay
+    // the test progress, delay, threshold and starting orientation are kept in sfg
+    // so that every fusion instance runs its own test.
+    // volatile keyword used to force compiler not to optimize out this variable.
     volatile float angle=0.0f;                     ///< Float Residual angle associated with measured delay
-    volatile static float threshold=0;
-    static Quaternion StartingQ = {
-        .q0 = 1.0,
-        .q1 = 0.0,
-        .q2 = 0.0,
-        .q3 = 0.0
-    };
     Quaternion CurrentQ =  {
         .q0 = 1.0,
         .q1 = 0.0,
@@ -92,7 +82,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = 1.0F;
             ftmpq.q2 = 0.0F;
             ftmpq.q3 = 0.0F;
-            threshold = 90.0;
+            sfg->fTestThreshold = 90.0;
             break;
 
         case 2:  // 180 degrees about Y
@@ -100,7 +90,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = 0.0F;
             ftmpq.q2 = 1.0F;
             ftmpq.q3 = 0.0F;
-            threshold = 90.0;
+            sfg->fTestThreshold = 90.0;
             break;
 
         case 3:  // 180 degrees about Z
@@ -108,7 +98,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = 0.0F;
             ftmpq.q2 = 0.0F;
             ftmpq.q3 = 1.0F;
-            threshold = 90.0;
+            sfg->fTestThreshold = 90.0;
             break;
 
         case 4:  // -90 degrees about X
@@ -116,7 +106,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = -ONEOVERSQRT2;
             ftmpq.q2 = 0.0F;
             ftmpq.q3 = 0.0F;
-            threshold = 45.0;
+            sfg->fTestThreshold = 45.0;
             break;
 
         case 5:  // +90 degrees about X
@@ -124,7 +114,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = ONEOVERSQRT2;
             ftmpq.q2 = 0.0F;
             ftmpq.q3 = 0.0F;
-            threshold = 45.0;
+            sfg->fTestThreshold = 45.0;
             break;
 
         case 6:  // -90 degrees about Y
@@ -132,7 +122,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = 0.0F;
             ftmpq.q2 = -ONEOVERSQRT2;
             ftmpq.q3 = 0.0F;
-            threshold = 45.0;
+            sfg->fTestThreshold = 45.0;
             break;
 
         case 7:  // +90 degrees about Y
@@ -140,7 +130,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = 0.0F;
             ftmpq.q2 = ONEOVERSQRT2;
             ftmpq.q3 = 0.0F;
-            threshold = 45.0;
+            sfg->fTestThreshold = 45.0;
             break;
 
         case 8:  // -90 degrees about Z
@@ -148,7 +138,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = 0.0F;
             ftmpq.q2 = 0.0F;
             ftmpq.q3 = -ONEOVERSQRT2;
-            threshold = 45.0;
+            sfg->fTestThreshold = 45.0;
             break;
 
         case 9:  // +90 degrees about Z
@@ -156,7 +146,7 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
             ftmpq.q1 = 0.0F;
             ftmpq.q2 = 0.0F;
             ftmpq.q3 = ONEOVERSQRT2;
-            threshold = 45.0;
+            sfg->fTestThreshold = 45.0;
             break;
 
         default: // No rotation
@@ -213,24 +203,24 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
     }
 
     // Begin of code for white-box testing - requires IAR debugger
-    switch (iTestProgress) {
+    switch (sfg->iTestProgress) {
     case 0:  // no test in progress, check to see if we should start one
         if (sfg->iPerturbation>0) {
             // Start Test
-            iTestProgress = 1;
+            sfg->iTestProgress = 1;
             sfg->iPerturbation = 0;
-            iTestDelay = 0;
+            sfg->iTestDelay = 0;
             //iTestAngle = 0;
             // We'll need the complex conjugate of the starting quaternion
-            StartingQ.q0 = CurrentQ.q0;
-            StartingQ.q1 = -1 * CurrentQ.q1;
-            StartingQ.q2 = -1 * CurrentQ.q2;
-            StartingQ.q3 = -1 * CurrentQ.q3;
+            sfg->fqTestStart.q0 = CurrentQ.q0;
+            sfg->fqTestStart.q1 = -1 * CurrentQ.q1;
+            sfg->fqTestStart.q2 = -1 * CurrentQ.q2;
+            sfg->fqTestStart.q3 = -1 * CurrentQ.q3;
         }
         break;
     default:  // Test in progress, check to see if trigger reached
-        iTestDelay += 1;
-        qAeqAxB(&CurrentQ, &StartingQ);
+        sfg->iTestDelay += 1;
+        qAeqAxB(&CurrentQ, &(sfg->fqTestStart));
         angle = 2 * F180OVERPI * acos(CurrentQ.q0);
         angle = fmod(fabs(angle), 180.0);
         //iTestAngle = (uint16_t) (10 * angle);
@@ -239,9 +229,9 @@ void ApplyPerturbation(SensorFusionGlobals *sfg)
         // checkbox for C-Spy macro.  Then Click any of the "Test" buttons
         // in the Sensor Fusion Toolbox and monitor the results in the Messages window.
         //"Delay=", iTestDelay:%d, " Angle=",iTestAngle:%d
-        if (angle<threshold)           iTestProgress=2;  // triggered
-        if (angle < (0.2 * threshold)) iTestProgress=0;  // test is done
-        if (iTestDelay>100) iTestProgress=0;  // abort test
+        if (angle<sfg->fTestThreshold)           sfg->iTestProgress=2;  // triggered
+        if (angle < (0.2 * sfg->fTestThreshold)) sfg->iTestProgress=0;  // test is done
+        if (sfg->iTestDelay>100) sfg->iTestProgress=0;  // abort test
         break;
     }
     // End of code for white-box testing
@@ -67,12 +67,6 @@ const registerreadlist_t    FXAS21002_F_STATUS_READ[] =
     { .readFrom = FXAS21002_STATUS, .numBytes = 1 }, __END_READ_DATA__
 };
 
-// Command definition to read the number of entries in the accel FIFO.
-registerreadlist_t          FXAS21002_DATA_READ[] =
-{
-    { .readFrom = FXAS21002_OUT_X_MSB, .numBytes = 1 }, __END_READ_DATA__
-};
-
 // Each entry in a RegisterWriteList is composed of: register address, value to write, bit-mask to apply to write (0 enables)
 const registerwritelist_t   FXAS21000_Initialization[] =
 {
@@ -202,13 +196,13 @@ const registerwritelist_t   FXAS21002_Initialization[] =
 // sfg = pointer to top level (generally global) data structure for sensor fusion
 int8_t FXAS21002_Init(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 {
-
+    struct GyroSensor *pGyro = gyroInstance(sfg, sensor);   // primary or redundant gyro storage
     int32_t status;
     uint8_t reg;
 
     status = Register_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXAS21002_WHO_AM_I, 1, &reg);
     if (status==SENSOR_ERROR_NONE) {
-        sfg->Gyro.iWhoAmI = reg;
+        pGyro->iWhoAmI = reg;
         switch (reg) {
         case FXAS21002_WHO_AM_I_WHOAMI_PROD_VALUE:
         case FXAS21002_WHO_AM_I_WHOAMI_PRE_VALUE:
@@ -222,24 +216,25 @@ int8_t FXAS21002_Init(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
     }
 
     // configure FXAS21000 or FXAS21002 depending on WHOAMI value read
-    switch (sfg->Gyro.iWhoAmI) {
+    switch (pGyro->iWhoAmI) {
     case (FXAS21000_WHO_AM_I_VALUE):
         // Configure and start the FXAS21000 sensor.  This does multiple register writes
         // (see FXAS21009_Initialization definition above)
         status = Sensor_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXAS21000_Initialization );
-        sfg->Gyro.iCountsPerDegPerSec = FXAS21000_COUNTSPERDEGPERSEC;
-        sfg->Gyro.fDegPerSecPerCount = 1.0F / FXAS21000_COUNTSPERDEGPERSEC;
+        pGyro->iCountsPerDegPerSec = FXAS21000_COUNTSPERDEGPERSEC;
+        pGyro->fDegPerSecPerCount = 1.0F / FXAS21000_COUNTSPERDEGPERSEC;
         break;
     case (FXAS21002_WHO_AM_I_WHOAMI_PRE_VALUE):
     case (FXAS21002_WHO_AM_I_WHOAMI_PROD_VALUE):
         status = Sensor_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXAS21002_Initialization );
-        sfg->Gyro.iCountsPerDegPerSec = FXAS21002_COUNTSPERDEGPERSEC;
-        sfg->Gyro.fDegPerSecPerCount = 1.0F / FXAS21002_COUNTSPERDEGPERSEC;
+        pGyro->iCountsPerDegPerSec = FXAS21002_COUNTSPERDEGPERSEC;
+        pGyro->fDegPerSecPerCount = 1.0F / FXAS21002_COUNTSPERDEGPERSEC;
         break;
     }
-    sfg->Gyro.iFIFOCount=0;
+    pGyro->iFIFOCount=0;
+    pGyro->iODRHz = GYRO_ODR_HZ;
     sensor->isInitialized = F_USING_GYRO;
-    sfg->Gyro.isEnabled = true;
+    pGyro->isEnabled = true;
     return (status);
 }
 
@@ -247,8 +242,11 @@ int8_t FXAS21002_Init(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 int8_t FXAS21002_Read(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 {
     uint8_t     I2C_Buffer[6 * FXAS21002_GYRO_FIFO_SIZE]; // I2C read buffer
+    struct GyroSensor *pGyro = gyroInstance(sfg, sensor);   // primary or redundant gyro storage
     int8_t      j;                              // scratch
     uint8_t     sensor_fifo_count = 1;
+    uint8_t     fifo_first = pGyro->iFIFOCount;   // software FIFO index of the first sample of this read
+    uint32_t    timestamp;                      // time of the newest sample in the sensor FIFO
     int32_t     status;
     int16_t     sample[3];
 
@@ -258,7 +256,8 @@ int8_t FXAS21002_Read(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
     }
 
      // read the F_STATUS register (mapped to STATUS) and extract number of measurements available (lower 6 bits)
-    status =  Sensor_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXAS21002_F_STATUS_READ, I2C_Buffer );
+    status =  readSensorRegisters(sfg, sensor, FXAS21002_STATUS, 1, I2C_Buffer);
+    timestamp = ARM_timestamp();
     if (status==SENSOR_ERROR_NONE) {
 #ifdef SIMULATOR_MODE
         sensor_fifo_count = 1;
@@ -274,17 +273,13 @@ int8_t FXAS21002_Read(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 
     // at this point there must be at least one measurement in the FIFO available to read.
     // handle the FXAS21000 and FXAS21002 differently because only FXAS21002 supports WRAPTOONE feature.
-    if (sfg->Gyro.iWhoAmI == FXAS21002_WHO_AM_I_WHOAMI_OLD_VALUE)
+    if (pGyro->iWhoAmI == FXAS21002_WHO_AM_I_WHOAMI_OLD_VALUE)
     {
-        // read six sequential gyro output bytes
-        FXAS21002_DATA_READ[0].readFrom = FXAS21002_OUT_X_MSB;
-        FXAS21002_DATA_READ[0].numBytes = 6;
-
         // for FXAS21000, perform sequential 6 byte reads
         for (j = 0; j < sensor_fifo_count; j++)
         {
             // read one set of measurements totalling 6 bytes
-            status =  Sensor_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXAS21002_DATA_READ, I2C_Buffer );
+            status =  readSensorRegisters(sfg, sensor, FXAS21002_OUT_X_MSB, 6, I2C_Buffer);
 
             if (status==SENSOR_ERROR_NONE) {
                 // place the measurements read into the gyroscope buffer structure
@@ -292,16 +287,14 @@ int8_t FXAS21002_Read(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
                 sample[CHY] = (I2C_Buffer[2] << 8) | I2C_Buffer[3];
                 sample[CHZ] = (I2C_Buffer[4] << 8) | I2C_Buffer[5];
                 conditionSample(sample);  // truncate negative values to -32767
-                addToFifo((union FifoSensor*) &(sfg->Gyro), GYRO_FIFO_SIZE, sample);
+                addToFifo((union FifoSensor*) pGyro, GYRO_FIFO_SIZE, sample);
             }
         }
     }   // end of FXAS21000 FIFO read
     else
     {
         // for FXAS21002, clear the FIFO in one using WRAPTOONE feature
-        FXAS21002_DATA_READ[0].readFrom = FXAS21002_OUT_X_MSB;
-        FXAS21002_DATA_READ[0].numBytes = 6 * sensor_fifo_count;
-        status =  Sensor_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXAS21002_DATA_READ, I2C_Buffer );
+        status =  readSensorRegisters(sfg, sensor, FXAS21002_OUT_X_MSB, 6 * sensor_fifo_count, I2C_Buffer);
 
         if (status==SENSOR_ERROR_NONE) {
             for (j = 0; j < sensor_fifo_count; j++) {
@@ -310,10 +303,11 @@ int8_t FXAS21002_Read(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
                 sample[CHY] = (I2C_Buffer[6*j + 2] << 8) | I2C_Buffer[6*j + 3];
                 sample[CHZ] = (I2C_Buffer[6*j + 4] << 8) | I2C_Buffer[6*j + 5];
                 conditionSample(sample);  // truncate negative values to -32767
-                addToFifo((union FifoSensor*) &(sfg->Gyro), GYRO_FIFO_SIZE, sample);
+                addToFifo((union FifoSensor*) pGyro, GYRO_FIFO_SIZE, sample);
             }
         }
     }   // end of optimized FXAS21002 FIFO read
+    stampFifoBatch((union FifoSensor*) pGyro, pGyro->iYsTime, fifo_first, timestamp, pGyro->iODRHz);
 
     return status;
 }
@@ -330,14 +324,53 @@ const registerwritelist_t   FXAS21002_IDLE[] =
 // FXAS21002_Idle places the gyro into READY mode (wakeup time = 1/ODR+5ms)
 int8_t FXAS21002_Idle(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 {
+    struct GyroSensor *pGyro = gyroInstance(sfg, sensor);   // primary or redundant gyro storage
     int32_t     status;
     if(sensor->isInitialized == F_USING_GYRO) {
         status = Sensor_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXAS21002_IDLE );
         sensor->isInitialized = 0;
-        sfg->Gyro.isEnabled = false;
+        pGyro->isEnabled = false;
     } else {
       return SENSOR_ERROR_INIT;
     }
     return status;
 }
+// FXAS21002_SetODR changes the output data rate of an initialized gyro at run time using the
+// same ODR selection as the initialization lists.  The part passes through Standby.
+int8_t FXAS21002_SetODR(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg, uint16_t iODRHz)
+{
+    struct GyroSensor *pGyro = gyroInstance(sfg, sensor);   // primary or redundant gyro storage
+    int32_t     status;
+    uint8_t     ctrl;           // CTRL_REG1 address
+    uint8_t     reg;            // CTRL_REG1 value: ODR and Active mode
+
+    if(sensor->isInitialized != F_USING_GYRO) return SENSOR_ERROR_INIT;
+    if (pGyro->iWhoAmI == FXAS21000_WHO_AM_I_VALUE) {
+        ctrl = FXAS21000_CTRL_REG1;
+        if (iODRHz <= 1)        reg = 0x1E;     // 1.5625Hz
+        else if (iODRHz <= 3)   reg = 0x1A;     // 3.125Hz
+        else if (iODRHz <= 6)   reg = 0x16;     // 6.25Hz
+        else if (iODRHz <= 12)  reg = 0x12;     // 12.5Hz
+        else if (iODRHz <= 25)  reg = 0x0E;     // 25Hz
+        else if (iODRHz <= 50)  reg = 0x0A;     // 50Hz
+        else if (iODRHz <= 100) reg = 0x06;     // 100Hz
+        else                    reg = 0x02;     // 200Hz
+    } else {
+        ctrl = FXAS21002_CTRL_REG1;
+        if (iODRHz <= 12)       reg = 0x1A;     // 12.5Hz
+        else if (iODRHz <= 25)  reg = 0x16;     // 25Hz
+        else if (iODRHz <= 50)  reg = 0x12;     // 50Hz
+        else if (iODRHz <= 100) reg = 0x0E;     // 100Hz
+        else if (iODRHz <= 200) reg = 0x0A;     // 200Hz
+        else if (iODRHz <= 400) reg = 0x06;     // 400Hz
+        else                    reg = 0x02;     // 800Hz
+    }
+
+    // the data rate may only be changed in Standby
+    status = Register_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, ctrl, 0x00, 0x00, false);
+    if (status == SENSOR_ERROR_NONE)
+        status = Register_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, ctrl, reg, 0x00, false);
+    if (status == SENSOR_ERROR_NONE) pGyro->iODRHz = iODRHz;
+    return (status);
+}
 #endif
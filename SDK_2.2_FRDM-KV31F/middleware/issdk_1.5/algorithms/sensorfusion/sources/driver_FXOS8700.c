@@ -34,6 +34,7 @@
 
 #include "board.h"                      // generated by Kinetis Expert.  Long term - merge sensor_board.h into this file
 #include "sensor_fusion.h"              // Sensor fusion structures and types
+#include "drivers.h"                    // ARM_timestamp() for FIFO read times
 #include "sensor_io_i2c.h"              // Required for registerreadlist_t / registerwritelist_t declarations
 #include "fxos8700.h"                   // describes the FXOS8700 register definition and its bit mask
 #include "fxos8700_drv.h"               // Low level IS-SDK prototype driver
@@ -55,12 +56,6 @@ const registerreadlist_t    FXOS8700_F_STATUS_READ[] =
     { .readFrom = FXOS8700_STATUS, .numBytes = 1 }, __END_READ_DATA__
 };
 
-// Command definition to read the number of entries in the accel FIFO.
-registerreadlist_t          FXOS8700_DATA_READ[] =
-{
-    { .readFrom = FXOS8700_OUT_X_MSB, .numBytes = 6 }, __END_READ_DATA__
-};
-
 // Each entry in a RegisterWriteList is composed of: register address, value to write, bit-mask to apply to write (0 enables)
 const registerwritelist_t   FXOS8700_Initialization[] =
 {
@@ -153,20 +148,26 @@ int8_t FXOS8700_Init(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 {
     int32_t status;
     uint8_t reg;
+#if F_USING_ACCEL
+    struct AccelSensor *pAccel = accelInstance(sfg, sensor);    // primary or redundant accel storage
+#endif
+#if F_USING_MAG
+    struct MagSensor *pMag = magInstance(sfg, sensor);          // primary or redundant mag storage
+#endif
 
     status = Register_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_WHO_AM_I, 1, &reg);
 
     if (status==SENSOR_ERROR_NONE) {
 #if F_USING_ACCEL
-       sfg->Accel.iWhoAmI = reg;
-       sfg->Accel.iCountsPerg = FXOS8700_COUNTSPERG;
-       sfg->Accel.fgPerCount = 1.0F / FXOS8700_COUNTSPERG;
+       pAccel->iWhoAmI = reg;
+       pAccel->iCountsPerg = FXOS8700_COUNTSPERG;
+       pAccel->fgPerCount = 1.0F / FXOS8700_COUNTSPERG;
 #endif
 #if F_USING_MAG
-       sfg->Mag.iWhoAmI = reg;
-       sfg->Mag.iCountsPeruT = FXOS8700_COUNTSPERUT;
-       sfg->Mag.fCountsPeruT = (float) FXOS8700_COUNTSPERUT;
-       sfg->Mag.fuTPerCount = 1.0F / FXOS8700_COUNTSPERUT;
+       pMag->iWhoAmI = reg;
+       pMag->iCountsPeruT = FXOS8700_COUNTSPERUT;
+       pMag->fCountsPeruT = (float) FXOS8700_COUNTSPERUT;
+       pMag->fuTPerCount = 1.0F / FXOS8700_COUNTSPERUT;
 #endif
        if (reg != FXOS8700_WHO_AM_I_PROD_VALUE) {
           return SENSOR_ERROR_INIT;  // The whoAmI did not match
@@ -182,10 +183,10 @@ int8_t FXOS8700_Init(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
     status = Sensor_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_Initialization );
     sensor->isInitialized = F_USING_ACCEL | F_USING_MAG;
 #if F_USING_ACCEL
-    sfg->Accel.isEnabled = true;
+    pAccel->isEnabled = true;
 #endif
 #if F_USING_MAG
-    sfg->Mag.isEnabled = true;
+    pMag->isEnabled = true;
 #endif
 
     return (status);
@@ -195,10 +196,12 @@ int8_t FXOS8700_Init(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 int8_t FXOS8700_ReadAccData(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 {
     uint8_t                     I2C_Buffer[6 * FXOS8700_ACCEL_FIFO_SIZE];    // I2C read buffer
+    struct AccelSensor          *pAccel = accelInstance(sfg, sensor);       // primary or redundant accel storage
     int32_t                     status;         // I2C transaction status
     int8_t                      j;              // scratch
     uint8_t                     sensor_fifo_count;
     int16_t                     sample[3];
+    uint32_t                    timestamp;      // time of the newest sample in the sensor FIFO
 
     if(!(sensor->isInitialized & F_USING_ACCEL))
     {
@@ -206,7 +209,8 @@ int8_t FXOS8700_ReadAccData(struct PhysicalSensor *sensor, SensorFusionGlobals *
     }
 
     // read the F_STATUS register (mapped to STATUS) and extract number of measurements available (lower 6 bits)
-    status =  Sensor_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_F_STATUS_READ, I2C_Buffer );
+    status =  readSensorRegisters(sfg, sensor, FXOS8700_STATUS, 1, I2C_Buffer);
+    timestamp = ARM_timestamp();
     if (status != SENSOR_ERROR_NONE) return(status);
     else {
 #ifdef SIMULATOR_MODE
@@ -219,9 +223,8 @@ int8_t FXOS8700_ReadAccData(struct PhysicalSensor *sensor, SensorFusionGlobals *
       if  (sensor_fifo_count == 0) return(SENSOR_ERROR_READ);
     }
 
-    FXOS8700_DATA_READ[0].readFrom = FXOS8700_OUT_X_MSB;
-    FXOS8700_DATA_READ[0].numBytes = 6 * sensor_fifo_count;
-    status =  Sensor_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_DATA_READ, I2C_Buffer );
+    // drain the FIFO in one transfer, the task sleeps while the DMA moves the data
+    status =  readSensorRegisters(sfg, sensor, FXOS8700_OUT_X_MSB, 6 * sensor_fifo_count, I2C_Buffer);
 
     if (status==SENSOR_ERROR_NONE) {
         for (j = 0; j < sensor_fifo_count; j++) {
@@ -230,8 +233,9 @@ int8_t FXOS8700_ReadAccData(struct PhysicalSensor *sensor, SensorFusionGlobals *
             sample[CHZ] = (I2C_Buffer[6 * j + 4] << 8) | (I2C_Buffer[6 * j + 5]); // decode Z
             conditionSample(sample);  // truncate negative values to -32767
             // place the 6 bytes read into the 16 bit accelerometer structure
-            addToFifo((union FifoSensor*) &(sfg->Accel), ACCEL_FIFO_SIZE, sample);
+            addToFifo((union FifoSensor*) pAccel, ACCEL_FIFO_SIZE, sample);
         }
+        stampFifoBatch((union FifoSensor*) pAccel, NULL, 0, timestamp, ACCEL_ODR_HZ);
     }
 
     return (status);
@@ -242,6 +246,7 @@ int8_t FXOS8700_ReadAccData(struct PhysicalSensor *sensor, SensorFusionGlobals *
 int8_t FXOS8700_ReadMagData(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 {
     uint8_t                     I2C_Buffer[6];  // I2C read buffer
+    struct MagSensor            *pMag = magInstance(sfg, sensor);   // primary or redundant mag storage
     int32_t                     status;         // I2C transaction status
     int16_t                     sample[3];
 
@@ -251,16 +256,15 @@ int8_t FXOS8700_ReadMagData(struct PhysicalSensor *sensor, SensorFusionGlobals *
     }
 
     // read the six sequential magnetometer output bytes
-    FXOS8700_DATA_READ[0].readFrom = FXOS8700_M_OUT_X_MSB;
-    FXOS8700_DATA_READ[0].numBytes = 6;
-    status =  Sensor_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_DATA_READ, I2C_Buffer );
+    status =  readSensorRegisters(sfg, sensor, FXOS8700_M_OUT_X_MSB, 6, I2C_Buffer);
     if (status==SENSOR_ERROR_NONE) {
         // place the 6 bytes read into the magnetometer structure
         sample[CHX] = (I2C_Buffer[0] << 8) | I2C_Buffer[1];
         sample[CHY] = (I2C_Buffer[2] << 8) | I2C_Buffer[3];
         sample[CHZ] = (I2C_Buffer[4] << 8) | I2C_Buffer[5];
         conditionSample(sample);  // truncate negative values to -32767
-        addToFifo((union FifoSensor*) &(sfg->Mag), MAG_FIFO_SIZE, sample);
+        addToFifo((union FifoSensor*) pMag, MAG_FIFO_SIZE, sample);
+        stampFifoBatch((union FifoSensor*) pMag, NULL, 0, ARM_timestamp(), ACCEL_ODR_HZ);
     }
     return status;
 }
@@ -302,17 +306,47 @@ const registerwritelist_t   FXOS8700_FULL_IDLE[] =
 int8_t FXOS8700_Idle(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
 {
     int32_t     status;
+#if F_USING_ACCEL
+    struct AccelSensor *pAccel = accelInstance(sfg, sensor);    // primary or redundant accel storage
+#endif
+#if F_USING_MAG
+    struct MagSensor *pMag = magInstance(sfg, sensor);          // primary or redundant mag storage
+#endif
     if(sensor->isInitialized == (F_USING_ACCEL|F_USING_MAG)) {
         status = Sensor_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_FULL_IDLE );
         sensor->isInitialized = 0;
 #if F_USING_ACCEL
-        sfg->Accel.isEnabled = false;
+        pAccel->isEnabled = false;
 #endif
 #if F_USING_MAG
-        sfg->Mag.isEnabled = false;
+        pMag->isEnabled = false;
 #endif
     } else {
       return SENSOR_ERROR_INIT;
     }
     return status;
 }
+
+// FXOS8700_SetODR changes the hybrid accel and mag output data rate of an initialized sensor at
+// run time using the same ODR selection as FXOS8700_Initialization.  The part passes through Standby.
+int8_t FXOS8700_SetODR(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg, uint16_t iODRHz)
+{
+    int32_t     status;
+    uint8_t     reg;            // CTRL_REG1 value: ODR, low noise and Active mode
+
+    if(sensor->isInitialized != (F_USING_ACCEL|F_USING_MAG)) return SENSOR_ERROR_INIT;
+    if (iODRHz <= 1)            reg = 0x3D;     // 0.78Hz
+    else if (iODRHz <= 3)       reg = 0x35;     // 3.125Hz
+    else if (iODRHz <= 6)       reg = 0x2D;     // 6.25Hz
+    else if (iODRHz <= 30)      reg = 0x25;     // 25Hz
+    else if (iODRHz <= 50)      reg = 0x1D;     // 50Hz
+    else if (iODRHz <= 100)     reg = 0x15;     // 100Hz
+    else if (iODRHz <= 200)     reg = 0x0D;     // 200Hz
+    else                        reg = 0x05;     // 400Hz
+
+    // the data rate may only be changed in Standby
+    status = Register_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_CTRL_REG1, 0x00, 0x00, false);
+    if (status == SENSOR_ERROR_NONE)
+        status = Register_I2C_Write(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, FXOS8700_CTRL_REG1, reg, 0x00, false);
+    return (status);
+}
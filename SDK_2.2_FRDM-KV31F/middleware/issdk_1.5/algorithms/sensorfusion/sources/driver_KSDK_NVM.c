@@ -68,3 +68,49 @@ byte NVM_SetBlockFlash(uint8_t *Source, uint32_t Dest, uint16_t Count)
 
     return(retVal);
 }
+
+// erase the single flash sector starting at Dest without programming it
+byte NVM_EraseSectorFlash(uint32_t Dest)
+{
+    status_t result;
+    uint32_t pflashSectorSize = 0;
+    flash_config_t flashDriver;                                            /* Flash driver Structure */
+
+    memset(&flashDriver, 0, sizeof(flash_config_t));
+    result = FLASH_Init(&flashDriver);
+    if (kStatus_FLASH_Success == result)
+    {
+        FLASH_GetProperty(&flashDriver, FLASH_SECTOR_SIZE_PROPERTY, &pflashSectorSize);
+        result = FLASH_Erase(&flashDriver, Dest, pflashSectorSize,  FLASH_ERASE_KEY);
+    }
+
+    return((kStatus_FLASH_Success == result) ? 0 : ERROR);
+}
+
+// program Count bytes at Dest which must already be erased: no sector erase is performed
+// Dest and Count must be multiples of the flash write unit
+byte NVM_ProgramFlash(uint8_t *Source, uint32_t Dest, uint16_t Count)
+{
+    status_t result;
+    flash_config_t flashDriver;                                            /* Flash driver Structure */
+
+    memset(&flashDriver, 0, sizeof(flash_config_t));
+    result = FLASH_Init(&flashDriver);
+    if (kStatus_FLASH_Success == result)
+        result = FLASH_Program(&flashDriver, Dest, (uint32_t*) Source, Count);
+
+    return((kStatus_FLASH_Success == result) ? 0 : ERROR);
+}
+
+// return the program flash sector (minimum erase) size in bytes
+uint32_t NVM_GetSectorSize(void)
+{
+    uint32_t pflashSectorSize = 0;
+    flash_config_t flashDriver;                                            /* Flash driver Structure */
+
+    memset(&flashDriver, 0, sizeof(flash_config_t));
+    if (kStatus_FLASH_Success == FLASH_Init(&flashDriver))
+        FLASH_GetProperty(&flashDriver, FLASH_SECTOR_SIZE_PROPERTY, &pflashSectorSize);
+
+    return(pflashSectorSize);
+}
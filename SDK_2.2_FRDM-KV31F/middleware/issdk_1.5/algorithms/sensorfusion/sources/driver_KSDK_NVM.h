@@ -36,5 +36,8 @@
 #define DRVNVM_H
 
 byte NVM_SetBlockFlash(uint8_t *Source, uint32_t Dest, uint16_t Count);
+byte NVM_EraseSectorFlash(uint32_t Dest);
+byte NVM_ProgramFlash(uint8_t *Source, uint32_t Dest, uint16_t Count);
+uint32_t NVM_GetSectorSize(void);
 
 #endif
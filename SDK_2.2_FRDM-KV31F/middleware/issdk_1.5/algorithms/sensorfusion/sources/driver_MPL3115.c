@@ -55,12 +55,6 @@ const registerreadlist_t    MPL3115_F_STATUS_READ[] =
     { .readFrom = MPL3115_STATUS, .numBytes = 1 }, __END_READ_DATA__
 };
 
-// Command definition to read the number of entries in the accel FIFO.
-registerreadlist_t          MPL3115_DATA_READ[] =
-{
-    { .readFrom = MPL3115_OUT_P_MSB, .numBytes = 5 }, __END_READ_DATA__
-};
-
 // Each entry in a RegisterWriteList is composed of: register address, value to write, bit-mask to apply to write (0 enables)
 const registerwritelist_t   MPL3115_Initialization[] =
 {
@@ -127,7 +121,8 @@ int8_t MPL3115_Read(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg)
         return SENSOR_ERROR_INIT;
     }
 
-    status =  Sensor_I2C_Read(sensor->bus_driver, &sensor->deviceInfo, sensor->addr, MPL3115_DATA_READ, I2C_Buffer );
+    // read pressure/altitude (3 bytes) and temperature (2 bytes) in one transfer
+    status =  readSensorRegisters(sfg, sensor, MPL3115_OUT_P_MSB, 5, I2C_Buffer);
 
     if (status==SENSOR_ERROR_NONE) {
       	// place the read buffer into the 32 bit altitude and 16 bit temperature
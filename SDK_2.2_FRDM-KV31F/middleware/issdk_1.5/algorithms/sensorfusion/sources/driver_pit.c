@@ -96,3 +96,10 @@ void pit_init(uint32_t microseconds)
     EnableIRQ(PIT_IRQ_ID);
     PIT_StartTimer(PIT, kPIT_Chnl_0);
 }
+
+// pit_set_period changes the interval of the running timer.  The new load value is taken
+// when the current period expires, so no interrupt is lost or doubled.
+void pit_set_period(uint32_t microseconds)
+{
+    PIT_SetTimerPeriod(PIT, kPIT_Chnl_0, USEC_TO_COUNT(microseconds, PIT_SOURCE_CLOCK));
+}
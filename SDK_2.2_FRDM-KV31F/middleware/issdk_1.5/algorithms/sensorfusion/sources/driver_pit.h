@@ -46,6 +46,7 @@ void pit_init(uint32_t microseconds, void (*WakeUpReadTaskCallBack)(void));
 #else
 void pit_init(uint32_t microseconds);
 #endif
+void pit_set_period(uint32_t microseconds);
 extern volatile bool pitIsrFlag;
 
 
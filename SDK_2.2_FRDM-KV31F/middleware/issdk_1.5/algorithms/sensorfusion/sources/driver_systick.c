@@ -73,6 +73,34 @@ int32 ARM_systick_elapsed_ticks(int32 start_ticks)
 	return elapsed_ticks;
 }
 
+// ARM-core specific function that starts the free-running DWT cycle counter (M3/M4 only).
+// Unlike SysTick it is not reprogrammed by an RTOS, so it can timestamp sensor reads.
+void ARM_timestamp_enable(void)
+{
+#if (__CORTEX_M >= 3)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;     // enable the DWT unit
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                // start counting core clock cycles
+#endif
+    return;
+}
+
+// ARM-core specific function returning the free-running 32 bit timestamp
+uint32 ARM_timestamp(void)
+{
+#if (__CORTEX_M >= 3)
+    return DWT->CYCCNT;
+#else
+    return 0;
+#endif
+}
+
+// frequency (Hz) of the ARM_timestamp() counter
+uint32 ARM_timestamp_hz(void)
+{
+    return SystemCoreClock;
+}
+
 void ARM_systick_delay_ms(uint32 iSystemCoreClock, uint32 delay_ms)
 {
 	int32 istart_ticks;	// start ticks on entry
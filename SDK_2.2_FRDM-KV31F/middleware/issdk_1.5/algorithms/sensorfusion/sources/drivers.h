@@ -56,6 +56,17 @@ int32_t ARM_systick_elapsed_ticks(int32_t start_ticks);
 void ARM_systick_delay_ms(uint32_t iSystemCoreClock, uint32_t delay_ms);
 ///@}
 
+/// @name Timestamp Functions
+/// A free-running 32 bit counter used to timestamp sensor FIFO reads.  It wraps
+/// every 2^32 / ARM_timestamp_hz() seconds, so only differences are meaningful.
+/// On cores without a cycle counter ARM_timestamp() returns 0 and the fusion
+/// falls back to evenly spaced samples.
+///@{
+void ARM_timestamp_enable(void);
+uint32_t ARM_timestamp(void);
+uint32_t ARM_timestamp_hz(void);
+///@}
+
 /// @name Sensor Drivers
 /// Each physical sensor must be provided with one initialization function
 /// and one "read" function.  These must be installed by the user using the
@@ -100,6 +111,9 @@ int8_t FXLS8471Q_Idle(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg);
 int8_t FXLS8962_Idle(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg);
 int8_t FXLS8972_Idle(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg);
 
+int8_t FXOS8700_SetODR(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg, uint16_t iODRHz);
+int8_t FXAS21002_SetODR(struct PhysicalSensor *sensor, SensorFusionGlobals *sfg, uint16_t iODRHz);
+
 ///@}
 
 
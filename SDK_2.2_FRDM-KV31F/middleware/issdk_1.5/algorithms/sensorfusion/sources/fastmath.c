@@ -0,0 +1,661 @@
+/*
+ * Copyright (c) 2015 - 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2017 NXP
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * o Redistributions of source code must retain the above copyright notice, this list
+ *   of conditions and the following disclaimer.
+ *
+ * o Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * o Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*! \file fastmath.c
+    \brief Table driven trigonometry and reciprocal square root kernels
+
+    Each kernel looks up the nearest node of a small table and corrects with a
+    short polynomial in the residual, so the cost is a handful of multiplies
+    and at most one division.  The tables hold double precision values rounded
+    to the storage type.  See fastmath.h for the fixed point angle convention.
+*/
+
+#include "math.h"
+#include "stdint.h"
+
+#include "fastmath.h"
+
+// compile time constants that are private to this file
+#define FMPI 3.14159265358979F          // pi
+#define FMPIOVER2 1.57079632679490F     // pi / 2
+#define FMRAD2DEG 57.2957795130823F     // radians to degrees = 180 / pi
+#define FMSTEPINV 4.074366379E+01F      // sine table nodes per radian = 128 / pi
+#define FMSTEPHI 2.453613281E-02F       // pi / 128 rounded to 12 significant bits so k * FMSTEPHI is exact
+#define FMSTEPLO 7.559793630E-06F       // pi / 128 - FMSTEPHI
+#define FMONEOVER6 0.166666666667F      // 1 / 6
+#define PI_Q29 1686629713               // pi in Q29
+
+// sin(k * pi / 128) for k = 0 to 64: one quarter wave at 256 nodes per turn
+static const float fSinTable[65] = {
+    0.000000000E+00F, 2.454122901E-02F, 4.906767607E-02F, 7.356456667E-02F,
+    9.801714122E-02F, 1.224106774E-01F, 1.467304677E-01F, 1.709618866E-01F,
+    1.950903237E-01F, 2.191012353E-01F, 2.429801822E-01F, 2.667127550E-01F,
+    2.902846634E-01F, 3.136817515E-01F, 3.368898630E-01F, 3.598950505E-01F,
+    3.826834261E-01F, 4.052413106E-01F, 4.275550842E-01F, 4.496113360E-01F,
+    4.713967443E-01F, 4.928981960E-01F, 5.141027570E-01F, 5.349976420E-01F,
+    5.555702448E-01F, 5.758081675E-01F, 5.956993103E-01F, 6.152315736E-01F,
+    6.343932748E-01F, 6.531728506E-01F, 6.715589762E-01F, 6.895405650E-01F,
+    7.071067691E-01F, 7.242470980E-01F, 7.409511209E-01F, 7.572088242E-01F,
+    7.730104327E-01F, 7.883464098E-01F, 8.032075167E-01F, 8.175848126E-01F,
+    8.314695954E-01F, 8.448535800E-01F, 8.577286005E-01F, 8.700869679E-01F,
+    8.819212914E-01F, 8.932242990E-01F, 9.039893150E-01F, 9.142097831E-01F,
+    9.238795042E-01F, 9.329928160E-01F, 9.415440559E-01F, 9.495281577E-01F,
+    9.569403529E-01F, 9.637760520E-01F, 9.700312614E-01F, 9.757021070E-01F,
+    9.807852507E-01F, 9.852776527E-01F, 9.891765118E-01F, 9.924795628E-01F,
+    9.951847196E-01F, 9.972904325E-01F, 9.987954497E-01F, 9.996988177E-01F,
+    1.000000000E+00F,
+};
+
+// the same quarter wave in Q31, sin(pi / 2) saturated to 0x7FFFFFFF
+static const int32_t iSinTable[65] = {
+    0, 52701887, 105372028, 157978697, 210490206, 262874923,
+    315101295, 367137861, 418953276, 470516330, 521795963, 572761285,
+    623381598, 673626408, 723465451, 772868706, 821806413, 870249095,
+    918167572, 965532978, 1012316784, 1058490808, 1104027237, 1148898640,
+    1193077991, 1236538675, 1279254516, 1321199781, 1362349204, 1402678000,
+    1442161874, 1480777044, 1518500250, 1555308768, 1591180426, 1626093616,
+    1660027308, 1692961062, 1724875040, 1755750017, 1785567396, 1814309216,
+    1841958164, 1868497586, 1893911494, 1918184581, 1941302225, 1963250501,
+    1984016189, 2003586779, 2021950484, 2039096241, 2055013723, 2069693342,
+    2083126254, 2095304370, 2106220352, 2115867626, 2124240380, 2131333572,
+    2137142927, 2141664948, 2144896910, 2146836866, 2147483647,
+};
+
+// atan(t) around the nodes t = k / 32, k = 0 to 32:
+// atan(t + h) = A + h * (B + h * (C + h * D)) with A = atan(t), B = 1 / (1 + t^2),
+// C = -t B^2 and D = (3t^2 - 1) B^3 / 3, the Taylor series to third order in h
+static const float fAtanTable[33][4] = {
+    {0.000000000E+00F, 1.000000000E+00F, -0.000000000E+00F, -3.333333433E-01F},
+    {3.123983368E-02F, 9.990243912E-01F, -3.118905425E-02F, -3.313849568E-01F},
+    {6.241881102E-02F, 9.961089492E-01F, -6.201456487E-02F, -3.255965710E-01F},
+    {9.347677976E-02F, 9.912875295E-01F, -9.212352335E-02F, -3.161351979E-01F},
+    {1.243549958E-01F, 9.846153855E-01F, -1.211834326E-01F, -3.032692969E-01F},
+    {1.549967378E-01F, 9.761677980E-01F, -1.488911808E-01F, -2.873547673E-01F},
+    {1.853479445E-01F, 9.660377502E-01F, -1.749804169E-01F, -2.688168883E-01F},
+    {2.153577060E-01F, 9.543336630E-01F, -1.992271543E-01F, -2.481298894E-01F},
+    {2.449786663E-01F, 9.411764741E-01F, -2.214532942E-01F, -2.257955074E-01F},
+    {2.741674483E-01F, 9.266968369E-01F, -2.415282279E-01F, -2.023218870E-01F},
+    {3.028848767E-01F, 9.110320210E-01F, -2.593685389E-01F, -1.782043427E-01F},
+    {3.310960829E-01F, 8.943231702E-01F, -2.749360204E-01F, -1.539088786E-01F},
+    {3.587706685E-01F, 8.767123222E-01F, -2.882342041E-01F, -1.298589408E-01F},
+    {3.858826756E-01F, 8.583403230E-01F, -2.993039191E-01F, -1.064260304E-01F},
+    {4.124104381E-01F, 8.393442631E-01F, -3.082182109E-01F, -8.392389864E-02F},
+    {4.383365512E-01F, 8.198558688E-01F, -3.150767088E-01F, -6.260611862E-02F},
+    {4.636476040E-01F, 8.000000119E-01F, -3.199999928E-01F, -4.266666621E-02F},
+    {4.883339405E-01F, 7.798933983E-01F, -3.231241405E-01F, -2.424287610E-02F},
+    {5.123894811E-01F, 7.596439123E-01F, -3.245956302E-01F, -7.420144044E-03F},
+    {5.358112454E-01F, 7.393501997E-01F, -3.245667219E-01F, 7.762137800E-03F},
+    {5.585992932E-01F, 7.191011310E-01F, -3.231915236E-01F, 2.130400948E-02F},
+    {5.807563663E-01F, 6.989760995E-01F, -3.206224740E-01F, 3.323816136E-02F},
+    {6.022873521E-01F, 6.790450811E-01F, -3.170077801E-01F, 4.362328723E-02F},
+    {6.231993437E-01F, 6.593689919E-01F, -3.124890924E-01F, 5.253789574E-02F},
+    {6.435011029E-01F, 6.399999857E-01F, -3.072000146E-01F, 6.007466838E-02F},
+    {6.632030010E-01F, 6.209824085E-01F, -3.012649715E-01F, 6.633553654E-02F},
+    {6.823165417E-01F, 6.023529172E-01F, -2.947986126E-01F, 7.142752409E-02F},
+    {7.008544207E-01F, 5.841414928E-01F, -2.879054248E-01F, 7.545927167E-02F},
+    {7.188299894E-01F, 5.663716793E-01F, -2.806797624E-01F, 7.853829116E-02F},
+    {7.362574339E-01F, 5.490616560E-01F, -2.732060254E-01F, 8.076883107E-02F},
+    {7.531512976E-01F, 5.322245359E-01F, -2.655590177E-01F, 8.225029707E-02F},
+    {7.695264816E-01F, 5.158690214E-01F, -2.578045726E-01F, 8.307617903E-02F},
+    {7.853981853E-01F, 5.000000000E-01F, -2.500000000E-01F, 8.333333582E-02F},
+};
+
+// the same series to fourth order, E = t (1 - t^2) B^4, with all five coefficients divided by pi in Q31
+static const int32_t iAtanTable[33][5] = {
+    {0, 683565276, 0, -227855092, 0},
+    {21354465, 682898383, -21319754, -226523257, 21257396},
+    {42667331, 680905489, -42391003, -222566512, 41897450},
+    {63897482, 677609721, -62972443, -216099044, 61336063},
+    {85004756, 673048887, -82836786, -207304367, 79052762},
+    {105950391, 667274397, -101776838, -196425741, 94615747},
+    {126697423, 660349851, -119610539, -183753885, 107699731},
+    {147211045, 652349340, -136184764, -169612978, 118095582},
+    {167458907, 643355553, -151377777, -154345969, 125711649},
+    {187411349, 633457776, -165100307, -138300214, 130567466},
+    {207041579, 622749860, -177295334, -121814303, 132781207},
+    {226325781, 611328246, -187936719, -105206761, 132552637},
+    {245243172, 599290105, -197026884, -88767059, 130143485},
+    {263775993, 586731636, -204593764, -72749140, 125857058},
+    {281909457, 573746592, -210687273, -57367464, 120018704},
+    {299631651, 560425014, -215375506, -42795368, 112958306},
+    {316933406, 546852220, -218740888, -29165452, 104995626},
+    {333808132, 533108029, -220876442, -16571588, 96428906},
+    {350251643, 519266203, -221882295, -5072153, 87526762},
+    {366261957, 505394110, -221862541, 5305928, 78523187},
+    {381839095, 491552558, -220922498, 14562682, 69615270},
+    {396984877, 477795797, -219166400, 22720452, 60963127},
+    {411702716, 464171646, -216695516, 29819365, 52691548},
+    {425997422, 450721727, -213606691, 35913082, 44892842},
+    {439875013, 437481776, -209991253, 41064956, 37630432},
+    {453342536, 424482015, -205934270, 45344670, 30942840},
+    {466407904, 411747554, -201514097, 48825376, 24847734},
+    {479079736, 399298826, -196802160, 51581340, 19345858},
+    {491367227, 387152014, -191862945, 53686050, 14424656},
+    {503280012, 375319486, -186754147, 55210766, 10061521},
+    {514828063, 363810209, -181526923, 56223446, 6226623},
+    {526021581, 352630147, -176226250, 56787991, 2885294},
+    {536870912, 341782638, -170891319, 56963773, 0},
+};
+
+// 1 / sqrt(m) at the centre of 32 mantissa bins, for 2 <= m < 4 (entries 0 to 31, odd exponent)
+// and 1 <= m < 2 (entries 32 to 63, even exponent), indexed by the exponent lsb and top five mantissa bits
+static const float fRsqrtSeed[64] = {
+    7.016463876E-01F, 6.910947561E-01F, 6.810052395E-01F, 6.713451147E-01F,
+    6.620846987E-01F, 6.531972885E-01F, 6.446583867E-01F, 6.364458203E-01F,
+    6.285393834E-01F, 6.209204197E-01F, 6.135720015E-01F, 6.064784527E-01F,
+    5.996253490E-01F, 5.929994583E-01F, 5.865884423E-01F, 5.803809762E-01F,
+    5.743665099E-01F, 5.685352683E-01F, 5.628780127E-01F, 5.573863983E-01F,
+    5.520524383E-01F, 5.468687415E-01F, 5.418283939E-01F, 5.369248390E-01F,
+    5.321520567E-01F, 5.275043845E-01F, 5.229763389E-01F, 5.185629725E-01F,
+    5.142594576E-01F, 5.100613832E-01F, 5.059643984E-01F, 5.019646287E-01F,
+    9.922778606E-01F, 9.773555398E-01F, 9.630868435E-01F, 9.494253397E-01F,
+    9.363291860E-01F, 9.237604141E-01F, 9.116846323E-01F, 9.000703096E-01F,
+    8.888888955E-01F, 8.781141043E-01F, 8.677218556E-01F, 8.576900363E-01F,
+    8.479983211E-01F, 8.386278749E-01F, 8.295613527E-01F, 8.207826614E-01F,
+    8.122769594E-01F, 8.040302396E-01F, 7.960297465E-01F, 7.882634401E-01F,
+    7.807200551E-01F, 7.733892202E-01F, 7.662610412E-01F, 7.593263984E-01F,
+    7.525767088E-01F, 7.460038662E-01F, 7.396002412E-01F, 7.333588004E-01F,
+    7.272727489E-01F, 7.213357091E-01F, 7.155417800E-01F, 7.098851800E-01F,
+};
+
+// 1 / sqrt(x) in Q30 at the centre of 24 bins 1/32 wide covering 0.25 <= x < 1
+static const int32_t iRsqrtSeed[24] = {
+    2083365155, 1970666148, 1874477404, 1791125178, 1717986918, 1653133683,
+    1595110809, 1542797797, 1495315679, 1451963954, 1412176548, 1375490368,
+    1341522400, 1309952745, 1280511845, 1252970736, 1227133513, 1202831433,
+    1179918260, 1158266544, 1137764631, 1118314230, 1099828424, 1082230034,
+};
+
+// round Q31 to Q15 with saturation
+static int16_t iQ31toQ15(int32_t i)
+{
+	i = ((i >> 15) + 1) >> 1;
+	if (i > 32767) return 32767;
+	return (int16_t) i;
+}
+
+// number of leading zero bits in a non-zero 32 bit word
+static int32_t iLeadingZeros(uint32_t u)
+{
+#if defined(__GNUC__)
+	return __builtin_clz(u);
+#else
+	int32_t n = 0;
+	while (!(u & 0x80000000U))
+	{
+		u <<= 1;
+		n++;
+	}
+	return n;
+#endif
+}
+
+// function returns sin(x) and cos(x) for x in radians
+
+// maximum error is 6.1E-8 for |x| <= 100 rad.  The argument reduction is exact for |x| < 100 rad
+// and the error grows with the spacing of floats beyond that.  x must be finite with |x| < 5E7 rad
+void ffastsincos(float x, float *pfsin, float *pfcos)
+{
+	float fu;					// x in table steps
+	float fd;					// residual angle (rad) -pi/256 <= fd <= pi/256
+	float fd2;					// fd^2
+	float fsind;				// sin(fd)
+	float fcosdm1;				// cos(fd) - 1
+	float fs, fc;				// sine and cosine at the nearest table node
+	float ftmp;					// scratch
+	int32_t k;					// nearest table node (256 per turn)
+	uint32_t i;					// quarter wave table index
+
+	// find the nearest node and the residual angle using the two part pi / 128
+	fu = x * FMSTEPINV;
+	k = (int32_t) (fu + ((fu >= 0.0F) ? 0.5F : -0.5F));
+	fd = (x - (float) k * FMSTEPHI) - (float) k * FMSTEPLO;
+
+	// third order sine and second order cosine of the residual angle
+	fd2 = fd * fd;
+	fsind = fd * (1.0F - FMONEOVER6 * fd2);
+	fcosdm1 = -0.5F * fd2;
+
+	// sine and cosine of the node from the quarter wave table
+	i = (uint32_t) k & 63U;
+	fs = fSinTable[i];
+	fc = fSinTable[64U - i];
+	switch (((uint32_t) k >> 6) & 3U)
+	{
+	case 1:
+		ftmp = fs;
+		fs = fc;
+		fc = -ftmp;
+		break;
+	case 2:
+		fs = -fs;
+		fc = -fc;
+		break;
+	case 3:
+		ftmp = fs;
+		fs = -fc;
+		fc = ftmp;
+		break;
+	default:
+		break;
+	}
+
+	// angle addition formulae
+	*pfsin = fs + (fs * fcosdm1 + fc * fsind);
+	*pfcos = fc + (fc * fcosdm1 - fs * fsind);
+}
+
+// function returns sin(x) for x in radians with the error and domain of ffastsincos
+float ffastsin(float x)
+{
+	float fsin, fcos;
+
+	ffastsincos(x, &fsin, &fcos);
+	return fsin;
+}
+
+// function returns cos(x) for x in radians with the error and domain of ffastsincos
+float ffastcos(float x)
+{
+	float fsin, fcos;
+
+	ffastsincos(x, &fsin, &fcos);
+	return fcos;
+}
+
+// function returns angle(rad)=atan2(y, x) in the range -pi < angle <= pi for finite y and x
+// and returns 0 for y = x = 0
+
+// maximum error is 2.9E-7 rad
+float ffastatan2(float y, float x)
+{
+	float fax, fay;				// |x| and |y|
+	float ft;					// min(|x|, |y|) / max(|x|, |y|) in the range 0 to 1
+	float fh;					// offset from the nearest table node -1/64 <= fh <= 1/64
+	float fangle;				// computed angle (rad)
+	const float *pf;			// table row of the nearest node
+	int32_t k;					// nearest table node
+
+	fax = fabsf(x);
+	fay = fabsf(y);
+	if (fay <= fax)
+	{
+		if (fax == 0.0F) return 0.0F;
+		ft = fay / fax;
+	}
+	else
+	{
+		ft = fax / fay;
+	}
+
+	// atan(ft) from the nearest node of the table
+	k = (int32_t) (ft * 32.0F + 0.5F);
+	fh = ft - (float) k * 0.03125F;
+	pf = fAtanTable[k];
+	fangle = pf[0] + fh * (pf[1] + fh * (pf[2] + fh * pf[3]));
+
+	// undo the octant mapping
+	if (fay > fax) fangle = FMPIOVER2 - fangle;
+	if (x < 0.0F) fangle = FMPI - fangle;
+	if (y < 0.0F) fangle = -fangle;
+
+	return fangle;
+}
+
+// function returns angle(rad)=asin(x) for x in the range -1 <= x <= 1
+// and returns -pi/2 <= angle <= pi/2, clamping arguments outside the range
+
+// maximum error is 3.1E-7 rad
+float ffastasin(float x)
+{
+	if (x >= 1.0F) return FMPIOVER2;
+	if (x <= -1.0F) return -FMPIOVER2;
+
+	// (1 - x)(1 + x) keeps full precision near |x| = 1 where 1 - x^2 does not
+	return ffastatan2(x, sqrtf((1.0F - x) * (1.0F + x)));
+}
+
+// function returns angle(rad)=acos(x) for x in the range -1 <= x <= 1
+// and returns 0 <= angle <= pi, clamping arguments outside the range
+
+// maximum error is 3.1E-7 rad
+float ffastacos(float x)
+{
+	if (x >= 1.0F) return 0.0F;
+	if (x <= -1.0F) return FMPI;
+
+	return ffastatan2(sqrtf((1.0F - x) * (1.0F + x)), x);
+}
+
+// function returns 1 / sqrt(x) for positive normal x and returns 0 for x <= 0
+
+// maximum relative error is 1.9E-7
+float ffastrsqrt(float x)
+{
+	union
+	{
+		float f;
+		uint32_t i;
+	} fu;						// float and its bit pattern
+	float fy;					// estimate of 1 / sqrt(x)
+	int32_t ie;					// even unbiased exponent of the table entry
+
+	if (!(x > 0.0F)) return 0.0F;
+
+	// seed from the table scaled by 2^(-ie/2) where x = m * 2^ie and 1 <= m < 4
+	fu.f = x;
+	ie = (int32_t) (fu.i >> 23) - 127;
+	ie -= ie & 1;
+	fu.f = fRsqrtSeed[(fu.i >> 18) & 0x3FU];
+	fu.i -= (uint32_t) (ie / 2) << 23;
+	fy = fu.f;
+
+	// two Newton iterations y = y (3 - x y^2) / 2 take the 0.8% seed error below the float rounding error
+	fy = fy * (1.5F - 0.5F * x * fy * fy);
+	fy = fy * (1.5F - 0.5F * x * fy * fy);
+
+	return fy;
+}
+
+// function returns angle(deg)=atan(x) in the range -90 to 90 deg
+
+// maximum error is 2.6E-5 deg
+float ffastatan_deg(float x)
+{
+	return FMRAD2DEG * ffastatan2(x, 1.0F);
+}
+
+// function returns angle(deg)=atan2(y, x) in the range -180 < angle <= 180 deg
+
+// maximum error is 2.6E-5 deg
+float ffastatan2_deg(float y, float x)
+{
+	return FMRAD2DEG * ffastatan2(y, x);
+}
+
+// function returns angle(deg)=asin(x) in the range -90 to 90 deg
+
+// maximum error is 2.6E-5 deg
+float ffastasin_deg(float x)
+{
+	return FMRAD2DEG * ffastasin(x);
+}
+
+// function returns angle(deg)=acos(x) in the range 0 to 180 deg
+
+// maximum error is 2.6E-5 deg
+float ffastacos_deg(float x)
+{
+	return FMRAD2DEG * ffastacos(x);
+}
+
+// sine and cosine in Q31 of an angle in Q31 units of pi
+static void iSinCosQ31(int32_t iangle, int32_t *pisin, int32_t *picos)
+{
+	uint32_t k;					// nearest table node (256 per turn)
+	uint32_t i;					// quarter wave table index
+	int32_t id;					// residual angle in Q31 units of pi, |id| <= 2^23
+	int32_t idr;				// residual angle in Q31 radians
+	int32_t id2;				// idr^2
+	int32_t isind;				// sin(residual)
+	int32_t icosdm1;			// cos(residual) - 1
+	int32_t is, ic;				// sine and cosine at the nearest table node
+	int32_t itmp;				// scratch
+	int64_t iacc;				// accumulator
+
+	// one turn is 2^32 so the node and residual follow from the unsigned angle with wrap around
+	k = ((uint32_t) iangle + 0x00800000U) >> 24;
+	id = (int32_t) ((uint32_t) iangle - (k << 24));
+	idr = (int32_t) (((int64_t) id * PI_Q29) >> 29);
+
+	// fifth order sine and fourth order cosine of the residual angle
+	id2 = (int32_t) (((int64_t) idr * idr) >> 31);
+	isind = idr - (int32_t) ((((int64_t) idr * id2) >> 31) / 6);
+	icosdm1 = -(id2 >> 1) + (int32_t) ((((int64_t) (id2 >> 1) * (id2 >> 1)) >> 31) / 6);
+
+	// sine and cosine of the node from the quarter wave table
+	i = k & 63U;
+	is = iSinTable[i];
+	ic = iSinTable[64U - i];
+	switch ((k >> 6) & 3U)
+	{
+	case 1:
+		itmp = is;
+		is = ic;
+		ic = -itmp;
+		break;
+	case 2:
+		is = -is;
+		ic = -ic;
+		break;
+	case 3:
+		itmp = is;
+		is = -ic;
+		ic = itmp;
+		break;
+	default:
+		break;
+	}
+
+	// angle addition formulae with rounding and saturation
+	iacc = (int64_t) is + (((int64_t) is * icosdm1 + (int64_t) ic * isind + 0x40000000) >> 31);
+	*pisin = (int32_t) ((iacc > 0x7FFFFFFF) ? 0x7FFFFFFF : ((iacc < -0x7FFFFFFF) ? -0x7FFFFFFF : iacc));
+	iacc = (int64_t) ic + (((int64_t) ic * icosdm1 - (int64_t) is * isind + 0x40000000) >> 31);
+	*picos = (int32_t) ((iacc > 0x7FFFFFFF) ? 0x7FFFFFFF : ((iacc < -0x7FFFFFFF) ? -0x7FFFFFFF : iacc));
+}
+
+// atan(t) / pi in Q31 for 0 <= t <= 1 with t in unsigned Q31 (1.0 = 0x80000000)
+static int32_t iAtanUnitQ31(uint32_t it)
+{
+	uint32_t k;					// nearest table node
+	int32_t ih;					// offset from the node in Q31, |ih| <= 2^25
+	int32_t ir;					// Horner accumulator
+	const int32_t *pi;			// table row of the nearest node
+
+	k = (it + (1U << 25)) >> 26;
+	ih = (int32_t) (it - (k << 26));
+	pi = iAtanTable[k];
+	ir = pi[3] + (int32_t) (((int64_t) pi[4] * ih + 0x40000000) >> 31);
+	ir = pi[2] + (int32_t) (((int64_t) ir * ih + 0x40000000) >> 31);
+	ir = pi[1] + (int32_t) (((int64_t) ir * ih + 0x40000000) >> 31);
+	ir = pi[0] + (int32_t) (((int64_t) ir * ih + 0x40000000) >> 31);
+
+	return ir;
+}
+
+// maps atan(min / max) / pi in Q31 onto the four quadrant angle in Q31 units of pi
+static int32_t iUnfoldAtan2Q31(int32_t iangle, int32_t iswapped, int32_t ixnegative, int32_t iynegative)
+{
+	if (iswapped) iangle = 0x40000000 - iangle;
+	if (ixnegative) iangle = (iangle == 0) ? 0x7FFFFFFF : (int32_t) (0x80000000U - (uint32_t) iangle);
+	if (iynegative) iangle = -iangle;
+
+	return iangle;
+}
+
+// function returns sin(angle) in Q31 for an angle in Q31 units of pi
+
+// maximum error is 3 LSB (1.4E-9)
+int32_t ifastsin_q31(int32_t iangle)
+{
+	int32_t isin, icos;
+
+	iSinCosQ31(iangle, &isin, &icos);
+	return isin;
+}
+
+// function returns cos(angle) in Q31 for an angle in Q31 units of pi
+
+// maximum error is 3 LSB (1.4E-9)
+int32_t ifastcos_q31(int32_t iangle)
+{
+	int32_t isin, icos;
+
+	iSinCosQ31(iangle, &isin, &icos);
+	return icos;
+}
+
+// function returns atan2(y, x) in Q31 units of pi for Q31 y and x, saturating +pi to 0x7FFFFFFF
+// and returning 0 for y = x = 0.  Uses one 64 bit division
+
+// maximum error is 2 LSB (1.9E-9 rad)
+int32_t ifastatan2_q31(int32_t iy, int32_t ix)
+{
+	uint32_t uax, uay;			// |x| and |y|
+	uint32_t ut;				// min(|x|, |y|) / max(|x|, |y|) in unsigned Q31
+
+	uax = (ix < 0) ? 0U - (uint32_t) ix : (uint32_t) ix;
+	uay = (iy < 0) ? 0U - (uint32_t) iy : (uint32_t) iy;
+	if (uay <= uax)
+	{
+		if (uax == 0U) return 0;
+		ut = (uint32_t) (((uint64_t) uay << 31) / uax);
+	}
+	else
+	{
+		ut = (uint32_t) (((uint64_t) uax << 31) / uay);
+	}
+
+	return iUnfoldAtan2Q31(iAtanUnitQ31(ut), uay > uax, ix < 0, iy < 0);
+}
+
+// function returns asin(x) in Q31 units of pi (-0.5 to 0.5) for Q31 x
+
+// maximum error is 16 LSB (7.2E-9 rad) for |x| <= 0.999 rising to 8.9E-6 rad as |x| approaches 1
+// where the Q31 resolution of 1 - x^2 limits the result
+int32_t ifastasin_q31(int32_t ix)
+{
+	int32_t iv;					// 1 - x^2 in Q31
+	int32_t im;					// mantissa of 1 / sqrt(1 - x^2)
+	int8_t ishift;				// exponent of 1 / sqrt(1 - x^2)
+	int64_t iacc;				// accumulator
+
+	iacc = 0x7FFFFFFF - (((int64_t) ix * ix) >> 31);
+	if (iacc <= 0) return (ix < 0) ? -0x40000000 : 0x40000000;
+	iv = (int32_t) iacc;
+
+	// sqrt(1 - x^2) = (1 - x^2) / sqrt(1 - x^2)
+	im = ifastrsqrt_q31(iv, &ishift);
+	iv = (int32_t) (((int64_t) iv * im) >> (31 - ishift));
+
+	return ifastatan2_q31(ix, iv);
+}
+
+// function returns 1 / sqrt(x) for 0 < x < 1 in Q31 as a mantissa 0.5 < m <= 1 in Q31 and a
+// shift with 1 / sqrt(x) = m * 2^shift.  Returns 0 with zero shift for x <= 0
+
+// maximum relative error is 2 LSB of the mantissa (9.3E-10)
+int32_t ifastrsqrt_q31(int32_t ix, int8_t *pishift)
+{
+	int32_t in;					// even normalization shift
+	uint32_t ux;				// normalized argument 0.25 <= x < 1 in Q31
+	int64_t iy;					// estimate of 1 / sqrt(ux) in Q30, 1 < y <= 2
+	int64_t it;					// ux y^2 in Q30
+	int32_t i;					// loop counter
+
+	if (ix <= 0)
+	{
+		*pishift = 0;
+		return 0;
+	}
+
+	// normalize by an even shift so 1 / sqrt(x) = 1 / sqrt(ux) * 2^(in / 2)
+	in = (iLeadingZeros((uint32_t) ix) - 1) & ~1;
+	ux = (uint32_t) ix << in;
+
+	// three Newton iterations y = y (3 - x y^2) / 2 from the 3% seed
+	iy = iRsqrtSeed[(ux >> 26) - 8U];
+	for (i = 0; i < 3; i++)
+	{
+		it = (((iy * iy) >> 30) * ux) >> 31;
+		iy = (iy * ((3LL << 30) - it)) >> 31;
+	}
+
+	// y in Q30 is y / 2 in Q31
+	*pishift = (int8_t) (in / 2 + 1);
+	return (iy > 0x7FFFFFFF) ? 0x7FFFFFFF : (int32_t) iy;
+}
+
+// function returns sin(angle) in Q15 for an angle in Q15 units of pi
+
+// maximum error is 1 LSB (3.1E-5)
+int16_t ifastsin_q15(int16_t iangle)
+{
+	return iQ31toQ15(ifastsin_q31((int32_t) ((uint32_t) (uint16_t) iangle << 16)));
+}
+
+// function returns cos(angle) in Q15 for an angle in Q15 units of pi
+
+// maximum error is 1 LSB (3.1E-5)
+int16_t ifastcos_q15(int16_t iangle)
+{
+	return iQ31toQ15(ifastcos_q31((int32_t) ((uint32_t) (uint16_t) iangle << 16)));
+}
+
+// function returns atan2(y, x) in Q15 units of pi for Q15 y and x, saturating +pi to 0x7FFF
+// and returning 0 for y = x = 0.  Uses one 32 bit division
+
+// maximum error is 1 LSB (9.6E-5 rad)
+int16_t ifastatan2_q15(int16_t iy, int16_t ix)
+{
+	uint32_t uax, uay;			// |x| and |y|
+	uint32_t ut;				// min(|x|, |y|) / max(|x|, |y|) in Q16
+
+	uax = (uint32_t) ((ix < 0) ? -ix : ix);
+	uay = (uint32_t) ((iy < 0) ? -iy : iy);
+	if (uay <= uax)
+	{
+		if (uax == 0U) return 0;
+		ut = (uay << 16) / uax;
+	}
+	else
+	{
+		ut = (uax << 16) / uay;
+	}
+
+	return iQ31toQ15(iUnfoldAtan2Q31(iAtanUnitQ31(ut << 15), uay > uax, ix < 0, iy < 0));
+}
+
+// function returns asin(x) in Q15 units of pi (-0.5 to 0.5) for Q15 x
+
+// maximum error is 1 LSB (4.8E-5 rad)
+int16_t ifastasin_q15(int16_t ix)
+{
+	return iQ31toQ15(ifastasin_q31((int32_t) ((uint32_t) (uint16_t) ix << 16)));
+}
+
+// function returns 1 / sqrt(x) for 0 < x < 1 in Q15 as a mantissa 0.5 < m <= 1 in Q15 and a
+// shift with 1 / sqrt(x) = m * 2^shift.  Returns 0 with zero shift for x <= 0
+
+// maximum relative error is 1 LSB of the mantissa (3.1E-5)
+int16_t ifastrsqrt_q15(int16_t ix, int8_t *pishift)
+{
+	return iQ31toQ15(ifastrsqrt_q31((int32_t) ((uint32_t) (uint16_t) ix << 16), pishift));
+}
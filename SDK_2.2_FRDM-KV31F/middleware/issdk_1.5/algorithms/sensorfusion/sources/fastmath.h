@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2015 - 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2017 NXP
+ *
+ * Redistribution and use in source and binary forms, with or without modification,
+ * are permitted provided that the following conditions are met:
+ *
+ * o Redistributions of source code must retain the above copyright notice, this list
+ *   of conditions and the following disclaimer.
+ *
+ * o Redistributions in binary form must reproduce the above copyright notice, this
+ *   list of conditions and the following disclaimer in the documentation and/or
+ *   other materials provided with the distribution.
+ *
+ * o Neither the name of the copyright holder nor the names of its
+ *   contributors may be used to endorse or promote products derived from this
+ *   software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ * ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON
+ * ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef FASTMATH_H
+#define FASTMATH_H
+
+/*! \file fastmath.h
+    \brief Table driven trigonometry and reciprocal square root kernels
+
+    Lookup table plus short polynomial versions of sin, cos, atan2, asin, acos
+    and 1/sqrt in float and in Q15 / Q31 fixed point, shared by the fusion
+    algorithms and the control code.  The float kernels make no library calls
+    and use at most one VDIV and one VSQRT on the Cortex-M4F; the fixed point
+    kernels use only integer instructions.  The maximum errors listed
+    with each function are measured over the full input domain by
+    benchmark/fastmath_bench.c.
+
+    Fixed point angles are in units of pi: Q15 0x8000 (-1.0) is -180 deg and
+    0x4000 (0.5) is 90 deg, the convention of the RTCESL GFLIB functions.
+
+    With FAST_MATH set to 1 in build.h, the FSIN, FACOS, FRSQRT and degree
+    macros below route orientation.c and fusion.c through these kernels.
+    With FAST_MATH 0 they map onto the C library and approximations.c.
+*/
+
+#include "stdint.h"
+
+// float kernels, angles in radians
+float ffastsin(float x);
+float ffastcos(float x);
+void ffastsincos(float x, float *pfsin, float *pfcos);
+float ffastatan2(float y, float x);
+float ffastasin(float x);
+float ffastacos(float x);
+float ffastrsqrt(float x);
+
+// float kernels, angles in degrees as approximations.c
+float ffastatan_deg(float x);
+float ffastatan2_deg(float y, float x);
+float ffastasin_deg(float x);
+float ffastacos_deg(float x);
+
+// Q31 and Q15 kernels, angles in units of pi
+int32_t ifastsin_q31(int32_t iangle);
+int32_t ifastcos_q31(int32_t iangle);
+int32_t ifastatan2_q31(int32_t iy, int32_t ix);
+int32_t ifastasin_q31(int32_t ix);
+int32_t ifastrsqrt_q31(int32_t ix, int8_t *pishift);
+int16_t ifastsin_q15(int16_t iangle);
+int16_t ifastcos_q15(int16_t iangle);
+int16_t ifastatan2_q15(int16_t iy, int16_t ix);
+int16_t ifastasin_q15(int16_t ix);
+int16_t ifastrsqrt_q15(int16_t ix, int8_t *pishift);
+
+// math used by orientation.c and fusion.c; FRSQRT callers guarantee a positive argument
+#if FAST_MATH
+#define FSIN(x) ffastsin(x)
+#define FACOS(x) ffastacos(x)
+#define FRSQRT(x) ffastrsqrt(x)
+#define FATAN_DEG(x) ffastatan_deg(x)
+#define FATAN2_DEG(y, x) ffastatan2_deg(y, x)
+#define FASIN_DEG(x) ffastasin_deg(x)
+#define FACOS_DEG(x) ffastacos_deg(x)
+#else
+#define FSIN(x) sinf(x)
+#define FACOS(x) acosf(x)
+#define FRSQRT(x) (1.0F / sqrtf(x))
+#define FATAN_DEG(x) fatan_deg(x)
+#define FATAN2_DEG(y, x) fatan2_deg(y, x)
+#define FASIN_DEG(x) fasin_deg(x)
+#define FACOS_DEG(x) facos_deg(x)
+#endif
+
+#endif // FASTMATH_H
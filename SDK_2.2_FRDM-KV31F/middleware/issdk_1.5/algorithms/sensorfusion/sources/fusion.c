@@ -44,8 +44,10 @@
 #include "orientation.h"
 #include "matrix.h"
 #include "approximations.h"
+#include "fastmath.h"
 #include "drivers.h"
 #include "control.h"
+#include "calibration_storage.h"
 
 //////////////////////////////////////////////////////////////////////////////////////////////////
 // intialization functions for the sensor fusion algorithms
@@ -57,6 +59,17 @@ void fInitializeFusion(SensorFusionGlobals *sfg)
     // reset the quaternion type to the default packet type
     // sfg->pControlSubsystem->QuaternionPacketType = sfg->pControlSubsystem->DefaultQuaternionPacketType;
 
+#if F_9DOF_GBY_KALMAN
+    // default noise variances, a tuning tool may change them and call fSetFusionRate() again
+    sfg->SV_9DOF_GBY_KALMAN.fQvY = FQVY_9DOF_GBY_KALMAN;
+    sfg->SV_9DOF_GBY_KALMAN.fQvG = FQVG_9DOF_GBY_KALMAN;
+    sfg->SV_9DOF_GBY_KALMAN.fQvB = FQVB_9DOF_GBY_KALMAN;
+    sfg->SV_9DOF_GBY_KALMAN.fQwb = FQWB_9DOF_GBY_KALMAN;
+#endif
+
+    // set the algorithm sampling intervals for the current fusion rate (not reset to FUSION_HZ)
+    fSetFusionRate(sfg, sfg->iFusionHz);
+
     // force a reset of all the algorithms next time they execute
     // the initialization will result in the default and current quaternion being set to the most sophisticated
     // algorithm supported by the build
@@ -87,6 +100,67 @@ void fInitializeFusion(SensorFusionGlobals *sfg)
     return;
 }
 
+// function sets the low pass filter constant with maximum value 1.0 (all pass) decreasing to 0.0 (increasing low pass)
+static float fLowPassConstant(float fdeltat, float flpftimesecs)
+{
+    if (flpftimesecs > fdeltat)
+        return (fdeltat / flpftimesecs);
+    return (1.0F);
+}
+
+// function sets the sampling interval of every fusion algorithm and the terms derived from it.
+// it may be called between fusion passes to change the fusion rate without resetting the algorithms.
+void fSetFusionRate(SensorFusionGlobals *sfg, uint16_t iFusionHz)
+{
+    float fdeltat;      // fusion interval (s)
+
+    sfg->iFusionHz = iFusionHz;
+    fdeltat = 1.0F / (float) iFusionHz;
+
+#if F_1DOF_P_BASIC
+    sfg->SV_1DOF_P_BASIC.fdeltat = fdeltat;
+    sfg->SV_1DOF_P_BASIC.flpf = fLowPassConstant(fdeltat, FLPFSECS_1DOF_P_BASIC);
+#endif
+#if F_3DOF_G_BASIC
+    sfg->SV_3DOF_G_BASIC.fdeltat = fdeltat;
+    sfg->SV_3DOF_G_BASIC.flpf = fLowPassConstant(fdeltat, FLPFSECS_3DOF_G_BASIC);
+#endif
+#if F_3DOF_B_BASIC
+    sfg->SV_3DOF_B_BASIC.fdeltat = fdeltat;
+    sfg->SV_3DOF_B_BASIC.flpf = fLowPassConstant(fdeltat, FLPFSECS_3DOF_B_BASIC);
+#endif
+#if F_3DOF_Y_BASIC
+    sfg->SV_3DOF_Y_BASIC.fdeltat = fdeltat;
+#endif
+#if F_6DOF_GB_BASIC
+    sfg->SV_6DOF_GB_BASIC.fdeltat = fdeltat;
+    sfg->SV_6DOF_GB_BASIC.flpf = fLowPassConstant(fdeltat, FLPFSECS_6DOF_GB_BASIC);
+#endif
+#if F_6DOF_GY_KALMAN
+    // compute and store useful product terms to save floating point calculations later
+    sfg->SV_6DOF_GY_KALMAN.fdeltat = fdeltat;
+    sfg->SV_6DOF_GY_KALMAN.fQwbOver3 = FQWB_6DOF_GY_KALMAN / 3.0F;
+    sfg->SV_6DOF_GY_KALMAN.fAlphaOver2 = FPIOVER180 * fdeltat / 2.0F;
+    sfg->SV_6DOF_GY_KALMAN.fAlphaSqOver4 = sfg->SV_6DOF_GY_KALMAN.fAlphaOver2 * sfg->SV_6DOF_GY_KALMAN.fAlphaOver2;
+    sfg->SV_6DOF_GY_KALMAN.fAlphaQwbOver6 = sfg->SV_6DOF_GY_KALMAN.fAlphaOver2 * sfg->SV_6DOF_GY_KALMAN.fQwbOver3;
+    sfg->SV_6DOF_GY_KALMAN.fAlphaSqQvYQwbOver12 = sfg->SV_6DOF_GY_KALMAN.fAlphaSqOver4 *
+        (FQVY_6DOF_GY_KALMAN + FQWB_6DOF_GY_KALMAN) / 3.0F;
+    sfg->SV_6DOF_GY_KALMAN.fMaxGyroOffsetChange = sqrtf(fabs(FQWB_6DOF_GY_KALMAN)) * fdeltat;
+#endif
+#if F_9DOF_GBY_KALMAN
+    sfg->SV_9DOF_GBY_KALMAN.fdeltat = fdeltat;
+    sfg->SV_9DOF_GBY_KALMAN.fgdeltat = GTOMSEC2 * fdeltat;
+    sfg->SV_9DOF_GBY_KALMAN.fQwbOver3 = sfg->SV_9DOF_GBY_KALMAN.fQwb / 3.0F;
+    sfg->SV_9DOF_GBY_KALMAN.fAlphaOver2 = FPIOVER180 * fdeltat / 2.0F;
+    sfg->SV_9DOF_GBY_KALMAN.fAlphaSqOver4 = sfg->SV_9DOF_GBY_KALMAN.fAlphaOver2 * sfg->SV_9DOF_GBY_KALMAN.fAlphaOver2;
+    sfg->SV_9DOF_GBY_KALMAN.fAlphaQwbOver6 = sfg->SV_9DOF_GBY_KALMAN.fAlphaOver2 * sfg->SV_9DOF_GBY_KALMAN.fQwbOver3;
+    sfg->SV_9DOF_GBY_KALMAN.fAlphaSqQvYQwbOver12 = sfg->SV_9DOF_GBY_KALMAN.fAlphaSqOver4 *
+        (sfg->SV_9DOF_GBY_KALMAN.fQvY + sfg->SV_9DOF_GBY_KALMAN.fQwb) / 3.0F;
+    sfg->SV_9DOF_GBY_KALMAN.fMaxGyroOffsetChange = sqrtf(fabs(sfg->SV_9DOF_GBY_KALMAN.fQwb)) * fdeltat;
+#endif
+    return;
+}
+
 void fFuseSensors(struct SV_1DOF_P_BASIC *pthisSV_1DOF_P_BASIC,
                   struct SV_3DOF_G_BASIC *pthisSV_3DOF_G_BASIC,
                   struct SV_3DOF_B_BASIC *pthisSV_3DOF_B_BASIC,
@@ -179,14 +253,9 @@ void fInit_1DOF_P_BASIC(struct SV_1DOF_P_BASIC *pthisSV,
     // set algorithm sampling interval (typically 40Hz) and low pass filter
     // Note: the MPL3115 sensor only updates its output every 1s and is therefore repeatedly oversampled at 40Hz
     // but executing the exponenial filter at the 40Hz rate also performs an interpolation giving smoother output.
-    // set algorithm sampling interval (typically 40Hz)
-    pthisSV->fdeltat = 1.0F / (float) FUSION_HZ;
-
+    // the algorithm sampling interval fdeltat is set by fSetFusionRate()
     // set low pass filter constant with maximum value 1.0 (all pass) decreasing to 0.0 (increasing low pass)
-    if (flpftimesecs > pthisSV->fdeltat)
-        pthisSV->flpf = pthisSV->fdeltat / flpftimesecs;
-    else
-        pthisSV->flpf = 1.0F;
+    pthisSV->flpf = fLowPassConstant(pthisSV->fdeltat, flpftimesecs);
 
     // initialize the low pass filters to current measurement
     pthisSV->fLPH = pthisPressure->fH;
@@ -201,14 +270,9 @@ void fInit_1DOF_P_BASIC(struct SV_1DOF_P_BASIC *pthisSV,
 void fInit_3DOF_G_BASIC(struct SV_3DOF_G_BASIC *pthisSV,
                         struct AccelSensor *pthisAccel, float flpftimesecs)
 {
-    // set algorithm sampling interval (typically 40Hz)
-    pthisSV->fdeltat = 1.0F / (float) FUSION_HZ;
-
+    // the algorithm sampling interval fdeltat is set by fSetFusionRate()
     // set low pass filter constant with maximum value 1.0 (all pass) decreasing to 0.0 (increasing low pass)
-    if (flpftimesecs > pthisSV->fdeltat)
-        pthisSV->flpf = pthisSV->fdeltat / flpftimesecs;
-    else
-        pthisSV->flpf = 1.0F;
+    pthisSV->flpf = fLowPassConstant(pthisSV->fdeltat, flpftimesecs);
 
     // apply the tilt estimation algorithm to initialize the low pass orientation matrix and quaternion
 #if THISCOORDSYSTEM == NED
@@ -229,14 +293,9 @@ void fInit_3DOF_G_BASIC(struct SV_3DOF_G_BASIC *pthisSV,
 void fInit_3DOF_B_BASIC(struct SV_3DOF_B_BASIC *pthisSV,
                         struct MagSensor *pthisMag, float flpftimesecs)
 {
-    // set algorithm sampling interval (typically 40Hz)
-    pthisSV->fdeltat = 1.0F / (float) FUSION_HZ;
-
+    // the algorithm sampling interval fdeltat is set by fSetFusionRate()
     // set low pass filter constant with maximum value 1.0 (all pass) decreasing to 0.0 (increasing low pass)
-    if (flpftimesecs > pthisSV->fdeltat)
-        pthisSV->flpf = pthisSV->fdeltat / flpftimesecs;
-    else
-        pthisSV->flpf = 1.0F;
+    pthisSV->flpf = fLowPassConstant(pthisSV->fdeltat, flpftimesecs);
 
     // initialize the low pass filtered magnetometer orientation matrix and quaternion using fBc
 #if THISCOORDSYSTEM == NED
@@ -256,9 +315,7 @@ void fInit_3DOF_B_BASIC(struct SV_3DOF_B_BASIC *pthisSV,
 
 void fInit_3DOF_Y_BASIC(struct SV_3DOF_Y_BASIC *pthisSV)
 {
-    // compute the sampling time intervals (secs)
-    pthisSV->fdeltat = 1.0F / (float) FUSION_HZ;
-
+    // the sampling time interval fdeltat is set by fSetFusionRate()
     // initialize orientation estimate to flat
     f3x3matrixAeqI(pthisSV->fR);
     fqAeq1(&(pthisSV->fq));
@@ -275,14 +332,9 @@ void fInit_6DOF_GB_BASIC(struct SV_6DOF_GB_BASIC *pthisSV,
 {
     float ftmp;
 
-    // set algorithm sampling interval (typically 40Hz)
-    pthisSV->fdeltat = 1.0F / (float) FUSION_HZ;
-
+    // the algorithm sampling interval fdeltat is set by fSetFusionRate()
     // set low pass filter constant with maximum value 1.0 (all pass) decreasing to 0.0 (increasing low pass)
-    if (flpftimesecs > pthisSV->fdeltat)
-        pthisSV->flpf = pthisSV->fdeltat / flpftimesecs;
-    else
-        pthisSV->flpf = 1.0F;
+    pthisSV->flpf = fLowPassConstant(pthisSV->fdeltat, flpftimesecs);
 
     // initialize the instantaneous orientation matrix, inclination angle and quaternion
 #if THISCOORDSYSTEM == NED
@@ -300,6 +352,19 @@ void fInit_6DOF_GB_BASIC(struct SV_6DOF_GB_BASIC *pthisSV,
     return;
 }   // end fInit_6DOF_GB_BASIC
 
+// function returns the integration interval (s) for gyro FIFO measurement j from the
+// difference between its timestamp and the previously integrated one.  fNominal is used
+// instead when timestamps are unavailable or implausible (first pass, missed reads).
+static float fGyroSampleInterval(struct GyroSensor *pthisGyro, int8 j, uint32_t *piGyroTime, float fNominal)
+{
+    float fdt;      // measured interval (s)
+
+    fdt = (float) (pthisGyro->iYsTime[j] - *piGyroTime) / (float) ARM_timestamp_hz();
+    *piGyroTime = pthisGyro->iYsTime[j];
+    if ((fdt <= 0.0F) || (fdt > 2.0F * fNominal)) return (fNominal);
+    return (fdt);
+}
+
 // function initalizes the 6DOF accel + gyro Kalman filter algorithm
 void fInit_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
                           struct AccelSensor *pthisAccel,
@@ -308,14 +373,8 @@ void fInit_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
     float   *pFlash;    // pointer to flash float words
     int8    i;          // loop counter
 
-    // compute and store useful product terms to save floating point calculations later
-    pthisSV->fdeltat = 1.0F / (float) FUSION_HZ;
-    pthisSV->fQwbOver3 = FQWB_6DOF_GY_KALMAN / 3.0F;
-    pthisSV->fAlphaOver2 = FPIOVER180 * pthisSV->fdeltat / 2.0F;
-    pthisSV->fAlphaSqOver4 = pthisSV->fAlphaOver2 * pthisSV->fAlphaOver2;
-    pthisSV->fAlphaQwbOver6 = pthisSV->fAlphaOver2 * pthisSV->fQwbOver3;
-    pthisSV->fAlphaSqQvYQwbOver12 = pthisSV->fAlphaSqOver4 * (FQVY_6DOF_GY_KALMAN + FQWB_6DOF_GY_KALMAN) / 3.0F;
-    pthisSV->fMaxGyroOffsetChange = sqrtf(fabs(FQWB_6DOF_GY_KALMAN)) / (float)FUSION_HZ;
+    // fdeltat and the product terms derived from it are set by fSetFusionRate()
+    pthisSV->iGyroTime = 0;
 
     // zero the a posteriori gyro offset and error vectors
     for (i = CHX; i <= CHZ; i++)
@@ -325,10 +384,9 @@ void fInit_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
     }
 
     // check to see if a gyro calibration exists in flash
-    // the standard value for erased flash is 0xFF in each byte but for portability check against 0x12345678
 #ifndef SIMULATION
-    pFlash = (float *) (CALIBRATION_NVM_ADDR + GYRO_NVM_OFFSET);
-    if (*((uint32 *) pFlash++) == 0x12345678)
+    pFlash = GetGyroCalibrationFromNVM();
+    if (pFlash != NULL)
     {
         // copy the gyro calibration from flash into the state vector
         for (i = CHX; i <= CHZ; i++) pthisSV->fbPl[i] = *(pFlash++);
@@ -372,15 +430,8 @@ void fInit_9DOF_GBY_KALMAN(struct SV_9DOF_GBY_KALMAN *pthisSV, struct AccelSenso
     float *pFlash;// pointer to flash float words
     int8 i;// loop counter
 
-    // compute and store useful product terms to save floating point calculations later
-    pthisSV->fdeltat = 1.0F / (float) FUSION_HZ;
-    pthisSV->fgdeltat = GTOMSEC2 * pthisSV->fdeltat;
-    pthisSV->fQwbOver3 = FQWB_9DOF_GBY_KALMAN / 3.0F;
-    pthisSV->fAlphaOver2 = FPIOVER180 * pthisSV->fdeltat / 2.0F;
-    pthisSV->fAlphaSqOver4 = pthisSV->fAlphaOver2 * pthisSV->fAlphaOver2;
-    pthisSV->fAlphaQwbOver6 = pthisSV->fAlphaOver2 * pthisSV->fQwbOver3;
-    pthisSV->fAlphaSqQvYQwbOver12 = pthisSV->fAlphaSqOver4 * (FQVY_9DOF_GBY_KALMAN + FQWB_9DOF_GBY_KALMAN) / 3.0F;
-    pthisSV->fMaxGyroOffsetChange = sqrtf(fabs(FQWB_9DOF_GBY_KALMAN)) / (float)FUSION_HZ;
+    // fdeltat and the product terms derived from it are set by fSetFusionRate()
+    pthisSV->iGyroTime = 0;
 
     // zero the a posteriori error vectors and inertial outputs
     for (i = CHX; i <= CHZ; i++) {
@@ -392,10 +443,9 @@ void fInit_9DOF_GBY_KALMAN(struct SV_9DOF_GBY_KALMAN *pthisSV, struct AccelSenso
     }
 
     // check to see if a gyro calibration exists in flash
-    // the standard value for erased flash is 0xFF in each byte but for portability check against 0x12345678
 #ifndef SIMULATION
-    pFlash = (float *) (CALIBRATION_NVM_ADDR + GYRO_NVM_OFFSET);
-    if (*((uint32*) pFlash++) == 0x12345678) {
+    pFlash = GetGyroCalibrationFromNVM();
+    if (pFlash != NULL) {
     // copy the gyro calibration from flash into the state vector
         for (i = CHX; i <= CHZ; i++)
             pthisSV->fbPl[i] = *(pFlash++);
@@ -482,6 +532,10 @@ void fRun_3DOF_G_BASIC(struct SV_3DOF_G_BASIC *pthisSV,
     fLPFOrientationQuaternion(&(pthisSV->fq), &(pthisSV->fLPq), pthisSV->flpf,
                               pthisSV->fdeltat, pthisSV->fOmega);
 
+#if LAZY_ORIENTATION
+    // the low pass rotation matrix, rotation vector and Euler angles are derived on request
+    pthisSV->iStale = ORIENT_ALL | ORIENT_ZEROYAW;
+#else
     // compute the low pass rotation matrix and rotation vector from low pass filtered quaternion
     fRotationMatrixFromQuaternion(pthisSV->fLPR, &(pthisSV->fLPq));
     fRotationVectorDegFromQuaternion(&(pthisSV->fLPq), pthisSV->fLPRVec);
@@ -503,6 +557,7 @@ void fRun_3DOF_G_BASIC(struct SV_3DOF_G_BASIC *pthisSV,
 
     // force the yaw and compass angles to zero
     pthisSV->fLPPsi = pthisSV->fLPRho = 0.0F;
+#endif
 
     return;
 }   // end fRun_3DOF_G_BASIC
@@ -531,6 +586,10 @@ void fRun_3DOF_B_BASIC(struct SV_3DOF_B_BASIC *pthisSV, struct MagSensor *pthisM
     fLPFOrientationQuaternion(&(pthisSV->fq), &(pthisSV->fLPq), pthisSV->flpf,
                               pthisSV->fdeltat, pthisSV->fOmega);
 
+#if LAZY_ORIENTATION
+    // the low pass rotation matrix, rotation vector and Euler angles are derived on request
+    pthisSV->iStale = ORIENT_ALL;
+#else
     // compute the low pass rotation matrix and rotation vector from low pass filtered quaternion
     fRotationMatrixFromQuaternion(pthisSV->fLPR, &(pthisSV->fLPq));
     fRotationVectorDegFromQuaternion(&(pthisSV->fLPq), pthisSV->fLPRVec);
@@ -548,6 +607,7 @@ void fRun_3DOF_B_BASIC(struct SV_3DOF_B_BASIC *pthisSV, struct MagSensor *pthisM
     fWin8AnglesDegFromRotationMatrix(pthisSV->fLPR, &(pthisSV->fLPPhi),
                                      &(pthisSV->fLPThe), &(pthisSV->fLPPsi),
                                      &(pthisSV->fLPRho), &(pthisSV->fLPChi));
+#endif
 #endif
     return;
 }
@@ -579,6 +639,10 @@ void fRun_3DOF_Y_BASIC(struct SV_3DOF_Y_BASIC *pthisSV,
     qAeqAxB(&(pthisSV->fq), &ftmpq);
     fqAeqNormqA(&(pthisSV->fq));
 
+#if LAZY_ORIENTATION
+    // the rotation matrix, rotation vector and Euler angles are derived on request
+    pthisSV->iStale = ORIENT_ALL;
+#else
     // get the rotation matrix and rotation vector from the orientation quaternion fq
     fRotationMatrixFromQuaternion(pthisSV->fR, &(pthisSV->fq));
     fRotationVectorDegFromQuaternion(&(pthisSV->fq), pthisSV->fRVec);
@@ -596,6 +660,7 @@ void fRun_3DOF_Y_BASIC(struct SV_3DOF_Y_BASIC *pthisSV,
     fWin8AnglesDegFromRotationMatrix(pthisSV->fR, &(pthisSV->fPhi),
                                      &(pthisSV->fThe), &(pthisSV->fPsi),
                                      &(pthisSV->fRho), &(pthisSV->fChi));
+#endif
 #endif
     return;
 }                       // end fRun_3DOF_Y_BASIC
@@ -628,6 +693,10 @@ void fRun_6DOF_GB_BASIC(struct SV_6DOF_GB_BASIC *pthisSV,
     fLPFOrientationQuaternion(&(pthisSV->fq), &(pthisSV->fLPq), pthisSV->flpf,
                               pthisSV->fdeltat, pthisSV->fOmega);
 
+#if LAZY_ORIENTATION
+    // the low pass rotation matrix, rotation vector and Euler angles are derived on request
+    pthisSV->iStale = ORIENT_ALL;
+#else
     // compute the low pass rotation matrix and rotation vector from low pass filtered quaternion
     fRotationMatrixFromQuaternion(pthisSV->fLPR, &(pthisSV->fLPq));
     fRotationVectorDegFromQuaternion(&(pthisSV->fLPq), pthisSV->fLPRVec);
@@ -645,6 +714,7 @@ void fRun_6DOF_GB_BASIC(struct SV_6DOF_GB_BASIC *pthisSV,
     fWin8AnglesDegFromRotationMatrix(pthisSV->fLPR, &(pthisSV->fLPPhi),
                                      &(pthisSV->fLPThe), &(pthisSV->fLPPsi),
                                      &(pthisSV->fLPRho), &(pthisSV->fLPChi));
+#endif
 #endif
 
     // low pass filter the geomagnetic inclination angle with a simple exponential filter
@@ -698,12 +768,13 @@ void fRun_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
     fqMi = pthisSV->fqPl;
     if (pthisGyro->iFIFOCount > 0)
     {
-        // set ftmp to the interval between the FIFO gyro measurements
-        ftmp = pthisSV->fdeltat / (float) pthisGyro->iFIFOCount;
-
         // normal case, loop over all the buffered gyroscope measurements
         for (j = 0; j < pthisGyro->iFIFOCount; j++)
         {
+            // set ftmp to the time since the previous gyro measurement (average interval if not timestamped)
+            ftmp = fGyroSampleInterval(pthisGyro, j, &(pthisSV->iGyroTime),
+                                       pthisSV->fdeltat / (float) pthisGyro->iFIFOCount);
+
             // calculate the instantaneous angular velocity subtracting the gyro offset
             for (i = CHX; i <= CHZ; i++)
                 ftmpMi3x1[i] = (float) pthisGyro->iYsFIFO[j][i] *
@@ -972,7 +1043,7 @@ void fRun_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
     else
     {
         // if vector component exceeds unity then set to 180 degree rotation and force normalization
-        ftmp = 1.0F / sqrtf(ftmp);
+        ftmp = FRSQRT(ftmp);
         ftmpq.q0 = 0.0F;
         ftmpq.q1 *= ftmp;
         ftmpq.q2 *= ftmp;
@@ -983,9 +1054,14 @@ void fRun_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
     qAeqBxC(&(pthisSV->fqPl), &fqMi, &ftmpq);
 
     // normalize the a posteriori quaternion and compute the a posteriori rotation matrix and rotation vector
+    // (the matrix is needed below for the linear acceleration, the rotation vector only as an output)
     fqAeqNormqA(&(pthisSV->fqPl));
     fRotationMatrixFromQuaternion(pthisSV->fRPl, &(pthisSV->fqPl));
+#if LAZY_ORIENTATION
+    pthisSV->iStale = ORIENT_EULER | ORIENT_ROTVEC;
+#else
     fRotationVectorDegFromQuaternion(&(pthisSV->fqPl), pthisSV->fRVecPl);
+#endif
 
     // update the a posteriori gyro offset vector: b+[k] = b-[k] - be+[k] = b+[k] - be+[k] (deg/s)
     // limiting the correction to the maximum permitted by the random walk model
@@ -1020,6 +1096,7 @@ void fRun_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
     pthisSV->fAccGl[CHZ] = -(pthisSV->fAccGl[CHZ] + 1.0F);
 #endif
 
+#if !LAZY_ORIENTATION
     // compute the a posteriori Euler angles from the a posteriori orientation matrix fRPl
 #if THISCOORDSYSTEM == NED
     fNEDAnglesDegFromRotationMatrix(pthisSV->fRPl, &(pthisSV->fPhiPl),
@@ -1033,6 +1110,7 @@ void fRun_6DOF_GY_KALMAN(struct SV_6DOF_GY_KALMAN *pthisSV,
     fWin8AnglesDegFromRotationMatrix(pthisSV->fRPl, &(pthisSV->fPhiPl),
                                      &(pthisSV->fThePl), &(pthisSV->fPsiPl),
                                      &(pthisSV->fRhoPl), &(pthisSV->fChiPl));
+#endif
 #endif
     return;
 }   // end fRun_6DOF_GY_KALMAN
@@ -1091,11 +1169,12 @@ void fRun_9DOF_GBY_KALMAN(struct SV_9DOF_GBY_KALMAN *pthisSV,
     // and incrementally rotate fqMi by the contents of the gyro FIFO buffer
     fqMi = pthisSV->fqPl;
     if (pthisGyro->iFIFOCount > 0) {
-        // set ftmp to the average interval between FIFO gyro measurements
-        ftmp = pthisSV->fdeltat / (float)pthisGyro->iFIFOCount;
-
         // normal case, loop over all the buffered gyroscope measurements
         for (j = 0; j < pthisGyro->iFIFOCount; j++) {
+            // set ftmp to the true interval since the previous gyro measurement from the FIFO
+            // timestamps, falling back to the average interval if they are not available
+            ftmp = fGyroSampleInterval(pthisGyro, j, &(pthisSV->iGyroTime),
+                                       pthisSV->fdeltat / (float)pthisGyro->iFIFOCount);
         // calculate the instantaneous angular velocity subtracting the gyro offset
             for (i = CHX; i <= CHZ; i++) ftmpA3x1[i] = (float)pthisGyro->iYsFIFO[j][i] * pthisGyro->fDegPerSecPerCount - pthisSV->fbPl[i];
             // compute the incremental rotation quaternion ftmpq and integrate the a priori orientation quaternion fqMi
@@ -1122,25 +1201,31 @@ void fRun_9DOF_GBY_KALMAN(struct SV_9DOF_GBY_KALMAN *pthisSV,
     feCompassWin8(fR6DOF, &fDelta6DOF, &fsinDelta6DOF, &fcosDelta6DOF, pthisMag->fBc, pthisAccel->fGc, &fmodBc, &fmodGc);
 #endif
 
+#if !LAZY_ORIENTATION
     // compute the 6DOF orientation quaternion fq6DOF from the 6DOF orientation matrix fR6OF
     fQuaternionFromRotationMatrix(fR6DOF, &fq6DOF);
+#endif
 
     // calculate the acceleration noise variance relative to 1g sphere
     ftmp = fmodGc - 1.0F;
     fQvGQa = 3.0F * ftmp * ftmp;
-    if (fQvGQa < FQVG_9DOF_GBY_KALMAN)
-    fQvGQa = FQVG_9DOF_GBY_KALMAN;
+    if (fQvGQa < pthisSV->fQvG)
+    fQvGQa = pthisSV->fQvG;
 
     // calculate magnetic noise variance relative to geomagnetic sphere
     ftmp = fmodBc - pthisMagCal->fB;
     fQvBQd = 3.0F * ftmp * ftmp;
-    if (fQvBQd < FQVB_9DOF_GBY_KALMAN)
-    fQvBQd = FQVB_9DOF_GBY_KALMAN;
+    if (fQvBQd < pthisSV->fQvB)
+    fQvBQd = pthisSV->fQvB;
 
     // do a once-only orientation lock immediately after the first valid magnetic calibration by:
     // i) setting the a priori and a posteriori orientations to the 6DOF eCompass orientation
     // ii) setting the geomagnetic inclination angle fDeltaPl now that the first calibrated 6DOF estimate is available
     if (pthisMagCal->iValidMagCal && !pthisSV->iFirstAccelMagLock) {
+#if LAZY_ORIENTATION
+        // the 6DOF quaternion is only needed for this lock
+        fQuaternionFromRotationMatrix(fR6DOF, &fq6DOF);
+#endif
         fqMi = pthisSV->fqPl = fq6DOF;
         f3x3matrixAeqB(fRMi, fR6DOF);
         pthisSV->fDeltaPl = fDelta6DOF;
@@ -1390,7 +1475,11 @@ void fRun_9DOF_GBY_KALMAN(struct SV_9DOF_GBY_KALMAN *pthisSV,
 
     // compute the a posteriori quaternion fqPl and rotation vector fRVecPl from fRPl
     fQuaternionFromRotationMatrix(pthisSV->fRPl, &(pthisSV->fqPl));
+#if LAZY_ORIENTATION
+    pthisSV->iStale = ORIENT_EULER | ORIENT_ROTVEC;
+#else
     fRotationVectorDegFromQuaternion(&(pthisSV->fqPl), pthisSV->fRVecPl);
+#endif
 
     // update the a posteriori gyro offset vector: b+[k] = b-[k] - be+[k] = b+[k] - be+[k] (deg/s)
     for (i = CHX; i <= CHZ; i++) {
@@ -1437,6 +1526,7 @@ void fRun_9DOF_GBY_KALMAN(struct SV_9DOF_GBY_KALMAN *pthisSV,
         pthisSV->fDisGl[i] += pthisSV->fVelGl[i] * pthisSV->fdeltat;
     }
 
+#if !LAZY_ORIENTATION
     // compute the a posteriori Euler angles from the a posteriori orientation matrix fRPl
 #if THISCOORDSYSTEM == NED
     fNEDAnglesDegFromRotationMatrix(pthisSV->fRPl, &(pthisSV->fPhiPl), &(pthisSV->fThePl), &(pthisSV->fPsiPl), &(pthisSV->fRhoPl), &(pthisSV->fChiPl));
@@ -1444,8 +1534,43 @@ void fRun_9DOF_GBY_KALMAN(struct SV_9DOF_GBY_KALMAN *pthisSV,
     fAndroidAnglesDegFromRotationMatrix(pthisSV->fRPl, &(pthisSV->fPhiPl), &(pthisSV->fThePl), &(pthisSV->fPsiPl), &(pthisSV->fRhoPl), &(pthisSV->fChiPl));
 #else // WIN8
     fWin8AnglesDegFromRotationMatrix(pthisSV->fRPl, &(pthisSV->fPhiPl), &(pthisSV->fThePl), &(pthisSV->fPsiPl), &(pthisSV->fRhoPl), &(pthisSV->fChiPl));
+#endif
 #endif
 
     return;
 } // end fRun_9DOF_GBY_KALMAN
 #endif // #if F_9DOF_GBY_KALMAN
+
+#if LAZY_ORIENTATION
+// function derives the requested orientation outputs of a motion state vector from its quaternion
+// if the last fusion pass left them out of date.  The Euler angles are computed from the orientation
+// matrix, so a stale matrix is refreshed first when Euler angles are requested.
+void fUpdateOrientationOutputs(SV_ptr pSV, uint8_t iOutputs)
+{
+    uint8_t iStale;     // requested outputs that are out of date
+
+    iStale = pSV->iStale & iOutputs & ORIENT_ALL;
+    if (iStale & ORIENT_EULER) iStale |= pSV->iStale & ORIENT_MATRIX;
+    if (!iStale) return;
+
+    if (iStale & ORIENT_MATRIX)
+        fRotationMatrixFromQuaternion(pSV->fRM, &(pSV->fq));
+    if (iStale & ORIENT_ROTVEC)
+        fRotationVectorDegFromQuaternion(&(pSV->fq), pSV->fRVec);
+    if (iStale & ORIENT_EULER)
+    {
+#if THISCOORDSYSTEM == NED
+        fNEDAnglesDegFromRotationMatrix(pSV->fRM, &(pSV->fPhi), &(pSV->fThe), &(pSV->fPsi), &(pSV->fRho), &(pSV->fChi));
+#elif THISCOORDSYSTEM == ANDROID
+        fAndroidAnglesDegFromRotationMatrix(pSV->fRM, &(pSV->fPhi), &(pSV->fThe), &(pSV->fPsi), &(pSV->fRho), &(pSV->fChi));
+#else // WIN8
+        fWin8AnglesDegFromRotationMatrix(pSV->fRM, &(pSV->fPhi), &(pSV->fThe), &(pSV->fPsi), &(pSV->fRho), &(pSV->fChi));
+#endif
+        // tilt only algorithms have no yaw or compass heading
+        if (pSV->iStale & ORIENT_ZEROYAW) pSV->fPsi = pSV->fRho = 0.0F;
+    }
+    pSV->iStale &= (uint8_t) ~iStale;
+
+    return;
+}
+#endif // #if LAZY_ORIENTATION
@@ -90,6 +90,7 @@
 /// as details are provided in sensor_fusion.h.
 ///@{
 void fInitializeFusion(SensorFusionGlobals *sfg);
+void fSetFusionRate(SensorFusionGlobals *sfg, uint16_t iFusionHz);
 void fFuseSensors(struct SV_1DOF_P_BASIC *pthisSV_1DOF_P_BASIC, struct SV_3DOF_G_BASIC *pthisSV_3DOF_G_BASIC,
 		struct SV_3DOF_B_BASIC *pthisSV_3DOF_B_BASIC, struct SV_3DOF_Y_BASIC *pthisSV_3DOF_Y_BASIC,
 		struct SV_6DOF_GB_BASIC *pthisSV_6DOF_GB_BASIC, struct SV_6DOF_GY_KALMAN *pthisSV_6DOF_GY_KALMAN,
@@ -37,6 +37,7 @@
 */
 
 #include "sensor_fusion.h"
+#include "calibration_storage.h"
 #include "math.h"
 #include "stdlib.h"
 #include "time.h"
@@ -54,6 +55,12 @@ void fInitializeMagCalibration(struct MagCalibration *pthisMagCal,
     pthisMagBuffer->iMagBufferCount = 0;
     for (i = 0; i < MAGBUFFSIZEX; i++)
         for (j = 0; j < MAGBUFFSIZEY; j++) pthisMagBuffer->index[i][j] = -1;
+#if MAGBUFFER_FASTINDEX
+    pthisMagBuffer->iOldest = pthisMagBuffer->iNewest = -1;
+#endif
+#if COMPACT_GLOBALS
+    pthisMagBuffer->iIndexBase = 0;
+#endif
 
     // initialize the array of (MAGBUFFSIZEX - 1) elements of 100 * tangents used for buffer indexing
     // entries cover the range 100 * tan(-PI/2 + PI/MAGBUFFSIZEX), 100 * tan(-PI/2 + 2*PI/MAGBUFFSIZEX) to
@@ -63,11 +70,10 @@ void fInitializeMagCalibration(struct MagCalibration *pthisMagCal,
         pthisMagBuffer->tanarray[i] = (int16) (100.0F * tanf(PI * (-0.5F + (float) (i + 1) / MAGBUFFSIZEX)));
 
     // check to see if the stored magnetic calibration has been erased
-    // the standard value for erased flash is 0xFF in each byte but for portability check against 0x12345678
 #ifndef SIMULATION
 
-    pFlash = (float *) (CALIBRATION_NVM_ADDR + MAG_NVM_OFFSET);
-    if (*((uint32 *) pFlash++) == 0x12345678)
+    pFlash = GetMagCalibrationFromNVM();
+    if (pFlash != NULL)
     {
         // a magnetic calibration is present in flash
         // copy magnetic calibration elements (15x float + 1x int32 total 64 bytes) from flash to RAM
@@ -107,6 +113,144 @@ void fInitializeMagCalibration(struct MagCalibration *pthisMagCal,
     return;
 }
 
+// function abandons the time sliced calibration in progress (if any) after its scratch matrices have
+// been overwritten.  The abandoned solver is marked untried so that it is selected again.
+void fAbandonMagCalibration(struct MagCalibration *pthisMagCal)
+{
+    switch (pthisMagCal->iCalInProgress)
+    {
+        case 4:
+            pthisMagCal->i4ElementSolverTried = false;
+            break;
+
+        case 7:
+            pthisMagCal->i7ElementSolverTried = false;
+            break;
+
+        case 10:
+            pthisMagCal->i10ElementSolverTried = false;
+            break;
+
+        default:
+            break;
+    }
+    pthisMagCal->iCalInProgress = 0;
+    pthisMagCal->iMagBufferReadOnly = false;
+
+    return;
+}
+
+#if COMPACT_GLOBALS
+// function points the solver scratch matrices and vectors of a magnetic calibration at pthisScratch
+void fAttachMagCalScratch(struct MagCalibration *pthisMagCal, struct CalibrationScratch *pthisScratch)
+{
+    pthisMagCal->fmatA = pthisScratch->fmatA;
+    pthisMagCal->fmatB = pthisScratch->fmatB;
+    pthisMagCal->fvecA = pthisScratch->fvecA;
+    pthisMagCal->fvecB = pthisScratch->fvecB;
+
+    return;
+}
+
+// function returns the 16 bit time index of loopcounter.  When loopcounter is outside the range
+// iIndexBase to iIndexBase + MAGINDEX_MAX the occupied bins are first renumbered by age rank, oldest
+// first and equal indices sharing a rank, and the base is moved to rank count loops before loopcounter.
+// The ranks stay below MAGBUFFSIZEX * MAGBUFFSIZEY, so every comparison between time indices, and
+// with it the choice of the oldest bin, is the same as with 32 bit loop counts.  The renumbering
+// costs one pass over the buffer per distinct index but runs once every MAGINDEX_MAX loops or so.
+static magindex_t iMagBufferTimeIndex(struct MagBuffer *pthisMagBuffer, int32 loopcounter)
+{
+    magindex_t *pindex = &pthisMagBuffer->index[0][0];
+    magindex_t  ioldest;    // oldest index not yet ranked
+    int16   irank;      // next age rank
+    int16   i;          // bin counter
+
+    if ((loopcounter < pthisMagBuffer->iIndexBase) ||
+        (loopcounter - pthisMagBuffer->iIndexBase > MAGINDEX_MAX))
+    {
+        // ranked bins are marked -2 - rank while the others still hold their index (-1 is empty)
+        irank = 0;
+        do
+        {
+            ioldest = -1;
+            for (i = 0; i < MAGBUFFSIZEX * MAGBUFFSIZEY; i++)
+            {
+                if ((pindex[i] >= 0) && ((ioldest == -1) || (pindex[i] < ioldest)))
+                    ioldest = pindex[i];
+            }
+            if (ioldest != -1)
+            {
+                for (i = 0; i < MAGBUFFSIZEX * MAGBUFFSIZEY; i++)
+                {
+                    if (pindex[i] == ioldest) pindex[i] = (magindex_t) (-2 - irank);
+                }
+                irank++;
+            }
+        } while (ioldest != -1);
+        for (i = 0; i < MAGBUFFSIZEX * MAGBUFFSIZEY; i++)
+        {
+            if (pindex[i] < -1) pindex[i] = (magindex_t) (-2 - pindex[i]);
+        }
+        pthisMagBuffer->iIndexBase = loopcounter - irank;
+    }
+
+    return ((magindex_t) (loopcounter - pthisMagBuffer->iIndexBase));
+}
+#endif
+
+#if MAGBUFFER_FASTINDEX
+// function removes bin ibin from the age ordered list of occupied bins
+static void fUnlinkMagBufferEntry(struct MagBuffer *pthisMagBuffer, int16 ibin)
+{
+    int16   iolder = pthisMagBuffer->iOlder[ibin];
+    int16   inewer = pthisMagBuffer->iNewer[ibin];
+
+    if (iolder != -1)
+        pthisMagBuffer->iNewer[iolder] = inewer;
+    else
+        pthisMagBuffer->iOldest = inewer;
+    if (inewer != -1)
+        pthisMagBuffer->iOlder[inewer] = iolder;
+    else
+        pthisMagBuffer->iNewest = iolder;
+
+    return;
+}
+#endif
+
+// function stores the current magnetometer reading in bin j, k and time stamps it
+static void fStoreMagBufferEntry(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag,
+                                 int8 j, int8 k, int32 loopcounter)
+{
+    int8    i;          // counter
+#if MAGBUFFER_FASTINDEX
+    int16   ibin = (int16) (j * MAGBUFFSIZEY + k);
+
+    // move the bin to the newest end of the age ordered list
+    if (pthisMagBuffer->index[j][k] != -1) fUnlinkMagBufferEntry(pthisMagBuffer, ibin);
+    pthisMagBuffer->iOlder[ibin] = pthisMagBuffer->iNewest;
+    pthisMagBuffer->iNewer[ibin] = -1;
+    if (pthisMagBuffer->iNewest != -1)
+        pthisMagBuffer->iNewer[pthisMagBuffer->iNewest] = ibin;
+    else
+        pthisMagBuffer->iOldest = ibin;
+    pthisMagBuffer->iNewest = ibin;
+#endif
+
+    for (i = CHX; i <= CHZ; i++)
+    {
+        pthisMagBuffer->iBs[i][j][k] = pthisMag->iBs[i];
+    }
+
+#if COMPACT_GLOBALS
+    pthisMagBuffer->index[j][k] = iMagBufferTimeIndex(pthisMagBuffer, loopcounter);
+#else
+    pthisMagBuffer->index[j][k] = loopcounter;
+#endif
+
+    return;
+}
+
 // function updates the magnetic measurement buffer with most recent magnetic data (typically 200Hz)
 
 // the uncalibrated measurements iBs are stored in the buffer but the calibrated measurements iBc are used for indexing.
@@ -124,8 +268,8 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
             m;          // counters
     int8    itooclose;  // flag denoting measurement is too close to existing ones
 
-    // calculate the magnetometer buffer bins from the tangent ratios
     if (pthisMag->iBc[CHZ] == 0) return;
+    // calculate the magnetometer buffer bins from the tangent ratios
     itanj = (100 * (int32) pthisMag->iBc[CHX]) / ((int32) pthisMag->iBc[CHZ]);
     itank = (100 * (int32) pthisMag->iBc[CHY]) / ((int32) pthisMag->iBc[CHZ]);
 
@@ -145,12 +289,7 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
         (pthisMagBuffer->index[j][k] != -1))
     {
         // store the fast (unaveraged at typically 200Hz) integer magnetometer reading into the buffer bin j, k
-        for (i = CHX; i <= CHZ; i++)
-        {
-            pthisMagBuffer->iBs[i][j][k] = pthisMag->iBs[i];
-        }
-
-        pthisMagBuffer->index[j][k] = loopcounter;
+        fStoreMagBufferEntry(pthisMagBuffer, pthisMag, j, k, loopcounter);
         return;
     }                   // end case 1
 
@@ -160,15 +299,16 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
         (pthisMagBuffer->index[j][k] == -1))
     {
         // store the fast (unaveraged at typically 200Hz) integer magnetometer reading into the buffer bin j, k
-        for (i = CHX; i <= CHZ; i++)
-        {
-            pthisMagBuffer->iBs[i][j][k] = pthisMag->iBs[i];
-        }
-
-        pthisMagBuffer->index[j][k] = loopcounter;
-
-        // set l and m to the oldest active entry and disable it
-        i = loopcounter;
+        fStoreMagBufferEntry(pthisMagBuffer, pthisMag, j, k, loopcounter);
+
+#if MAGBUFFER_FASTINDEX
+        // the oldest active entry is the head of the age ordered list
+        i = pthisMagBuffer->iOldest;
+        fUnlinkMagBufferEntry(pthisMagBuffer, (int16) i);
+        (&pthisMagBuffer->index[0][0])[i] = -1;
+#else
+        // set l and m to the oldest active entry and disable it (older than the entry just stored)
+        i = pthisMagBuffer->index[j][k];
         l = m = 0;      // to avoid compiler complaint
         for (j = 0; j < MAGBUFFSIZEX; j++)
         {
@@ -193,6 +333,7 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
 
         // deactivate the oldest measurement (no need to zero the measurement data)
         pthisMagBuffer->index[l][m] = -1;
+#endif
         return;
     }                   // end case 2
 
@@ -201,12 +342,7 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
         (pthisMagBuffer->index[j][k] == -1))
     {
         // store the fast (unaveraged at typically 200Hz) integer magnetometer reading into the buffer bin j, k
-        for (i = CHX; i <= CHZ; i++)
-        {
-            pthisMagBuffer->iBs[i][j][k] = pthisMag->iBs[i];
-        }
-
-        pthisMagBuffer->index[j][k] = loopcounter;
+        fStoreMagBufferEntry(pthisMagBuffer, pthisMag, j, k, loopcounter);
         (pthisMagBuffer->iMagBufferCount)++;
         return;
     }                   // end case 3
@@ -228,12 +364,7 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
         if (idelta < MESHDELTACOUNTS)
         {
             // simply over-write the measurement and return
-            for (i = CHX; i <= CHZ; i++)
-            {
-                pthisMagBuffer->iBs[i][j][k] = pthisMag->iBs[i];
-            }
-
-            pthisMagBuffer->index[j][k] = loopcounter;
+            fStoreMagBufferEntry(pthisMagBuffer, pthisMag, j, k, loopcounter);
         }
         else
         {
@@ -244,6 +375,7 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
             l = m = 0;
 
             // loop over the buffer j from 0 potentially up to MAGBUFFSIZEX - 1
+            // this search only runs while the buffer is filling so is left as a scan with MAGBUFFER_FASTINDEX
             j = 0;
             while (!itooclose && (j < MAGBUFFSIZEX))
             {
@@ -286,12 +418,7 @@ void iUpdateMagBuffer(struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisM
             // l and m are guaranteed to be set if no entries too close are detected
             if (!itooclose)
             {
-                for (i = CHX; i <= CHZ; i++)
-                {
-                    pthisMagBuffer->iBs[i][l][m] = pthisMag->iBs[i];
-                }
-
-                pthisMagBuffer->index[l][m] = loopcounter;
+                fStoreMagBufferEntry(pthisMagBuffer, pthisMag, l, m, loopcounter);
                 (pthisMagBuffer->iMagBufferCount)++;
             }
         }               // end of test for closeness to current buffer entry
@@ -331,86 +458,64 @@ void fInvertMagCal(struct MagSensor *pthisMag, struct MagCalibration *pthisMagCa
     return;
 }
 
-// function runs the magnetic calibration
-void fRunMagCalibration(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer,
-                        struct MagSensor *pthisMag, int32 loopcounter)
+// function selects the magnetic calibration model to run next (if any) given the number of
+// measurements in the buffer and stores it in iInitiateMagCal (0 = none, 4, 7 or 10 element)
+static void fSelectMagCalibration(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer,
+                                  int32 loopcounter)
 {
-    int8    i,
-            j;  // loop counters
+    // clear the flag
+    pthisMagCal->iInitiateMagCal = 0;
 
-    // determine whether to initiate a new magnetic calibration
-    if (!pthisMagCal->iCalInProgress)
+    // try one calibration attempt with the best model available given the number of measurements
+    if ((pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS10CAL) &&
+        (!pthisMagCal->i10ElementSolverTried))
+    {
+        pthisMagCal->i10ElementSolverTried = true;
+        pthisMagCal->iInitiateMagCal = 10;
+    }
+    else if ((pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS7CAL) &&
+             (!pthisMagCal->i7ElementSolverTried))
+    {
+        pthisMagCal->i7ElementSolverTried = true;
+        pthisMagCal->iInitiateMagCal = 7;
+    }
+    else if ((pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS4CAL) &&
+             (!pthisMagCal->i4ElementSolverTried))
     {
-        // clear the flag
-        pthisMagCal->iInitiateMagCal = 0;
+        pthisMagCal->i4ElementSolverTried = true;
+        pthisMagCal->iInitiateMagCal = 4;
+    }
 
-        // try one calibration attempt with the best model available given the number of measurements
-        if ((pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS10CAL) &&
-            (!pthisMagCal->i10ElementSolverTried))
+    // otherwise start a calibration at regular interval defined by CAL_INTERVAL_SECS
+    else if (!pthisMagCal->iInitiateMagCal &&
+             !(loopcounter % (CAL_INTERVAL_SECS * FUSION_HZ)))
+    {
+        if (pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS10CAL)
         {
             pthisMagCal->i10ElementSolverTried = true;
             pthisMagCal->iInitiateMagCal = 10;
         }
-        else if ((pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS7CAL) &&
-                 (!pthisMagCal->i7ElementSolverTried))
+        else if (pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS7CAL)
         {
             pthisMagCal->i7ElementSolverTried = true;
             pthisMagCal->iInitiateMagCal = 7;
         }
-        else if ((pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS4CAL) &&
-                 (!pthisMagCal->i4ElementSolverTried))
+        else if (pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS4CAL)
         {
             pthisMagCal->i4ElementSolverTried = true;
             pthisMagCal->iInitiateMagCal = 4;
         }
-
-        // otherwise start a calibration at regular interval defined by CAL_INTERVAL_SECS
-        else if (!pthisMagCal->iInitiateMagCal &&
-                 !(loopcounter % (CAL_INTERVAL_SECS * FUSION_HZ)))
-        {
-            if (pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS10CAL)
-            {
-                pthisMagCal->i10ElementSolverTried = true;
-                pthisMagCal->iInitiateMagCal = 10;
-            }
-            else if (pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS7CAL)
-            {
-                pthisMagCal->i7ElementSolverTried = true;
-                pthisMagCal->iInitiateMagCal = 7;
-            }
-            else if (pthisMagBuffer->iMagBufferCount >= MINMEASUREMENTS4CAL)
-            {
-                pthisMagCal->i4ElementSolverTried = true;
-                pthisMagCal->iInitiateMagCal = 4;
-            }
-        }
-
-        // store the selected calibration model (if any) to be run
-        pthisMagCal->iCalInProgress = pthisMagCal->iInitiateMagCal;
     }
 
-    // on entry each of the calibration functions resets iInitiateMagCal and on completion sets
-    // iCalInProgress=0 and iNewCalibrationAvailable=4,7,10 according to the solver used
-    switch (pthisMagCal->iCalInProgress)
-    {
-        case 0:
-            break;
-
-        case 4:
-            fUpdateMagCalibration4Slice(pthisMagCal, pthisMagBuffer, pthisMag);
-            break;
-
-        case 7:
-            fUpdateMagCalibration7Slice(pthisMagCal, pthisMagBuffer, pthisMag);
-            break;
-
-        case 10:
-            fUpdateMagCalibration10Slice(pthisMagCal, pthisMagBuffer, pthisMag);
-            break;
+    return;
+}
 
-        default:
-            break;
-    }
+// function decides whether to accept a new trial calibration (iNewCalibrationAvailable set) and ages
+// the fit error of the current one.  Called once per fusion iteration.
+static void fEvaluateMagCalibration(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer)
+{
+    int8    i,
+            j;  // loop counters
 
     // evaluate the new calibration to determine whether to accept it
     if (pthisMagCal->iNewCalibrationAvailable)
@@ -461,6 +566,167 @@ void fRunMagCalibration(struct MagCalibration *pthisMagCal, struct MagBuffer *pt
     return;
 }
 
+// function runs the magnetic calibration
+void fRunMagCalibration(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer,
+                        struct MagSensor *pthisMag, int32 loopcounter)
+{
+    // determine whether to initiate a new magnetic calibration
+    if (!pthisMagCal->iCalInProgress)
+    {
+        fSelectMagCalibration(pthisMagCal, pthisMagBuffer, loopcounter);
+
+        // store the selected calibration model (if any) to be run
+        pthisMagCal->iCalInProgress = pthisMagCal->iInitiateMagCal;
+    }
+
+    // on entry each of the calibration functions resets iInitiateMagCal and on completion sets
+    // iCalInProgress=0 and iNewCalibrationAvailable=4,7,10 according to the solver used
+    switch (pthisMagCal->iCalInProgress)
+    {
+        case 0:
+            break;
+
+        case 4:
+            fUpdateMagCalibration4Slice(pthisMagCal, pthisMagBuffer, pthisMag);
+            break;
+
+        case 7:
+            fUpdateMagCalibration7Slice(pthisMagCal, pthisMagBuffer, pthisMag);
+            break;
+
+        case 10:
+            fUpdateMagCalibration10Slice(pthisMagCal, pthisMagBuffer, pthisMag);
+            break;
+
+        default:
+            break;
+    }
+
+    // evaluate the new calibration to determine whether to accept it
+    fEvaluateMagCalibration(pthisMagCal, pthisMagBuffer);
+
+    return;
+}
+
+#if MAGCAL_BACKGROUND
+// function discards any background calibration queued before a magnetic calibration reset
+void fInitializeMagCalBackground(struct MagCalBackground *pthisBg)
+{
+    int32   iJob;                   // last job handed to the worker
+
+    // bring the fusion task indices level with the last queued job.  iPublished is only ever
+    // written by the worker: it is already level when the worker is idle, and a job still
+    // running completes into a result at or below iDiscard, which is never taken.  No new
+    // job is queued until iQueued, iPublished and iConsumed agree again.
+    iJob = pthisBg->iQueued;
+    pthisBg->iDiscard = iJob;
+    pthisBg->iConsumed = iJob;
+
+    return;
+}
+
+// function is the fusion task side of the background magnetic calibration.  It replaces
+// fRunMagCalibration: it evaluates any result published by the worker and, when the worker
+// is idle, snapshots the measurement buffer and queues the next solver.  Returns true if a
+// job was queued and the worker task should be woken.
+int8 fQueueMagCalibration(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer,
+                          struct MagSensor *pthisMag, struct MagCalBackground *pthisBg, int32 loopcounter)
+{
+    struct MagCalResult *pResult;   // result published by the worker
+    int32   iJob;                   // job number
+    int8    i,
+            j;                      // loop counters
+
+    // take the latest published result as the trial calibration
+    iJob = pthisBg->iPublished;
+    __DMB();                        // read the result slot only after its job number
+    if (iJob != pthisBg->iConsumed)
+    {
+        pthisBg->iConsumed = iJob;
+        pResult = &(pthisBg->Result[iJob & 1]);
+        if (iJob - pthisBg->iDiscard > 0)
+        {
+            for (i = CHX; i <= CHZ; i++)
+            {
+                pthisMagCal->ftrV[i] = pResult->fV[i];
+                for (j = CHX; j <= CHZ; j++)
+                    pthisMagCal->ftrinvW[i][j] = pResult->finvW[i][j];
+            }
+            pthisMagCal->ftrB = pResult->fB;
+            pthisMagCal->ftrFitErrorpc = pResult->fFitErrorpc;
+            pthisMagCal->iNewCalibrationAvailable = (int8) pResult->iSolver;
+        }
+    }
+
+    // evaluate the new calibration to determine whether to accept it
+    fEvaluateMagCalibration(pthisMagCal, pthisMagBuffer);
+
+    // queue the next solver on a private copy of the buffer if the worker is idle
+    if ((pthisBg->iQueued != pthisBg->iPublished) || (pthisBg->iConsumed != pthisBg->iPublished))
+        return (false);
+    fSelectMagCalibration(pthisMagCal, pthisMagBuffer, loopcounter);
+    if (!pthisMagCal->iInitiateMagCal)
+        return (false);
+    pthisBg->MagBuffer = *pthisMagBuffer;
+    pthisBg->pMag = pthisMag;
+    pthisBg->iSolver = pthisMagCal->iInitiateMagCal;
+    pthisMagCal->iInitiateMagCal = 0;
+    __DMB();                                    // the snapshot is complete before it is handed over
+    pthisBg->iQueued = pthisBg->iQueued + 1;   // hand the snapshot over to the worker
+
+    return (true);
+}
+
+// function is the worker side of the background magnetic calibration, called from a low
+// priority task.  It runs the queued solver to completion on the buffer snapshot and
+// publishes the result in the slot not being read by the fusion task.
+void fRunMagCalibrationJob(struct MagCalBackground *pthisBg)
+{
+    struct MagCalResult *pResult;   // slot receiving this result
+    int32   iJob;                   // job number
+    int8    i,
+            j;                      // loop counters
+
+    iJob = pthisBg->iQueued;
+    if (iJob == pthisBg->iPublished)
+        return;
+    __DMB();                        // read the snapshot only after its job number
+
+    switch (pthisBg->iSolver)
+    {
+        case 4:
+            fComputeMagCalibration4(&(pthisBg->MagCal), &(pthisBg->MagBuffer), pthisBg->pMag);
+            break;
+
+        case 7:
+            fComputeMagCalibration7(&(pthisBg->MagCal), &(pthisBg->MagBuffer), pthisBg->pMag);
+            break;
+
+        case 10:
+            fComputeMagCalibration10(&(pthisBg->MagCal), &(pthisBg->MagBuffer), pthisBg->pMag);
+            break;
+
+        default:
+            break;
+    }
+
+    pResult = &(pthisBg->Result[iJob & 1]);
+    for (i = CHX; i <= CHZ; i++)
+    {
+        pResult->fV[i] = pthisBg->MagCal.ftrV[i];
+        for (j = CHX; j <= CHZ; j++)
+            pResult->finvW[i][j] = pthisBg->MagCal.ftrinvW[i][j];
+    }
+    pResult->fB = pthisBg->MagCal.ftrB;
+    pResult->fFitErrorpc = pthisBg->MagCal.ftrFitErrorpc;
+    pResult->iSolver = pthisBg->iSolver;
+    __DMB();                        // the result is complete before its job number is published
+    pthisBg->iPublished = iJob;     // single word write publishes the complete result
+
+    return;
+}
+#endif
+
 // 4 element calibration using 4x4 matrix inverse
 void fUpdateMagCalibration4Slice(struct MagCalibration *pthisMagCal,
                                  struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag)
@@ -1129,6 +1395,29 @@ void fUpdateMagCalibration10Slice(struct MagCalibration *pthisMagCal,
         (pthisMagCal->itimeslice)++;
     }                   // end of time slice MAGBUFFSIZEX * MAGBUFFSIZEY + 1
 
+#if MAGCAL_INVERSE_ITERATION
+    // time slices MAGBUFFSIZEX * MAGBUFFSIZEY + 2 to MAGBUFFSIZEX * MAGBUFFSIZEY + 46 inclusive compute only the
+    // smallest eigenvalue fvecA[0] and its eigenvector in column 0 of fmatB by inverse iteration: the first slice
+    // factorizes fmatA and each later slice is one iteration (typically 3 or 4) until the eigenvector converges.
+    else if ((pthisMagCal->itimeslice >= (MAGBUFFSIZEX * MAGBUFFSIZEY + 2)) &&
+             (pthisMagCal->itimeslice <= (MAGBUFFSIZEX * MAGBUFFSIZEY + 46)))
+    {
+        k = pthisMagCal->itimeslice - (MAGBUFFSIZEX * MAGBUFFSIZEY + 2);
+        if (fComputeEigSmallestSlice(pthisMagCal->fmatA, pthisMagCal->fmatB,
+                                     pthisMagCal->fvecA, k, MATRIX_10_SIZE))
+            // skip to calculation of the calibration coefficients
+            (pthisMagCal->itimeslice) = MAGBUFFSIZEX * MAGBUFFSIZEY + 48;
+        else
+            (pthisMagCal->itimeslice)++;
+    }                   // end of time slice MAGBUFFSIZEX * MAGBUFFSIZEY + 2 to MAGBUFFSIZEX * MAGBUFFSIZEY + 46 inclusive
+
+    // time slice MAGBUFFSIZEX * MAGBUFFSIZEY + 47: the inverse iteration has used all its slices without
+    // converging so continue with the latest estimate and let the fit error decide on the calibration
+    else if (pthisMagCal->itimeslice == (MAGBUFFSIZEX * MAGBUFFSIZEY + 47))
+    {
+        (pthisMagCal->itimeslice)++;
+    }                   // end of time slice MAGBUFFSIZEX * MAGBUFFSIZEY + 47
+#else
     // repeating 45 time slices MAGBUFFSIZEX * MAGBUFFSIZEY + 2 to MAGBUFFSIZEX * MAGBUFFSIZEY + 46 inclusive
     // to perform the eigendecomposition of the measurement matrix fmatA.
     // 28.2k ticks = 0.56ms on KL25Z (with max stored in systick[3]).
@@ -1211,6 +1500,7 @@ void fUpdateMagCalibration10Slice(struct MagCalibration *pthisMagCal,
             // continue to compute the calibration coefficients since the eigen-decomposition is complete
             (pthisMagCal->itimeslice)++;
     }                   // end of time slice MAGBUFFSIZEX * MAGBUFFSIZEY + 47
+#endif
 
     // time slice MAGBUFFSIZEX * MAGBUFFSIZEY + 48: 38.5k ticks = 0.80ms on KL25Z (constant) (stored in systick[5])
     // compute the calibration coefficients (excluding invW) from the solution eigenvector
@@ -1221,8 +1511,10 @@ void fUpdateMagCalibration10Slice(struct MagCalibration *pthisMagCal,
 
         // set imin to the index of the smallest eigenvalue in fvecA
         imin = 0;
+#if !MAGCAL_INVERSE_ITERATION
         for (i = 1; i < MATRIX_10_SIZE; i++)
             if (pthisMagCal->fvecA[i] < pthisMagCal->fvecA[imin]) imin = i;
+#endif
 
         // set the ellipsoid matrix A from elements 0 to 5 of the solution eigenvector.
         pthisMagCal->fA[CHX][CHX] = pthisMagCal->fmatB[0][imin];
@@ -1881,6 +2173,12 @@ void fComputeMagCalibration10(struct MagCalibration *pthisMagCal,
         }
     }
 
+#if MAGCAL_INVERSE_ITERATION
+    // set pthisMagCal->fvecA[0] to the smallest eigenvalue and column 0 of fmatB to its normalized eigenvector
+    fEigenSmallest10(pthisMagCal->fmatA, pthisMagCal->fvecA, pthisMagCal->fmatB,
+                     10);
+    j = 0;
+#else
     // set pthisMagCal->fvecA to the unsorted eigenvalues and fmatB to the unsorted normalized eigenvectors of fmatA
     fEigenCompute10(pthisMagCal->fmatA, pthisMagCal->fvecA, pthisMagCal->fmatB,
                     10);
@@ -1894,6 +2192,7 @@ void fComputeMagCalibration10(struct MagCalibration *pthisMagCal,
             j = i;
         }
     }
+#endif
 
     pthisMagCal->fA[0][0] = pthisMagCal->fmatB[0][j];
     pthisMagCal->fA[0][1] = pthisMagCal->fA[1][0] = pthisMagCal->fmatB[1][j];
@@ -43,6 +43,19 @@
 #define F_USING_MAG 0x0002  // normally should be defined in build.h
 #endif
 
+#if COMPACT_GLOBALS
+/// Scratch matrices and vectors of the 4, 7 and 10 element calibration solvers.  With
+/// COMPACT_GLOBALS one copy in SensorFusionGlobals is shared by the precision accelerometer
+/// calibration and the time sliced magnetic calibration, which never run at the same time.
+struct CalibrationScratch
+{
+	float fmatA[10][10];			        ///< scratch 10x10 float matrix used by calibration algorithms
+	float fmatB[10][10];			        ///< scratch 10x10 float matrix used by calibration algorithms
+	float fvecA[10];				///< scratch 10x1 vector used by calibration algorithms
+	float fvecB[4];					///< scratch 4x1 vector used by calibration algorithms
+};
+#endif
+
 #if F_USING_MAG
 /// @name Magnetic Calibration Constants
 ///@{
@@ -58,17 +71,51 @@
 #define FITERRORAGINGSECS 86400.0F		///< 24 hours: time (s) for fit error to increase (age) by e=2.718
 #define MESHDELTACOUNTS 50			///< magnetic buffer mesh spacing in counts (here 5uT)
 #define DEFAULTB 50.0F				///< default geomagnetic field (uT)
+#ifndef MAGCAL_BACKGROUND
+#define MAGCAL_BACKGROUND 0			///< 1 to allow running the solvers in a separate low priority task
+#endif
+#ifndef MAGCAL_INVERSE_ITERATION
+#define MAGCAL_INVERSE_ITERATION 0		///< 1 to solve only the smallest eigenpair in the 10 element calibration
+#endif
+#ifndef MAGBUFFER_FASTINDEX
+#define MAGBUFFER_FASTINDEX 0			///< 1 for constant time retirement of the oldest bin
+#endif
 ///@}
 
+#if COMPACT_GLOBALS
+typedef int16_t magindex_t;			///< magnetic buffer time index: loop count relative to iIndexBase, -1 for empty
+#define MAGINDEX_MAX 0x7FFF			///< largest relative time index before the buffer is rebased
+#else
+typedef int32_t magindex_t;			///< magnetic buffer time index: loop count, -1 for empty
+#endif
+
 /// The Magnetometer Measurement Buffer holds a 3-dimensional "constellation"
 /// of data points.
 ///
 /// The constellation of points are used to compute magnetic hard/soft iron compensation terms.
 /// The contents of this buffer are updated on a continuing basis.
+///
+/// With MAGBUFFER_FASTINDEX the occupied bins are also chained in the order they were last
+/// written (bin number j * MAGBUFFSIZEY + k), so that the oldest measurement is the head of
+/// the list rather than the result of a search over all time indices.
+///
+/// With COMPACT_GLOBALS the time indices are 16 bit ages relative to iIndexBase.  When the
+/// loop counter runs MAGINDEX_MAX past the base, the occupied bins are renumbered by age rank
+/// (0 for the oldest) and the base is moved so that the next index follows the newest rank.
+/// The order of the bins, and so the oldest bin retired, is the same as with 32 bit indices.
 struct MagBuffer
 {
 	int16_t iBs[3][MAGBUFFSIZEX][MAGBUFFSIZEY];		///< uncalibrated magnetometer readings
-	int32_t index[MAGBUFFSIZEX][MAGBUFFSIZEY];		///< array of time indices
+	magindex_t index[MAGBUFFSIZEX][MAGBUFFSIZEY];		///< array of time indices
+#if COMPACT_GLOBALS
+	int32_t iIndexBase;					///< loop count of time index 0
+#endif
+#if MAGBUFFER_FASTINDEX
+	int16_t iNewer[MAGBUFFSIZEX * MAGBUFFSIZEY];		///< next more recently written bin or -1
+	int16_t iOlder[MAGBUFFSIZEX * MAGBUFFSIZEY];		///< next less recently written bin or -1
+	int16_t iOldest;					///< least recently written occupied bin or -1
+	int16_t iNewest;					///< most recently written occupied bin or -1
+#endif
 	int16_t tanarray[MAGBUFFSIZEX - 1];			///< array of tangents of (100 * angle)
 	int16_t iMagBufferCount;				///< number of magnetometer readings
 };
@@ -91,10 +138,17 @@ struct MagCalibration
 	float ftrFitErrorpc;			        ///< trial value of fit error %
 	float fA[3][3];					///< ellipsoid matrix A
 	float finvA[3][3];				///< inverse of ellipsoid matrix A
+#if COMPACT_GLOBALS
+	float (*fmatA)[10];				///< scratch 10x10 float matrix (struct CalibrationScratch)
+	float (*fmatB)[10];				///< scratch 10x10 float matrix (struct CalibrationScratch)
+	float *fvecA;					///< scratch 10x1 vector (struct CalibrationScratch)
+	float *fvecB;					///< scratch 4x1 vector (struct CalibrationScratch)
+#else
 	float fmatA[10][10];			        ///< scratch 10x10 float matrix used by calibration algorithms
 	float fmatB[10][10];			        ///< scratch 10x10 float matrix used by calibration algorithms
 	float fvecA[10];				///< scratch 10x1 vector used by calibration algorithms
 	float fvecB[4];					///< scratch 4x1 vector used by calibration algorithms
+#endif
 	float fYTY;					///< Y^T.Y for 4 element calibration = (iB^2)^2
 	int32_t iSumBs[3];				///< sum of measurements in buffer (counts)
 	int32_t iMeanBs[3];				///< average magnetic measurement (counts)
@@ -108,9 +162,42 @@ struct MagCalibration
 	int8_t i10ElementSolverTried;		        ///< flag to denote at least one attempt made with 4 element calibration
 };
 
-
 struct MagSensor;  // actual typedef is located in sensor_fusion_types.h
 
+#if MAGCAL_BACKGROUND
+/// Result of one background magnetic calibration, as published by the worker task
+struct MagCalResult
+{
+	float fV[3];					///< trial hard iron offset x, y, z (uT)
+	float finvW[3][3];				///< trial inverse soft iron matrix
+	float fB;					///< trial geomagnetic field magnitude (uT)
+	float fFitErrorpc;				///< trial fit error %
+	int32_t iSolver;				///< solver used: 4, 7 or 10 element
+};
+
+/// Background Magnetic Calibration Structure
+///
+/// The fusion task snapshots the measurement buffer and queues a solver (fQueueMagCalibration),
+/// a low priority task runs it to completion on the copy (fRunMagCalibrationJob) and publishes
+/// the result in one of two slots.  The fusion task never waits for a solver and the live
+/// buffer is never made read only.
+struct MagCalBackground
+{
+	struct MagBuffer MagBuffer;			///< snapshot of the measurement buffer owned by the worker
+	struct MagCalibration MagCal;			///< worker scratch matrices and trial values
+#if COMPACT_GLOBALS
+	struct CalibrationScratch Scratch;		///< worker scratch (the worker runs concurrently so cannot share)
+#endif
+	struct MagCalResult Result[2];			///< double buffered results, slot = job number & 1
+	struct MagSensor *pMag;				///< magnetometer scale factors used by the solvers
+	int32_t iSolver;				///< solver requested for the queued job
+	volatile int32_t iQueued;			///< number of the last job handed to the worker
+	volatile int32_t iPublished;			///< number of the last job completed by the worker
+	int32_t iConsumed;				///< number of the last result taken by the fusion task
+	int32_t iDiscard;				///< results up to this job number predate a calibration reset
+};
+#endif
+
 /// @name Function prototypes for functions in magnetic.c
 /// These functions comprise the core of the magnetic calibration features of
 /// the library.  Parameter descriptions are not included here,
@@ -126,6 +213,18 @@ void fUpdateMagCalibration10(struct MagCalibration *pthisMagCal, struct MagBuffe
 void fUpdateMagCalibration4Slice(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag);
 void fUpdateMagCalibration7Slice(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag);
 void fUpdateMagCalibration10Slice(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag);
+void fComputeMagCalibration4(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag);
+void fComputeMagCalibration7(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag);
+void fComputeMagCalibration10(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag);
+void fAbandonMagCalibration(struct MagCalibration *pthisMagCal);
+#if COMPACT_GLOBALS
+void fAttachMagCalScratch(struct MagCalibration *pthisMagCal, struct CalibrationScratch *pthisScratch);
+#endif
+#if MAGCAL_BACKGROUND
+void fInitializeMagCalBackground(struct MagCalBackground *pthisBg);
+int8_t fQueueMagCalibration(struct MagCalibration *pthisMagCal, struct MagBuffer *pthisMagBuffer, struct MagSensor *pthisMag, struct MagCalBackground *pthisBg, int32_t loopcounter);
+void fRunMagCalibrationJob(struct MagCalBackground *pthisBg);
+#endif
 ///@}
 #else    // if F_USING_MAG
 struct MagBuffer
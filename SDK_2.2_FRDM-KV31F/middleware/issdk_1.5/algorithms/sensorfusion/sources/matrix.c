@@ -44,6 +44,9 @@
 
 // compile time constants that are private to this file
 #define CORRUPTMATRIX   0.001F  // column vector modulus limit for rotation matrix
+#define EIGPIVOTFLOOR   1E-7F   // Cholesky pivot floor relative to the diagonal element in the inverse iteration
+#define EIGCONVERGENCE  1E-10F  // squared eigenvector change at which the inverse iteration has converged
+#define NINVITERATIONS  20      // maximum number of inverse iterations
 
 // function sets the 3x3 matrix A to the identity matrix
 void f3x3matrixAeqI(float A[][3])
@@ -664,6 +667,115 @@ void fComputeEigSlice(float fmatA[10][10], float fmatB[10][10], float fvecA[10],
     return;
 }
 
+// function performs one slice of an inverse iteration for the eigenvalue of smallest magnitude and its eigenvector
+// of a real symmetric matrix fmatA[0..iMatrixSize-1][0..iMatrixSize-1].  for the positive semi-definite
+// calibration measurement matrices this is the smallest eigenvalue, including when rounding has made it negative.
+// slice 0 replaces the below diagonal elements of fmatA with the unit lower triangular L and the diagonal with D
+// where fmatA = L.D.L^T and sets the start vector in column 0 of fmatB.  the above diagonal elements are not used.
+// each later slice solves L.D.L^T.y = x for x in column 0 of fmatB (using column 1 as scratch), stores the
+// Rayleigh estimate of the eigenvalue in fvecA[0] and the normalized y back into column 0.
+// the function returns true once the eigenvector has converged.
+int8 fComputeEigSmallestSlice(float fmatA[10][10], float fmatB[10][10], float fvecA[10],
+                              int8 islice, int8 iMatrixSize)
+{
+    float   fsum;       // accumulator
+    float   fnorm;      // norm of y
+    float   fdelta;     // squared change in the normalized eigenvector
+    int8    i,
+            j,
+            k;          // loop counters
+
+    if (islice == 0)
+    {
+        // in place L.D.L^T factorization of the lower triangle.  a pivot which has lost all its significant
+        // digits (the matrix is singular or nearly so) is clamped rather than failing since that only enlarges
+        // the component of the solution along the wanted eigenvector.
+        for (k = 0; k < iMatrixSize; k++)
+        {
+            fnorm = EIGPIVOTFLOOR * fabsf(fmatA[k][k]);
+            if (fnorm == 0.0F) fnorm = EIGPIVOTFLOOR;
+            fsum = fmatA[k][k];
+            for (j = 0; j < k; j++)
+                fsum -= fmatA[k][j] * fmatA[k][j] * fmatA[j][j];
+            if (fabsf(fsum) < fnorm) fsum = (fsum < 0.0F) ? -fnorm : fnorm;
+            fmatA[k][k] = fsum;
+
+            for (i = k + 1; i < iMatrixSize; i++)
+            {
+                fsum = fmatA[i][k];
+                for (j = 0; j < k; j++)
+                    fsum -= fmatA[i][j] * fmatA[k][j] * fmatA[j][j];
+                fmatA[i][k] = fsum / fmatA[k][k];
+            }
+        }
+
+        // start from the normalized vector of ones
+        fnorm = 1.0F / sqrtf((float) iMatrixSize);
+        for (i = 0; i < iMatrixSize; i++)
+            fmatB[i][0] = fnorm;
+        fvecA[0] = 0.0F;
+
+        return (false);
+    }
+
+    // forward substitution L.z = x with z in column 1 of fmatB
+    for (i = 0; i < iMatrixSize; i++)
+    {
+        fsum = fmatB[i][0];
+        for (k = 0; k < i; k++)
+            fsum -= fmatA[i][k] * fmatB[k][1];
+        fmatB[i][1] = fsum;
+    }
+
+    // divide by D and back substitute L^T.y = inv(D).z in place in column 1 of fmatB
+    for (i = iMatrixSize - 1; i >= 0; i--)
+    {
+        fsum = fmatB[i][1] / fmatA[i][i];
+        for (k = i + 1; k < iMatrixSize; k++)
+            fsum -= fmatA[k][i] * fmatB[k][1];
+        fmatB[i][1] = fsum;
+    }
+
+    // the Rayleigh quotient of the inverse x^T.y = 1 / eigenvalue when x is the eigenvector
+    fsum = fnorm = 0.0F;
+    for (i = 0; i < iMatrixSize; i++)
+    {
+        fsum += fmatB[i][0] * fmatB[i][1];
+        fnorm += fmatB[i][1] * fmatB[i][1];
+    }
+    fvecA[0] = (fsum != 0.0F) ? 1.0F / fsum : 0.0F;
+
+    // normalize y keeping the sign of x and replace x
+    fnorm = 1.0F / sqrtf(fnorm);
+    if (fsum < 0.0F) fnorm = -fnorm;
+    fdelta = 0.0F;
+    for (i = 0; i < iMatrixSize; i++)
+    {
+        fsum = fmatB[i][1] * fnorm;
+        fdelta += (fsum - fmatB[i][0]) * (fsum - fmatB[i][0]);
+        fmatB[i][0] = fsum;
+    }
+
+    return (fdelta < EIGCONVERGENCE);
+}
+
+// function computes the smallest eigenvalue and its eigenvector of a real symmetric positive semi-definite
+// matrix A[0..n-1][0..n-1] by inverse iteration.  A[][] is changed on output.
+// eigval[0] returns the smallest (in magnitude) eigenvalue and column 0 of eigvec[][] the normalized eigenvector.
+// column 1 of eigvec[][] is used as scratch and the other elements are not changed.
+void fEigenSmallest10(float A[][10], float eigval[], float eigvec[][10], int8 n)
+{
+    int8    islice;     // iteration counter
+
+    fComputeEigSmallestSlice(A, eigvec, eigval, 0, n);
+    for (islice = 1; islice <= NINVITERATIONS; islice++)
+    {
+        if (fComputeEigSmallestSlice(A, eigvec, eigval, islice, n)) break;
+    }
+
+    return;
+}
+
 // function uses Gauss-Jordan elimination to compute the inverse of matrix A in situ
 
 // on exit, A is replaced with its inverse
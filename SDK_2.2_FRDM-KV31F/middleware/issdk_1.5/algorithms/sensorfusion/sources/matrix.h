@@ -105,6 +105,23 @@ void fComputeEigSlice(
     int8 j, 
     int8 iMatrixSize
 );
+/// function computes the smallest eigenvalue and its eigenvector of a real symmetric positive semi-definite
+/// matrix A[0..n-1][0..n-1] by inverse iteration.  A[][] is changed on output.
+void fEigenSmallest10(
+    float A[][10],              ///< real symmetric matrix A[0..n-1][0..n-1]
+    float eigval[],             ///< eigval[0] returns the smallest eigenvalue of A[][]
+    float eigvec[][10],         ///< column 0 returns the normalized eigenvector, column 1 is scratch
+    int8 n                      ///< n can vary up to and including 10 but the matrices A and eigvec must have 10 columns.
+);
+/// function performs one slice of the inverse iteration used by fEigenSmallest10: slice 0 factorizes
+/// fmatA = L.D.L^T in place and each later slice is one iteration.  Returns true once the eigenvector has converged.
+int8 fComputeEigSmallestSlice(
+    float fmatA[10][10], 
+    float fmatB[10][10], 
+    float fvecA[10], 
+    int8 islice, 
+    int8 iMatrixSize
+);
 /// function uses Gauss-Jordan elimination to compute the inverse of matrix A in situ
 /// on exit, A is replaced with its inverse
 void fmatrixAeqInvA(
@@ -52,6 +52,7 @@
 #include "fusion.h"
 #include "matrix.h"
 #include "approximations.h"
+#include "fastmath.h"
 
 // compile time constants that are private to this file
 #define SMALLQ0 1E-4F		// limit of quaternion scalar component requiring special algorithm
@@ -353,7 +354,7 @@ void feCompassNED(float fR[][3], float *pfDelta, float *pfsinDelta, float *pfcos
 	{
 		*pfsinDelta = fGcdotBc / (*pfmodGc * *pfmodBc);
 		*pfcosDelta = sqrtf(1.0F - *pfsinDelta * *pfsinDelta);
-		*pfDelta = fasin_deg(*pfsinDelta);
+		*pfDelta = FASIN_DEG(*pfsinDelta);
 	}
 
 	return;
@@ -427,7 +428,7 @@ void feCompassAndroid(float fR[][3], float *pfDelta, float *pfsinDelta, float *p
 	{
 		*pfsinDelta = -fGcdotBc / (*pfmodGc * *pfmodBc);
 		*pfcosDelta = sqrtf(1.0F - *pfsinDelta * *pfsinDelta);
-		*pfDelta = fasin_deg(*pfsinDelta);
+		*pfDelta = FASIN_DEG(*pfsinDelta);
 	}
 
 	return;
@@ -501,7 +502,7 @@ void feCompassWin8(float fR[][3], float *pfDelta, float *pfsinDelta, float *pfco
 	{
 		*pfsinDelta = fGcdotBc / (*pfmodGc * *pfmodBc);
 		*pfcosDelta = sqrtf(1.0F - *pfsinDelta * *pfsinDelta);
-		*pfDelta = fasin_deg(*pfsinDelta);
+		*pfDelta = FASIN_DEG(*pfsinDelta);
 	}
 
 	return;
@@ -515,10 +516,10 @@ void fNEDAnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *pfThe
 		float *pfRhoDeg, float *pfChiDeg)
 {
 	// calculate the pitch angle -90.0 <= Theta <= 90.0 deg
-	*pfTheDeg = fasin_deg(-R[CHX][CHZ]);
+	*pfTheDeg = FASIN_DEG(-R[CHX][CHZ]);
 
 	// calculate the roll angle range -180.0 <= Phi < 180.0 deg
-	*pfPhiDeg = fatan2_deg(R[CHY][CHZ], R[CHZ][CHZ]);
+	*pfPhiDeg = FATAN2_DEG(R[CHY][CHZ], R[CHZ][CHZ]);
 
 	// map +180 roll onto the functionally equivalent -180 deg roll
 	if (*pfPhiDeg == 180.0F)
@@ -530,17 +531,17 @@ void fNEDAnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *pfThe
 	if (*pfTheDeg == 90.0F)
 	{
 		// vertical upwards gimbal lock case
-		*pfPsiDeg = fatan2_deg(R[CHZ][CHY], R[CHY][CHY]) + *pfPhiDeg;
+		*pfPsiDeg = FATAN2_DEG(R[CHZ][CHY], R[CHY][CHY]) + *pfPhiDeg;
 	}
 	else if (*pfTheDeg == -90.0F)
 	{
 		// vertical downwards gimbal lock case
-		*pfPsiDeg = fatan2_deg(-R[CHZ][CHY], R[CHY][CHY]) - *pfPhiDeg;
+		*pfPsiDeg = FATAN2_DEG(-R[CHZ][CHY], R[CHY][CHY]) - *pfPhiDeg;
 	}
 	else
 	{
 		// general case
-		*pfPsiDeg = fatan2_deg(R[CHX][CHY], R[CHX][CHX]);
+		*pfPsiDeg = FATAN2_DEG(R[CHX][CHY], R[CHX][CHX]);
 	}
 
 	// map yaw angle Psi onto range 0.0 <= Psi < 360.0 deg
@@ -559,7 +560,7 @@ void fNEDAnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *pfThe
 	*pfRhoDeg = *pfPsiDeg;
 
 	// calculate the tilt angle from vertical Chi (0 <= Chi <= 180 deg)
-	*pfChiDeg = facos_deg(R[CHZ][CHZ]);
+	*pfChiDeg = FACOS_DEG(R[CHZ][CHZ]);
 
 	return;
 }
@@ -571,10 +572,10 @@ void fAndroidAnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *p
 		float *pfRhoDeg, float *pfChiDeg)
 {
 	// calculate the roll angle -90.0 <= Phi <= 90.0 deg
-	*pfPhiDeg = fasin_deg(R[CHX][CHZ]);
+	*pfPhiDeg = FASIN_DEG(R[CHX][CHZ]);
 
 	// calculate the pitch angle -180.0 <= The < 180.0 deg
-	*pfTheDeg = fatan2_deg(-R[CHY][CHZ], R[CHZ][CHZ]);
+	*pfTheDeg = FATAN2_DEG(-R[CHY][CHZ], R[CHZ][CHZ]);
 
 	// map +180 pitch onto the functionally equivalent -180 deg pitch
 	if (*pfTheDeg == 180.0F)
@@ -586,17 +587,17 @@ void fAndroidAnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *p
 	if (*pfPhiDeg == 90.0F)
 	{
 		// vertical downwards gimbal lock case
-		*pfPsiDeg = fatan2_deg(R[CHY][CHX], R[CHY][CHY]) - *pfTheDeg;
+		*pfPsiDeg = FATAN2_DEG(R[CHY][CHX], R[CHY][CHY]) - *pfTheDeg;
 	}
 	else if (*pfPhiDeg == -90.0F)
 	{
 		// vertical upwards gimbal lock case
-		*pfPsiDeg = fatan2_deg(R[CHY][CHX], R[CHY][CHY]) + *pfTheDeg;
+		*pfPsiDeg = FATAN2_DEG(R[CHY][CHX], R[CHY][CHY]) + *pfTheDeg;
 	}
 	else
 	{
 		// general case
-		*pfPsiDeg = fatan2_deg(-R[CHX][CHY], R[CHX][CHX]);
+		*pfPsiDeg = FATAN2_DEG(-R[CHX][CHY], R[CHX][CHX]);
 	}
 
 	// map yaw angle Psi onto range 0.0 <= Psi < 360.0 deg
@@ -616,7 +617,7 @@ void fAndroidAnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *p
 	*pfRhoDeg = *pfPsiDeg;
 
 	// calculate the tilt angle from vertical Chi (0 <= Chi <= 180 deg)
-	*pfChiDeg = facos_deg(R[CHZ][CHZ]);
+	*pfChiDeg = FACOS_DEG(R[CHZ][CHZ]);
 
 	return;
 }
@@ -644,11 +645,11 @@ void fWin8AnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *pfTh
 	else
 	{
 		// general case
-		*pfPhiDeg = fatan_deg(-R[CHX][CHZ] / R[CHZ][CHZ]);
+		*pfPhiDeg = FATAN_DEG(-R[CHX][CHZ] / R[CHZ][CHZ]);
 	}
 
 	// first calculate the pitch angle The in the range -90.0 <= The <= 90.0 deg
-	*pfTheDeg = fasin_deg(R[CHY][CHZ]);
+	*pfTheDeg = FASIN_DEG(R[CHY][CHZ]);
 
 	// use R[CHZ][CHZ]=cos(Phi)*cos(The) to correct the quadrant of The remembering
 	// cos(Phi) is non-negative so that cos(The) has the same sign as R[CHZ][CHZ].
@@ -668,17 +669,17 @@ void fWin8AnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *pfTh
 	if (*pfTheDeg == 90.0F)
 	{
 		// vertical upwards gimbal lock case: -270 <= Psi < 90 deg
-		*pfPsiDeg = fatan2_deg(R[CHX][CHY], R[CHX][CHX]) - *pfPhiDeg;
+		*pfPsiDeg = FATAN2_DEG(R[CHX][CHY], R[CHX][CHX]) - *pfPhiDeg;
 	}
 	else if (*pfTheDeg == -90.0F)
 	{
 		// vertical downwards gimbal lock case: -270 <= Psi < 90 deg
-		*pfPsiDeg = fatan2_deg(R[CHX][CHY], R[CHX][CHX]) + *pfPhiDeg;
+		*pfPsiDeg = FATAN2_DEG(R[CHX][CHY], R[CHX][CHX]) + *pfPhiDeg;
 	}
 	else
 	{
 		// general case: -180 <= Psi < 180 deg
-		*pfPsiDeg = fatan2_deg(-R[CHY][CHX], R[CHY][CHY]);
+		*pfPsiDeg = FATAN2_DEG(-R[CHY][CHX], R[CHY][CHY]);
 
 		// correct the quadrant for Psi using the value of The (deg) to give -180 <= Psi < 380 deg
 		if (fabsf(*pfTheDeg) >= 90.0F)
@@ -709,7 +710,7 @@ void fWin8AnglesDegFromRotationMatrix(float R[][3], float *pfPhiDeg, float *pfTh
 	}
 
 	// calculate the tilt angle from vertical Chi (0 <= Chi <= 180 deg)
-	*pfChiDeg = facos_deg(R[CHZ][CHZ]);
+	*pfChiDeg = FACOS_DEG(R[CHZ][CHZ]);
 
 	return;
 }
@@ -748,7 +749,7 @@ void fQuaternionFromRotationVectorDeg(Quaternion *pq, const float rvecdeg[], flo
 	else
 	{
 		// use exact calculation
-		sinhalfeta = (float)sinf(0.5F * fetarad);
+		sinhalfeta = FSIN(0.5F * fetarad);
 	}
 
 	// compute the vector quaternion components q1, q2, q3
@@ -882,7 +883,7 @@ void fRotationVectorDegFromQuaternion(Quaternion *pq, float rvecdeg[])
 	else
 	{
 		// general case returning 0 < eta < 360 deg
-		fetarad = 2.0F * acosf(pq->q0);
+		fetarad = 2.0F * FACOS(pq->q0);
 		fetadeg = fetarad * F180OVERPI;
 	}
 
@@ -894,7 +895,7 @@ void fRotationVectorDegFromQuaternion(Quaternion *pq, float rvecdeg[])
 	}
 
 	// calculate sin(eta/2) which will be in the range -1 to +1
-	sinhalfeta = (float)sinf(0.5F * fetarad);
+	sinhalfeta = FSIN(0.5F * fetarad);
 
 	// calculate the rotation vector (deg)
 	if (sinhalfeta == 0.0F)
@@ -1006,12 +1007,12 @@ void fqAeqNormqA(Quaternion *pqA)
 {
 	float fNorm;					// quaternion Norm
 
-	// calculate the quaternion Norm
-	fNorm = sqrtf(pqA->q0 * pqA->q0 + pqA->q1 * pqA->q1 + pqA->q2 * pqA->q2 + pqA->q3 * pqA->q3);
-	if (fNorm > CORRUPTQUAT)
+	// calculate the squared quaternion Norm
+	fNorm = pqA->q0 * pqA->q0 + pqA->q1 * pqA->q1 + pqA->q2 * pqA->q2 + pqA->q3 * pqA->q3;
+	if (fNorm > CORRUPTQUAT * CORRUPTQUAT)
 	{
 		// general case
-		fNorm = 1.0F / fNorm;
+		fNorm = FRSQRT(fNorm);
 		pqA->q0 *= fNorm;
 		pqA->q1 *= fNorm;
 		pqA->q2 *= fNorm;
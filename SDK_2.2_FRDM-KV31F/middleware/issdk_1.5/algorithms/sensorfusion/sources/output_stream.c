@@ -104,6 +104,9 @@ void readCommon( SV_ptr data,
                  int16_t *iRho,
                  int16_t iOmega[],
                  uint16_t *isystick) {
+#if LAZY_ORIENTATION
+    fUpdateOrientationOutputs(data, ORIENT_EULER);   // only the Euler angles are transmitted
+#endif
     *fq = data->fq;
     iOmega[CHX] = (int16_t) (data->fOmega[CHX] * 20.0F);
     iOmega[CHY] = (int16_t) (data->fOmega[CHY] * 20.0F);
@@ -116,9 +119,9 @@ void readCommon( SV_ptr data,
 
 // throttle back by fractional multiplier
 ///    (OVERSAMPLE_RATIO * MAXPACKETRATEHZ) / SENSORFS
-uint16_t throttle()
+/// The throttle accumulator lives in the control subsystem so each port is paced independently.
+uint16_t throttle(ControlSubsystem *pComm, uint16_t iFusionHz)
 {
-    static int32 iThrottle = 0;
     uint8_t skip;
     // The UART (serial over USB and over Bluetooth)
     // is limited to 115kbps which is more than adequate for the 31kbps
@@ -128,10 +131,12 @@ uint16_t throttle()
     // support a higher rate, the limit is set to MAXPACKETRATEHZ=40Hz.
 
     // the increment applied to iThrottle is in the range 0 to (RATERESOLUTION - 1)
-    iThrottle += ((int32) MAXPACKETRATEHZ * (int32) RATERESOLUTION) / (int32) FUSION_HZ;
-    if (iThrottle >= RATERESOLUTION) {
+    // (the fusion rate can change at run time so there is no compile time bypass)
+    if (iFusionHz <= MAXPACKETRATEHZ) return(false);
+    pComm->iThrottle += ((int32) MAXPACKETRATEHZ * (int32) RATERESOLUTION) / (int32) iFusionHz;
+    if (pComm->iThrottle >= RATERESOLUTION) {
         // update the throttle counter and transmit the packets over UART (USB and Bluetooth)
-	iThrottle -= RATERESOLUTION;
+	pComm->iThrottle -= RATERESOLUTION;
         skip = false;
     } else {
         skip = true;
@@ -145,7 +150,6 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
 {
     Quaternion      fq;                 // quaternion to be transmitted
     float           ftmp;               // scratch
-    static uint32_t iTimeStamp = 0;     // 1MHz time stamp
     uint16_t        iIndex;             // output buffer counter
     int32_t         scratch32;          // scratch int32_t
     int16_t         scratch16;          // scratch int16_t
@@ -162,15 +166,13 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
                     DebugPacketOn,
                     RPCPacketOn;
     int8_t          AccelCalPacketOn;
-    static uint8_t  iPacketNumber = 0;  // packet number
+    ControlSubsystem *pComm = sfg->pControlSubsystem;   // packet counters and time stamp are per port
 
     // update the 1MHz time stamp counter expected by the PC GUI (independent of project clock rates)
-    iTimeStamp += 1000000 / FUSION_HZ;
+    pComm->iTimeStamp += 1000000 / sfg->iFusionHz;
 
-#if (MAXPACKETRATEHZ < FUSION_HZ)
-    uint8_t  skip_packet = throttle(); // possible UART bandwidth problem
+    uint8_t  skip_packet = throttle(pComm, sfg->iFusionHz); // possible UART bandwidth problem
     if (skip_packet) return;  // need to skip packet transmission to avoid UART overrun
-#endif
 
     // cache local copies of control flags so we don't have to keep dereferencing pointers below
     quaternion_type quaternionPacketType;
@@ -212,11 +214,11 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
     sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
     // [2]: packet number byte
-    sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-    iPacketNumber++;
+    sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+    pComm->iPacketNumber++;
 
     // [6-3]: 1MHz time stamp (4 bytes)
-    sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &iTimeStamp, 4);
+    sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &pComm->iTimeStamp, 4);
 
     // [12-7]: integer accelerometer data words (scaled to 8192 counts per g for PC GUI)
     // send non-zero data only if the accelerometer sensor is enabled and used by the selected quaternion
@@ -452,8 +454,8 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
         // [2]: packet number byte
-        sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-        iPacketNumber++;
+        sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+        pComm->iPacketNumber++;
 
         // [4-3] software version number
         scratch16 = THISBUILD;
@@ -480,11 +482,11 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
         // [2]: packet number byte
-        sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-        iPacketNumber++;
+        sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+        pComm->iPacketNumber++;
 
         // [6-3]: time stamp (4 bytes)
-        sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &iTimeStamp, 4);
+        sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &pComm->iTimeStamp, 4);
 
         // [12-7]: add the scaled angular velocity vector to the output buffer
         sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &iOmega[CHX], 2);
@@ -509,11 +511,11 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
         // [2]: packet number byte
-        sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-        iPacketNumber++;
+        sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+        pComm->iPacketNumber++;
 
         // [6-3]: time stamp (4 bytes)
-        sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &iTimeStamp, 4);
+        sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &pComm->iTimeStamp, 4);
 
         // [12-7]: add the angles (resolution 0.1 deg per count) to the transmit buffer
         sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &iPhi, 2);
@@ -541,11 +543,11 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
             sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
             // [2]: packet number byte
-            sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-            iPacketNumber++;
+            sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+            pComm->iPacketNumber++;
 
             // [6-3]: time stamp (4 bytes)
-            sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &iTimeStamp,
+            sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &pComm->iTimeStamp,
                            4);
 
             // [10-7]: altitude (4 bytes, metres times 1000)
@@ -568,7 +570,6 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
     // this packet is only transmitted if a magnetic algorithm is computed
     // ************************************************************************
 #if F_USING_MAG
-    static int16_t  MagneticPacketID = 0;   // magnetic packet number
     if (sfg->iFlags & F_USING_MAG)
     {
         // [0]: packet start byte
@@ -579,8 +580,8 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
         // [2]: packet number byte
-        sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-        iPacketNumber++;
+        sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+        pComm->iPacketNumber++;
 
         // [4-3]: number of active measurements in the magnetic buffer
         sBufAppendItem(sUARTOutputBuffer, &iIndex,
@@ -598,7 +599,7 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &scratch16, 2);
 
         // always calculate magnetic buffer row and column (low overhead and saves warnings)
-        k = MagneticPacketID - 10;
+        k = pComm->MagneticPacketID - 10;
         j = k / MAGBUFFSIZEX;
         i = k - j * MAGBUFFSIZEX;
 
@@ -607,23 +608,23 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         // ID 5 to 9 inclusive are for future expansion
         // ID 10 to (MAGBUFFSIZEX=12) * (MAGBUFFSIZEY=24)-1 or 10 to 10+288-1 are magnetic buffer elements
         // where the convention is used that a negative value indicates empty buffer element (index=-1)
-        if ((MagneticPacketID >= 10) && (sfg->MagBuffer.index[i][j] == -1))
+        if ((pComm->MagneticPacketID >= 10) && (sfg->MagBuffer.index[i][j] == -1))
         {
             // use negative ID to indicate inactive magnetic buffer element
-            scratch16 = -MagneticPacketID;
+            scratch16 = -pComm->MagneticPacketID;
             sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &scratch16, 2);
         }
         else
         {
             // use positive ID unchanged for variable or active magnetic buffer entry
-            scratch16 = MagneticPacketID;
+            scratch16 = pComm->MagneticPacketID;
             sBufAppendItem(sUARTOutputBuffer, &iIndex, (uint8_t *) &scratch16, 2);
         }
 
         // [12-11]: int16_t: variable 1 to be transmitted this iteration
         // [14-13]: int16_t: variable 2 to be transmitted this iteration
         // [16-15]: int16_t: variable 3 to be transmitted this iteration
-        switch (MagneticPacketID)
+        switch (pComm->MagneticPacketID)
         {
             case 0:
                 // item 1: currently unused
@@ -691,9 +692,9 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         }
 
         // wrap the variable ID back to zero if necessary
-        MagneticPacketID++;
-        if (MagneticPacketID >= (10 + MAGBUFFSIZEX * MAGBUFFSIZEY))
-            MagneticPacketID = 0;
+        pComm->MagneticPacketID++;
+        if (pComm->MagneticPacketID >= (10 + MAGBUFFSIZEX * MAGBUFFSIZEY))
+            pComm->MagneticPacketID = 0;
 
         // [17]: add the tail byte for the magnetic packet type 6
         sUARTOutputBuffer[iIndex++] = 0x7E;
@@ -728,8 +729,8 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
             sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
             // [2]: packet number byte
-            sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-            iPacketNumber++;
+            sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+            pComm->iPacketNumber++;
 
             // [4-3]: fzgErr[CHX] resolution scaled by 30000
             // [6-5]: fzgErr[CHY] resolution scaled by 30000
@@ -869,8 +870,8 @@ void CreateAndSendPackets(SensorFusionGlobals *sfg, uint8_t *sUARTOutputBuffer)
         sBufAppendItem(sUARTOutputBuffer, &iIndex, &tmpuint8_t, 1);
 
         // [2]: packet number byte
-        sBufAppendItem(sUARTOutputBuffer, &iIndex, &iPacketNumber, 1);
-        iPacketNumber++;
+        sBufAppendItem(sUARTOutputBuffer, &iIndex, &pComm->iPacketNumber, 1);
+        pComm->iPacketNumber++;
 
         // [3]: AccelCalPacketOn in range 0-11 denotes stored location and MAXORIENTATIONS denotes transmit
         // precision accelerometer calibration on power on before any measurements have been obtained.
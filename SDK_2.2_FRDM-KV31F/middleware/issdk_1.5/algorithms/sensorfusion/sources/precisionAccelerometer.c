@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include "sensor_fusion.h"
 #include "fusion.h"
+#include "calibration_storage.h"
 
 /*! \file precisionAccelerometer.c
     \brief Implements accelerometer calibration routines
@@ -52,10 +53,9 @@ void fInitializeAccelCalibration(struct AccelCalibration *pthisAccelCal,
     *AccelCalPacketOn = MAX_ACCEL_CAL_ORIENTATIONS;
 
     // check to see if the stored accelerometer calibration has been erased
-    // the standard value for erased flash is 0xFF in each byte but for portability check against 0x12345678
 #ifndef SIMULATION
-    pFlash = (float *) (CALIBRATION_NVM_ADDR + ACCEL_NVM_OFFSET);
-    if (*((uint32 *) pFlash++) == 0x12345678)
+    pFlash = GetAccelCalibrationFromNVM();
+    if (pFlash != NULL)
     {
         // a precision accelerometer calibration is present in flash
         // copy accelerometer calibration elements (21x float total 84 bytes) from flash to RAM
@@ -85,6 +85,20 @@ void fInitializeAccelCalibration(struct AccelCalibration *pthisAccelCal,
     return;
 }
 
+#if COMPACT_GLOBALS
+// function points the solver scratch matrices and vectors of the accelerometer calibration at pthisScratch
+void fAttachAccelCalScratch(struct AccelCalibration *pthisAccelCal,
+                            struct CalibrationScratch *pthisScratch)
+{
+    pthisAccelCal->fmatA = pthisScratch->fmatA;
+    pthisAccelCal->fmatB = pthisScratch->fmatB;
+    pthisAccelCal->fvecA = pthisScratch->fvecA;
+    pthisAccelCal->fvecB = pthisScratch->fvecB;
+
+    return;
+}
+#endif
+
 void fUpdateAccelBuffer(struct AccelCalibration *pthisAccelCal,
                         struct AccelBuffer *pthisAccelBuffer,
                         struct AccelSensor *pthisAccel, volatile int8 *AccelCalPacketOn)
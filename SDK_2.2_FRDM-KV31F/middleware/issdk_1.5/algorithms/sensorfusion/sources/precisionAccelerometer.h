@@ -57,10 +57,17 @@ typedef struct AccelCalibration
 	float finvW[3][3];				///< inverse gain matrix
 	float fR0[3][3];				///< forward rotation matrix for measurement 0
 	// end of elements stored in flash memory
+#if COMPACT_GLOBALS
+	float (*fmatA)[10];				///< scratch 10x10 matrix (struct CalibrationScratch shared with the magnetic calibration)
+	float (*fmatB)[10];				///< scratch 10x10 matrix (struct CalibrationScratch shared with the magnetic calibration)
+	float *fvecA;					///< scratch 10x1 vector (struct CalibrationScratch shared with the magnetic calibration)
+	float *fvecB;					///< scratch 4x1 vector (struct CalibrationScratch shared with the magnetic calibration)
+#else
 	float fmatA[10][10];			        ///< scratch 10x10 matrix used by calibration algorithms
 	float fmatB[10][10];			        ///< scratch 10x10 matrix used by calibration algorithms
 	float fvecA[10];				///< scratch 10x1 vector used by calibration algorithms
 	float fvecB[4];					///< scratch 4x1 vector used by calibration algorithms
+#endif
 	float fA[3][3];					///< ellipsoid matrix A
 	float finvA[3][3];				///< inverse of the ellipsoid matrix A
 } AccelCalibration;
@@ -74,6 +81,13 @@ void fInitializeAccelCalibration(
     struct AccelBuffer *pthisAccelBuffer,               ///< Buffer of measurements used as input to the accel calibration functions
     volatile int8_t *AccelCalPacketOn                   ///< Used to coordinate calibration sample storage and communications
 );
+#if COMPACT_GLOBALS
+/// Point the accelerometer calibration scratch matrices at storage shared with the magnetic calibration.
+void fAttachAccelCalScratch(
+    struct AccelCalibration *pthisAccelCal,             ///< Accelerometer calibration parameter structure
+    struct CalibrationScratch *pthisScratch             ///< Scratch matrices shared by the calibrations
+);
+#endif
 /// Update the buffer used to store samples used for accelerometer calibration.
 void fUpdateAccelBuffer(
     struct AccelCalibration *pthisAccelCal,             ///< Accelerometer calibration parameter structure
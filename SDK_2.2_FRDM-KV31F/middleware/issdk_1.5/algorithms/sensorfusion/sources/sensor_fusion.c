@@ -38,6 +38,8 @@
 #include "magnetic.h"
 #include "drivers.h"
 #include "sensor_drv.h"
+#include "register_io_i2c.h"
+#include "register_io_spi.h"
 #include "status.h"
 #include "control.h"
 #include "fusion.h"
@@ -69,6 +71,28 @@ void testStatus(SensorFusionGlobals *sfg)
     sfg->pStatusSubsystem->test(sfg->pStatusSubsystem);
 }
 
+#if F_NUM_SENSOR_INSTANCES > 1
+// Give every instance of one logical sensor type an identity HAL, no offset and unit weight
+static void initInstanceSet(struct SensorInstanceSet *pSet, float fGate)
+{
+    int8 k, j;                  // counters
+
+    for (k = 0; k < F_NUM_SENSOR_INSTANCES; k++)
+    {
+        for (j = CHX; j <= CHZ; j++)
+        {
+            pSet->Cal[k].iAxis[j] = j + 1;
+            pSet->Cal[k].fOffset[j] = 0.0F;
+        }
+        pSet->Cal[k].fWeight = 1.0F;
+        pSet->Cal[k].iOffsetCount = 0;
+    }
+    for (j = CHX; j <= CHZ; j++) pSet->fLast[j] = 0.0F;
+    pSet->fGate = fGate;
+    pSet->iRejected = 0;
+}
+#endif
+
 /// utility function to insert default values in the top level structure
 void initSensorFusionGlobals(SensorFusionGlobals *sfg,
                              StatusSubsystem *pStatusSubsystem,
@@ -90,14 +114,23 @@ void initSensorFusionGlobals(SensorFusionGlobals *sfg,
                 F_9DOF_GBY_KALMAN	;	// 9DOF accel, mag and gyro (Kalman): (accel + mag + gyro)
 
     sfg->pControlSubsystem = pControlSubsystem;
+    if (pControlSubsystem) pControlSubsystem->sfg = sfg;    // commands received on the port are applied to this instance
     sfg->pStatusSubsystem = pStatusSubsystem;
     sfg->loopcounter = 0;                     // counter incrementing each iteration of sensor fusion (typically 25Hz)
+    sfg->iFusionHz = FUSION_HZ;               // fusion rate until changed by fSetFusionRate()
     sfg->systick_I2C = 0;                     // systick counter to benchmark I2C reads
     sfg->systick_Spare = 0;                   // systick counter for counts spare waiting for timing interrupt
     sfg->iPerturbation = 0;                   // no perturbation to be applied
+#ifdef INCLUDE_DEBUG_FUNCTIONS
+    sfg->iTestProgress = 0;                   // no perturbation test in progress
+    sfg->iTestDelay = 0;
+    sfg->fTestThreshold = 0.0F;
+    fqAeq1(&(sfg->fqTestStart));
+#endif
     sfg->installSensor = installSensor;       // function for installing a new sensor into the structures
     sfg->initializeFusionEngine = initializeFusionEngine;   // function for installing a new sensor into the structures
     sfg->readSensors = readSensors;           // function for installing a new sensor into the structures
+    sfg->readSensorsOnBus = readSensorsOnBus; // per-bus variant of readSensors for concurrent bus tasks
     sfg->runFusion = runFusion;               // function for installing a new sensor into the structures
     sfg->applyPerturbation = ApplyPerturbation; // function used for step function testing
     sfg->conditionSensorReadings = conditionSensorReadings; // function does averaging, HAL adjustments, etc.
@@ -107,6 +140,21 @@ void initSensorFusionGlobals(SensorFusionGlobals *sfg,
     sfg->updateStatus = updateStatus;         // function to promote queued status change
     sfg->testStatus = testStatus;             // function for unit testing the status subsystem
     sfg->pSensors = NULL;                     // pointer to linked list of physical sensors
+    sfg->waitForBus = NULL;                   // no RTOS hooks: spin on the bus idle function while reading
+    sfg->signalBus = NULL;
+    sfg->signalMagCal = NULL;                 // magnetic calibration is time sliced in the fusion task
+#if COMPACT_GLOBALS
+    // the accelerometer and time sliced magnetic calibrations share one set of scratch matrices
+#if F_USING_ACCEL
+    fAttachAccelCalScratch(&(sfg->AccelCal), &(sfg->CalScratch));
+#endif
+#if F_USING_MAG
+    fAttachMagCalScratch(&(sfg->MagCal), &(sfg->CalScratch));
+#if MAGCAL_BACKGROUND
+    fAttachMagCalScratch(&(sfg->MagCalBackground.MagCal), &(sfg->MagCalBackground.Scratch));
+#endif
+#endif
+#endif
 //  put error value into whoAmI as initial value
 #if F_USING_ACCEL
     sfg->Accel.iWhoAmI = 0;
@@ -120,6 +168,33 @@ void initSensorFusionGlobals(SensorFusionGlobals *sfg,
 #if F_USING_PRESSURE
     sfg->Pressure.iWhoAmI = 0;
 #endif
+#if F_NUM_SENSOR_INSTANCES > 1
+    int8 k;                     // instance counter
+#if F_USING_ACCEL
+    initInstanceSet(&(sfg->AccelSet), ACCEL_INSTANCE_GATE);
+    for (k = 0; k < F_NUM_SENSOR_INSTANCES - 1; k++)
+    {
+        sfg->AccelInstance[k].iWhoAmI = 0;
+        sfg->AccelInstance[k].isEnabled = false;
+    }
+#endif
+#if F_USING_MAG
+    initInstanceSet(&(sfg->MagSet), MAG_INSTANCE_GATE);
+    for (k = 0; k < F_NUM_SENSOR_INSTANCES - 1; k++)
+    {
+        sfg->MagInstance[k].iWhoAmI = 0;
+        sfg->MagInstance[k].isEnabled = false;
+    }
+#endif
+#if F_USING_GYRO
+    initInstanceSet(&(sfg->GyroSet), GYRO_INSTANCE_GATE);
+    for (k = 0; k < F_NUM_SENSOR_INSTANCES - 1; k++)
+    {
+        sfg->GyroInstance[k].iWhoAmI = 0;
+        sfg->GyroInstance[k].isEnabled = false;
+    }
+#endif
+#endif
 }
 /// installSensor is used to instantiate a physical sensor driver into the
 /// sensor fusion system.
@@ -146,6 +221,7 @@ int8_t installSensor(
         pSensor->read = read;                   // The read function is responsible for taking sensor readings and
                                                 // loading them into the sensor fusion input structures.  Also KDSK-based.
         pSensor->addr = addr;                   // I2C address if applicable
+        pSensor->instance = 0;                  // primary sensor unless the application says otherwise
         pSensor->schedule = schedule;
         pSensor->slaveParams.pReadPreprocessFN = NULL;  // SPI-specific parameters get overwritten later if used
         pSensor->slaveParams.pWritePreprocessFN = NULL;
@@ -177,6 +253,438 @@ int8_t initializeSensors(SensorFusionGlobals *sfg)
     return (status);
 }
 
+// Completion callback for readSensorRegisters(), runs in bus interrupt context
+static void sensorReadComplete(void *userParam, int32_t status)
+{
+    struct SensorRead *pRead = (struct SensorRead *) userParam;
+
+    pRead->status = status;
+    pRead->pending = false;
+    if (pRead->sfg->signalBus)
+        pRead->sfg->signalBus(pRead->sfg, pRead->sensor->deviceInfo.deviceInstance);
+}
+
+/// readSensorRegisters submits an asynchronous register read and waits for it
+/// without occupying the CPU (see sensor_fusion.h).
+int8_t readSensorRegisters(SensorFusionGlobals *sfg, struct PhysicalSensor *sensor,
+                           uint8_t offset, uint8_t length, uint8_t *pOutBuffer)
+{
+    struct SensorRead   read;
+    int32_t             status;
+
+    read.sfg = sfg;
+    read.sensor = sensor;
+    read.status = ARM_DRIVER_OK;
+    read.pending = true;
+    if (sensor->addr == SPI_ADDR)
+        status = Register_SPI_ReadAsync(sensor->bus_driver, &sensor->deviceInfo, &sensor->slaveParams,
+                                        offset, length, pOutBuffer, sensorReadComplete, &read);
+    else
+        status = Register_I2C_ReadAsync(sensor->bus_driver, &sensor->deviceInfo, sensor->addr,
+                                        offset, length, pOutBuffer, sensorReadComplete, &read);
+    if (status != ARM_DRIVER_OK) return (SENSOR_ERROR_READ);
+
+    // the completion interrupt may fire at any time, so the flag is re-checked after every wake-up
+    while (read.pending)
+    {
+        if (sfg->waitForBus)
+            sfg->waitForBus(sfg, sensor->deviceInfo.deviceInstance);
+        else if (sensor->deviceInfo.idleFunction)
+            sensor->deviceInfo.idleFunction(sensor->deviceInfo.functionParam);
+    }
+    return ((read.status == ARM_DRIVER_OK) ? SENSOR_ERROR_NONE : SENSOR_ERROR_READ);
+}
+
+#if F_USING_ACCEL
+/// accelInstance returns the accelerometer structure fed by this physical sensor
+struct AccelSensor *accelInstance(SensorFusionGlobals *sfg, struct PhysicalSensor *sensor)
+{
+#if F_NUM_SENSOR_INSTANCES > 1
+    if ((sensor->instance > 0) && (sensor->instance < F_NUM_SENSOR_INSTANCES))
+        return (&(sfg->AccelInstance[sensor->instance - 1]));
+#endif
+    return (&(sfg->Accel));
+}
+#endif
+#if F_USING_MAG
+/// magInstance returns the magnetometer structure fed by this physical sensor
+struct MagSensor *magInstance(SensorFusionGlobals *sfg, struct PhysicalSensor *sensor)
+{
+#if F_NUM_SENSOR_INSTANCES > 1
+    if ((sensor->instance > 0) && (sensor->instance < F_NUM_SENSOR_INSTANCES))
+        return (&(sfg->MagInstance[sensor->instance - 1]));
+#endif
+    return (&(sfg->Mag));
+}
+#endif
+#if F_USING_GYRO
+/// gyroInstance returns the gyro structure fed by this physical sensor
+struct GyroSensor *gyroInstance(SensorFusionGlobals *sfg, struct PhysicalSensor *sensor)
+{
+#if F_NUM_SENSOR_INSTANCES > 1
+    if ((sensor->instance > 0) && (sensor->instance < F_NUM_SENSOR_INSTANCES))
+        return (&(sfg->GyroInstance[sensor->instance - 1]));
+#endif
+    return (&(sfg->Gyro));
+}
+#endif
+
+#if FIFO_RESAMPLE
+// Design the resamplers of one sensor type from iInHz to iOutHz and restart their streams
+static void designResampleSet(struct FifoResampleSet *pSet, uint16_t iInHz, uint16_t iOutHz)
+{
+    float fFc;                                  // cutoff (cycles per upsampled sample)
+    float fX, fSum;
+    uint16_t iL, iM, iTaps, iGcd, iRem, itmp;
+    int16 i, j, k;                              // counters
+
+    pSet->isEnabled = false;
+    if ((iInHz == 0) || (iOutHz == 0)) return;
+    // reduce the rate ratio to L / M
+    iGcd = iInHz;
+    itmp = iOutHz;
+    while (itmp)
+    {
+        iRem = iGcd % itmp;
+        iGcd = itmp;
+        itmp = iRem;
+    }
+    iL = iOutHz / iGcd;
+    iM = iInHz / iGcd;
+    // at most one output per input so that a burst never overruns its output buffer
+    if ((iL > iM) || (iM > 255)) return;
+    iTaps = ((FIFO_RESAMPLE_SPAN * iM + iL - 1) / iL) * iL;
+    if (iTaps > FIFO_RESAMPLE_MAX_TAPS) return;
+
+    // Hamming windowed sinc at the output Nyquist frequency, scaled to a DC gain of L
+    fFc = 0.5F / (float) iM;
+    fSum = 0.0F;
+    for (i = 0; i < iTaps; i++)
+    {
+        fX = (float) i - 0.5F * (float) (iTaps - 1);
+        pSet->fCoeffs[iTaps - 1 - i] = ((fX == 0.0F) ? 2.0F * fFc : sinf(2.0F * PI * fFc * fX) / (PI * fX)) *
+                                        (0.54F - 0.46F * cosf(2.0F * PI * (float) i / (float) (iTaps - 1)));
+        fSum += pSet->fCoeffs[iTaps - 1 - i];
+    }
+    for (i = 0; i < iTaps; i++) pSet->fCoeffs[i] *= (float) iL / fSum;
+
+    for (k = 0; k < F_NUM_SENSOR_INSTANCES; k++)
+    {
+        for (j = CHX; j <= CHZ; j++)
+            arm_fir_resample_init_f32(&(pSet->Instance[k].Axis[j]), (uint8_t) iL, (uint8_t) iM, iTaps,
+                                      pSet->fCoeffs, pSet->Instance[k].fState[j], FIFO_RESAMPLE_BLOCK);
+        pSet->Instance[k].isPrimed = false;
+    }
+    pSet->isEnabled = true;
+}
+
+void fSetResampleRates(SensorFusionGlobals *sfg, uint16_t iAccelHz, uint16_t iMagHz)
+{
+#if F_USING_ACCEL
+    designResampleSet(&(sfg->AccelResample), iAccelHz, sfg->iFusionHz);
+#endif
+#if F_USING_MAG
+    designResampleSet(&(sfg->MagResample), iMagHz, sfg->iFusionHz);
+#endif
+}
+
+// Resample a software FIFO to the fusion rate in physical units.  fOut is the latest output,
+// or the previous one if the burst completed none.  Returns false if the FIFO is empty.
+static bool resampleFifo(struct FifoResampler *pRes, int16 iFIFO[][3], uint8_t iFIFOCount,
+                         uint16_t iFIFOExceeded, float fPerCount, float fOut[3])
+{
+    float32_t fIn[FIFO_RESAMPLE_BLOCK];         // one axis of the FIFO (counts)
+    float32_t fY[FIFO_RESAMPLE_BLOCK];          // resampled axis (counts)
+    uint32_t iOut;                              // number of outputs
+    int16 i, j;                                 // counters
+
+    if (iFIFOCount == 0) return (false);
+    for (j = CHX; j <= CHZ; j++)
+    {
+        for (i = 0; i < iFIFOCount; i++) fIn[i] = (float32_t) iFIFO[i][j];
+        // after a restart or lost samples the history is the first sample rather than zeros or
+        // a gap, so the filter does not ring.  The history is the start of the state buffer.
+        if (!pRes->isPrimed || (iFIFOExceeded > 0))
+            for (i = 0; i < pRes->Axis[j].phaseLength - 1; i++) pRes->Axis[j].pState[i] = fIn[0];
+        iOut = arm_fir_resample_f32(&(pRes->Axis[j]), fIn, fY, iFIFOCount);
+        if (iOut > 0) pRes->fLast[j] = fY[iOut - 1] * fPerCount;
+        fOut[j] = pRes->fLast[j];
+    }
+    pRes->isPrimed = true;
+    return (true);
+}
+#endif
+
+#if F_NUM_SENSOR_INSTANCES > 1
+// Average a software FIFO in physical units.  Returns false if the FIFO is empty.
+static bool averageFifo(int16 iFIFO[][3], uint8_t iFIFOCount, float fPerCount, float fAvg[3])
+{
+    int32 iSum[3];		        // channel sums
+    int16 i, j;			        // counters
+
+    if (iFIFOCount == 0) return (false);
+    for (j = CHX; j <= CHZ; j++) iSum[j] = 0;
+    for (i = 0; i < iFIFOCount; i++)
+        for (j = CHX; j <= CHZ; j++) iSum[j] += iFIFO[i][j];
+    for (j = CHX; j <= CHZ; j++) fAvg[j] = (float) iSum[j] / (float) iFIFOCount * fPerCount;
+    return (true);
+}
+
+// fuseInstances maps the averaged reading fIn[k] of every sampled instance (isValid[k])
+// into the frame of instance 0 using its own HAL and calibration, then returns the
+// weighted average in fOut.  While the instance furthest from the average is beyond
+// pSet->fGate it is rejected and the average recomputed.  With only two instances left
+// the one that moved furthest from the last output is dropped.  Returns false and leaves
+// fOut untouched if no instance is usable.
+static bool fuseInstances(struct SensorInstanceSet *pSet, float fIn[][3], bool isValid[], float fOut[3])
+{
+    float fX[F_NUM_SENSOR_INSTANCES][3];        // instances in the frame of instance 0
+    bool isActive[F_NUM_SENSOR_INSTANCES];      // instances still in the consensus
+    float fMean[3];                             // weighted average of the active instances
+    float fSumW;                                // sum of the active weights
+    float fDist, fWorst;                        // squared distances
+    int8 k, j, iAxis, iWorst, iActive;
+
+    iActive = 0;
+    for (k = 0; k < F_NUM_SENSOR_INSTANCES; k++)
+    {
+        isActive[k] = isValid[k] && (pSet->Cal[k].fWeight > 0.0F);
+        if (!isActive[k]) continue;
+        for (j = CHX; j <= CHZ; j++)
+        {
+            iAxis = pSet->Cal[k].iAxis[j];
+            fX[k][j] = ((iAxis < 0) ? -fIn[k][-iAxis - 1] : fIn[k][iAxis - 1]) - pSet->Cal[k].fOffset[j];
+        }
+        iActive++;
+    }
+    if (iActive == 0) return (false);
+
+    while (1)
+    {
+        fSumW = 0.0F;
+        for (j = CHX; j <= CHZ; j++) fMean[j] = 0.0F;
+        for (k = 0; k < F_NUM_SENSOR_INSTANCES; k++)
+        {
+            if (!isActive[k]) continue;
+            fSumW += pSet->Cal[k].fWeight;
+            for (j = CHX; j <= CHZ; j++) fMean[j] += pSet->Cal[k].fWeight * fX[k][j];
+        }
+        for (j = CHX; j <= CHZ; j++) fMean[j] /= fSumW;
+        if (iActive == 1) break;
+
+        // find the instance furthest from the consensus
+        fWorst = 0.0F;
+        iWorst = -1;
+        for (k = 0; k < F_NUM_SENSOR_INSTANCES; k++)
+        {
+            if (!isActive[k]) continue;
+            fDist = 0.0F;
+            for (j = CHX; j <= CHZ; j++) fDist += (fX[k][j] - fMean[j]) * (fX[k][j] - fMean[j]);
+            if (fDist > fWorst)
+            {
+                fWorst = fDist;
+                iWorst = k;
+            }
+        }
+        if (fWorst <= pSet->fGate * pSet->fGate) break;
+
+        // two instances that disagree are both far from their mean, keep the one
+        // closest to the last output
+        if (iActive == 2)
+        {
+            fWorst = -1.0F;
+            for (k = 0; k < F_NUM_SENSOR_INSTANCES; k++)
+            {
+                if (!isActive[k]) continue;
+                fDist = 0.0F;
+                for (j = CHX; j <= CHZ; j++) fDist += (fX[k][j] - pSet->fLast[j]) * (fX[k][j] - pSet->fLast[j]);
+                if (fDist > fWorst)
+                {
+                    fWorst = fDist;
+                    iWorst = k;
+                }
+            }
+        }
+        isActive[iWorst] = false;
+        iActive--;
+        pSet->iRejected++;
+    }
+
+    for (j = CHX; j <= CHZ; j++) fOut[j] = pSet->fLast[j] = fMean[j];
+    return (true);
+}
+#endif
+
+#if F_USING_ACCEL && (F_NUM_SENSOR_INSTANCES > 1)
+// Replace the primary accelerometer average with the average of all accelerometers
+static void fuseAccelInstances(SensorFusionGlobals *sfg)
+{
+    float fIn[F_NUM_SENSOR_INSTANCES][3];       // averaged reading of each instance (g)
+    bool isValid[F_NUM_SENSOR_INSTANCES];       // instance was sampled this period
+    float fOut[3];                              // fused reading (g)
+    struct AccelSensor *pAccel;
+    int8 k, j;                                  // counters
+
+    isValid[0] = (sfg->Accel.iFIFOCount > 0);
+    for (j = CHX; j <= CHZ; j++) fIn[0][j] = sfg->Accel.fGs[j];
+    for (k = 1; k < F_NUM_SENSOR_INSTANCES; k++)
+    {
+        pAccel = &(sfg->AccelInstance[k - 1]);
+        if (pAccel->iFIFOExceeded > 0) sfg->setStatus(sfg, SOFT_FAULT);
+#if FIFO_RESAMPLE
+        if (sfg->AccelResample.isEnabled)
+            isValid[k] = pAccel->isEnabled &&
+                         resampleFifo(&(sfg->AccelResample.Instance[k]), pAccel->iGsFIFO, pAccel->iFIFOCount,
+                                      pAccel->iFIFOExceeded, pAccel->fgPerCount, fIn[k]);
+        else
+#endif
+        isValid[k] = pAccel->isEnabled &&
+                     averageFifo(pAccel->iGsFIFO, pAccel->iFIFOCount, pAccel->fgPerCount, fIn[k]);
+    }
+    if (fuseInstances(&(sfg->AccelSet), fIn, isValid, fOut))
+    {
+        for (j = CHX; j <= CHZ; j++)
+        {
+            sfg->Accel.fGs[j] = fOut[j];
+            sfg->Accel.iGs[j] = (int16) (fOut[j] / sfg->Accel.fgPerCount);
+        }
+    }
+}
+#endif
+#if F_USING_MAG && (F_NUM_SENSOR_INSTANCES > 1)
+// Each magnetometer carries its own hard iron, often tens of uT apart from part to part,
+// and only the one of instance 0 is removed by the magnetic calibration.  Every instance
+// sees the same geomagnetic field, so the difference between a rotated instance and
+// instance 0 is the difference of their hard irons.  It is learned into Cal[k].fOffset,
+// first as a running mean over MAG_INSTANCE_TRAINING periods, during which the instance
+// is left out of the average, then as a slow average that only follows readings within
+// the gate so that a failing instance is still rejected rather than learned.
+static void trackMagInstanceOffsets(struct SensorInstanceSet *pSet, float fIn[][3], bool isValid[])
+{
+    struct SensorInstanceCal *pCal;
+    float fDelta[3];                            // hard iron difference seen this period (uT)
+    float fDist;                                // squared distance from the learned difference
+    float fGain;                                // update gain
+    int8 k, j, iAxis;
+
+    for (k = 1; k < F_NUM_SENSOR_INSTANCES; k++)
+    {
+        if (!isValid[k]) continue;
+        pCal = &(pSet->Cal[k]);
+        if (!isValid[0])
+        {
+            // nothing to learn from, average the instance only once trained
+            isValid[k] = (pCal->iOffsetCount >= MAG_INSTANCE_TRAINING);
+            continue;
+        }
+        fDist = 0.0F;
+        for (j = CHX; j <= CHZ; j++)
+        {
+            iAxis = pCal->iAxis[j];
+            fDelta[j] = ((iAxis < 0) ? -fIn[k][-iAxis - 1] : fIn[k][iAxis - 1]) - fIn[0][j];
+            fDist += (fDelta[j] - pCal->fOffset[j]) * (fDelta[j] - pCal->fOffset[j]);
+        }
+        if (pCal->iOffsetCount < MAG_INSTANCE_TRAINING)
+        {
+            pCal->iOffsetCount++;
+            fGain = 1.0F / (float) pCal->iOffsetCount;
+            isValid[k] = false;
+        }
+        else if (fDist <= pSet->fGate * pSet->fGate)
+        {
+            fGain = 1.0F / (float) MAG_INSTANCE_TRAINING;
+        }
+        else
+        {
+            continue;
+        }
+        for (j = CHX; j <= CHZ; j++) pCal->fOffset[j] += fGain * (fDelta[j] - pCal->fOffset[j]);
+    }
+}
+
+// Replace the primary magnetometer average with the average of all magnetometers.  The
+// readings keep the hard iron of instance 0, which fInvertMagCal() removes afterwards.
+static void fuseMagInstances(SensorFusionGlobals *sfg)
+{
+    float fIn[F_NUM_SENSOR_INSTANCES][3];       // averaged reading of each instance (uT)
+    bool isValid[F_NUM_SENSOR_INSTANCES];       // instance was sampled this period
+    float fOut[3];                              // fused reading (uT)
+    struct MagSensor *pMag;
+    int8 k, j;                                  // counters
+
+    isValid[0] = (sfg->Mag.iFIFOCount > 0);
+    for (j = CHX; j <= CHZ; j++) fIn[0][j] = sfg->Mag.fBs[j];
+    for (k = 1; k < F_NUM_SENSOR_INSTANCES; k++)
+    {
+        pMag = &(sfg->MagInstance[k - 1]);
+        if (pMag->iFIFOExceeded > 0) sfg->setStatus(sfg, SOFT_FAULT);
+#if FIFO_RESAMPLE
+        if (sfg->MagResample.isEnabled)
+            isValid[k] = pMag->isEnabled &&
+                         resampleFifo(&(sfg->MagResample.Instance[k]), pMag->iBsFIFO, pMag->iFIFOCount,
+                                      pMag->iFIFOExceeded, pMag->fuTPerCount, fIn[k]);
+        else
+#endif
+        isValid[k] = pMag->isEnabled &&
+                     averageFifo(pMag->iBsFIFO, pMag->iFIFOCount, pMag->fuTPerCount, fIn[k]);
+    }
+    trackMagInstanceOffsets(&(sfg->MagSet), fIn, isValid);
+    if (fuseInstances(&(sfg->MagSet), fIn, isValid, fOut))
+    {
+        for (j = CHX; j <= CHZ; j++)
+        {
+            sfg->Mag.fBs[j] = fOut[j];
+            sfg->Mag.iBs[j] = (int16) (fOut[j] / sfg->Mag.fuTPerCount);
+        }
+    }
+}
+#endif
+#if F_USING_GYRO && (F_NUM_SENSOR_INSTANCES > 1)
+// Replace the primary gyro average with the average of all gyros.  The Kalman filters
+// integrate the individual FIFO samples, so those are shifted by the same correction.
+static void fuseGyroInstances(SensorFusionGlobals *sfg)
+{
+    float fIn[F_NUM_SENSOR_INSTANCES][3];       // averaged reading of each instance (deg/s)
+    bool isValid[F_NUM_SENSOR_INSTANCES];       // instance was sampled this period
+    float fOut[3];                              // fused reading (deg/s)
+    int32 iDelta[3];                            // correction applied to the primary FIFO (counts)
+    int32 itmp32;
+    struct GyroSensor *pGyro;
+    int8 k, j;                                  // counters
+    int16 i;                                    // FIFO counter
+
+    isValid[0] = (sfg->Gyro.iFIFOCount > 0);
+    for (j = CHX; j <= CHZ; j++) fIn[0][j] = sfg->Gyro.fYs[j];
+    for (k = 1; k < F_NUM_SENSOR_INSTANCES; k++)
+    {
+        pGyro = &(sfg->GyroInstance[k - 1]);
+        if (pGyro->iFIFOExceeded > 0) sfg->setStatus(sfg, SOFT_FAULT);
+        isValid[k] = pGyro->isEnabled &&
+                     averageFifo(pGyro->iYsFIFO, pGyro->iFIFOCount, pGyro->fDegPerSecPerCount, fIn[k]);
+    }
+    if (fuseInstances(&(sfg->GyroSet), fIn, isValid, fOut))
+    {
+        for (j = CHX; j <= CHZ; j++)
+        {
+            sfg->Gyro.fYs[j] = fOut[j];
+            itmp32 = (int32) (fOut[j] / sfg->Gyro.fDegPerSecPerCount);
+            iDelta[j] = itmp32 - sfg->Gyro.iYs[j];
+            sfg->Gyro.iYs[j] = (int16) itmp32;
+        }
+        for (i = 0; i < sfg->Gyro.iFIFOCount; i++)
+        {
+            for (j = CHX; j <= CHZ; j++)
+            {
+                itmp32 = sfg->Gyro.iYsFIFO[i][j] + iDelta[j];
+                if (itmp32 > 32767) itmp32 = 32767;
+                if (itmp32 < -32767) itmp32 = -32767;
+                sfg->Gyro.iYsFIFO[i][j] = (int16) itmp32;
+            }
+        }
+    }
+}
+#endif
+
 // process<Sensor>Data routines do post processing for HAL and averaging.  They
 // are called from the readSensors() function below.
 #if F_USING_ACCEL
@@ -190,28 +698,53 @@ void processAccelData(SensorFusionGlobals *sfg)
 
     ApplyAccelHAL(&(sfg->Accel));     // This function is board-dependent
 
+#if FIFO_RESAMPLE
+    // low pass filter the HAL-corrected measurements down to the fusion rate
+    if (sfg->AccelResample.isEnabled)
+    {
+        if (resampleFifo(&(sfg->AccelResample.Instance[0]), sfg->Accel.iGsFIFO, sfg->Accel.iFIFOCount,
+                         sfg->Accel.iFIFOExceeded, sfg->Accel.fgPerCount, sfg->Accel.fGs))
+        {
+            for (j = CHX; j <= CHZ; j++)
+                sfg->Accel.iGs[j] = (int16) (sfg->Accel.fGs[j] / sfg->Accel.fgPerCount);
+        }
+    }
+    else
+#endif
     // calculate the average HAL-corrected measurement
-    for (j = CHX; j <= CHZ; j++) iSum[j] = 0;
-    for (i = 0; i < sfg->Accel.iFIFOCount; i++)
-        for (j = CHX; j <= CHZ; j++) iSum[j] += sfg->Accel.iGsFIFO[i][j];
     if (sfg->Accel.iFIFOCount > 0)
     {
+        for (j = CHX; j <= CHZ; j++) iSum[j] = 0;
+        for (i = 0; i < sfg->Accel.iFIFOCount; i++)
+            for (j = CHX; j <= CHZ; j++) iSum[j] += sfg->Accel.iGsFIFO[i][j];
         for (j = CHX; j <= CHZ; j++)
         {
             sfg->Accel.iGs[j] = (int16)(iSum[j] / (int32) sfg->Accel.iFIFOCount);
             sfg->Accel.fGs[j] = (float)sfg->Accel.iGs[j] * sfg->Accel.fgPerCount;
         }
     }
+#if F_NUM_SENSOR_INSTANCES > 1
+    fuseAccelInstances(sfg);          // weighted average with the redundant accelerometers
+#endif
 
     // apply precision accelerometer calibration (offset V, inverse gain invW and rotation correction R^T)
     // to map fGs onto fGc (g), iGc (counts)
     fInvertAccelCal(&(sfg->Accel), &(sfg->AccelCal));
 
     // update the precision accelerometer data buffer
+#if COMPACT_GLOBALS && F_USING_MAG
+    int16 iStoreCounter = sfg->AccelBuffer.iStoreCounter;
+#endif
     fUpdateAccelBuffer(&(sfg->AccelCal),
                        &(sfg->AccelBuffer),
                        &(sfg->Accel),
                        &(sfg->pControlSubsystem->AccelCalPacketOn));
+#if COMPACT_GLOBALS && F_USING_MAG
+    // a measurement completed (iStoreCounter reached -1) so the accelerometer calibration has just
+    // run in the scratch matrices shared with the time sliced magnetic calibration
+    if ((iStoreCounter >= 0) && (sfg->AccelBuffer.iStoreCounter < 0))
+        fAbandonMagCalibration(&(sfg->MagCal));
+#endif
     return;
 }
 #endif
@@ -228,23 +761,51 @@ void processMagData(SensorFusionGlobals *sfg)
 
     ApplyMagHAL(&(sfg->Mag));         // This function is board-dependent
 
+#if FIFO_RESAMPLE
+    // low pass filter the HAL-corrected measurements down to the fusion rate
+    if (sfg->MagResample.isEnabled)
+    {
+        if (resampleFifo(&(sfg->MagResample.Instance[0]), sfg->Mag.iBsFIFO, sfg->Mag.iFIFOCount,
+                         sfg->Mag.iFIFOExceeded, sfg->Mag.fuTPerCount, sfg->Mag.fBs))
+        {
+            for (j = CHX; j <= CHZ; j++)
+                sfg->Mag.iBs[j] = (int16) (sfg->Mag.fBs[j] / sfg->Mag.fuTPerCount);
+        }
+    }
+    else
+#endif
     // calculate the average HAL-corrected measurement
-    for (j = CHX; j <= CHZ; j++) iSum[j] = 0;
-    for (i = 0; i < sfg->Mag.iFIFOCount; i++)
-	for (j = CHX; j <= CHZ; j++) iSum[j] += sfg->Mag.iBsFIFO[i][j];
     if (sfg->Mag.iFIFOCount > 0)
     {
+      for (j = CHX; j <= CHZ; j++) iSum[j] = 0;
+      for (i = 0; i < sfg->Mag.iFIFOCount; i++)
+	for (j = CHX; j <= CHZ; j++) iSum[j] += sfg->Mag.iBsFIFO[i][j];
       for (j = CHX; j <= CHZ; j++)
       {
           sfg->Mag.iBs[j] = (int16)(iSum[j] / (int32) sfg->Mag.iFIFOCount);
           sfg->Mag.fBs[j] = (float)sfg->Mag.iBs[j] * sfg->Mag.fuTPerCount;
       }
     }
+#if F_NUM_SENSOR_INSTANCES > 1
+    fuseMagInstances(sfg);            // weighted average with the redundant magnetometers
+#endif
 
     // remove hard and soft iron terms from fBs (uT) to get calibrated data fBc (uT), iBc (counts) and
     // update magnetic buffer avoiding a write while a magnetic calibration is in progress.
     // run one iteration of the time sliced magnetic calibration
     fInvertMagCal(&(sfg->Mag), &(sfg->MagCal));
+#if MAGCAL_BACKGROUND
+    if (sfg->signalMagCal)
+    {
+        // the solvers run to completion in a background task on a snapshot of the buffer,
+        // so the buffer is never read only and this task never runs a calibration slice
+        iUpdateMagBuffer(&(sfg->MagBuffer), &(sfg->Mag), sfg->loopcounter);
+        if (fQueueMagCalibration(&(sfg->MagCal), &(sfg->MagBuffer), &(sfg->Mag),
+                                 &(sfg->MagCalBackground), sfg->loopcounter))
+            sfg->signalMagCal(sfg);
+        return;
+    }
+#endif
     if (!sfg->MagCal.iMagBufferReadOnly)
         iUpdateMagBuffer(&(sfg->MagBuffer), &(sfg->Mag), sfg->loopcounter);
     fRunMagCalibration(&(sfg->MagCal), &(sfg->MagBuffer), &(sfg->Mag),
@@ -277,14 +838,16 @@ void processGyroData(SensorFusionGlobals *sfg)
             sfg->Gyro.fYs[j] = (float)sfg->Gyro.iYs[j] * sfg->Gyro.fDegPerSecPerCount;
         }
     }
+#if F_NUM_SENSOR_INSTANCES > 1
+    fuseGyroInstances(sfg);           // weighted average with the redundant gyros
+#endif
     return;
 }
 #endif
-/// readSensors traverses the linked list of physical sensors, calling the
-/// individual read functions one by one.
-/// This function is normally involved via the "sfg." global pointer.
-int8_t readSensors(
+// Common body of readSensors() and readSensorsOnBus(): bus_driver == NULL selects every sensor
+static int8_t readScheduledSensors(
     SensorFusionGlobals *sfg,   ///< pointer to global sensor fusion data structure
+    void *bus_driver,           ///< only read sensors on this bus (NULL = all buses)
     uint16_t read_loop_counter  ///< current loop counter (used for multirate processing)
 )
 {
@@ -293,10 +856,8 @@ int8_t readSensors(
     int8_t          status = 0;
     float           remainder;
 
-    pSensor = sfg->pSensors;
-
     for (pSensor = sfg->pSensors; pSensor != NULL; pSensor = pSensor->next)
-    {   if (pSensor->isInitialized) {
+    {   if (pSensor->isInitialized && (bus_driver == NULL || pSensor->bus_driver == bus_driver)) {
             remainder = fmod(read_loop_counter, pSensor->schedule);
             if (remainder==0) {
                 s = pSensor->read(pSensor, sfg);
@@ -307,6 +868,28 @@ int8_t readSensors(
     if (status==SENSOR_ERROR_INIT) sfg->setStatus(sfg, HARD_FAULT);  // Never returns
     return (status);
 }
+
+/// readSensors traverses the linked list of physical sensors, calling the
+/// individual read functions one by one.
+/// This function is normally involved via the "sfg." global pointer.
+int8_t readSensors(
+    SensorFusionGlobals *sfg,   ///< pointer to global sensor fusion data structure
+    uint16_t read_loop_counter  ///< current loop counter (used for multirate processing)
+)
+{
+    return (readScheduledSensors(sfg, NULL, read_loop_counter));
+}
+
+/// readSensorsOnBus is readSensors restricted to the sensors installed on one
+/// bus driver.  Running one caller per bus lets the transfers overlap.
+int8_t readSensorsOnBus(
+    SensorFusionGlobals *sfg,   ///< pointer to global sensor fusion data structure
+    void *bus_driver,           ///< I2C or SPI driver the sensors were installed with
+    uint16_t read_loop_counter  ///< current loop counter (used for multirate processing)
+)
+{
+    return (readScheduledSensors(sfg, bus_driver, read_loop_counter));
+}
 /// conditionSensorReadings() transforms raw software FIFO readings into forms that
 /// can be consumed by the sensor fusion engine.  This include sample averaging
 /// and (in the case of the gyro) integrations, applying hardware abstraction layers,
@@ -386,6 +969,24 @@ void clearFIFOs(SensorFusionGlobals *sfg) {
     sfg->Gyro.iFIFOCount=0;
     sfg->Gyro.iFIFOExceeded = false;
 #endif
+#if F_NUM_SENSOR_INSTANCES > 1
+    int8 k;
+    for (k = 0; k < F_NUM_SENSOR_INSTANCES - 1; k++)
+    {
+#if F_USING_ACCEL
+        sfg->AccelInstance[k].iFIFOCount = 0;
+        sfg->AccelInstance[k].iFIFOExceeded = false;
+#endif
+#if F_USING_MAG
+        sfg->MagInstance[k].iFIFOCount = 0;
+        sfg->MagInstance[k].iFIFOExceeded = false;
+#endif
+#if F_USING_GYRO
+        sfg->GyroInstance[k].iFIFOCount = 0;
+        sfg->GyroInstance[k].iFIFOExceeded = false;
+#endif
+    }
+#endif
 }
 
 /// runFusion the top level call that actually runs the sensor fusion.
@@ -487,6 +1088,7 @@ void initializeFusionEngine(SensorFusionGlobals *sfg)
     // configure the 24 bit downwards ARM systick timer and wait 50ms=CORE_SYSTICK_HZ / 20 clock ticks
     // to avoid a race condition between Kinetis and the sensors after power on.
     ARM_systick_enable();
+    ARM_timestamp_enable();               // free-running counter used to timestamp FIFO reads
     // wait 50ms to avoid a race condition with sensors at power on
     ARM_systick_delay_ms(CORE_SYSTICK_HZ, 50);
 
@@ -508,6 +1110,10 @@ void initializeFusionEngine(SensorFusionGlobals *sfg)
 
     // initialize the sensor fusion algorithms
     fInitializeFusion(sfg);
+#if FIFO_RESAMPLE
+    // the mag is read once per fast loop pass
+    fSetResampleRates(sfg, ACCEL_ODR_HZ, sfg->iFusionHz * (OVERSAMPLE_RATE));
+#endif
 
     // reset the loop counter to zero for first iteration
     sfg->loopcounter = 0;
@@ -515,6 +1121,9 @@ void initializeFusionEngine(SensorFusionGlobals *sfg)
     // initialize the magnetic calibration and magnetometer data buffer
 #if F_USING_MAG
     fInitializeMagCalibration(&sfg->MagCal, &sfg->MagBuffer);
+#if MAGCAL_BACKGROUND
+    fInitializeMagCalBackground(&sfg->MagCalBackground);
+#endif
 #endif
 
     // initialize the precision accelerometer calibration and accelerometer data buffer
@@ -538,6 +1147,24 @@ void conditionSample(int16_t sample[3])
     if (sample[CHY] == -32768) sample[CHY]++;
     if (sample[CHZ] == -32768) sample[CHZ]++;
 }
+void stampFifoBatch(union FifoSensor *sensor, uint32_t *pSampleTime, uint8_t iFirst,
+                    uint32_t iTimestamp, uint16_t iODR)
+{
+    uint32_t iTicksPerSample;
+    uint8_t i;
+    uint8_t fifoCount = sensor->Accel.iFIFOCount;
+
+    sensor->Accel.iFIFOTimestamp = iTimestamp;
+    if ((pSampleTime == NULL) || (iODR == 0)) return;
+
+    // the newest sample read was taken at iTimestamp, earlier ones one ODR period apart.  when the
+    // software FIFO overflowed addToFifo dropped the newest iFIFOExceeded samples of this batch, so the
+    // last sample kept is that many periods older (the count is reset whenever a sample is kept)
+    iTicksPerSample = ARM_timestamp_hz() / iODR;
+    for (i = iFirst; i < fifoCount; i++)
+        pSampleTime[i] = iTimestamp -
+            (uint32_t) (fifoCount - 1 - i + sensor->Accel.iFIFOExceeded) * iTicksPerSample;
+}
 void addToFifo(union FifoSensor *sensor, uint16_t maxFifoSize, int16_t sample[3])
 {
   // Note that FifoSensor is a union of GyroSensor, MagSensor and AccelSensor.
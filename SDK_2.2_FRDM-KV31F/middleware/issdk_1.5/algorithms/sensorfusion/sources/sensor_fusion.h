@@ -49,6 +49,22 @@
 
 #include "issdk_hal.h"                  // Hardware Abstraction Layer board dependencies beyond those generated in board.h by PEX
 #include "build.h"                      // This is where the build parameters are defined
+#ifndef COMPACT_GLOBALS
+#define COMPACT_GLOBALS 0               // 1 for the memory optimized SensorFusionGlobals layout (see below)
+#endif
+#ifndef LAZY_ORIENTATION
+#define LAZY_ORIENTATION 0              // 1 to derive orientation matrix, Euler angles and rotation vector on request
+#endif
+#ifndef FAST_MATH
+#define FAST_MATH 0                     // 1 to run orientation.c and fusion.c math on the fastmath.c kernels
+#endif
+#ifndef FIFO_RESAMPLE
+#define FIFO_RESAMPLE 0                 // 1 to low pass filter the accel and mag FIFOs down to the fusion rate (CMSIS-DSP)
+#endif
+#if FIFO_RESAMPLE
+#include "arm_math.h"                   // arm_fir_resample_f32()
+#undef PI                               // arm_math.h defines its own, replaced by the one below
+#endif
 #include "magnetic.h"                   // Magnetic calibration functions/structures
 #include "precisionAccelerometer.h"     // Accel calibration functions/structures
 #include "orientation.h"                // Functions for manipulating orientations
@@ -84,6 +100,42 @@ typedef enum quaternion {
 #define CHZ 2   ///< Used to access Z-channel entries in various data data structures
 ///@}
 
+/// @name Redundant Sensors
+/// Number of physical instances supported per logical sensor type (accel, mag, gyro) and
+/// the default outlier gates used when averaging them.  Override in build.h.
+///@{
+#ifndef F_NUM_SENSOR_INSTANCES
+#define F_NUM_SENSOR_INSTANCES 1        ///< 1 = a single sensor per type (original behavior)
+#endif
+#define ACCEL_INSTANCE_GATE 0.15F       ///< reject accel instances further than this from the consensus (g)
+#define MAG_INSTANCE_GATE 15.0F         ///< reject mag instances further than this from the consensus (uT)
+#define MAG_INSTANCE_TRAINING 64        ///< fusion periods used to learn the hard iron of a redundant magnetometer
+#define GYRO_INSTANCE_GATE 10.0F        ///< reject gyro instances further than this from the consensus (deg/s)
+///@}
+
+/// @name Memory Optimized Layout
+/// With COMPACT_GLOBALS set in build.h, the precision accelerometer and the time sliced magnetic
+/// calibrations share one set of solver scratch matrices, the magnetic buffer time indices are
+/// 16 bit relative ages and build.h can size the software FIFOs with SW_FIFO_DEPTH from the
+/// worst ODR / fusion rate ratio instead of the hardware FIFO size.
+///@{
+/// software FIFO depth for a sensor sampled at odrHz and drained every fusion period at fusionHz:
+/// one period of samples plus the samples of one late fast loop read, capped at the hardware FIFO
+#define SW_FIFO_DEPTH(odrHz, fusionHz, hwSize) \
+    ((((odrHz) + (fusionHz) - 1) / (fusionHz) + ((odrHz) + (fusionHz) * OVERSAMPLE_RATE - 1) / ((fusionHz) * OVERSAMPLE_RATE)) < (hwSize) ? \
+     (((odrHz) + (fusionHz) - 1) / (fusionHz) + ((odrHz) + (fusionHz) * OVERSAMPLE_RATE - 1) / ((fusionHz) * OVERSAMPLE_RATE)) : (hwSize))
+///@}
+
+/// @name FIFO Resampling
+/// With FIFO_RESAMPLE set in build.h, the accel and mag FIFOs are run through a windowed sinc
+/// low pass FIR resampler from the sensor rate down to the fusion rate instead of being box
+/// averaged, which removes the vibration that the average aliases into the fusion band.
+///@{
+#define FIFO_RESAMPLE_SPAN 4            ///< filter length in output periods: numTaps = FIFO_RESAMPLE_SPAN * max(L, M)
+#define FIFO_RESAMPLE_MAX_TAPS 32       ///< longest filter, rates needing more are box averaged
+#define FIFO_RESAMPLE_BLOCK (ACCEL_FIFO_SIZE > MAG_FIFO_SIZE ? ACCEL_FIFO_SIZE : MAG_FIFO_SIZE)  ///< largest FIFO burst
+///@}
+
 // booleans
 #define true 1  ///< Boolean TRUE
 #define false 0 ///< Boolean FALSE
@@ -147,6 +199,11 @@ typedef int8_t (readSensors_t) (
     struct SensorFusionGlobals *sfg,
     uint16_t read_loop_counter
 ) ;
+typedef int8_t (readSensorsOnBus_t) (
+    struct SensorFusionGlobals *sfg,
+    void *bus_driver,
+    uint16_t read_loop_counter
+) ;
 typedef int8_t (installSensor_t) (
     struct SensorFusionGlobals *sfg,    ///< Global data structure pointer
     struct PhysicalSensor *sensor,      ///< SF Structure to store sensor configuration
@@ -169,6 +226,8 @@ typedef void   (setStatus_t) 			(struct SensorFusionGlobals *sfg, fusion_status_
 typedef void   (updateStatus_t) 		(struct SensorFusionGlobals *sfg);
 typedef void   (ssSetStatus_t) 			(struct StatusSubsystem *pStatus, fusion_status_t status);
 typedef void   (ssUpdateStatus_t) 		(struct StatusSubsystem *pStatus);
+typedef void   (busEvent_t) 			(struct SensorFusionGlobals *sfg, uint8_t deviceInstance);
+typedef void   (magCalEvent_t) 			(struct SensorFusionGlobals *sfg);
 
 /// \brief An instance of PhysicalSensor structure type should be allocated for each physical sensors (combo devices = 1)
 ///
@@ -179,6 +238,7 @@ struct PhysicalSensor {
 	void *bus_driver;  			///< should be of type (ARM_DRIVER_I2C* for I2C-based sensors, ARM_DRIVER_SPI* for SPI)
         registerDeviceInfo_t *busInfo;          ///< information required for bus power management
 	uint16_t addr;  			///< I2C address if applicable
+        uint8_t instance;                       ///< 0 = primary sensor, 1..F_NUM_SENSOR_INSTANCES-1 = redundant copy
         uint16_t isInitialized;                 ///< Bitfields to indicate sensor is active (use SensorBitFields from build.h)
         spiSlaveSpecificParams_t slaveParams;   ///< SPI specific parameters.  Not used for I2C.
 	struct PhysicalSensor *next;		///< pointer to next sensor in this linked list
@@ -187,6 +247,17 @@ struct PhysicalSensor {
 	readSensor_t *read;			///< pointer to function to read       sensor using the supplied drivers
 };
 
+/// \brief Completion record for one asynchronous sensor register read.
+///
+/// Filled in by readSensorRegisters() and updated from the bus interrupt when the
+/// transfer completes.  Drivers never need to touch it directly.
+struct SensorRead {
+        struct SensorFusionGlobals *sfg;        ///< fusion structure owning the bus wait/signal hooks
+        struct PhysicalSensor *sensor;          ///< sensor the read was issued for
+        volatile int32_t status;                ///< ARM_DRIVER_OK or ARM_DRIVER_ERROR once complete
+        volatile bool pending;                  ///< true while the transfer is in flight
+};
+
 // Now start "standard" sensor fusion structure definitions
 
 /// \brief The PressureSensor structure stores raw and processed measurements for an altimeter.
@@ -217,6 +288,7 @@ struct AccelSensor
         bool  isEnabled;                        ///< true if the device is sampling
 	uint8_t iFIFOCount;			///< number of measurements read from FIFO
         uint16_t iFIFOExceeded;                 ///< Number of samples received in excess of software FIFO size
+        uint32_t iFIFOTimestamp;                ///< ARM_timestamp() when the latest FIFO batch was read
 	int16_t iGsFIFO[ACCEL_FIFO_SIZE][3];	///< FIFO measurements (counts)
         // End of common fields which can be referenced via FifoSensor union type
 	float fGs[3];			        ///< averaged measurement (g)
@@ -239,6 +311,7 @@ struct MagSensor
         bool  isEnabled;                        ///< true if the device is sampling
 	uint8_t iFIFOCount;			///< number of measurements read from FIFO
         uint16_t iFIFOExceeded;                 ///< Number of samples received in excess of software FIFO size
+        uint32_t iFIFOTimestamp;                ///< ARM_timestamp() when the latest FIFO batch was read
 	int16_t iBsFIFO[MAG_FIFO_SIZE][3];	///< FIFO measurements (counts)
         // End of common fields which can be referenced via FifoSensor union type
 	float fBs[3];				///< averaged un-calibrated measurement (uT)
@@ -261,8 +334,11 @@ struct GyroSensor
         bool  isEnabled;                        ///< true if the device is sampling
 	uint8_t iFIFOCount;			///< number of measurements read from FIFO
         uint16_t iFIFOExceeded;                 ///< Number of samples received in excess of software FIFO size
+        uint32_t iFIFOTimestamp;                ///< ARM_timestamp() when the latest FIFO batch was read
 	int16_t iYsFIFO[GYRO_FIFO_SIZE][3];	///< FIFO measurements (counts)
         // End of common fields which can be referenced via FifoSensor union type
+	uint32_t iYsTime[GYRO_FIFO_SIZE];	///< ARM_timestamp() of each FIFO measurement, back-interpolated from the ODR
+	uint16_t iODRHz;			///< currently requested ODR (Hz) used to space the FIFO timestamps
 	float fYs[3];				///< averaged measurement (deg/s)
 	float fDegPerSecPerCount;		///< deg/s per count
 	int16_t iCountsPerDegPerSec;		///< counts per deg/s
@@ -271,13 +347,54 @@ struct GyroSensor
 
 /// \brief The FifoSensor union allows us to use common pointers for Accel, Mag & Gyro logical sensor structures.
 ///
-/// Common elements include: iWhoAmI, isEnabled, iFIFOCount, iFIFOExceeded and the FIFO itself.
+/// Common elements include: iWhoAmI, isEnabled, iFIFOCount, iFIFOExceeded, iFIFOTimestamp and the FIFO itself.
 union FifoSensor  {
     struct GyroSensor Gyro;
     struct MagSensor  Mag;
     struct AccelSensor Accel;
 };
 
+/// \brief Per-instance HAL rotation and calibration used when averaging redundant sensors.
+///
+/// Maps the averaged reading of one physical instance (in physical units) into the
+/// HAL-corrected frame of instance 0.  Instance 0 has already been through the board
+/// HAL, so its entry is normally the identity.
+struct SensorInstanceCal
+{
+	int8_t iAxis[3];			///< signed one-based source channel for X, Y, Z (e.g. {2, 1, -3})
+	float fOffset[3];			///< offset removed after the rotation (g, uT or deg/s), learned at run time for magnetometers
+	float fWeight;				///< relative weight, nominally 1 / noise variance (0 = ignore instance)
+	uint16_t iOffsetCount;			///< magnetometers only: offset updates so far, the instance is averaged after MAG_INSTANCE_TRAINING
+};
+
+/// \brief Averaging state shared by all instances of one logical sensor type.
+struct SensorInstanceSet
+{
+	struct SensorInstanceCal Cal[F_NUM_SENSOR_INSTANCES]; ///< HAL and calibration per instance
+	float fLast[3];				///< last averaged output, breaks ties when only two instances disagree
+	float fGate;				///< distance from the consensus above which an instance is rejected
+	uint16_t iRejected;			///< number of instance readings rejected as outliers
+};
+
+#if FIFO_RESAMPLE
+/// \brief Resampler of the FIFO of one physical sensor instance, one stream per axis.
+struct FifoResampler
+{
+	arm_fir_resample_instance_f32 Axis[3];	///< resampler per axis, on the coefficients of the FifoResampleSet
+	float32_t fState[3][FIFO_RESAMPLE_BLOCK + FIFO_RESAMPLE_MAX_TAPS - 1];  ///< last inputs per axis
+	float fLast[3];				///< last output (g or uT), kept when a burst completes no output
+	bool isPrimed;				///< false: the input history is filled with the next sample
+};
+
+/// \brief Resamplers of all instances of one logical sensor type (accel or mag).
+struct FifoResampleSet
+{
+	float32_t fCoeffs[FIFO_RESAMPLE_MAX_TAPS];	///< time reversed low pass filter, DC gain L
+	bool isEnabled;				///< false: no usable L/M for the current rates, the FIFOs are box averaged
+	struct FifoResampler Instance[F_NUM_SENSOR_INSTANCES];  ///< instance 0 is sfg->Accel (Mag)
+};
+#endif
+
 /// The SV_1DOF_P_BASIC structure contains state information for a pressure sensor/altimeter.
 struct SV_1DOF_P_BASIC
 {
@@ -303,6 +420,9 @@ struct SV_3DOF_G_BASIC
 	float fLPRVec[3];			///< rotation vector
 	float fOmega[3];			///< angular velocity (deg/s)
 	int32_t systick;			///< systick timer
+#if LAZY_ORIENTATION
+	uint8_t iStale;				///< ORIENT_ bit-field of the outputs not yet derived from the quaternion
+#endif
 	// end: elements common to all motion state vectors
 	float fR[3][3];				///< unfiltered orientation matrix
 	Quaternion fq;				///< unfiltered orientation quaternion
@@ -325,6 +445,9 @@ struct SV_3DOF_B_BASIC
 	float fLPRVec[3];			///< rotation vector
 	float fOmega[3];			///< angular velocity (deg/s)
 	int32_t systick;			///< systick timer
+#if LAZY_ORIENTATION
+	uint8_t iStale;				///< ORIENT_ bit-field of the outputs not yet derived from the quaternion
+#endif
 	// end: elements common to all motion state vectors
 	float fR[3][3];				///< unfiltered orientation matrix
 	Quaternion fq;				///< unfiltered orientation quaternion
@@ -347,6 +470,9 @@ struct SV_3DOF_Y_BASIC
 	float fRVec[3];				///< rotation vector
 	float fOmega[3];			///< angular velocity (deg/s)
 	int32_t systick;			///< systick timer
+#if LAZY_ORIENTATION
+	uint8_t iStale;				///< ORIENT_ bit-field of the outputs not yet derived from the quaternion
+#endif
 	// end: elements common to all motion state vectors
 	float fdeltat;				///< fusion filter sampling interval (s)
 	int8_t resetflag;			///< flag to request re-initialization on next pass
@@ -366,6 +492,9 @@ struct SV_6DOF_GB_BASIC
 	float fLPRVec[3];			///< rotation vector
 	float fOmega[3];			///< virtual gyro angular velocity (deg/s)
 	int32_t systick;			///< systick timer
+#if LAZY_ORIENTATION
+	uint8_t iStale;				///< ORIENT_ bit-field of the outputs not yet derived from the quaternion
+#endif
 	// end: elements common to all motion state vectors
 	float fR[3][3];				///< unfiltered orientation matrix
 	Quaternion fq;				///< unfiltered orientation quaternion
@@ -390,6 +519,9 @@ struct SV_6DOF_GY_KALMAN
 	float fRVecPl[3];			///< rotation vector
 	float fOmega[3];			///< average angular velocity (deg/s)
 	int32_t systick;			///< systick timer;
+#if LAZY_ORIENTATION
+	uint8_t iStale;				///< ORIENT_ bit-field of the outputs not yet derived from the quaternion
+#endif
 	// end: elements common to all motion state vectors
 	float fQw6x6[6][6];			///< covariance matrix Qw
 	float fK6x3[6][3];			///< kalman filter gain matrix K
@@ -407,6 +539,7 @@ struct SV_6DOF_GY_KALMAN
 	float fAlphaQwbOver6;			///< (PI / 180 * fdeltat) * Qwb / 6
 	float fQwbOver3;			///< Qwb / 3
 	float fMaxGyroOffsetChange;		///< maximum permissible gyro offset change per iteration (deg/s)
+	uint32_t iGyroTime;			///< timestamp of the last integrated gyro measurement
 	int8_t resetflag;			///< flag to request re-initialization on next pass
 };
 
@@ -424,6 +557,9 @@ struct SV_9DOF_GBY_KALMAN
 	float fRVecPl[3];			///< rotation vector
 	float fOmega[3];			///< average angular velocity (deg/s)
 	int32_t systick;			///< systick timer;
+#if LAZY_ORIENTATION
+	uint8_t iStale;				///< ORIENT_ bit-field of the outputs not yet derived from the quaternion
+#endif
 	// end: elements common to all motion state vectors
 	float fQw9x9[9][9];			///< covariance matrix Qw
 	float fK9x6[9][6];			///< kalman filter gain matrix K
@@ -448,7 +584,12 @@ struct SV_9DOF_GBY_KALMAN
 	float fAlphaQwbOver6;			///< (PI / 180 * fdeltat) * Qwb / 6
 	float fQwbOver3;			///< Qwb / 3
 	float fMaxGyroOffsetChange;		///< maximum permissible gyro offset change per iteration (deg/s)
+	float fQvY;				///< gyro sensor noise variance (deg/s)^2, FQVY_9DOF_GBY_KALMAN by default
+	float fQvG;				///< minimum accelerometer noise variance g^2, FQVG_9DOF_GBY_KALMAN by default
+	float fQvB;				///< minimum magnetometer noise variance uT^2, FQVB_9DOF_GBY_KALMAN by default
+	float fQwb;				///< gyro offset random walk (deg/s)^2, FQWB_9DOF_GBY_KALMAN by default
 	int8_t iFirstAccelMagLock;		///< denotes that 9DOF orientation has locked to 6DOF eCompass
+	uint32_t iGyroTime;			///< timestamp of the last integrated gyro measurement
 	int8_t resetflag;			///< flag to request re-initialization on next pass
 };
 
@@ -465,9 +606,24 @@ struct SV_COMMON {
 	float fRVec[3];			        ///< rotation vector
 	float fOmega[3];			///< average angular velocity (deg/s)
 	int32_t systick;			///< systick timer;
+#if LAZY_ORIENTATION
+	uint8_t iStale;				///< ORIENT_ bit-field of the outputs not yet derived from the quaternion
+#endif
 };
 typedef struct SV_COMMON *SV_ptr;
 
+/// @name OrientationOutputs
+/// With LAZY_ORIENTATION the quaternion is the only orientation state updated by every
+/// fusion pass.  The outputs below are derived from it by fUpdateOrientationOutputs()
+/// when a consumer asks for them, and iStale records which ones are out of date.
+///@{
+#define ORIENT_MATRIX 0x01                      ///< orientation matrix
+#define ORIENT_EULER 0x02                       ///< roll, pitch, yaw, compass and tilt angles
+#define ORIENT_ROTVEC 0x04                      ///< rotation vector
+#define ORIENT_ALL 0x07                         ///< all of the above
+#define ORIENT_ZEROYAW 0x80                     ///< not an output: yaw and compass are forced to zero (3DOF tilt)
+///@}
+
 /// \brief The top level fusion structure
 ///
 /// The top level fusion structure grows/shrinks based upon flag definitions
@@ -489,10 +645,20 @@ typedef struct SensorFusionGlobals
         uint32_t iFlags;                        ///< a bit-field of sensors and algorithms used
 	struct PhysicalSensor *pSensors;    	        ///< a linked list of physical sensors
 	volatile uint8_t iPerturbation;	        ///< test perturbation to be applied
+#ifdef INCLUDE_DEBUG_FUNCTIONS
+	uint16_t iTestProgress;			///< perturbation test status
+	uint16_t iTestDelay;			///< perturbation test measured delay (fusion loops)
+	float fTestThreshold;			///< perturbation test residual angle threshold (deg)
+	Quaternion fqTestStart;			///< conjugate of the orientation when the perturbation test started
+#endif
 	// Book-keeping variables
 	int32_t loopcounter;			///< counter incrementing each iteration of sensor fusion (typically 25Hz)
+	uint16_t iFusionHz;			///< current fusion rate (Hz): FUSION_HZ unless changed by fSetFusionRate()
 	int32_t systick_I2C;			///< systick counter to benchmark I2C reads
 	int32_t systick_Spare;			///< systick counter for counts spare waiting for timing interrupt
+#if COMPACT_GLOBALS && (F_USING_ACCEL || F_USING_MAG)
+	struct CalibrationScratch CalScratch;  ///< solver scratch shared by AccelCal and MagCal
+#endif
         ///@}
         ///@{
         /// @name SensorRelatedStructures
@@ -506,14 +672,35 @@ typedef struct SensorFusionGlobals
 	struct AccelSensor 	Accel;                  ///< accelerometer storage
 	struct AccelCalibration AccelCal;              ///< structures for accel calibration
 	struct AccelBuffer AccelBuffer;                ///< storage for points used for calibration
+#if     FIFO_RESAMPLE
+	struct FifoResampleSet AccelResample;          ///< accelerometer FIFOs to fusion rate
+#endif
+#if     F_NUM_SENSOR_INSTANCES > 1
+	struct AccelSensor 	AccelInstance[F_NUM_SENSOR_INSTANCES - 1];  ///< redundant accelerometers 1..N-1
+	struct SensorInstanceSet AccelSet;              ///< averaging of all accelerometer instances
+#endif
 #endif
 #if     F_USING_MAG
 	struct MagSensor 	Mag;                    ///< magnetometer storage
 	struct MagCalibration MagCal;                  ///< mag cal storage
 	struct MagBuffer MagBuffer;                    ///< mag cal constellation points
+#if     FIFO_RESAMPLE
+	struct FifoResampleSet MagResample;            ///< magnetometer FIFOs to fusion rate
+#endif
+#if     MAGCAL_BACKGROUND
+	struct MagCalBackground MagCalBackground;      ///< buffer snapshot and results of the background mag cal task
+#endif
+#if     F_NUM_SENSOR_INSTANCES > 1
+	struct MagSensor 	MagInstance[F_NUM_SENSOR_INSTANCES - 1];    ///< redundant magnetometers 1..N-1
+	struct SensorInstanceSet MagSet;                ///< averaging of all magnetometer instances
+#endif
 #endif
 #if     F_USING_GYRO
 	struct GyroSensor 	Gyro;                   ///< gyro storage
+#if     F_NUM_SENSOR_INSTANCES > 1
+	struct GyroSensor 	GyroInstance[F_NUM_SENSOR_INSTANCES - 1];   ///< redundant gyros 1..N-1
+	struct SensorInstanceSet GyroSet;               ///< averaging of all gyro instances
+#endif
 #endif
         ///@}
         ///@{
@@ -547,6 +734,7 @@ typedef struct SensorFusionGlobals
 	initializeFusionEngine_t *initializeFusionEngine ;  ///< set sensor fusion structures to initial values
 	applyPerturbation_t     *applyPerturbation ;	///< apply step function for testing purposes
 	readSensors_t		*readSensors;		///< read all physical sensors
+	readSensorsOnBus_t	*readSensorsOnBus;	///< read the physical sensors attached to one bus
 	runFusion_t		*runFusion;		///< run the fusion routines
         conditionSensorReadings_t *conditionSensorReadings;  ///< preprocessing step for sensor fusion
         clearFIFOs_t            *clearFIFOs;            ///< clear sensor FIFOs
@@ -554,6 +742,9 @@ typedef struct SensorFusionGlobals
 	setStatus_t		*queueStatus;  	        ///< queue status change for next regular interval
 	updateStatus_t		*updateStatus; 		///< status=next status
 	updateStatus_t		*testStatus; 		///< increment to next enumerated status value (test only)
+	busEvent_t		*waitForBus;		///< optional: block the reading task until signalBus (NULL = spin on bus idle function)
+	busEvent_t		*signalBus;		///< optional: wake the reading task, called from interrupt context
+	magCalEvent_t		*signalMagCal;		///< optional: wake the background mag cal task (NULL = time sliced on the fusion path)
         ///@}
 } SensorFusionGlobals;
 
@@ -576,8 +767,66 @@ void conditionSensorReadings(
 void clearFIFOs(
     SensorFusionGlobals *sfg                            ///< Global data structure pointer
 );
+#if FIFO_RESAMPLE
+/// \brief fSetResampleRates designs the accel and mag FIFO resamplers for the current fusion rate
+///
+/// The rates are reduced to L/M = sfg->iFusionHz / sensor rate and a Hamming windowed sinc
+/// with its cutoff at the lower Nyquist frequency is shared by all instances of the sensor.
+/// The streams restart, primed with their next sample.  Call it after fSetFusionRate()
+/// whenever the fusion rate or an ODR changes.  A sensor whose rates need upsampling or
+/// more than FIFO_RESAMPLE_MAX_TAPS taps falls back to the box average.
+void fSetResampleRates(
+    SensorFusionGlobals *sfg,                           ///< Global data structure pointer
+    uint16_t iAccelHz,                                  ///< rate of the accel FIFO samples (Hz)
+    uint16_t iMagHz                                     ///< rate of the mag FIFO samples (Hz)
+);
+#endif
 runFusion_t runFusion;
 readSensors_t readSensors;
+/// \brief readSensorsOnBus reads only the sensors installed on bus_driver
+///
+/// One task per bus calls this with the same read_loop_counter so that transfers on
+/// different buses overlap and the read phase costs max(bus) rather than sum(bus).
+/// The caller must wait for every bus to finish before conditionSensorReadings().
+/// Sensors on different buses must not share a FIFO (e.g. two accelerometers both
+/// feeding sfg->Accel), since their reads are then no longer serialized.
+readSensorsOnBus_t readSensorsOnBus;
+/// \brief accelInstance, magInstance and gyroInstance return the logical sensor structure
+/// a driver must fill for a given physical sensor.
+///
+/// Instance 0 is sfg->Accel (Mag, Gyro) as before.  Higher instances land in the
+/// AccelInstance[] (MagInstance[], GyroInstance[]) arrays and are averaged into instance 0
+/// by conditionSensorReadings(), after their own HAL rotation and calibration and with
+/// outlier rejection.  A redundant magnetometer is averaged and gated only after the
+/// difference between its hard iron and that of instance 0 has been learned, so all
+/// magnetometers are compared with the same hard iron, which the magnetic calibration
+/// then removes.
+struct AccelSensor *accelInstance(
+    SensorFusionGlobals *sfg,                           ///< Global data structure pointer
+    struct PhysicalSensor *sensor                       ///< sensor being read
+);
+struct MagSensor *magInstance(
+    SensorFusionGlobals *sfg,                           ///< Global data structure pointer
+    struct PhysicalSensor *sensor                       ///< sensor being read
+);
+struct GyroSensor *gyroInstance(
+    SensorFusionGlobals *sfg,                           ///< Global data structure pointer
+    struct PhysicalSensor *sensor                       ///< sensor being read
+);
+/// \brief readSensorRegisters reads a block of sensor registers without busy waiting
+///
+/// The transfer is submitted through Register_I2C_ReadAsync() or Register_SPI_ReadAsync()
+/// (SPI when sensor->addr == SPI_ADDR) and the calling task then blocks in sfg->waitForBus
+/// until the completion interrupt calls sfg->signalBus, leaving the CPU to other tasks while
+/// the DMA controller moves the data.  Without installed hooks the bus idle function is
+/// called while waiting.  Returns SENSOR_ERROR_NONE or SENSOR_ERROR_READ.
+int8_t readSensorRegisters(
+    SensorFusionGlobals *sfg,                           ///< Global data structure pointer
+    struct PhysicalSensor *sensor,                      ///< sensor to read from
+    uint8_t offset,                                     ///< first register to read
+    uint8_t length,                                     ///< number of bytes to read
+    uint8_t *pOutBuffer                                 ///< destination buffer
+);
 void zeroArray(
     struct StatusSubsystem *pStatus,                    ///< Status subsystem pointer
     void* data,                                         ///< pointer to array to be zeroed
@@ -596,6 +845,20 @@ void conditionSample(
     int16_t sample[3]                                   ///< 16-bit register value from triaxial sensor read
 );
 
+#if LAZY_ORIENTATION
+/// \brief fUpdateOrientationOutputs derives out of date orientation outputs from the quaternion
+///
+/// The fusion functions update only the quaternion (plus any matrix they need internally)
+/// and mark the other outputs stale.  Call this before reading the matrix, Euler angles or
+/// rotation vector of a motion state vector.  Outputs that are already current cost nothing.
+/// Call it from the fusion task, or from a lower priority task between fusion passes.
+/// Defined in fusion.c.
+void fUpdateOrientationOutputs(
+    SV_ptr pSV,                                         ///< any motion state vector cast to SV_ptr
+    uint8_t iOutputs                                    ///< ORIENT_ bit-field of the outputs to be read
+);
+#endif
+
 // The following functions are defined in <hal_board_name>.c.
 // Please note that these are board-dependent
 
@@ -611,6 +874,20 @@ void addToFifo(
     uint16_t maxFifoSize,                               ///< the size of the software (not hardware) FIFO
     int16_t sample[3]                                   ///< the sample to add
 );
+/// \brief stampFifoBatch records when a driver read a batch of FIFO samples
+///
+/// Call it right after the samples from one hardware FIFO read were added with addToFifo().
+/// iTimestamp is the ARM_timestamp() taken when the sensor FIFO count was read, which is
+/// the time of the newest sample.  If pSampleTime is not NULL each new sample also gets a
+/// time back-interpolated from the configured output data rate iODR, counting the newest
+/// samples that addToFifo() dropped when the software FIFO overflowed.
+void stampFifoBatch(
+    union FifoSensor *sensor,                           ///< pointer to structure of type AccelSensor, MagSensor or GyroSensor
+    uint32_t *pSampleTime,                              ///< per sample times (e.g. GyroSensor.iYsTime) or NULL
+    uint8_t iFirst,                                     ///< FIFO index of the first sample of this batch
+    uint32_t iTimestamp,                                ///< ARM_timestamp() at read time
+    uint16_t iODR                                       ///< configured sensor output data rate (Hz)
+);
 /// \brief Apply the accelerometer Hardware Abstraction Layer
 void ApplyAccelHAL(
     struct AccelSensor *Accel                                  ///< pointer to accelerometer logical sensor
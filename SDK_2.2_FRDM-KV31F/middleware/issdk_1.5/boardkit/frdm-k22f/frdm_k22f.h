@@ -147,6 +147,8 @@ extern gpioHandleKSDK_t BLUE_LED;
 #define WIRED_UART_IRQn UART1_RX_TX_IRQn             ///< The interrupt number associated with this IRQ
 #define WIRED_UART_CLKSRC UART1_CLK_SRC              ///< KSDK instance name for the clock feeding this module
 #define WIRED_UART_IRQn UART1_RX_TX_IRQn             ///< KSDK interrupt vector number
+#define WIRED_UART_DMA_CHANNEL 4U                    ///< eDMA channel used to transmit (0 to 3 are used by RTE_Device.h)
+#define WIRED_UART_DMA_REQUEST kDmaRequestMux0UART1Tx ///< DMAMUX source for the transmit requests
 ///@}
 
 /// @name Wireless UART Parameters
@@ -163,6 +165,8 @@ extern gpioHandleKSDK_t BLUE_LED;
 #define WIRELESS_UART_IRQn UART2_RX_TX_IRQn             ///< The interrupt number associated with this IRQ
 #define WIRELESS_UART_CLKSRC UART2_CLK_SRC              ///< KSDK instance name for the clock feeding this module
 #define WIRELESS_UART_IRQn UART2_RX_TX_IRQn             ///< KSDK interrupt vector number
+#define WIRELESS_UART_DMA_CHANNEL 5U                    ///< eDMA channel used to transmit
+#define WIRELESS_UART_DMA_REQUEST kDmaRequestMux0UART2Tx ///< DMAMUX source for the transmit requests
 ///@}
 
 ///@name Miscellaneous Hardware Configuration Parameters
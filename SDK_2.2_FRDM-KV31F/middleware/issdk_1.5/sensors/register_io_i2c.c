@@ -47,12 +47,40 @@
  ******************************************************************************/
 #define I2C_COUNT (sizeof(i2cBases) / sizeof(void *))
 
+/*! @brief Phases of an asynchronous register read. */
+enum
+{
+    I2C_ASYNC_IDLE = 0, /* No asynchronous transfer pending.*/
+    I2C_ASYNC_ADDRESS,  /* Register offset is being sent.*/
+    I2C_ASYNC_DATA      /* Register contents are being received.*/
+};
+
+/*! @brief State of the asynchronous register read pending on one I2C instance. */
+typedef struct
+{
+    ARM_DRIVER_I2C *pCommDrv;      /* The I2C driver the transfer was submitted to.*/
+    registeriocallback_t callback; /* Completion callback.*/
+    void *userParam;               /* Parameter passed back to the callback.*/
+    uint8_t *pOutBuffer;           /* Destination of the register contents.*/
+    uint16_t slaveAddress;         /* The sensor's I2C slave address.*/
+    uint8_t offset;                /* Register offset, kept here as the driver sends it by reference.*/
+    uint8_t length;                /* Number of bytes to read.*/
+    volatile uint8_t phase;        /* One of I2C_ASYNC_xxx.*/
+} i2cAsyncTransfer_t;
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
 I2C_Type *const i2cBases[] = I2C_BASE_PTRS;
 volatile bool b_I2C_CompletionFlag[I2C_COUNT] = {false};
 volatile uint32_t g_I2C_ErrorEvent[I2C_COUNT] = {ARM_I2C_EVENT_TRANSFER_DONE};
+static i2cAsyncTransfer_t g_I2C_AsyncTransfer[I2C_COUNT];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void I2C_AsyncSignalEvent(uint32_t index);
+static bool I2C_IsPolledTransfer(uint32_t index, uint32_t length);
 
 /*******************************************************************************
  * Code
@@ -67,6 +95,7 @@ void I2C0_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[0] = event;
     }
     b_I2C_CompletionFlag[0] = true;
+    I2C_AsyncSignalEvent(0);
 }
 #endif
 
@@ -79,6 +108,7 @@ void I2C1_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[1] = event;
     }
     b_I2C_CompletionFlag[1] = true;
+    I2C_AsyncSignalEvent(1);
 }
 #endif
 
@@ -91,6 +121,7 @@ void I2C2_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[2] = event;
     }
     b_I2C_CompletionFlag[2] = true;
+    I2C_AsyncSignalEvent(2);
 }
 #endif
 
@@ -103,6 +134,7 @@ void I2C3_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[3] = event;
     }
     b_I2C_CompletionFlag[3] = true;
+    I2C_AsyncSignalEvent(3);
 }
 #endif
 
@@ -115,6 +147,7 @@ void I2C4_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[4] = event;
     }
     b_I2C_CompletionFlag[4] = true;
+    I2C_AsyncSignalEvent(4);
 }
 #endif
 
@@ -127,6 +160,7 @@ void I2C5_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[5] = event;
     }
     b_I2C_CompletionFlag[5] = true;
+    I2C_AsyncSignalEvent(5);
 }
 #endif
 
@@ -139,6 +173,7 @@ void I2C6_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[6] = event;
     }
     b_I2C_CompletionFlag[6] = true;
+    I2C_AsyncSignalEvent(6);
 }
 #endif
 
@@ -151,9 +186,86 @@ void I2C7_SignalEvent_t(uint32_t event)
         g_I2C_ErrorEvent[7] = event;
     }
     b_I2C_CompletionFlag[7] = true;
+    I2C_AsyncSignalEvent(7);
 }
 #endif
 
+/* Returns true when the driver of an I2C instance completes a transfer of this length by polling.
+ * The DMA variants of the CMSIS I2C driver (RTE_I2Cx_DMA_EN) move a single byte before MasterTransmit or
+ * MasterReceive return and do not call the signal event handler for it. */
+static bool I2C_IsPolledTransfer(uint32_t index, uint32_t length)
+{
+    if (length > 1)
+    {
+        return false;
+    }
+
+    switch (index)
+    {
+#if defined(RTE_I2C0_DMA_EN) && RTE_I2C0_DMA_EN
+        case 0:
+            return true;
+#endif
+#if defined(RTE_I2C1_DMA_EN) && RTE_I2C1_DMA_EN
+        case 1:
+            return true;
+#endif
+#if defined(RTE_I2C2_DMA_EN) && RTE_I2C2_DMA_EN
+        case 2:
+            return true;
+#endif
+#if defined(RTE_I2C3_DMA_EN) && RTE_I2C3_DMA_EN
+        case 3:
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
+
+/* Advances the asynchronous register read pending on an I2C instance (interrupt context, or the
+ * submitting task for a transfer the driver completed by polling). */
+static void I2C_AsyncSignalEvent(uint32_t index)
+{
+    i2cAsyncTransfer_t *pXfer = &g_I2C_AsyncTransfer[index];
+    int32_t status;
+
+    if (I2C_ASYNC_IDLE == pXfer->phase)
+    {
+        return;
+    }
+
+    if (g_I2C_ErrorEvent[index] != ARM_I2C_EVENT_TRANSFER_DONE)
+    {
+        if (g_I2C_ErrorEvent[index] == ARM_I2C_EVENT_TRANSFER_INCOMPLETE)
+        {
+            pXfer->pCommDrv->Control(ARM_I2C_ABORT_TRANSFER, 0);
+        }
+        status = ARM_DRIVER_ERROR;
+    }
+    else if (I2C_ASYNC_ADDRESS == pXfer->phase)
+    {
+        /*! Offset sent with a repeated start, now read the register contents.*/
+        pXfer->phase = I2C_ASYNC_DATA;
+        b_I2C_CompletionFlag[index] = false;
+        status = pXfer->pCommDrv->MasterReceive(pXfer->slaveAddress, pXfer->pOutBuffer, pXfer->length, false);
+        if ((ARM_DRIVER_OK == status) && !I2C_IsPolledTransfer(index, pXfer->length))
+        {
+            return;
+        }
+    }
+    else
+    {
+        status = ARM_DRIVER_OK;
+    }
+
+    pXfer->phase = I2C_ASYNC_IDLE;
+    if (pXfer->callback)
+    {
+        pXfer->callback(pXfer->userParam, status);
+    }
+}
+
 /*! The interface function to block write sensor registers. */
 int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
                                 registerDeviceInfo_t *devInfo,
@@ -171,6 +283,10 @@ int32_t Register_I2C_BlockWrite(ARM_DRIVER_I2C *pCommDrv,
     b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
     g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
     status = pCommDrv->MasterTransmit(slaveAddress, buffer, bytesToWrite + 1, false);
+    if ((ARM_DRIVER_OK == status) && I2C_IsPolledTransfer(devInfo->deviceInstance, bytesToWrite + 1))
+    {
+        b_I2C_CompletionFlag[devInfo->deviceInstance] = true;
+    }
     if (ARM_DRIVER_OK == status)
     {
         /* Wait for completion */
@@ -218,6 +334,10 @@ int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
         g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
         /*! Send the register address to read from.*/
         status = pCommDrv->MasterTransmit(slaveAddress, &config[0], 1, true);
+        if ((ARM_DRIVER_OK == status) && I2C_IsPolledTransfer(devInfo->deviceInstance, 1))
+        {
+            b_I2C_CompletionFlag[devInfo->deviceInstance] = true;
+        }
         if (ARM_DRIVER_OK == status)
         {
             /* Wait for completion without calling idle function */
@@ -241,6 +361,10 @@ int32_t Register_I2C_Write(ARM_DRIVER_I2C *pCommDrv,
         g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
         /*! Read the value.*/
         status = pCommDrv->MasterReceive(slaveAddress, &config[1], 1, false);
+        if ((ARM_DRIVER_OK == status) && I2C_IsPolledTransfer(devInfo->deviceInstance, 1))
+        {
+            b_I2C_CompletionFlag[devInfo->deviceInstance] = true;
+        }
         if (ARM_DRIVER_OK == status)
         {
             /* Wait for completion */
@@ -321,6 +445,10 @@ int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
     b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
     g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
     status = pCommDrv->MasterTransmit(slaveAddress, &offset, 1, true);
+    if ((ARM_DRIVER_OK == status) && I2C_IsPolledTransfer(devInfo->deviceInstance, 1))
+    {
+        b_I2C_CompletionFlag[devInfo->deviceInstance] = true;
+    }
     if (ARM_DRIVER_OK == status)
     {
         /* Wait for completion without calling idle function. */
@@ -345,6 +473,10 @@ int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
     g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
     /*! Read and update the value.*/
     status = pCommDrv->MasterReceive(slaveAddress, pOutBuffer, length, false);
+    if ((ARM_DRIVER_OK == status) && I2C_IsPolledTransfer(devInfo->deviceInstance, length))
+    {
+        b_I2C_CompletionFlag[devInfo->deviceInstance] = true;
+    }
     if (ARM_DRIVER_OK == status)
     {
         /* Wait for completion */
@@ -371,3 +503,48 @@ int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
 
     return status;
 }
+
+/*! The interface function to start reading a sensor register without waiting for completion. */
+int32_t Register_I2C_ReadAsync(ARM_DRIVER_I2C *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               uint16_t slaveAddress,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registeriocallback_t callback,
+                               void *userParam)
+{
+    int32_t status;
+    i2cAsyncTransfer_t *pXfer = &g_I2C_AsyncTransfer[devInfo->deviceInstance];
+
+    if (I2C_ASYNC_IDLE != pXfer->phase)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    pXfer->pCommDrv = pCommDrv;
+    pXfer->callback = callback;
+    pXfer->userParam = userParam;
+    pXfer->pOutBuffer = pOutBuffer;
+    pXfer->slaveAddress = slaveAddress;
+    pXfer->offset = offset;
+    pXfer->length = length;
+    pXfer->phase = I2C_ASYNC_ADDRESS;
+
+    b_I2C_CompletionFlag[devInfo->deviceInstance] = false;
+    g_I2C_ErrorEvent[devInfo->deviceInstance] = ARM_I2C_EVENT_TRANSFER_DONE;
+    /*! Send the register address, the signal event handler chains the data phase.*/
+    status = pCommDrv->MasterTransmit(slaveAddress, &pXfer->offset, 1, true);
+    if (ARM_DRIVER_OK != status)
+    {
+        pXfer->phase = I2C_ASYNC_IDLE;
+    }
+    else if (I2C_IsPolledTransfer(devInfo->deviceInstance, 1))
+    {
+        /*! The offset has already been sent, start the data phase as the signal event handler would.*/
+        b_I2C_CompletionFlag[devInfo->deviceInstance] = true;
+        I2C_AsyncSignalEvent(devInfo->deviceInstance);
+    }
+
+    return status;
+}
@@ -213,4 +213,37 @@ int32_t Register_I2C_Read(ARM_DRIVER_I2C *pCommDrv,
                           uint8_t length,
                           uint8_t *pOutBuffer);
 
+/*!
+ * @brief The interface function to start reading a sensor register without waiting for completion.
+ *
+ * The register offset and data phases are chained from the I2C signal event handler, so
+ * the caller is free to run other work while the transfer is in flight.  When the CMSIS
+ * driver is configured with RTE_I2Cx_DMA_EN the data phase is moved by fsl_i2c_edma; that
+ * driver sends the 1 byte register offset by polling without signalling it, so the data phase
+ * is then started before this function returns.  Only one asynchronous transfer may be pending per I2C instance, and the blocking
+ * Register_I2C_xxx functions must not be used on that instance until it completes.
+ *
+ * @param ARM_DRIVER_I2C *pCommDrv - The I2C driver to use.
+ * @param registerDeviceInfo_t *devInfo - The I2C device number and idle function.
+ * @param uint16_t slaveAddress - the sensor's I2C slave address.
+ * @param uint8_t offset - The register/offset to read from
+ * @param uint8_t length - The number of bytes to read
+ * @param uint8_t *pOutBuffer - The pointer to the buffer to store the register value read.
+ *                              It must remain valid until the callback is invoked.
+ * @param registeriocallback_t callback - Called from interrupt context when the read completes, or
+ *                                       before returning for a 1 byte read moved by polling.
+ * @param void *userParam - Parameter passed back to the callback.
+ *
+ * @return ARM_DRIVER_OK if the transfer was started, ARM_DRIVER_ERROR_BUSY if a transfer is
+ *         already pending on this instance or ARM_DRIVER_ERROR if error.
+ */
+int32_t Register_I2C_ReadAsync(ARM_DRIVER_I2C *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               uint16_t slaveAddress,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registeriocallback_t callback,
+                               void *userParam);
+
 #endif // __REGISTER_IO_I2C_H__
@@ -50,6 +50,21 @@
  ******************************************************************************/
 #define SPI_COUNT (sizeof(spiBases) / sizeof(void *))
 
+/*! @brief State of the asynchronous register read pending on one SPI instance. */
+typedef struct
+{
+    ARM_DRIVER_SPI *pCommDrv;      /* The SPI driver the transfer was submitted to.*/
+    registeriocallback_t callback; /* Completion callback.*/
+    void *userParam;               /* Parameter passed back to the callback.*/
+    void *pTargetSlavePinID;       /* Slave select pin to release on completion.*/
+    uint8_t *pReadBuffer;          /* Raw receive buffer formatted by the read preprocess function.*/
+    uint8_t *pOutBuffer;           /* Destination of the register contents.*/
+    uint8_t spiCmdLen;             /* Number of command bytes preceding the register contents.*/
+    uint8_t ssActiveValue;         /* Slave select polarity.*/
+    uint8_t length;                /* Number of bytes to read.*/
+    volatile bool pending;         /* true while the transfer is in flight.*/
+} spiAsyncTransfer_t;
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
@@ -57,6 +72,12 @@ GENERIC_DRIVER_GPIO *pDspiGpioDriver = &Driver_GPIO_KSDK;
 SPI_Type *const spiBases[] = SPI_BASE_PTRS;
 volatile bool b_SPI_CompletionFlag[SPI_COUNT] = {false};
 volatile uint32_t g_SPI_ErrorEvent[SPI_COUNT] = {ARM_SPI_EVENT_TRANSFER_COMPLETE};
+static spiAsyncTransfer_t g_SPI_AsyncTransfer[SPI_COUNT];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void SPI_AsyncSignalEvent(uint32_t index);
 
 /*******************************************************************************
  * Code
@@ -70,6 +91,7 @@ void SPI0_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[0] = event;
     }
     b_SPI_CompletionFlag[0] = true;
+    SPI_AsyncSignalEvent(0);
 }
 #endif
 
@@ -82,6 +104,7 @@ void SPI1_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[1] = event;
     }
     b_SPI_CompletionFlag[1] = true;
+    SPI_AsyncSignalEvent(1);
 }
 #endif
 
@@ -94,6 +117,7 @@ void SPI2_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[2] = event;
     }
     b_SPI_CompletionFlag[2] = true;
+    SPI_AsyncSignalEvent(2);
 }
 #endif
 
@@ -106,6 +130,7 @@ void SPI3_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[3] = event;
     }
     b_SPI_CompletionFlag[3] = true;
+    SPI_AsyncSignalEvent(3);
 }
 #endif
 
@@ -118,6 +143,7 @@ void SPI4_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[4] = event;
     }
     b_SPI_CompletionFlag[4] = true;
+    SPI_AsyncSignalEvent(4);
 }
 #endif
 
@@ -130,6 +156,7 @@ void SPI5_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[5] = event;
     }
     b_SPI_CompletionFlag[5] = true;
+    SPI_AsyncSignalEvent(5);
 }
 #endif
 
@@ -142,6 +169,7 @@ void SPI6_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[6] = event;
     }
     b_SPI_CompletionFlag[6] = true;
+    SPI_AsyncSignalEvent(6);
 }
 #endif
 
@@ -154,6 +182,7 @@ void SPI7_SignalEvent_t(uint32_t event)
         g_SPI_ErrorEvent[7] = event;
     }
     b_SPI_CompletionFlag[7] = true;
+    SPI_AsyncSignalEvent(7);
 }
 #endif
 
@@ -170,6 +199,42 @@ void register_spi_control(spiControlParams_t *ssControl)
     }
 }
 
+/* Completes the asynchronous register read pending on a SPI instance (interrupt context). */
+static void SPI_AsyncSignalEvent(uint32_t index)
+{
+    spiAsyncTransfer_t *pXfer = &g_SPI_AsyncTransfer[index];
+    int32_t status = ARM_DRIVER_OK;
+
+    if (!pXfer->pending)
+    {
+        return;
+    }
+
+    spiControlParams_t ss_dis_cmd = {
+        .cmdCode = ARM_SPI_SS_INACTIVE,
+        .activeValue = pXfer->ssActiveValue,
+        .pTargetSlavePinID = pXfer->pTargetSlavePinID,
+    };
+
+    if (g_SPI_ErrorEvent[index] != ARM_SPI_EVENT_TRANSFER_COMPLETE)
+    {
+        status = ARM_DRIVER_ERROR;
+        pXfer->pCommDrv->Control(ARM_SPI_ABORT_TRANSFER, 0);
+    }
+    register_spi_control(&ss_dis_cmd);
+
+    if (ARM_DRIVER_OK == status)
+    {
+        memcpy(pXfer->pOutBuffer, pXfer->pReadBuffer + pXfer->spiCmdLen, pXfer->length);
+    }
+
+    pXfer->pending = false;
+    if (pXfer->callback)
+    {
+        pXfer->callback(pXfer->userParam, status);
+    }
+}
+
 /*! The interface function to block write sensor registers. */
 int32_t Register_SPI_BlockWrite(ARM_DRIVER_SPI *pCommDrv,
                                 registerDeviceInfo_t *devInfo,
@@ -376,3 +441,60 @@ int32_t Register_SPI_Read(ARM_DRIVER_SPI *pCommDrv,
 
     return status;
 }
+
+/*! The interface function to start reading a sensor register without waiting for completion. */
+int32_t Register_SPI_ReadAsync(ARM_DRIVER_SPI *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               void *pReadParams,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registeriocallback_t callback,
+                               void *userParam)
+{
+    int32_t status;
+    spiCmdParams_t slaveReadCmd;
+    spiSlaveSpecificParams_t *pSlaveParams = pReadParams;
+    spiAsyncTransfer_t *pXfer = &g_SPI_AsyncTransfer[devInfo->deviceInstance];
+
+    spiControlParams_t ss_en_cmd = {
+        .cmdCode = ARM_SPI_SS_ACTIVE,
+        .activeValue = pSlaveParams->ssActiveValue,
+        .pTargetSlavePinID = pSlaveParams->pTargetSlavePinID,
+    };
+    spiControlParams_t ss_dis_cmd = {
+        .cmdCode = ARM_SPI_SS_INACTIVE,
+        .activeValue = pSlaveParams->ssActiveValue,
+        .pTargetSlavePinID = pSlaveParams->pTargetSlavePinID,
+    };
+
+    if (pXfer->pending)
+    {
+        return ARM_DRIVER_ERROR_BUSY;
+    }
+
+    pSlaveParams->pReadPreprocessFN(&slaveReadCmd, offset, length);
+    pXfer->pCommDrv = pCommDrv;
+    pXfer->callback = callback;
+    pXfer->userParam = userParam;
+    pXfer->pTargetSlavePinID = pSlaveParams->pTargetSlavePinID;
+    pXfer->pReadBuffer = slaveReadCmd.pReadBuffer;
+    pXfer->pOutBuffer = pOutBuffer;
+    pXfer->spiCmdLen = pSlaveParams->spiCmdLen;
+    pXfer->ssActiveValue = pSlaveParams->ssActiveValue;
+    pXfer->length = length;
+    pXfer->pending = true;
+
+    b_SPI_CompletionFlag[devInfo->deviceInstance] = false;
+    g_SPI_ErrorEvent[devInfo->deviceInstance] = ARM_SPI_EVENT_TRANSFER_COMPLETE;
+    /*! Start the read, the signal event handler releases slave select and copies the value.*/
+    register_spi_control(&ss_en_cmd);
+    status = pCommDrv->Transfer(slaveReadCmd.pWriteBuffer, slaveReadCmd.pReadBuffer, slaveReadCmd.size);
+    if (ARM_DRIVER_OK != status)
+    {
+        pXfer->pending = false;
+        register_spi_control(&ss_dis_cmd);
+    }
+
+    return status;
+}
@@ -244,4 +244,33 @@ int32_t Register_SPI_Read(ARM_DRIVER_SPI *pCommDrv,
                           uint8_t length,
                           uint8_t *pOutBuffer);
 
+/*!
+ * @brief The interface function to start reading a sensor register without waiting for completion.
+ *
+ * Slave select is released and the register contents are copied out from the SPI signal
+ * event handler.  When the CMSIS driver is configured with RTE_SPIx_DMA_EN the transfer is
+ * moved by fsl_dspi_edma.  Only one asynchronous transfer may be pending per SPI instance.
+ *
+ * @param ARM_DRIVER_SPI *pCommDrv - The SPI driver to use.
+ * @param registerDeviceInfo_t *devInfo - The SPI device number and idle function.
+ * @param void *pReadParams - the sensor's SPI slave select params.
+ * @param uint8_t offset - The register/offset to read from
+ * @param uint8_t length - The number of bytes to read
+ * @param uint8_t *pOutBuffer - The pointer to the buffer to store the register value read.
+ *                              It must remain valid until the callback is invoked.
+ * @param registeriocallback_t callback - Called from interrupt context when the read completes.
+ * @param void *userParam - Parameter passed back to the callback.
+ *
+ * @return ARM_DRIVER_OK if the transfer was started, ARM_DRIVER_ERROR_BUSY if a transfer is
+ *         already pending on this instance or ARM_DRIVER_ERROR if error.
+ */
+int32_t Register_SPI_ReadAsync(ARM_DRIVER_SPI *pCommDrv,
+                               registerDeviceInfo_t *devInfo,
+                               void *pReadParams,
+                               uint8_t offset,
+                               uint8_t length,
+                               uint8_t *pOutBuffer,
+                               registeriocallback_t callback,
+                               void *userParam);
+
 #endif // __REGISTER_IO_SPI_H__
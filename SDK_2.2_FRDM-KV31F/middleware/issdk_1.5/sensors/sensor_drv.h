@@ -115,6 +115,12 @@ typedef struct
  */
 typedef void (*registeridlefunction_t)(void *userParam);
 
+/*!
+ * @brief This is the completion callback type for asynchronous register I/O.
+ *        It is invoked from interrupt context with ARM_DRIVER_OK or ARM_DRIVER_ERROR.
+ */
+typedef void (*registeriocallback_t)(void *userParam, int32_t status);
+
 /*!
  * @brief This structure defines the device specific info required by register I/O.
  */